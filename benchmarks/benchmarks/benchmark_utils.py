@@ -0,0 +1,117 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import timeit
+
+import dpctl
+from dpctl.utils import TensorProfiler
+
+# sizes of arrays, from tiny to huge
+SIZES = [1, 100, 10_000, 1_000_000, 10_000_000]
+
+_queue = None
+
+
+def get_queue():
+    "Returns cached profiling-enabled queue for default-selected device"
+    global _queue
+    if _queue is None:
+        _queue = dpctl.SyclQueue(property=["enable_profiling", "in_order"])
+    return _queue
+
+
+def _wait_all(res):
+    if isinstance(res, (tuple, list)):
+        for r in res:
+            _wait_all(r)
+    elif hasattr(res, "sycl_queue"):
+        res.sycl_queue.wait()
+
+
+def breakdown(fn, n_iter=10):
+    """Returns dictionary with average time per call of `fn` in microseconds
+    split into "dispatch", "submit", "wait", and "total" host times, and
+    "device" time measured with :class:`dpctl.SyclTimer`.
+
+    `fn` is expected to submit work into the queue returned by
+    :func:`get_queue`, and may or may not synchronize.
+    """
+    q = get_queue()
+    # warm-up, compiles kernels
+    _wait_all(fn())
+
+    prof = TensorProfiler()
+    timer = dpctl.SyclTimer(time_scale=1e6)
+    host_total = 0.0
+    device_total = 0.0
+    with prof:
+        for _ in range(n_iter):
+            with timer(q):
+                t0 = timeit.default_timer()
+                prof.mark_dispatch_start()
+                res = fn()
+                _wait_all(res)
+                host_total += timeit.default_timer() - t0
+            device_total += timer.dt[1]
+            res = None
+    agg = prof.summary()
+    dispatch = sum(st["dispatch_time"] for st in agg.values())
+    submit = sum(st["submit_time"] for st in agg.values())
+    sc = 1e6 / n_iter
+    total = host_total * sc
+    return {
+        "dispatch": dispatch * sc,
+        "submit": submit * sc,
+        # remaining host time is spent waiting on submitted work
+        "wait": max(total - (dispatch + submit) * sc, 0.0),
+        "device": device_total / n_iter,
+        "total": total,
+    }
+
+
+class BreakdownMixin:
+    """Mixin which defines `track_*` benchmarks from `run` method.
+
+    The class using the mixin must define method `run(self, *params)`
+    returning result of the call being benchmarked.
+    """
+
+    n_iter = 10
+    unit = "microseconds"
+
+    def _breakdown(self, *params):
+        key = tuple(params)
+        cache = self.__dict__.setdefault("_breakdown_cache", dict())
+        if key not in cache:
+            cache[key] = breakdown(lambda: self.run(*params), self.n_iter)
+        return cache[key]
+
+    def track_dispatch(self, *params):
+        return self._breakdown(*params)["dispatch"]
+
+    def track_submit(self, *params):
+        return self._breakdown(*params)["submit"]
+
+    def track_wait(self, *params):
+        return self._breakdown(*params)["wait"]
+
+    def track_device(self, *params):
+        return self._breakdown(*params)["device"]
+
+    track_dispatch.unit = unit
+    track_submit.unit = unit
+    track_wait.unit = unit
+    track_device.unit = unit
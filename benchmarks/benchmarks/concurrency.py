@@ -0,0 +1,80 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import threading
+import time
+
+import dpctl
+import dpctl.tensor as dpt
+
+from .benchmark_utils import get_queue
+
+# number of calls made by each thread
+N_CALLS = 200
+
+
+class ConcurrentSubmission:
+    """Throughput of `dpt.add` calls on small arrays made concurrently by
+    several Python threads, each submitting into a queue of its own, or
+    all into the same queue. Entry points of `_tensor_impl` release the GIL
+    during submission, so throughput is expected to grow with the number of
+    threads until the SYCL runtime becomes the bottleneck."""
+
+    params = [[1, 2, 4, 8, 16, 32], ["own", "shared"]]
+    param_names = ["threads", "queue"]
+    timeout = 300
+
+    def setup(self, threads, queue):
+        q = get_queue()
+        if queue == "own":
+            queues = [
+                dpctl.SyclQueue(q.sycl_context, q.sycl_device)
+                for _ in range(threads)
+            ]
+        else:
+            queues = [q] * threads
+        self.args = [
+            (
+                dpt.ones(100, dtype="f4", sycl_queue=tq),
+                dpt.ones(100, dtype="f4", sycl_queue=tq),
+            )
+            for tq in queues
+        ]
+        # warm-up, compiles kernels
+        x1, x2 = self.args[0]
+        dpt.add(x1, x2).sycl_queue.wait()
+
+    def _worker(self, x1, x2, barrier):
+        barrier.wait()
+        for _ in range(N_CALLS):
+            r = dpt.add(x1, x2)
+        r.sycl_queue.wait()
+
+    def track_calls_per_second(self, threads, queue):
+        barrier = threading.Barrier(threads + 1)
+        workers = [
+            threading.Thread(target=self._worker, args=(x1, x2, barrier))
+            for x1, x2 in self.args
+        ]
+        for w in workers:
+            w.start()
+        t0 = time.perf_counter()
+        barrier.wait()
+        for w in workers:
+            w.join()
+        return threads * N_CALLS / (time.perf_counter() - t0)
+
+    track_calls_per_second.unit = "calls/s"
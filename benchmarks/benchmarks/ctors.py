@@ -0,0 +1,77 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import numpy as np
+
+import dpctl.tensor as dpt
+
+from .benchmark_utils import SIZES, BreakdownMixin, get_queue
+
+
+class Empty(BreakdownMixin):
+    """Benchmarks of allocation of result arrays"""
+
+    params = [SIZES]
+    param_names = ["size"]
+
+    def setup(self, size):
+        self.q = get_queue()
+
+    def run(self, size):
+        return dpt.empty(size, dtype="f4", sycl_queue=self.q)
+
+    def time_empty(self, size):
+        self.run(size)
+
+
+class AsArray(BreakdownMixin):
+    """Benchmarks of `dpt.asarray` from host objects and usm_ndarray"""
+
+    params = [SIZES, ["list", "numpy", "usm_ndarray"]]
+    param_names = ["size", "source"]
+
+    def setup(self, size, source):
+        self.q = get_queue()
+        if source == "list":
+            if size > 10_000:
+                raise NotImplementedError
+            self.obj = [1.0] * size
+        elif source == "numpy":
+            self.obj = np.ones(size, dtype="f4")
+        else:
+            self.obj = dpt.ones(size, dtype="f4", sycl_queue=self.q)
+
+    def run(self, size, source):
+        return dpt.asarray(self.obj, dtype="f4", sycl_queue=self.q)
+
+    def time_asarray(self, size, source):
+        self.run(size, source)
+
+
+class Full(BreakdownMixin):
+    """Benchmarks of `dpt.full`"""
+
+    params = [SIZES]
+    param_names = ["size"]
+
+    def setup(self, size):
+        self.q = get_queue()
+
+    def run(self, size):
+        return dpt.full(size, 3.0, dtype="f4", sycl_queue=self.q)
+
+    def time_full(self, size):
+        self.run(size)
@@ -0,0 +1,118 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import dpctl.tensor as dpt
+
+from .benchmark_utils import SIZES, BreakdownMixin, get_queue
+
+
+class Binary(BreakdownMixin):
+    """Benchmarks of `BinaryElementwiseFunc.__call__` on arrays of the same
+    data type, with contiguous, strided and broadcasting layouts."""
+
+    params = [SIZES, ["contig", "strided", "broadcast"]]
+    param_names = ["size", "layout"]
+
+    def setup(self, size, layout):
+        q = get_queue()
+        if layout == "contig":
+            self.x1 = dpt.ones(size, dtype="f4", sycl_queue=q)
+            self.x2 = dpt.ones(size, dtype="f4", sycl_queue=q)
+        elif layout == "strided":
+            self.x1 = dpt.ones(2 * size, dtype="f4", sycl_queue=q)[::2]
+            self.x2 = dpt.ones(size, dtype="f4", sycl_queue=q)
+        else:
+            self.x1 = dpt.ones(size, dtype="f4", sycl_queue=q)
+            self.x2 = dpt.ones(1, dtype="f4", sycl_queue=q)
+
+    def run(self, size, layout):
+        return dpt.add(self.x1, self.x2)
+
+    def time_add(self, size, layout):
+        self.run(size, layout)
+
+
+class BinaryTypePromotion(BreakdownMixin):
+    """Benchmarks of binary function requiring casting of an argument"""
+
+    params = [SIZES]
+    param_names = ["size"]
+
+    def setup(self, size):
+        q = get_queue()
+        self.x1 = dpt.ones(size, dtype="i4", sycl_queue=q)
+        self.x2 = dpt.ones(size, dtype="f4", sycl_queue=q)
+
+    def run(self, size):
+        return dpt.multiply(self.x1, self.x2)
+
+    def time_multiply(self, size):
+        self.run(size)
+
+
+class BinaryPythonScalar(BreakdownMixin):
+    """Benchmarks of binary function with Python scalar argument"""
+
+    params = [SIZES]
+    param_names = ["size"]
+
+    def setup(self, size):
+        self.x = dpt.ones(size, dtype="f4", sycl_queue=get_queue())
+
+    def run(self, size):
+        return dpt.add(self.x, 1.0)
+
+    def time_add_scalar(self, size):
+        self.run(size)
+
+
+class Unary(BreakdownMixin):
+    """Benchmarks of `UnaryElementwiseFunc.__call__`"""
+
+    params = [SIZES, ["contig", "strided"]]
+    param_names = ["size", "layout"]
+
+    def setup(self, size, layout):
+        q = get_queue()
+        if layout == "contig":
+            self.x = dpt.ones(size, dtype="f4", sycl_queue=q)
+        else:
+            self.x = dpt.ones(2 * size, dtype="f4", sycl_queue=q)[::2]
+
+    def run(self, size, layout):
+        return dpt.sin(self.x)
+
+    def time_sin(self, size, layout):
+        self.run(size, layout)
+
+
+class InPlace(BreakdownMixin):
+    """Benchmarks of in-place operator"""
+
+    params = [SIZES]
+    param_names = ["size"]
+
+    def setup(self, size):
+        q = get_queue()
+        self.x1 = dpt.ones(size, dtype="f4", sycl_queue=q)
+        self.x2 = dpt.ones(size, dtype="f4", sycl_queue=q)
+
+    def run(self, size):
+        self.x1 += self.x2
+        return self.x1
+
+    def time_iadd(self, size):
+        self.run(size)
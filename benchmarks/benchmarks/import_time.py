@@ -0,0 +1,84 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import subprocess
+import sys
+
+_peak_rss_script = """
+import resource
+{}
+print(resource.getrusage(resource.RUSAGE_SELF).ru_maxrss)
+"""
+
+
+def _peak_rss(code):
+    "Peak resident set size of a fresh interpreter executing `code`"
+    if sys.platform in ["win32", "cygwin"]:
+        raise NotImplementedError
+    out = subprocess.check_output(
+        [sys.executable, "-c", _peak_rss_script.format(code)]
+    )
+    return int(out.split()[-1])
+
+
+class ImportTime:
+    """Benchmarks of import time of dpctl modules and latency of first
+    calls, each run in a fresh interpreter"""
+
+    def timeraw_import_dpctl(self):
+        return "import dpctl"
+
+    def timeraw_import_dpctl_tensor(self):
+        return "import dpctl.tensor"
+
+    def timeraw_first_call_add(self):
+        # first call of a function family populates its dispatch tables
+        return (
+            "dpt.add(x, x).sycl_queue.wait()",
+            "import dpctl.tensor as dpt; x = dpt.ones(16)",
+        )
+
+    def timeraw_first_call_sum(self):
+        return (
+            "dpt.sum(x).sycl_queue.wait()",
+            "import dpctl.tensor as dpt; x = dpt.ones(16)",
+        )
+
+    def timeraw_first_call_take(self):
+        return (
+            "dpt.take(x, ind).sycl_queue.wait()",
+            "import dpctl.tensor as dpt; x = dpt.ones(16); "
+            "ind = dpt.arange(4)",
+        )
+
+
+class ImportMemory:
+    """Peak resident set size of a fresh interpreter importing dpctl.tensor
+    and using a single function family. Extensions with kernels of other
+    families are not loaded."""
+
+    def track_import_dpctl_tensor(self):
+        return _peak_rss("import dpctl.tensor")
+
+    track_import_dpctl_tensor.unit = "KiB"
+
+    def track_first_call_add(self):
+        return _peak_rss(
+            "import dpctl.tensor as dpt; "
+            "dpt.add(dpt.ones(16), 1).sycl_queue.wait()"
+        )
+
+    track_first_call_add.unit = "KiB"
@@ -0,0 +1,109 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import dpctl.tensor as dpt
+
+from .benchmark_utils import SIZES, BreakdownMixin, get_queue
+
+
+class BasicSlicing:
+    """Benchmarks of creation of views by `usm_ndarray.__getitem__`"""
+
+    params = [["int", "slice", "ellipsis", "newaxis"]]
+    param_names = ["key"]
+
+    def setup(self, key):
+        self.x = dpt.empty((10, 10, 10), dtype="f4", sycl_queue=get_queue())
+        self.key = {
+            "int": (1, 2),
+            "slice": (slice(1, None, 2), slice(None, 5)),
+            "ellipsis": (Ellipsis, 0),
+            "newaxis": (None, slice(None), None),
+        }[key]
+
+    def time_getitem(self, key):
+        self.x[self.key]
+
+    def time_getitem_loop(self, key):
+        x = self.x
+        k = self.key
+        for _ in range(1000):
+            x[k]
+
+
+class Views:
+    """Benchmarks of creation of views by attributes and functions"""
+
+    params = [["mT", "real", "permute_dims", "broadcast_to", "reshape"]]
+    param_names = ["kind"]
+
+    def setup(self, kind):
+        x = dpt.empty((10, 10, 10), dtype="c8", sycl_queue=get_queue())
+        self.fn = {
+            "mT": lambda: x.mT,
+            "real": lambda: x.real,
+            "permute_dims": lambda: dpt.permute_dims(x, (2, 0, 1)),
+            "broadcast_to": lambda: dpt.broadcast_to(x, (4, 10, 10, 10)),
+            "reshape": lambda: dpt.reshape(x, (100, 10)),
+        }[kind]
+
+    def time_view_loop(self, kind):
+        fn = self.fn
+        for _ in range(1000):
+            fn()
+
+
+class AdvancedIndexing(BreakdownMixin):
+    """Benchmarks of integer and boolean advanced indexing"""
+
+    params = [SIZES, ["integer", "boolean"]]
+    param_names = ["size", "key"]
+
+    def setup(self, size, key):
+        q = get_queue()
+        self.x = dpt.ones(size, dtype="f4", sycl_queue=q)
+        if key == "integer":
+            self.ind = dpt.arange(0, size, 2, sycl_queue=q)
+        else:
+            self.ind = dpt.arange(size, sycl_queue=q) % 2 == 0
+
+    def run(self, size, key):
+        return self.x[self.ind]
+
+    def time_getitem(self, size, key):
+        self.run(size, key)
+
+
+class SetItem(BreakdownMixin):
+    """Benchmarks of `usm_ndarray.__setitem__`"""
+
+    params = [SIZES, ["scalar", "mask_scalar"]]
+    param_names = ["size", "key"]
+
+    def setup(self, size, key):
+        q = get_queue()
+        self.x = dpt.ones(size, dtype="f4", sycl_queue=q)
+        if key == "scalar":
+            self.key = Ellipsis
+        else:
+            self.key = dpt.arange(size, sycl_queue=q) % 2 == 0
+
+    def run(self, size, key):
+        self.x[self.key] = 2.0
+        return self.x
+
+    def time_setitem(self, size, key):
+        self.run(size, key)
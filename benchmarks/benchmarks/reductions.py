@@ -0,0 +1,54 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import dpctl.tensor as dpt
+
+from .benchmark_utils import SIZES, BreakdownMixin, get_queue
+
+
+class Sum(BreakdownMixin):
+    """Benchmarks of `dpt.sum` over all axes and over the last axis"""
+
+    params = [SIZES, [None, -1]]
+    param_names = ["size", "axis"]
+
+    def setup(self, size, axis):
+        n1 = max(1, int(size**0.5))
+        self.x = dpt.ones((size // n1, n1), dtype="f4", sycl_queue=get_queue())
+
+    def run(self, size, axis):
+        return dpt.sum(self.x, axis=axis)
+
+    def time_sum(self, size, axis):
+        self.run(size, axis)
+
+
+class Testing(BreakdownMixin):
+    """Benchmarks of `dpt.allclose`"""
+
+    params = [SIZES]
+    param_names = ["size"]
+
+    def setup(self, size):
+        q = get_queue()
+        self.x1 = dpt.ones(size, dtype="f4", sycl_queue=q)
+        self.x2 = dpt.ones(size, dtype="f4", sycl_queue=q)
+
+    def run(self, size):
+        return dpt.allclose(self.x1, self.x2)
+
+    def time_allclose(self, size):
+        self.run(size)
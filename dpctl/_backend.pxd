@@ -252,6 +252,8 @@ cdef extern from "syclinterface/dpctl_sycl_device_selector_interface.h":
 cdef extern from "syclinterface/dpctl_sycl_event_interface.h":
     cdef DPCTLSyclEventRef DPCTLEvent_Create()
     cdef DPCTLSyclEventRef DPCTLEvent_Copy(const DPCTLSyclEventRef ERef)
+    cdef bool DPCTLEvent_AreEq(const DPCTLSyclEventRef ERef1,
+                               const DPCTLSyclEventRef ERef2)
     cdef void DPCTLEvent_Wait(DPCTLSyclEventRef ERef) nogil
     cdef void DPCTLEvent_WaitAndThrow(DPCTLSyclEventRef ERef) nogil
     cdef void DPCTLEvent_Delete(DPCTLSyclEventRef ERef)
@@ -269,6 +271,7 @@ cdef extern from "syclinterface/dpctl_sycl_event_interface.h":
     cdef size_t DPCTLEvent_GetProfilingInfoSubmit(DPCTLSyclEventRef ERef)
     cdef size_t DPCTLEvent_GetProfilingInfoStart(DPCTLSyclEventRef ERef)
     cdef size_t DPCTLEvent_GetProfilingInfoEnd(DPCTLSyclEventRef ERef)
+    cdef size_t DPCTLEvent_Hash(const DPCTLSyclEventRef ERef)
 
 
 cdef extern from "syclinterface/dpctl_sycl_kernel_interface.h":
@@ -471,3 +474,68 @@ cdef extern from "syclinterface/dpctl_sycl_usm_interface.h":
     cdef DPCTLSyclDeviceRef DPCTLUSM_GetPointerDevice(
         DPCTLSyclUSMRef MRef,
         DPCTLSyclContextRef CRef)
+
+
+cdef extern from "syclinterface/dpctl_usm_accounting.h":
+    cdef struct DPCTLOpaqueUSMAccountingSnapshot
+    ctypedef DPCTLOpaqueUSMAccountingSnapshot *DPCTLUSMAccountingSnapshotRef
+    cdef void DPCTLUSMAccounting_SetEnabled(bool enabled)
+    cdef bool DPCTLUSMAccounting_IsEnabled() nogil
+    cdef void DPCTLUSMAccounting_RecordAlloc(
+        DPCTLSyclUSMRef MRef,
+        size_t nbytes,
+        _usm_type kind,
+        DPCTLSyclQueueRef QRef,
+        const char *call_site) nogil
+    cdef void DPCTLUSMAccounting_RecordFree(DPCTLSyclUSMRef MRef) nogil
+    cdef void DPCTLUSMAccounting_ResetPeaks()
+    cdef const char *DPCTLUSMAccounting_Report()
+    cdef DPCTLUSMAccountingSnapshotRef DPCTLUSMAccounting_CreateSnapshot()
+    cdef void DPCTLUSMAccountingSnapshot_Delete(
+        DPCTLUSMAccountingSnapshotRef SRef)
+    cdef size_t DPCTLUSMAccountingSnapshot_Size(
+        DPCTLUSMAccountingSnapshotRef SRef)
+    cdef DPCTLSyclDeviceRef DPCTLUSMAccountingSnapshot_GetDevice(
+        DPCTLUSMAccountingSnapshotRef SRef, size_t pos)
+    cdef _usm_type DPCTLUSMAccountingSnapshot_GetUSMType(
+        DPCTLUSMAccountingSnapshotRef SRef, size_t pos)
+    cdef const char *DPCTLUSMAccountingSnapshot_GetCallSite(
+        DPCTLUSMAccountingSnapshotRef SRef, size_t pos)
+    cdef size_t DPCTLUSMAccountingSnapshot_GetLiveBytes(
+        DPCTLUSMAccountingSnapshotRef SRef, size_t pos)
+    cdef size_t DPCTLUSMAccountingSnapshot_GetPeakBytes(
+        DPCTLUSMAccountingSnapshotRef SRef, size_t pos)
+    cdef size_t DPCTLUSMAccountingSnapshot_GetLiveCount(
+        DPCTLUSMAccountingSnapshotRef SRef, size_t pos)
+    cdef size_t DPCTLUSMAccountingSnapshot_GetAllocCount(
+        DPCTLUSMAccountingSnapshotRef SRef, size_t pos)
+
+
+cdef extern from "syclinterface/dpctl_event_timer.h":
+    cdef struct DPCTLOpaqueEventTimer
+    ctypedef DPCTLOpaqueEventTimer *DPCTLEventTimerRef
+    ctypedef enum _event_timer_clock 'DPCTLEventTimerClock':
+        _EVENT_TIMER_HOST       'DPCTL_EVENT_TIMER_HOST'
+        _EVENT_TIMER_DEVICE     'DPCTL_EVENT_TIMER_DEVICE'
+    cdef DPCTLEventTimerRef DPCTLEventTimer_Create()
+    cdef void DPCTLEventTimer_Delete(DPCTLEventTimerRef TRef)
+    cdef bool DPCTLEventTimer_BeginRegion(
+        DPCTLEventTimerRef TRef, const char *name)
+    cdef bool DPCTLEventTimer_EndRegion(DPCTLEventTimerRef TRef)
+    cdef void DPCTLEventTimer_RecordEvent(DPCTLSyclEventRef ERef) nogil
+    cdef void DPCTLEventTimer_Synchronize(DPCTLEventTimerRef TRef) nogil
+    cdef void DPCTLEventTimer_Reset(DPCTLEventTimerRef TRef)
+    cdef uint64_t DPCTLEventTimer_GetLastDuration(
+        DPCTLEventTimerRef TRef, _event_timer_clock clock)
+    cdef size_t DPCTLEventTimer_GetNumRegions(DPCTLEventTimerRef TRef)
+    cdef const char *DPCTLEventTimer_GetRegionName(
+        DPCTLEventTimerRef TRef, size_t pos)
+    cdef size_t DPCTLEventTimer_GetCount(
+        DPCTLEventTimerRef TRef, const char *name,
+        _event_timer_clock clock)
+    cdef double DPCTLEventTimer_GetMean(
+        DPCTLEventTimerRef TRef, const char *name,
+        _event_timer_clock clock)
+    cdef double DPCTLEventTimer_GetQuantile(
+        DPCTLEventTimerRef TRef, const char *name,
+        _event_timer_clock clock, double q)
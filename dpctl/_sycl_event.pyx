@@ -28,6 +28,8 @@ from libc.stdint cimport uint64_t
 import collections.abc
 
 from ._backend cimport (  # noqa: E211
+    DPCTLCString_Delete,
+    DPCTLEvent_AreEq,
     DPCTLEvent_Copy,
     DPCTLEvent_Create,
     DPCTLEvent_Delete,
@@ -37,8 +39,23 @@ from ._backend cimport (  # noqa: E211
     DPCTLEvent_GetProfilingInfoStart,
     DPCTLEvent_GetProfilingInfoSubmit,
     DPCTLEvent_GetWaitList,
+    DPCTLEvent_Hash,
     DPCTLEvent_Wait,
     DPCTLEvent_WaitAndThrow,
+    DPCTLEventTimer_BeginRegion,
+    DPCTLEventTimer_Create,
+    DPCTLEventTimer_Delete,
+    DPCTLEventTimer_EndRegion,
+    DPCTLEventTimer_GetCount,
+    DPCTLEventTimer_GetLastDuration,
+    DPCTLEventTimer_GetMean,
+    DPCTLEventTimer_GetNumRegions,
+    DPCTLEventTimer_GetQuantile,
+    DPCTLEventTimer_GetRegionName,
+    DPCTLEventTimer_RecordEvent,
+    DPCTLEventTimer_Reset,
+    DPCTLEventTimer_Synchronize,
+    DPCTLEventTimerRef,
     DPCTLEventVector_Delete,
     DPCTLEventVector_GetAt,
     DPCTLEventVector_Size,
@@ -46,6 +63,7 @@ from ._backend cimport (  # noqa: E211
     DPCTLSyclEventRef,
     _backend_type,
     _event_status_type,
+    _event_timer_clock,
 )
 
 from .enum_types import backend_type, event_status_type
@@ -73,6 +91,17 @@ cdef api SyclEvent SyclEvent_Make(DPCTLSyclEventRef ERef):
     return SyclEvent._create(copied_ERef)
 
 
+cdef api void SyclEvent_RecordForTiming(
+    DPCTLSyclEventRef ERef
+) noexcept nogil:
+    """
+    C-API function to record the event of a submitted command with regions
+    of :class:`dpctl.SyclTimer` open on the calling thread. The event is
+    copied, the call is a no-op if no region is open.
+    """
+    DPCTLEventTimer_RecordEvent(ERef)
+
+
 cdef void _event_capsule_deleter(object o) noexcept:
     cdef DPCTLSyclEventRef ERef = NULL
     if pycapsule.PyCapsule_IsValid(o, "SyclEventRef"):
@@ -216,6 +245,33 @@ cdef class SyclEvent(_SyclEvent):
         """
         return self._event_ref
 
+    def __eq__(self, other):
+        """
+        Returns True if the :class:`dpctl.SyclEvent` argument refers to the
+        same ``sycl::event``, i.e. to the same command, as this
+        :class:`dpctl.SyclEvent` instance.
+
+        Unlike comparison of profiling information, the comparison does not
+        require the events to be submitted to queues with profiling enabled.
+
+        Returns:
+            :obj:`bool`: ``True`` if the two :class:`dpctl.SyclEvent` objects
+            refer to the same ``sycl::event``, otherwise ``False``.
+        """
+        if isinstance(other, SyclEvent):
+            return DPCTLEvent_AreEq(
+                self._event_ref, (<SyclEvent> other).get_event_ref()
+            )
+        else:
+            return False
+
+    def __hash__(self):
+        """
+        Returns a hash value by hashing the underlying ``sycl::event`` object.
+
+        """
+        return DPCTLEvent_Hash(self._event_ref)
+
     @staticmethod
     cdef void _wait(SyclEvent event):
         with nogil: DPCTLEvent_WaitAndThrow(event._event_ref)
@@ -363,3 +419,92 @@ cdef class SyclEvent(_SyclEvent):
     cpdef void wait(self):
         "Synchronously wait for completion of this event."
         with nogil: DPCTLEvent_Wait(self._event_ref)
+
+
+cdef class _SyclEventTimer:
+    """ Python wrapper of the region timer of libsyclinterface, see
+    dpctl_event_timer.h. Used to implement :class:`dpctl.SyclTimer`.
+    Durations are reported in nanoseconds.
+    """
+    cdef DPCTLEventTimerRef _timer_ref
+
+    def __cinit__(self):
+        self._timer_ref = DPCTLEventTimer_Create()
+        if self._timer_ref is NULL:
+            raise MemoryError()
+
+    def __dealloc__(self):
+        DPCTLEventTimer_Delete(self._timer_ref)
+
+    cdef _event_timer_clock _get_clock(self, str clock) except *:
+        if clock == "host":
+            return _event_timer_clock._EVENT_TIMER_HOST
+        elif clock == "device":
+            return _event_timer_clock._EVENT_TIMER_DEVICE
+        raise ValueError(
+            f"Expected clock to be 'host' or 'device', got {clock}"
+        )
+
+    def begin_region(self, str name):
+        "Opens region `name` on the calling thread"
+        cdef bytes name_b = name.encode("utf-8")
+        if not DPCTLEventTimer_BeginRegion(self._timer_ref, name_b):
+            raise RuntimeError(f"Could not begin timing region {name}")
+
+    def end_region(self):
+        "Closes the innermost region open on the calling thread"
+        if not DPCTLEventTimer_EndRegion(self._timer_ref):
+            raise RuntimeError(
+                "The innermost region open on the calling thread does not "
+                "belong to this timer"
+            )
+
+    def synchronize(self):
+        "Waits for events of closed regions and accumulates their durations"
+        with nogil: DPCTLEventTimer_Synchronize(self._timer_ref)
+
+    def reset(self):
+        "Discards all samples"
+        DPCTLEventTimer_Reset(self._timer_ref)
+
+    def last_duration(self, str clock):
+        "Duration of the region synchronized last"
+        return DPCTLEventTimer_GetLastDuration(
+            self._timer_ref, self._get_clock(clock)
+        )
+
+    def region_names(self):
+        "List of names of regions with samples"
+        cdef size_t i = 0
+        cdef size_t n = DPCTLEventTimer_GetNumRegions(self._timer_ref)
+        cdef const char *name = NULL
+        res = []
+        for i in range(n):
+            name = DPCTLEventTimer_GetRegionName(self._timer_ref, i)
+            if name is not NULL:
+                res.append(name.decode("utf-8"))
+                DPCTLCString_Delete(name)
+        return res
+
+    def count(self, str name, str clock):
+        "Number of samples of region `name`"
+        cdef bytes name_b = name.encode("utf-8")
+        return DPCTLEventTimer_GetCount(
+            self._timer_ref, name_b, self._get_clock(clock)
+        )
+
+    def mean(self, str name, str clock):
+        "Mean duration of region `name`, or None if there are no samples"
+        cdef bytes name_b = name.encode("utf-8")
+        cdef double res = DPCTLEventTimer_GetMean(
+            self._timer_ref, name_b, self._get_clock(clock)
+        )
+        return res if res >= 0 else None
+
+    def quantile(self, str name, str clock, double q):
+        "Quantile of durations of region `name`, or None if there are none"
+        cdef bytes name_b = name.encode("utf-8")
+        cdef double res = DPCTLEventTimer_GetQuantile(
+            self._timer_ref, name_b, self._get_clock(clock), q
+        )
+        return res if res >= 0 else None
@@ -22,7 +22,12 @@
 
 from libcpp cimport bool as cpp_bool
 
-from ._backend cimport DPCTLSyclDeviceRef, DPCTLSyclQueueRef, _arg_data_type
+from ._backend cimport (
+    DPCTLSyclDeviceRef,
+    DPCTLSyclEventRef,
+    DPCTLSyclQueueRef,
+    _arg_data_type,
+)
 from ._sycl_context cimport SyclContext
 from ._sycl_device cimport SyclDevice
 from ._sycl_event cimport SyclEvent
@@ -82,7 +87,15 @@ cdef public api class SyclQueue (_SyclQueue) [
     )
     cpdef void wait(self)
     cdef DPCTLSyclQueueRef get_queue_ref(self)
+    cdef DPCTLSyclEventRef _submit_memcpy(
+        self, object dest, object src, size_t count
+    ) except NULL
     cpdef memcpy(self, dest, src, size_t count)
+    cpdef SyclEvent memcpy_async(self, dest, src, size_t count)
+    cdef DPCTLSyclEventRef _submit_prefetch(
+        self, object mem, size_t count
+    ) except NULL
     cpdef prefetch(self, ptr, size_t count=*)
+    cpdef SyclEvent prefetch_async(self, mem, size_t count=*)
     cpdef mem_advise(self, ptr, size_t count, int mem)
     cpdef SyclEvent submit_barrier(self, dependent_events=*)
@@ -858,7 +858,9 @@ cdef class SyclQueue(_SyclQueue):
     cpdef void wait(self):
         with nogil: DPCTLQueue_Wait(self._queue_ref)
 
-    cpdef memcpy(self, dest, src, size_t count):
+    cdef DPCTLSyclEventRef _submit_memcpy(
+        self, object dest, object src, size_t count
+    ) except NULL:
         cdef void *c_dest
         cdef void *c_src
         cdef DPCTLSyclEventRef ERef = NULL
@@ -878,10 +880,42 @@ cdef class SyclQueue(_SyclQueue):
             raise RuntimeError(
                 "SyclQueue.memcpy operation encountered an error"
             )
+        return ERef
+
+    cpdef memcpy(self, dest, src, size_t count):
+        cdef DPCTLSyclEventRef ERef = self._submit_memcpy(dest, src, count)
+
         with nogil: DPCTLEvent_Wait(ERef)
         DPCTLEvent_Delete(ERef)
 
-    cpdef prefetch(self, mem, size_t count=0):
+    cpdef SyclEvent memcpy_async(self, dest, src, size_t count):
+        """
+        memcpy_async(dest, src, count)
+
+        Submits copying of ``count`` bytes from USM allocation ``src``
+        into USM allocation ``dest`` and returns without waiting for
+        the copy to complete.
+
+        Args:
+            dest (:class:`dpctl.memory._Memory`):
+                Destination USM allocation.
+            src (:class:`dpctl.memory._Memory`):
+                Source USM allocation.
+            count (int):
+                Number of bytes to copy.
+
+        Returns:
+            :class:`dpctl.SyclEvent`:
+                Event associated with the copy. Both ``dest`` and ``src``
+                must be kept alive until the event completes.
+        """
+        cdef DPCTLSyclEventRef ERef = self._submit_memcpy(dest, src, count)
+
+        return SyclEvent._create(ERef)
+
+    cdef DPCTLSyclEventRef _submit_prefetch(
+        self, object mem, size_t count
+    ) except NULL:
         cdef void *ptr
         cdef DPCTLSyclEventRef ERef = NULL
 
@@ -898,9 +932,38 @@ cdef class SyclQueue(_SyclQueue):
             raise RuntimeError(
                 "SyclQueue.prefetch encountered an error"
             )
+        return ERef
+
+    cpdef prefetch(self, mem, size_t count=0):
+        cdef DPCTLSyclEventRef ERef = self._submit_prefetch(mem, count)
+
         with nogil: DPCTLEvent_Wait(ERef)
         DPCTLEvent_Delete(ERef)
 
+    cpdef SyclEvent prefetch_async(self, mem, size_t count=0):
+        """
+        prefetch_async(mem, count=0)
+
+        Submits migration of the first ``count`` bytes of USM allocation
+        ``mem`` to the device of the queue and returns without waiting
+        for the migration to complete.
+
+        Args:
+            mem (:class:`dpctl.memory._Memory`):
+                USM allocation.
+            count (int):
+                Number of bytes to prefetch. The whole allocation is
+                prefetched if ``count`` is zero or exceeds its size.
+
+        Returns:
+            :class:`dpctl.SyclEvent`:
+                Event associated with the prefetch. ``mem`` must be kept
+                alive until the event completes.
+        """
+        cdef DPCTLSyclEventRef ERef = self._submit_prefetch(mem, count)
+
+        return SyclEvent._create(ERef)
+
     cpdef mem_advise(self, mem, size_t count, int advice):
         cdef void *ptr
         cdef DPCTLSyclEventRef ERef = NULL
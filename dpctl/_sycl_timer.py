@@ -15,16 +15,19 @@
 # limitations under the License.
 
 
+import threading
 import timeit
 
 from . import SyclQueue
+from ._sycl_event import _SyclEventTimer
 
 __doc__ = "This module implements :class:`dpctl.SyclTimer`."
 
 
 class SyclTimer:
     """
-    SyclTimer(host_timer=timeit.default_timer, time_scale=1)
+    SyclTimer(host_timer=timeit.default_timer, time_scale=1, \
+        device_timer="queue_barrier")
     Python class to measure device time of execution of commands submitted to
     :class:`dpctl.SyclQueue` as well as the wall-time.
 
@@ -48,31 +51,82 @@ class SyclTimer:
             sycl_dt, wall_dt = timer.dt
 
     Remark:
-        The timer submits barriers to the queue at the entrance and the
-        exit of the context and uses profiling information from events
-        associated with these submissions to perform the timing. Thus
-        :class:`dpctl.SyclTimer` requires the queue with "enable_profiling"
-        property. In order to be able to collect the profiling information
-        the property `dt` ensures that both submitted barriers complete
-        their execution and thus effectively synchronizing the queue.
+        With default ``device_timer="queue_barrier"``, the timer submits
+        barriers to the queue at the entrance and the exit of the context
+        and uses profiling information from events associated with these
+        submissions to perform the timing. Thus :class:`dpctl.SyclTimer`
+        requires the queue with "enable_profiling" property. In order to be
+        able to collect the profiling information the property `dt` ensures
+        that both submitted barriers complete their execution and thus
+        effectively synchronizing the queue.
+
+        With ``device_timer="kernel_events"``, no barriers are submitted.
+        Instead, events of commands submitted by the calling thread while
+        the context is active, e.g. by :meth:`dpctl.SyclQueue.submit`,
+        :meth:`dpctl.SyclQueue.memcpy` or functions of :mod:`dpctl.tensor`,
+        are recorded, and the device time is the span between the earliest
+        start and the latest end of these commands. Commands may be
+        submitted to several queues, so the context is entered without
+        a queue, and only commands submitted to queues with
+        "enable_profiling" property contribute to the device time.
+        Contexts may be nested, and durations are accumulated per region
+        name, see :meth:`dpctl.SyclTimer.statistics`.
+
+        .. code-block:: python
+
+            timer = dpctl.SyclTimer(device_timer="kernel_events")
+
+            for _ in range(100):
+                with timer(name="step"):
+                    with timer(name="sin"):
+                        y = dpt.sin(x)
+                    z = dpt.sum(y)
+
+            stats = timer.statistics()
+            print(stats["sin"]["device"]["median"])
 
     Args:
         host_timer (callable): A callable such that host_timer() returns current
             host time in seconds.
         time_scale (int, float): Ratio of the unit of time of interest and
             one second.
+        device_timer (str): Method used to measure device time,
+            ``"queue_barrier"`` or ``"kernel_events"``.
     """
 
-    def __init__(self, host_timer=timeit.default_timer, time_scale=1):
+    def __init__(
+        self,
+        host_timer=timeit.default_timer,
+        time_scale=1,
+        device_timer="queue_barrier",
+    ):
+        if device_timer not in ("queue_barrier", "kernel_events"):
+            raise ValueError(
+                "Expected device_timer to be 'queue_barrier' or "
+                f"'kernel_events', got {device_timer}"
+            )
         self.timer = host_timer
         self.time_scale = time_scale
+        self.device_timer = device_timer
         self.queue = None
         self.host_start = None
         self.host_finish = None
         self.event_start = None
         self.event_finish = None
-
-    def __call__(self, queue=None):
+        if device_timer == "kernel_events":
+            self._event_timer = _SyclEventTimer()
+            # region name is passed from __call__ to __enter__ per thread
+            self._tls = threading.local()
+
+    def __call__(self, queue=None, name=None):
+        if self.device_timer == "kernel_events":
+            if queue is not None:
+                raise TypeError(
+                    "With device_timer='kernel_events' commands submitted "
+                    "to any queue are timed, queue must not be given"
+                )
+            self._tls.name = name
+            return self
         if isinstance(queue, SyclQueue):
             if queue.has_enable_profiling:
                 self.queue = queue
@@ -89,11 +143,21 @@ class SyclTimer:
         return self
 
     def __enter__(self):
+        if self.device_timer == "kernel_events":
+            name = getattr(self._tls, "name", None)
+            self._tls.name = None
+            self._event_timer.begin_region(
+                "region" if name is None else name
+            )
+            return self
         self.event_start = self.queue.submit_barrier()
         self.host_start = self.timer()
         return self
 
     def __exit__(self, *args):
+        if self.device_timer == "kernel_events":
+            self._event_timer.end_region()
+            return
         self.event_finish = self.queue.submit_barrier()
         self.host_finish = self.timer()
 
@@ -102,7 +166,19 @@ class SyclTimer:
         """Returns a tuple of elapsed times where first
         element is the duration as measured by the host timer,
         while the second element is the duration as measured by
-        the device timer and encoded in profiling events"""
+        the device timer and encoded in profiling events
+
+        With ``device_timer="kernel_events"`` the durations are those
+        of the region closed last, and the host duration is measured
+        with a steady clock rather than `host_timer`.
+        """
+        if self.device_timer == "kernel_events":
+            self._event_timer.synchronize()
+            sc = 1e-9 * self.time_scale
+            return (
+                self._event_timer.last_duration("host") * sc,
+                self._event_timer.last_duration("device") * sc,
+            )
         self.event_start.wait()
         self.event_finish.wait()
         return (
@@ -113,3 +189,49 @@ class SyclTimer:
             )
             * (1e-9 * self.time_scale),
         )
+
+    def statistics(self):
+        """Returns dictionary mapping region name to statistics of its
+        durations accumulated since creation of the timer or the last call
+        to :meth:`dpctl.SyclTimer.reset`.
+
+        Statistics of each region is a dictionary with keys ``"host"`` and
+        ``"device"``, each mapping to a dictionary with keys ``"count"``,
+        ``"min"``, ``"median"``, ``"p99"`` and ``"mean"``. Durations are
+        scaled by `time_scale`, and are ``None`` if there are no samples,
+        e.g. if no command was submitted to a queue with "enable_profiling"
+        property.
+
+        Only available with ``device_timer="kernel_events"``.
+        """
+        if self.device_timer != "kernel_events":
+            raise TypeError(
+                "Statistics are only collected with "
+                "device_timer='kernel_events'"
+            )
+        et = self._event_timer
+        et.synchronize()
+        sc = 1e-9 * self.time_scale
+
+        def _scaled(v):
+            return None if v is None else v * sc
+
+        res = dict()
+        for name in et.region_names():
+            res[name] = {
+                clock: {
+                    "count": et.count(name, clock),
+                    "min": _scaled(et.quantile(name, clock, 0.0)),
+                    "median": _scaled(et.quantile(name, clock, 0.5)),
+                    "p99": _scaled(et.quantile(name, clock, 0.99)),
+                    "mean": _scaled(et.mean(name, clock)),
+                }
+                for clock in ("host", "device")
+            }
+        return res
+
+    def reset(self):
+        """Discards durations accumulated with
+        ``device_timer="kernel_events"``."""
+        if self.device_timer == "kernel_events":
+            self._event_timer.reset()
@@ -27,8 +27,10 @@
 
 #include "dpctl_capi.h"
 #include <CL/sycl.hpp>
+#include <array>
 #include <complex>
 #include <memory>
+#include <mutex>
 #include <pybind11/pybind11.h>
 #include <vector>
 
@@ -82,6 +84,7 @@ public:
 
     DPCTLSyclEventRef (*SyclEvent_GetEventRef_)(PySyclEventObject *);
     PySyclEventObject *(*SyclEvent_Make_)(DPCTLSyclEventRef);
+    void (*SyclEvent_RecordForTiming_)(DPCTLSyclEventRef);
 
     DPCTLSyclQueueRef (*SyclQueue_GetQueueRef_)(PySyclQueueObject *);
     PySyclQueueObject *(*SyclQueue_Make_)(DPCTLSyclQueueRef);
@@ -230,17 +233,18 @@ private:
           PySyclKernelType_(nullptr), SyclDevice_GetDeviceRef_(nullptr),
           SyclDevice_Make_(nullptr), SyclContext_GetContextRef_(nullptr),
           SyclContext_Make_(nullptr), SyclEvent_GetEventRef_(nullptr),
-          SyclEvent_Make_(nullptr), SyclQueue_GetQueueRef_(nullptr),
-          SyclQueue_Make_(nullptr), Memory_GetUsmPointer_(nullptr),
-          Memory_GetContextRef_(nullptr), Memory_GetQueueRef_(nullptr),
-          Memory_GetNumBytes_(nullptr), Memory_Make_(nullptr),
-          SyclKernel_GetKernelRef_(nullptr), SyclKernel_Make_(nullptr),
-          SyclProgram_GetKernelBundleRef_(nullptr), SyclProgram_Make_(nullptr),
-          UsmNDArray_GetData_(nullptr), UsmNDArray_GetNDim_(nullptr),
-          UsmNDArray_GetShape_(nullptr), UsmNDArray_GetStrides_(nullptr),
-          UsmNDArray_GetTypenum_(nullptr), UsmNDArray_GetElementSize_(nullptr),
-          UsmNDArray_GetFlags_(nullptr), UsmNDArray_GetQueueRef_(nullptr),
-          UsmNDArray_GetOffset_(nullptr), UsmNDArray_SetWritableFlag_(nullptr),
+          SyclEvent_Make_(nullptr), SyclEvent_RecordForTiming_(nullptr),
+          SyclQueue_GetQueueRef_(nullptr), SyclQueue_Make_(nullptr),
+          Memory_GetUsmPointer_(nullptr), Memory_GetContextRef_(nullptr),
+          Memory_GetQueueRef_(nullptr), Memory_GetNumBytes_(nullptr),
+          Memory_Make_(nullptr), SyclKernel_GetKernelRef_(nullptr),
+          SyclKernel_Make_(nullptr), SyclProgram_GetKernelBundleRef_(nullptr),
+          SyclProgram_Make_(nullptr), UsmNDArray_GetData_(nullptr),
+          UsmNDArray_GetNDim_(nullptr), UsmNDArray_GetShape_(nullptr),
+          UsmNDArray_GetStrides_(nullptr), UsmNDArray_GetTypenum_(nullptr),
+          UsmNDArray_GetElementSize_(nullptr), UsmNDArray_GetFlags_(nullptr),
+          UsmNDArray_GetQueueRef_(nullptr), UsmNDArray_GetOffset_(nullptr),
+          UsmNDArray_SetWritableFlag_(nullptr),
           UsmNDArray_MakeSimpleFromMemory_(nullptr),
           UsmNDArray_MakeSimpleFromPtr_(nullptr),
           UsmNDArray_MakeFromPtr_(nullptr), USM_ARRAY_C_CONTIGUOUS_(0),
@@ -290,6 +294,7 @@ private:
         // SyclEvent API
         this->SyclEvent_GetEventRef_ = SyclEvent_GetEventRef;
         this->SyclEvent_Make_ = SyclEvent_Make;
+        this->SyclEvent_RecordForTiming_ = SyclEvent_RecordForTiming;
 
         // SyclQueue API
         this->SyclQueue_GetQueueRef_ = SyclQueue_GetQueueRef;
@@ -408,6 +413,76 @@ private:
     }
 
 }; // struct dpctl_capi
+
+/*! @brief Queue of references to Python objects, released once a thread
+    holds the GIL.
+
+    Host tasks push references of objects they kept alive, without acquiring
+    the GIL, and the interpreter is asked to release them with
+    `Py_AddPendingCall`. Pending references are also released by
+    `keep_args_alive`, which is called with the GIL held.
+*/
+class deferred_decref
+{
+public:
+    static deferred_decref &get()
+    {
+        // never destroyed, host tasks may run during interpreter shutdown
+        static deferred_decref *instance = new deferred_decref{};
+        return *instance;
+    }
+
+    template <std::size_t num>
+    void push(const std::array<PyObject *, num> &objs)
+    {
+        bool schedule = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_.insert(pending_.end(), objs.begin(), objs.end());
+            schedule = !drain_scheduled_;
+            drain_scheduled_ = true;
+        }
+        if (!schedule) {
+            return;
+        }
+        // neither function requires the calling thread to hold the GIL
+        if (!Py_IsInitialized() || Py_AddPendingCall(&drain_cb, nullptr)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            drain_scheduled_ = false;
+        }
+    }
+
+    /*! @brief Releases pending references, the GIL must be held */
+    void drain()
+    {
+        std::vector<PyObject *> objs;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pending_.empty()) {
+                return;
+            }
+            objs.swap(pending_);
+            drain_scheduled_ = false;
+        }
+        for (PyObject *o : objs) {
+            Py_DECREF(o);
+        }
+    }
+
+private:
+    deferred_decref() = default;
+
+    static int drain_cb(void *)
+    {
+        get().drain();
+        return 0;
+    }
+
+    std::mutex mutex_;
+    std::vector<PyObject *> pending_;
+    bool drain_scheduled_ = false;
+};
+
 } // namespace detail
 } // namespace dpctl
 
@@ -1031,26 +1106,79 @@ private:
 namespace utils
 {
 
+/*! @brief Keeps Python objects alive until commands in `depends` complete.
+
+    Must be called with the GIL held. References are taken right away, and
+    released by a host task which does not acquire the GIL, so that entry
+    points may submit work with the GIL released, and threads waiting on
+    events with the GIL held do not block the host task. The command group
+    of the host task is submitted with the GIL released.
+
+    If `skip_if_complete` is set and all commands in `depends` have already
+    completed, e.g. when the operation was evaluated on the calling thread
+    and returned default-constructed event, no host task is submitted and
+    default-constructed event is returned. Checking costs a query of each
+    event, so entry points set it only if they may evaluate on the host.
+
+    Entry points likewise release the GIL with `py::gil_scoped_release`
+    while they pack kernel arguments and submit kernels, which only use
+    values extracted from Python objects beforehand. Objects those kernels
+    use are passed to this function once the GIL is acquired again.
+*/
 template <std::size_t num>
 sycl::event keep_args_alive(sycl::queue q,
                             const py::object (&py_objs)[num],
-                            const std::vector<sycl::event> &depends = {})
+                            const std::vector<sycl::event> &depends = {},
+                            bool skip_if_complete = false)
 {
-    sycl::event host_task_ev = q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(depends);
-        std::array<std::shared_ptr<py::handle>, num> shp_arr;
-        for (std::size_t i = 0; i < num; ++i) {
-            shp_arr[i] = std::make_shared<py::handle>(py_objs[i]);
-            shp_arr[i]->inc_ref();
-        }
-        cgh.host_task([=]() {
-            py::gil_scoped_acquire acquire;
+    auto &deferred = ::dpctl::detail::deferred_decref::get();
+    deferred.drain();
+
+    // commands the host task depends upon are recorded with regions of
+    // dpctl.SyclTimer open on the calling thread, if any
+    auto const &api = ::dpctl::detail::dpctl_capi::get();
+    for (const sycl::event &e : depends) {
+        api.SyclEvent_RecordForTiming_(reinterpret_cast<DPCTLSyclEventRef>(
+            const_cast<sycl::event *>(&e)));
+    }
 
-            for (std::size_t i = 0; i < num; ++i) {
-                shp_arr[i]->dec_ref();
+    // without events commands of in-order queue `q` may still use objects
+    if (skip_if_complete && !depends.empty()) {
+        bool all_complete = true;
+        for (const sycl::event &e : depends) {
+            if (e.get_info<sycl::info::event::command_execution_status>() !=
+                sycl::info::event_command_status::complete)
+            {
+                all_complete = false;
+                break;
             }
+        }
+        if (all_complete) {
+            return sycl::event();
+        }
+    }
+
+    std::array<PyObject *, num> refs;
+    for (std::size_t i = 0; i < num; ++i) {
+        refs[i] = py_objs[i].inc_ref().ptr();
+    }
+
+    sycl::event host_task_ev;
+    try {
+        py::gil_scoped_release release;
+
+        host_task_ev = q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
+            cgh.host_task([refs]() {
+                ::dpctl::detail::deferred_decref::get().push(refs);
+            });
         });
-    });
+    } catch (...) {
+        for (PyObject *o : refs) {
+            Py_DECREF(o);
+        }
+        throw;
+    }
 
     return host_task_ev;
 }
@@ -33,7 +33,14 @@ from ._memory import (
     MemoryUSMHost,
     MemoryUSMShared,
     USMAllocationError,
+    USMMemoryStats,
     as_usm_memory,
+    disable_usm_accounting,
+    enable_usm_accounting,
+    is_usm_accounting_enabled,
+    reset_usm_memory_peaks,
+    usm_memory_report,
+    usm_memory_stats,
 )
 
 __all__ = [
@@ -41,5 +48,12 @@ __all__ = [
     "MemoryUSMHost",
     "MemoryUSMShared",
     "USMAllocationError",
+    "USMMemoryStats",
     "as_usm_memory",
+    "enable_usm_accounting",
+    "disable_usm_accounting",
+    "is_usm_accounting_enabled",
+    "usm_memory_stats",
+    "usm_memory_report",
+    "reset_usm_memory_peaks",
 ]
@@ -35,6 +35,7 @@ from dpctl._backend cimport (  # noqa: E211
     DPCTLaligned_alloc_shared,
     DPCTLContext_AreEq,
     DPCTLContext_Delete,
+    DPCTLCString_Delete,
     DPCTLDevice_Copy,
     DPCTLEvent_Delete,
     DPCTLEvent_Wait,
@@ -55,6 +56,23 @@ from dpctl._backend cimport (  # noqa: E211
     DPCTLSyclUSMRef,
     DPCTLUSM_GetPointerDevice,
     DPCTLUSM_GetPointerType,
+    DPCTLUSMAccounting_CreateSnapshot,
+    DPCTLUSMAccounting_IsEnabled,
+    DPCTLUSMAccounting_RecordAlloc,
+    DPCTLUSMAccounting_RecordFree,
+    DPCTLUSMAccounting_Report,
+    DPCTLUSMAccounting_ResetPeaks,
+    DPCTLUSMAccounting_SetEnabled,
+    DPCTLUSMAccountingSnapshot_Delete,
+    DPCTLUSMAccountingSnapshot_GetAllocCount,
+    DPCTLUSMAccountingSnapshot_GetCallSite,
+    DPCTLUSMAccountingSnapshot_GetDevice,
+    DPCTLUSMAccountingSnapshot_GetLiveBytes,
+    DPCTLUSMAccountingSnapshot_GetLiveCount,
+    DPCTLUSMAccountingSnapshot_GetPeakBytes,
+    DPCTLUSMAccountingSnapshot_GetUSMType,
+    DPCTLUSMAccountingSnapshot_Size,
+    DPCTLUSMAccountingSnapshotRef,
     _usm_type,
 )
 
@@ -65,6 +83,8 @@ from .._sycl_queue_manager cimport get_device_cached_queue
 
 import collections
 import numbers
+import sys
+from pickle import PickleBuffer
 
 import numpy as np
 
@@ -73,6 +93,12 @@ __all__ = [
     "MemoryUSMHost",
     "MemoryUSMDevice",
     "USMAllocationError",
+    "enable_usm_accounting",
+    "disable_usm_accounting",
+    "is_usm_accounting_enabled",
+    "usm_memory_stats",
+    "usm_memory_report",
+    "reset_usm_memory_peaks",
 ]
 
 include "_sycl_usm_array_interface_utils.pxi"
@@ -121,10 +147,185 @@ cdef void copy_via_host(void *dest_ptr, SyclQueue dest_queue,
     DPCTLEvent_Delete(E2Ref)
 
 
-def _to_memory(unsigned char[::1] b, str usm_kind):
+cdef str _python_call_site():
+    """
+    Returns description of the innermost Python frame outside of this
+    module, i.e. the Python function which requested the allocation, as
+    "module.function:lineno". Frames of this module exist only in builds
+    with Cython profiling or line tracing, and are skipped, so that the
+    reported call site does not depend on build settings.
+    """
+    try:
+        f = sys._getframe(0)
+    except ValueError:
+        return "dpctl.memory"
+    while f is not None and f.f_globals.get("__name__") == __name__:
+        f = f.f_back
+    if f is None:
+        return "dpctl.memory"
+    return "{}.{}:{}".format(
+        f.f_globals.get("__name__", "<unknown>"),
+        f.f_code.co_name,
+        f.f_lineno
+    )
+
+
+cdef _record_usm_allocation(
+    DPCTLSyclUSMRef p,
+    Py_ssize_t nbytes,
+    bytes ptr_type,
+    DPCTLSyclQueueRef QRef,
+):
+    cdef _usm_type kind = _usm_type._USM_UNKNOWN
+    cdef bytes site = _python_call_site().encode("utf-8")
+    cdef const char *site_ptr = site
+    if ptr_type == b"device":
+        kind = _usm_type._USM_DEVICE
+    elif ptr_type == b"shared":
+        kind = _usm_type._USM_SHARED
+    elif ptr_type == b"host":
+        kind = _usm_type._USM_HOST
+    DPCTLUSMAccounting_RecordAlloc(p, nbytes, kind, QRef, site_ptr)
+
+
+cdef str _allocation_failure_message(str msg):
+    if DPCTLUSMAccounting_IsEnabled():
+        return msg + "\n" + usm_memory_report()
+    return msg
+
+
+USMMemoryStats = collections.namedtuple(
+    "USMMemoryStats",
+    [
+        "device",
+        "usm_type",
+        "call_site",
+        "live_bytes",
+        "peak_bytes",
+        "live_allocations",
+        "allocations",
+    ],
+)
+
+
+def enable_usm_accounting():
+    """
+    Enables accounting of USM allocations made by :class:`dpctl.memory`
+    classes and by temporary allocations of :mod:`dpctl.tensor` kernels.
+
+    Accounting can also be enabled at start-up by setting environment
+    variable ``DPCTL_USM_ACCOUNTING=1``.
+    """
+    DPCTLUSMAccounting_SetEnabled(True)
+
+
+def disable_usm_accounting():
+    """
+    Disables accounting of subsequent USM allocations. Deallocations of
+    already recorded allocations continue to be accounted for.
+    """
+    DPCTLUSMAccounting_SetEnabled(False)
+
+
+def is_usm_accounting_enabled():
+    """Returns `True` if USM allocations are being accounted for."""
+    return bool(DPCTLUSMAccounting_IsEnabled())
+
+
+def usm_memory_stats():
+    """
+    usm_memory_stats()
+
+    Returns list of :class:`USMMemoryStats` named tuples with fields
+    ``device``, ``usm_type``, ``call_site``, ``live_bytes``, ``peak_bytes``,
+    ``live_allocations`` and ``allocations``, one per (device, USM type,
+    call site) triple of allocations recorded since the accounting was
+    enabled.
+
+    Entries with ``call_site`` set to `None` hold totals for the
+    (device, USM type) pair, and precede per call site entries. Peak values
+    are high-water marks of live bytes since the last call to
+    :func:`reset_usm_memory_peaks`.
+
+    Call sites of allocations made by :class:`dpctl.memory` classes are
+    Python functions which requested the allocation, e.g.
+    ``"dpctl.tensor._ctors.empty:123"``, while call sites of temporary
+    allocations in :mod:`dpctl.tensor` kernels name the internal routine,
+    e.g. ``"device_allocate_and_pack"``.
+    """
+    cdef DPCTLUSMAccountingSnapshotRef SRef = (
+        DPCTLUSMAccounting_CreateSnapshot()
+    )
+    cdef size_t i = 0
+    cdef size_t n = 0
+    cdef const char *cs = NULL
+    cdef DPCTLSyclDeviceRef DRef = NULL
+    cdef _usm_type kind
+    cdef list res = []
+    if SRef is NULL:
+        return res
+    _kinds = {
+        _usm_type._USM_DEVICE: "device",
+        _usm_type._USM_SHARED: "shared",
+        _usm_type._USM_HOST: "host",
+    }
+    n = DPCTLUSMAccountingSnapshot_Size(SRef)
+    for i in range(n):
+        DRef = DPCTLUSMAccountingSnapshot_GetDevice(SRef, i)
+        dev = SyclDevice._create(DRef) if DRef is not NULL else None
+        kind = DPCTLUSMAccountingSnapshot_GetUSMType(SRef, i)
+        cs = DPCTLUSMAccountingSnapshot_GetCallSite(SRef, i)
+        site = None
+        if cs is not NULL:
+            site = cs.decode("utf-8")
+            DPCTLCString_Delete(cs)
+        res.append(
+            USMMemoryStats(
+                dev,
+                _kinds.get(kind, "unknown"),
+                site if site else None,
+                DPCTLUSMAccountingSnapshot_GetLiveBytes(SRef, i),
+                DPCTLUSMAccountingSnapshot_GetPeakBytes(SRef, i),
+                DPCTLUSMAccountingSnapshot_GetLiveCount(SRef, i),
+                DPCTLUSMAccountingSnapshot_GetAllocCount(SRef, i),
+            )
+        )
+    DPCTLUSMAccountingSnapshot_Delete(SRef)
+    return res
+
+
+def usm_memory_report():
+    """
+    Returns human-readable report of live and peak USM memory usage per
+    device, USM type and call site. The report is also included in the
+    message of :class:`USMAllocationError` if accounting is enabled.
+    """
+    cdef const char *rep = DPCTLUSMAccounting_Report()
+    if rep is NULL:
+        return ""
+    res = rep.decode("utf-8")
+    DPCTLCString_Delete(rep)
+    return res
+
+
+def reset_usm_memory_peaks():
+    """
+    Resets high-water marks of live bytes to the current number of live
+    bytes and allocation counts to zero. Entries without live allocations
+    are discarded.
+    """
+    DPCTLUSMAccounting_ResetPeaks()
+
+
+def _to_memory(const unsigned char[::1] b, str usm_kind):
     """
     Constructs Memory of the same size as the argument
-    and copies data into it"""
+    and copies data into it.
+
+    With pickle protocol 5 the argument may be an out-of-band buffer
+    provided to :func:`pickle.loads`, in which case its content is copied
+    into the new allocation directly, without intermediate copies.
+    """
     cdef _Memory res
 
     if (usm_kind == "shared"):
@@ -138,7 +339,8 @@ def _to_memory(unsigned char[::1] b, str usm_kind):
             "Unrecognized usm_kind={} stored in the "
             "pickle".format(usm_kind)
         )
-    res.copy_from_host(b)
+    if len(b) > 0:
+        res.copy_from_host(b)
 
     return res
 
@@ -197,9 +399,11 @@ cdef class _Memory:
                 self.memory_ptr = p
                 self.nbytes = nbytes
                 self.queue = queue
+                if DPCTLUSMAccounting_IsEnabled():
+                    _record_usm_allocation(p, nbytes, ptr_type, QRef)
             else:
                 raise USMAllocationError(
-                    "USM allocation failed"
+                    _allocation_failure_message("USM allocation failed")
                 )
         else:
             raise ValueError(
@@ -241,6 +445,7 @@ cdef class _Memory:
         if (self.refobj is None):
             if self.memory_ptr:
                 if (type(self.queue) is SyclQueue):
+                    DPCTLUSMAccounting_RecordFree(self.memory_ptr)
                     DPCTLfree_with_queue(
                         self.memory_ptr, self.queue.get_queue_ref()
                     )
@@ -346,6 +551,24 @@ cdef class _Memory:
     def __reduce__(self):
         return _to_memory, (self.copy_to_host(), self.get_usm_type())
 
+    def __reduce_ex__(self, protocol):
+        """
+        Supports pickling with protocol 5 out-of-band buffers.
+
+        With protocol 5 or higher, content of USM-shared and USM-host
+        allocations is exposed to the pickler as :class:`pickle.PickleBuffer`
+        without copying, while content of USM-device allocation is copied
+        to host once. Lower protocols pickle a host copy of the content.
+        """
+        if protocol < 5:
+            return self.__reduce__()
+        usm_type = self.get_usm_type()
+        if usm_type == "device":
+            host_obj = self.copy_to_host()
+        else:
+            host_obj = self
+        return _to_memory, (PickleBuffer(host_obj), usm_type)
+
     property __sycl_usm_array_interface__:
         def __get__(self):
             cdef dict iface = {
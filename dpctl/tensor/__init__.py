@@ -21,6 +21,8 @@
 
 """
 
+# must precede imports of extensions, see dpctl/tensor/_cpu_aot_finder.py
+import dpctl.tensor._cpu_aot_finder  # noqa: F401
 from dpctl.tensor._copy_utils import asnumpy, astype, copy, from_numpy, to_numpy
 from dpctl.tensor._ctors import (
     arange,
@@ -90,78 +92,20 @@ from dpctl.tensor._print import (
 )
 from dpctl.tensor._reshape import reshape
 from dpctl.tensor._search_functions import where
+from dpctl.tensor._stride_tricks import as_strided, sliding_window_view
 from dpctl.tensor._usmarray import usm_ndarray
 from dpctl.tensor._utility_functions import all, any
 
 from ._constants import e, inf, nan, newaxis, pi
-from ._elementwise_funcs import (
-    abs,
-    acos,
-    acosh,
-    add,
-    asin,
-    asinh,
-    atan,
-    atan2,
-    atanh,
-    bitwise_and,
-    bitwise_invert,
-    bitwise_left_shift,
-    bitwise_or,
-    bitwise_right_shift,
-    bitwise_xor,
-    ceil,
-    conj,
-    cos,
-    cosh,
-    divide,
-    equal,
-    exp,
-    expm1,
-    floor,
-    floor_divide,
-    greater,
-    greater_equal,
-    hypot,
-    imag,
-    isfinite,
-    isinf,
-    isnan,
-    less,
-    less_equal,
-    log,
-    log1p,
-    log2,
-    log10,
-    logaddexp,
-    logical_and,
-    logical_not,
-    logical_or,
-    logical_xor,
-    maximum,
-    minimum,
-    multiply,
-    negative,
-    not_equal,
-    positive,
-    pow,
-    proj,
-    real,
-    remainder,
-    round,
-    sign,
-    signbit,
-    sin,
-    sinh,
-    sqrt,
-    square,
-    subtract,
-    tan,
-    tanh,
-    trunc,
-)
+from ._growable import GrowableArray
+from ._npy_io import load, save
+from ._queue_pool import QueuePool, RoundRobinPolicy, get_device_queue_pool
+from ._random import Generator
 from ._reduction import sum
-from ._testing import allclose
+from ._sorting import top_k
+from ._statistical_functions import digitize, histogram, quantile
+from ._testing import allclose, isclose
+from ._usm_advice import get_usm_advice, set_usm_advice
 
 __all__ = [
     "Device",
@@ -187,6 +131,8 @@ __all__ = [
     "stack",
     "broadcast_arrays",
     "broadcast_to",
+    "as_strided",
+    "sliding_window_view",
     "expand_dims",
     "permute_dims",
     "squeeze",
@@ -255,6 +201,7 @@ __all__ = [
     "bitwise_right_shift",
     "bitwise_xor",
     "ceil",
+    "clip",
     "conj",
     "cos",
     "cosh",
@@ -264,6 +211,7 @@ __all__ = [
     "expm1",
     "floor",
     "floor_divide",
+    "fma",
     "greater",
     "greater_equal",
     "hypot",
@@ -271,6 +219,7 @@ __all__ = [
     "isfinite",
     "isinf",
     "isnan",
+    "lerp",
     "less",
     "less_equal",
     "log",
@@ -300,8 +249,6 @@ __all__ = [
     "sqrt",
     "square",
     "subtract",
-    "not_equal",
-    "floor_divide",
     "sum",
     "tan",
     "tanh",
@@ -309,4 +256,105 @@ __all__ = [
     "allclose",
     "repeat",
     "tile",
+    "isclose",
+    "load",
+    "save",
+    "top_k",
+    "histogram",
+    "digitize",
+    "quantile",
+    "Generator",
+    "QueuePool",
+    "RoundRobinPolicy",
+    "get_device_queue_pool",
+    "set_usm_advice",
+    "get_usm_advice",
+    "GrowableArray",
 ]
+
+# Elementwise functions are imported on first use, together with
+# _tensor_elementwise_impl extension holding their kernels
+_elementwise_funcs_names = (
+    "abs",
+    "acos",
+    "acosh",
+    "add",
+    "asin",
+    "asinh",
+    "atan",
+    "atan2",
+    "atanh",
+    "bitwise_and",
+    "bitwise_invert",
+    "bitwise_left_shift",
+    "bitwise_or",
+    "bitwise_right_shift",
+    "bitwise_xor",
+    "ceil",
+    "clip",
+    "conj",
+    "cos",
+    "cosh",
+    "divide",
+    "equal",
+    "exp",
+    "expm1",
+    "floor",
+    "floor_divide",
+    "fma",
+    "greater",
+    "greater_equal",
+    "hypot",
+    "imag",
+    "isfinite",
+    "isinf",
+    "isnan",
+    "lerp",
+    "less",
+    "less_equal",
+    "log",
+    "log1p",
+    "log2",
+    "log10",
+    "logaddexp",
+    "logical_and",
+    "logical_not",
+    "logical_or",
+    "logical_xor",
+    "maximum",
+    "minimum",
+    "multiply",
+    "negative",
+    "not_equal",
+    "positive",
+    "pow",
+    "proj",
+    "real",
+    "remainder",
+    "round",
+    "sign",
+    "signbit",
+    "sin",
+    "sinh",
+    "sqrt",
+    "square",
+    "subtract",
+    "tan",
+    "tanh",
+    "trunc",
+)
+
+
+def __getattr__(name):
+    if name in _elementwise_funcs_names:
+        from . import _elementwise_funcs
+
+        g = globals()
+        for fn_name in _elementwise_funcs_names:
+            g[fn_name] = getattr(_elementwise_funcs, fn_name)
+        return g[name]
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+
+
+def __dir__():
+    return sorted(set(globals()).union(_elementwise_funcs_names))
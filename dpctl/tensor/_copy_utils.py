@@ -26,6 +26,9 @@ import dpctl.tensor._tensor_impl as ti
 import dpctl.utils
 from dpctl.tensor._data_types import _get_dtype
 from dpctl.tensor._device import normalize_queue_device
+from dpctl.tensor._lazy_extension import tensor_indexing_impl as tii
+from dpctl.tensor._usm_advice import _last_access_side, _mark_host_access
+from dpctl.tensor._usmarray import _strided_view
 
 __doc__ = (
     "Implementation module for copy- and cast- operations on "
@@ -35,13 +38,11 @@ __doc__ = (
 int32_t_max = 2147483648
 
 
-def _copy_to_numpy(ary):
-    if not isinstance(ary, dpt.usm_ndarray):
-        raise TypeError
+def _numpy_view(ary, buf):
+    """NumPy array viewing elements of `ary` in host-accessible USM
+    allocation `buf`, laid out as the allocation of `ary`"""
     nb = ary.usm_data.nbytes
-    hh = dpm.MemoryUSMHost(nb, queue=ary.sycl_queue)
-    hh.copy_from_device(ary.usm_data)
-    h = np.ndarray(nb, dtype="u1", buffer=hh).view(ary.dtype)
+    h = np.ndarray(nb, dtype="u1", buffer=buf).view(ary.dtype)
     itsz = ary.itemsize
     strides_bytes = tuple(si * itsz for si in ary.strides)
     offset = ary.__sycl_usm_array_interface__.get("offset", 0) * itsz
@@ -54,6 +55,19 @@ def _copy_to_numpy(ary):
     )
 
 
+def _copy_to_numpy(ary):
+    if not isinstance(ary, dpt.usm_ndarray):
+        raise TypeError
+    if _last_access_side(ary) == "host":
+        # pages of the shared allocation reside on the host, read them
+        # there rather than have the device copy migrate them
+        return np.array(_numpy_view(ary, ary.usm_data), copy=True)
+    hh = dpm.MemoryUSMHost(ary.usm_data.nbytes, queue=ary.sycl_queue)
+    # the copy reads pages residing on the device without migrating them
+    hh.copy_from_device(ary.usm_data)
+    return _numpy_view(ary, hh)
+
+
 def _copy_from_numpy(np_ary, usm_type="device", sycl_queue=None):
     "Copies numpy array `np_ary` into a new usm_ndarray"
     # This may perform a copy to meet stated requirements
@@ -79,6 +93,12 @@ def _copy_from_numpy_into(dst, np_ary):
         raise TypeError(f"Expected numpy.ndarray, got {type(np_ary)}")
     if not isinstance(dst, dpt.usm_ndarray):
         raise TypeError(f"Expected usm_ndarray, got {type(dst)}")
+    if isinstance(dst.usm_data, dpm.MemoryUSMShared):
+        # shared USM is host accessible, so write it on the host, and
+        # have kernels reading it prefetch it to the device
+        np.copyto(_numpy_view(dst, dst.usm_data), np_ary, casting="unsafe")
+        _mark_host_access(dst)
+        return
     if np_ary.flags["OWNDATA"]:
         Xnp = np_ary
     else:
@@ -671,14 +691,14 @@ def _extract_impl(ary, ary_mask, axis=0):
     cumsum_dt = dpt.int32 if mask_nelems < int32_t_max else dpt.int64
     cumsum = dpt.empty(mask_nelems, dtype=cumsum_dt, device=ary_mask.device)
     exec_q = cumsum.sycl_queue
-    mask_count = ti.mask_positions(ary_mask, cumsum, sycl_queue=exec_q)
+    mask_count = tii.mask_positions(ary_mask, cumsum, sycl_queue=exec_q)
     dst_shape = ary.shape[:pp] + (mask_count,) + ary.shape[pp + mask_nd :]
     dst = dpt.empty(
         dst_shape, dtype=ary.dtype, usm_type=ary.usm_type, device=ary.device
     )
     if dst.size == 0:
         return dst
-    hev, _ = ti._extract(
+    hev, _ = tii._extract(
         src=ary,
         cumsum=cumsum,
         axis_start=pp,
@@ -702,7 +722,7 @@ def _nonzero_impl(ary):
     cumsum = dpt.empty(
         mask_nelems, dtype=cumsum_dt, sycl_queue=exec_q, order="C"
     )
-    mask_count = ti.mask_positions(ary, cumsum, sycl_queue=exec_q)
+    mask_count = tii.mask_positions(ary, cumsum, sycl_queue=exec_q)
     indexes_dt = ti.default_device_index_type(exec_q.sycl_device)
     indexes = dpt.empty(
         (ary.ndim, mask_count),
@@ -711,12 +731,61 @@ def _nonzero_impl(ary):
         sycl_queue=exec_q,
         order="C",
     )
-    hev, _ = ti._nonzero(cumsum, indexes, ary.shape, exec_q)
+    hev, _ = tii._nonzero(cumsum, indexes, ary.shape, exec_q)
     res = tuple(indexes[i, :] for i in range(ary.ndim))
     hev.wait()
     return res
 
 
+def _mergeable_dims(shape, strides):
+    "Returns True if dimensions can be merged into one without a copy"
+    return all(
+        strides[i] == strides[i + 1] * shape[i + 1]
+        for i in range(len(shape) - 1)
+    )
+
+
+def _adv_ind_to_integer(ary, adv_ind, p):
+    """Converts boolean arrays among advanced indices `adv_ind`, which
+    index consecutive dimensions of `ary` starting from `p`, to integer
+    indices.
+
+    Dimensions of `ary` indexed by a multi-dimensional boolean array are
+    merged into one when this does not require a copy, and the boolean
+    array is converted to a single array of flat positions of its set
+    elements, instead of one array of positions per dimension.
+
+    Returns a tuple of a view of `ary` and of integer indices.
+    """
+    shape = list(ary.shape)
+    strides = list(ary.strides)
+    int_inds = []
+    merged = False
+    k = p
+    for ind in adv_ind:
+        if ind.dtype.kind != "b":
+            int_inds.append(ind)
+            k += 1
+            continue
+        m = ind.ndim
+        if (
+            m > 1
+            and ind.shape == tuple(shape[k : k + m])
+            and _mergeable_dims(shape[k : k + m], strides[k : k + m])
+        ):
+            shape[k : k + m] = [ind.size]
+            strides[k : k + m] = [strides[k + m - 1]]
+            int_inds.extend(_nonzero_impl(dpt.reshape(ind, -1)))
+            merged = True
+            k += 1
+        else:
+            int_inds.extend(_nonzero_impl(ind))
+            k += m
+    if merged:
+        ary = _strided_view(ary, tuple(shape), tuple(strides))
+    return ary, tuple(int_inds)
+
+
 def _take_multi_index(ary, inds, p):
     if not isinstance(ary, dpt.usm_ndarray):
         raise TypeError
@@ -752,7 +821,7 @@ def _take_multi_index(ary, inds, p):
         res_shape, dtype=ary.dtype, usm_type=res_usm_type, sycl_queue=exec_q
     )
 
-    hev, _ = ti._take(
+    hev, _ = tii._take(
         src=ary, ind=inds, dst=res, axis_start=p, mode=0, sycl_queue=exec_q
     )
     hev.wait()
@@ -760,9 +829,59 @@ def _take_multi_index(ary, inds, p):
     return res
 
 
+def _masked_count_axis_broadcast(vals_shape, pre_nd, post_nd):
+    """Returns True if array of shape `vals_shape` broadcasts along the axis
+    of the selected elements of `ary[..., mask, ...]`, preceded by `pre_nd`
+    and followed by `post_nd` dimensions, so that the value assigned does
+    not depend on the position of the element among the selected ones"""
+    vals_nd = len(vals_shape)
+    if vals_nd > pre_nd + 1 + post_nd:
+        return False
+    return vals_nd <= post_nd or vals_shape[vals_nd - post_nd - 1] == 1
+
+
+def _place_fused(ary, ary_mask, vals, pp, exec_q):
+    """Assigns scalar, or array broadcasting along the axis of selected
+    elements, to elements of ary selected by mask without computing
+    positions of the selected elements"""
+    mask_nd = ary_mask.ndim
+    post_nd = ary.ndim - pp - mask_nd
+    if ary.shape[pp : pp + mask_nd] != ary_mask.shape:
+        raise ValueError("Inconsistent array dimensions")
+    if ti._array_overlap(ary, ary_mask):
+        ary_mask = dpt.copy(ary_mask)
+    mask_b = dpt.broadcast_to(
+        dpt.reshape(ary_mask, (1,) * pp + ary_mask.shape + (1,) * post_nd),
+        ary.shape,
+    )
+    if not isinstance(vals, dpt.usm_ndarray):
+        # convert on the host, as dpt.asarray would
+        fill_v = np.asarray(vals, dtype=ary.dtype).item()
+        hev, _ = tii._masked_fill(
+            dst=ary, mask=mask_b, value=fill_v, sycl_queue=exec_q
+        )
+        hev.wait()
+        return
+    if vals.dtype == ary.dtype:
+        rhs = vals
+    else:
+        rhs = dpt.astype(vals, ary.dtype)
+    # drop unit axis of selected elements, and put unit axes
+    # for dimensions spanned by the mask in its place
+    rhs_shape = (1,) * (pp + 1 + post_nd - rhs.ndim) + rhs.shape
+    rhs_shape = rhs_shape[:pp] + (1,) * mask_nd + rhs_shape[pp + 1 :]
+    rhs = dpt.broadcast_to(dpt.reshape(rhs, rhs_shape), ary.shape)
+    if ti._array_overlap(ary, rhs):
+        rhs = dpt.copy(rhs)
+    hev, _ = tii._masked_assign(
+        dst=ary, mask=mask_b, rhs=rhs, sycl_queue=exec_q
+    )
+    hev.wait()
+
+
 def _place_impl(ary, ary_mask, vals, axis=0):
-    """Extract elements of ary by applying mask starting from slot
-    dimension axis"""
+    """Assign vals to elements of ary selected by applying mask starting
+    from slot dimension axis"""
     if not isinstance(ary, dpt.usm_ndarray):
         raise TypeError(
             f"Expecting type dpctl.tensor.usm_ndarray, got {type(ary)}"
@@ -777,11 +896,12 @@ def _place_impl(ary, ary_mask, vals, axis=0):
             ary_mask.sycl_queue,
         )
     )
+    is_scalar = isinstance(vals, (bool, int, float, complex, np.generic))
     if exec_q is not None:
-        if not isinstance(vals, dpt.usm_ndarray):
-            vals = dpt.asarray(vals, dtype=ary.dtype, sycl_queue=exec_q)
-        else:
+        if isinstance(vals, dpt.usm_ndarray):
             exec_q = dpctl.utils.get_execution_queue((exec_q, vals.sycl_queue))
+        elif not is_scalar:
+            vals = dpt.asarray(vals, dtype=ary.dtype, sycl_queue=exec_q)
     if exec_q is None:
         raise dpctl.utils.ExecutionPlacementError(
             "arrays have different associated queues. "
@@ -794,11 +914,18 @@ def _place_impl(ary, ary_mask, vals, axis=0):
         raise ValueError(
             "Parameter p is inconsistent with input array dimensions"
         )
+    if is_scalar or _masked_count_axis_broadcast(
+        vals.shape, pp, ary_nd - pp - mask_nd
+    ):
+        # the same value is assigned to every selected element,
+        # positions of selected elements are not needed
+        _place_fused(ary, ary_mask, vals, pp, exec_q)
+        return
     mask_nelems = ary_mask.size
     cumsum_dt = dpt.int32 if mask_nelems < int32_t_max else dpt.int64
     cumsum = dpt.empty(mask_nelems, dtype=cumsum_dt, device=ary_mask.device)
     exec_q = cumsum.sycl_queue
-    mask_count = ti.mask_positions(ary_mask, cumsum, sycl_queue=exec_q)
+    mask_count = tii.mask_positions(ary_mask, cumsum, sycl_queue=exec_q)
     expected_vals_shape = (
         ary.shape[:pp] + (mask_count,) + ary.shape[pp + mask_nd :]
     )
@@ -807,7 +934,7 @@ def _place_impl(ary, ary_mask, vals, axis=0):
     else:
         rhs = dpt.astype(vals, ary.dtype)
     rhs = dpt.broadcast_to(rhs, expected_vals_shape)
-    hev, _ = ti._place(
+    hev, _ = tii._place(
         dst=ary,
         cumsum=cumsum,
         axis_start=pp,
@@ -867,7 +994,7 @@ def _put_multi_index(ary, inds, p, vals):
 
     vals = dpt.broadcast_to(vals, vals_shape)
 
-    hev, _ = ti._put(
+    hev, _ = tii._put(
         dst=ary, ind=inds, val=vals, axis_start=p, mode=0, sycl_queue=exec_q
     )
     hev.wait()
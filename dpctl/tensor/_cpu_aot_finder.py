@@ -0,0 +1,95 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import importlib.machinery
+import importlib.util
+import os
+import sys
+
+__doc__ = (
+    "Selection of variants of `dpctl.tensor` extensions with ahead-of-time "
+    "compiled CPU device code, built with `DPCTL_TARGET_CPU_AOT` option."
+)
+
+# instruction sets of variants, in order of preference
+_CPU_AOT_ISAS = ("avx512", "avx2", "avx", "sse4.2")
+
+_CPU_AOT_DIR = os.path.join(os.path.dirname(__file__), "_cpu_aot")
+
+
+def _select_cpu_aot_dir():
+    """Returns directory with variants of extensions for the widest
+    instruction set supported by the host CPU, or `None` if there is
+    no such variant, or their use is disabled by setting environment
+    variable ``DPCTL_TENSOR_CPU_AOT=0``.
+
+    The SYCL runtime uses the native image on every x86_64 CPU device
+    irrespective of the instruction sets it supports, so variants for
+    instruction sets the CPU lacks must not be imported.
+    """
+    if os.environ.get("DPCTL_TENSOR_CPU_AOT", "1") == "0":
+        return None
+    if not os.path.isdir(_CPU_AOT_DIR):
+        return None
+    try:
+        from dpctl.tensor._cpu_features import host_cpu_supports
+    except ImportError:
+        return None
+    for isa in _CPU_AOT_ISAS:
+        d = os.path.join(_CPU_AOT_DIR, isa.replace(".", "_"))
+        if os.path.isdir(d) and host_cpu_supports(isa):
+            return d
+    return None
+
+
+class CpuAotFinder:
+    """
+    CpuAotFinder(variant_dir)
+    Meta path finder resolving imports of `dpctl.tensor` extensions,
+    such as `dpctl.tensor._tensor_impl`, to their variants in directory
+    `variant_dir`. Extensions without a variant are imported as usual.
+    """
+
+    def __init__(self, variant_dir):
+        self.variant_dir = variant_dir
+
+    def find_spec(self, fullname, path=None, target=None):
+        pkg, _, name = fullname.rpartition(".")
+        if pkg != "dpctl.tensor" or not name.startswith("_tensor_"):
+            return None
+        for suffix in importlib.machinery.EXTENSION_SUFFIXES:
+            fn = os.path.join(self.variant_dir, name + suffix)
+            if os.path.isfile(fn):
+                return importlib.util.spec_from_file_location(fullname, fn)
+        return None
+
+
+def install_cpu_aot_finder():
+    """Makes imports of `dpctl.tensor` extensions use variants with
+    ahead-of-time compiled CPU device code, if the host CPU supports
+    their instruction set. Returns the installed finder, or `None`."""
+    for finder in sys.meta_path:
+        if isinstance(finder, CpuAotFinder):
+            return finder
+    d = _select_cpu_aot_dir()
+    if d is None:
+        return None
+    finder = CpuAotFinder(d)
+    sys.meta_path.insert(0, finder)
+    return finder
+
+
+install_cpu_aot_finder()
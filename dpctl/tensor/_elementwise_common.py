@@ -26,7 +26,12 @@ from dpctl.tensor._manipulation_functions import _broadcast_shape_impl
 from dpctl.tensor._usmarray import _is_object_with_buffer_protocol as _is_buffer
 from dpctl.utils import ExecutionPlacementError
 
-from ._copy_utils import _empty_like_orderK, _empty_like_pair_orderK
+from ._copy_utils import (
+    _empty_like_orderK,
+    _empty_like_pair_orderK,
+    _empty_like_triple_orderK,
+)
+from ._stride_tricks import _window_base, _windows_of
 from ._type_utils import (
     _acceptance_fn_default,
     _all_data_types,
@@ -34,6 +39,7 @@ from ._type_utils import (
     _find_buf_dtype2,
     _to_device_supported_dtype,
 )
+from ._usm_advice import prefetch_for_kernel
 
 
 class UnaryElementwiseFunc:
@@ -121,7 +127,18 @@ class UnaryElementwiseFunc:
                     "Input and output allocation queues are not compatible"
                 )
 
+        if out is None:
+            win = _window_base(x)
+            if win is not None and x.size >= 2 * win[0].size:
+                # evaluate the function once per element of overlapping
+                # windows, not once per window holding it
+                base, axes = win
+                res_base = self(base, order="C")
+                res = _windows_of(res_base, axes, x.shape)
+                return dpt.copy(res, order=("C" if order in "KA" else order))
+
         exec_q = x.sycl_queue
+        prefetch_for_kernel(exec_q, x, out)
         if buf_dt is None:
             if out is None:
                 if order == "K":
@@ -488,6 +505,7 @@ class BinaryElementwiseFunc:
                 "supported types according to the casting rule ''safe''."
             )
 
+        prefetch_for_kernel(exec_q, o1, o2, out)
         orig_out = out
         if out is not None:
             if not isinstance(out, dpt.usm_ndarray):
@@ -772,3 +790,213 @@ class BinaryElementwiseFunc:
         )
         dpctl.SyclEvent.wait_for([ht_copy1_ev, ht_copy2_ev, ht_])
         return out
+
+
+def _ternary_common_dtype_default(o1_dtype, o2_dtype, o3_dtype, sycl_dev):
+    "Promotes data types of operands, resolving weak types per NEP-0050"
+    o_dtypes = (o1_dtype, o2_dtype, o3_dtype)
+    strong_dts = [dt for dt in o_dtypes if isinstance(dt, dpt.dtype)]
+    if not strong_dts:
+        raise ValueError
+    strong_dt = _to_device_supported_dtype(
+        np.result_type(*strong_dts), sycl_dev
+    )
+    resolved = []
+    for dt in o_dtypes:
+        if not isinstance(dt, dpt.dtype):
+            dt, _ = _resolve_weak_types(dt, strong_dt, sycl_dev)
+        resolved.append(dt)
+    return _to_device_supported_dtype(np.result_type(*resolved), sycl_dev)
+
+
+class TernaryElementwiseFunc:
+    """
+    Class that implements element-wise functions of three arguments.
+
+    Operands are converted to a common data type, and the function is
+    evaluated by a single kernel, without temporary arrays for results of
+    intermediate operations.
+    """
+
+    def __init__(
+        self,
+        name,
+        result_type_resolver_fn,
+        ternary_dp_impl_fn,
+        docs,
+        common_dtype_fn=None,
+    ):
+        self.__name__ = "TernaryElementwiseFunc"
+        self.name_ = name
+        self.result_type_resolver_fn_ = result_type_resolver_fn
+        self.types_ = None
+        self.ternary_fn_ = ternary_dp_impl_fn
+        self.__doc__ = docs
+        if callable(common_dtype_fn):
+            self.common_dtype_fn_ = common_dtype_fn
+        else:
+            self.common_dtype_fn_ = _ternary_common_dtype_default
+
+    def __str__(self):
+        return f"<{self.__name__} '{self.name_}'>"
+
+    def __repr__(self):
+        return f"<{self.__name__} '{self.name_}'>"
+
+    @property
+    def types(self):
+        types = self.types_
+        if not types:
+            types = []
+            for dt1 in _all_data_types(True, True):
+                dt2 = self.result_type_resolver_fn_(dt1)
+                if dt2:
+                    types.append(f"{dt1.char}{dt1.char}{dt1.char}->{dt2.char}")
+            self.types_ = types
+        return types
+
+    def __call__(self, o1, o2, o3, out=None, order="K"):
+        if order not in ["K", "C", "F", "A"]:
+            order = "K"
+        operands = (o1, o2, o3)
+        queues_usm_types = [_get_queue_usm_type(o) for o in operands]
+        alloc_qs = [q for q, _ in queues_usm_types if q is not None]
+        if not alloc_qs:
+            raise ExecutionPlacementError(
+                "Execution placement can not be unambiguously inferred "
+                "from input arguments. "
+                "One of the arguments must represent USM allocation and "
+                "expose `__sycl_usm_array_interface__` property"
+            )
+        exec_q = dpctl.utils.get_execution_queue(alloc_qs)
+        if exec_q is None:
+            raise ExecutionPlacementError(
+                "Execution placement can not be unambiguously inferred "
+                "from input arguments."
+            )
+        res_usm_type = dpctl.utils.get_coerced_usm_type(
+            [usm_type for q, usm_type in queues_usm_types if q is not None]
+        )
+        dpctl.utils.validate_usm_type(res_usm_type, allow_none=False)
+        o_shapes = [_get_shape(o) for o in operands]
+        if not all(isinstance(s, (tuple, list)) for s in o_shapes):
+            raise TypeError(
+                "Shape of arguments can not be inferred. "
+                "Arguments are expected to be "
+                "lists, tuples, or both"
+            )
+        try:
+            res_shape = _broadcast_shape_impl(o_shapes)
+        except ValueError:
+            raise ValueError(
+                "operands could not be broadcast together with shapes "
+                f"{o_shapes[0]}, {o_shapes[1]} and {o_shapes[2]}"
+            )
+        sycl_dev = exec_q.sycl_device
+        o_dtypes = [_get_dtype(o, sycl_dev) for o in operands]
+        if not all(_validate_dtype(o) for o in o_dtypes):
+            raise ValueError("Operands have unsupported data types")
+
+        common_dt = self.common_dtype_fn_(*o_dtypes, sycl_dev)
+        buf_dt, res_dt = _find_buf_dtype(
+            common_dt, self.result_type_resolver_fn_, sycl_dev
+        )
+        if res_dt is None:
+            raise TypeError(
+                f"function '{self.name_}' does not support input types "
+                f"({o_dtypes[0]}, {o_dtypes[1]}, {o_dtypes[2]}), "
+                "and the inputs could not be safely coerced to any "
+                "supported types according to the casting rule ''safe''."
+            )
+        # data type of arguments of the kernel
+        arg_dt = common_dt if buf_dt is None else buf_dt
+
+        prefetch_for_kernel(exec_q, o1, o2, o3, out)
+        orig_out = out
+        if out is not None:
+            if not isinstance(out, dpt.usm_ndarray):
+                raise TypeError(
+                    f"output array must be of usm_ndarray type, got {type(out)}"
+                )
+
+            if out.shape != res_shape:
+                raise ValueError(
+                    "The shape of input and output arrays are inconsistent. "
+                    f"Expected output shape is {res_shape}, got {out.shape}"
+                )
+
+            if res_dt != out.dtype:
+                raise TypeError(
+                    f"Output array of type {res_dt} is needed,"
+                    f" got {out.dtype}"
+                )
+
+            if (
+                dpctl.utils.get_execution_queue((exec_q, out.sycl_queue))
+                is None
+            ):
+                raise ExecutionPlacementError(
+                    "Input and output allocation queues are not compatible"
+                )
+
+            for o in operands:
+                if (
+                    isinstance(o, dpt.usm_ndarray)
+                    and o.dtype == arg_dt
+                    and ti._array_overlap(o, out)
+                    and not ti._same_logical_tensors(o, out)
+                ):
+                    # Allocate a temporary buffer to avoid memory overlapping.
+                    out = dpt.empty_like(out)
+                    break
+
+        # operands of other data types are cast to the common data type,
+        # scalars become 0d arrays broadcast by the kernel
+        srcs = []
+        for o in operands:
+            if isinstance(o, dpt.usm_ndarray) and o.dtype == arg_dt:
+                srcs.append(o)
+            else:
+                srcs.append(dpt.asarray(o, dtype=arg_dt, sycl_queue=exec_q))
+
+        if out is None:
+            if order == "K":
+                out = _empty_like_triple_orderK(
+                    *srcs, res_dt, res_shape, res_usm_type, exec_q
+                )
+            else:
+                if order == "A":
+                    order = (
+                        "F" if all(s.flags.f_contiguous for s in srcs) else "C"
+                    )
+                out = dpt.empty(
+                    res_shape,
+                    dtype=res_dt,
+                    usm_type=res_usm_type,
+                    sycl_queue=exec_q,
+                    order=order,
+                )
+
+        srcs = [
+            s if s.shape == res_shape else dpt.broadcast_to(s, res_shape)
+            for s in srcs
+        ]
+        ht_ternary_ev, ternary_ev = self.ternary_fn_(
+            src1=srcs[0],
+            src2=srcs[1],
+            src3=srcs[2],
+            dst=out,
+            sycl_queue=exec_q,
+        )
+        if not (orig_out is None or orig_out is out):
+            # Copy the out data from temporary buffer to original memory
+            ht_copy_out_ev, _ = ti._copy_usm_ndarray_into_usm_ndarray(
+                src=out,
+                dst=orig_out,
+                sycl_queue=exec_q,
+                depends=[ternary_ev],
+            )
+            ht_copy_out_ev.wait()
+            out = orig_out
+        ht_ternary_ev.wait()
+        return out
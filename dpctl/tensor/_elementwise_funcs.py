@@ -14,9 +14,14 @@
 #  See the License for the specific language governing permissions and
 #  limitations under the License.
 
-import dpctl.tensor._tensor_impl as ti
+import dpctl.tensor as dpt
+import dpctl.tensor._tensor_elementwise_impl as tei
 
-from ._elementwise_common import BinaryElementwiseFunc, UnaryElementwiseFunc
+from ._elementwise_common import (
+    BinaryElementwiseFunc,
+    TernaryElementwiseFunc,
+    UnaryElementwiseFunc,
+)
 from ._type_utils import _acceptance_fn_divide
 
 # U01: ==== ABS    (x)
@@ -44,7 +49,9 @@ Returns:
         precision matches the precision of `x`.
 """
 
-abs = UnaryElementwiseFunc("abs", ti._abs_result_type, ti._abs, _abs_docstring_)
+abs = UnaryElementwiseFunc(
+    "abs", tei._abs_result_type, tei._abs, _abs_docstring_
+)
 
 # U02: ==== ACOS   (x)
 _acos_docstring = """
@@ -69,7 +76,7 @@ Returns:
 """
 
 acos = UnaryElementwiseFunc(
-    "acos", ti._acos_result_type, ti._acos, _acos_docstring
+    "acos", tei._acos_result_type, tei._acos, _acos_docstring
 )
 
 # U03: ===== ACOSH (x)
@@ -95,7 +102,7 @@ Returns:
 """
 
 acosh = UnaryElementwiseFunc(
-    "acosh", ti._acosh_result_type, ti._acosh, _acosh_docstring
+    "acosh", tei._acosh_result_type, tei._acosh, _acosh_docstring
 )
 
 # B01: ===== ADD   (x1, x2)
@@ -124,10 +131,10 @@ Returns:
 """
 add = BinaryElementwiseFunc(
     "add",
-    ti._add_result_type,
-    ti._add,
+    tei._add_result_type,
+    tei._add,
     _add_docstring_,
-    binary_inplace_fn=ti._add_inplace,
+    binary_inplace_fn=tei._add_inplace,
 )
 
 # U04: ===== ASIN  (x)
@@ -153,7 +160,7 @@ Returns:
 """
 
 asin = UnaryElementwiseFunc(
-    "asin", ti._asin_result_type, ti._asin, _asin_docstring
+    "asin", tei._asin_result_type, tei._asin, _asin_docstring
 )
 
 # U05: ===== ASINH (x)
@@ -179,7 +186,7 @@ Returns:
 """
 
 asinh = UnaryElementwiseFunc(
-    "asinh", ti._asinh_result_type, ti._asinh, _asinh_docstring
+    "asinh", tei._asinh_result_type, tei._asinh, _asinh_docstring
 )
 
 # U06: ===== ATAN  (x)
@@ -205,7 +212,7 @@ Returns:
 """
 
 atan = UnaryElementwiseFunc(
-    "atan", ti._atan_result_type, ti._atan, _atan_docstring
+    "atan", tei._atan_result_type, tei._atan, _atan_docstring
 )
 
 # B02: ===== ATAN2 (x1, x2)
@@ -237,7 +244,7 @@ Returns:
 """
 
 atan2 = BinaryElementwiseFunc(
-    "atan2", ti._atan2_result_type, ti._atan2, _atan2_docstring_
+    "atan2", tei._atan2_result_type, tei._atan2, _atan2_docstring_
 )
 
 # U07: ===== ATANH (x)
@@ -263,7 +270,7 @@ Returns:
 """
 
 atanh = UnaryElementwiseFunc(
-    "atanh", ti._atanh_result_type, ti._atanh, _atanh_docstring
+    "atanh", tei._atanh_result_type, tei._atanh, _atanh_docstring
 )
 
 # B03: ===== BITWISE_AND           (x1, x2)
@@ -294,8 +301,8 @@ Returns:
 
 bitwise_and = BinaryElementwiseFunc(
     "bitwise_and",
-    ti._bitwise_and_result_type,
-    ti._bitwise_and,
+    tei._bitwise_and_result_type,
+    tei._bitwise_and,
     _bitwise_and_docstring_,
 )
 
@@ -327,8 +334,8 @@ Returns:
 
 bitwise_left_shift = BinaryElementwiseFunc(
     "bitwise_left_shift",
-    ti._bitwise_left_shift_result_type,
-    ti._bitwise_left_shift,
+    tei._bitwise_left_shift_result_type,
+    tei._bitwise_left_shift,
     _bitwise_left_shift_docstring_,
 )
 
@@ -357,8 +364,8 @@ Returns:
 
 bitwise_invert = UnaryElementwiseFunc(
     "bitwise_invert",
-    ti._bitwise_invert_result_type,
-    ti._bitwise_invert,
+    tei._bitwise_invert_result_type,
+    tei._bitwise_invert,
     _bitwise_invert_docstring,
 )
 
@@ -390,8 +397,8 @@ Returns:
 
 bitwise_or = BinaryElementwiseFunc(
     "bitwise_or",
-    ti._bitwise_or_result_type,
-    ti._bitwise_or,
+    tei._bitwise_or_result_type,
+    tei._bitwise_or,
     _bitwise_or_docstring_,
 )
 
@@ -422,8 +429,8 @@ Returns:
 
 bitwise_right_shift = BinaryElementwiseFunc(
     "bitwise_right_shift",
-    ti._bitwise_right_shift_result_type,
-    ti._bitwise_right_shift,
+    tei._bitwise_right_shift_result_type,
+    tei._bitwise_right_shift,
     _bitwise_right_shift_docstring_,
 )
 
@@ -456,8 +463,8 @@ Returns:
 
 bitwise_xor = BinaryElementwiseFunc(
     "bitwise_xor",
-    ti._bitwise_xor_result_type,
-    ti._bitwise_xor,
+    tei._bitwise_xor_result_type,
+    tei._bitwise_xor,
     _bitwise_xor_docstring_,
 )
 
@@ -485,7 +492,7 @@ Returns:
 """
 
 ceil = UnaryElementwiseFunc(
-    "ceil", ti._ceil_result_type, ti._ceil, _ceil_docstring
+    "ceil", tei._ceil_result_type, tei._ceil, _ceil_docstring
 )
 
 # U10: ==== CONJ          (x)
@@ -510,7 +517,7 @@ Returns:
 """
 
 conj = UnaryElementwiseFunc(
-    "conj", ti._conj_result_type, ti._conj, _conj_docstring
+    "conj", tei._conj_result_type, tei._conj, _conj_docstring
 )
 
 # U11: ==== COS           (x)
@@ -534,7 +541,9 @@ Returns:
         of the returned array is determined by the Type Promotion Rules.
 """
 
-cos = UnaryElementwiseFunc("cos", ti._cos_result_type, ti._cos, _cos_docstring)
+cos = UnaryElementwiseFunc(
+    "cos", tei._cos_result_type, tei._cos, _cos_docstring
+)
 
 # U12: ==== COSH          (x)
 _cosh_docstring = """
@@ -558,7 +567,7 @@ Returns:
 """
 
 cosh = UnaryElementwiseFunc(
-    "cosh", ti._cosh_result_type, ti._cosh, _cosh_docstring
+    "cosh", tei._cosh_result_type, tei._cosh, _cosh_docstring
 )
 
 # B08: ==== DIVIDE        (x1, x2)
@@ -587,8 +596,8 @@ Returns:
 
 divide = BinaryElementwiseFunc(
     "divide",
-    ti._divide_result_type,
-    ti._divide,
+    tei._divide_result_type,
+    tei._divide,
     _divide_docstring_,
     acceptance_fn=_acceptance_fn_divide,
 )
@@ -618,7 +627,7 @@ Returns:
 """
 
 equal = BinaryElementwiseFunc(
-    "equal", ti._equal_result_type, ti._equal, _equal_docstring_
+    "equal", tei._equal_result_type, tei._equal, _equal_docstring_
 )
 
 # U13: ==== EXP           (x)
@@ -643,7 +652,9 @@ Returns:
         the Type Promotion Rules.
 """
 
-exp = UnaryElementwiseFunc("exp", ti._exp_result_type, ti._exp, _exp_docstring)
+exp = UnaryElementwiseFunc(
+    "exp", tei._exp_result_type, tei._exp, _exp_docstring
+)
 
 # U14: ==== EXPM1         (x)
 _expm1_docstring = """
@@ -666,7 +677,7 @@ Return:
 """
 
 expm1 = UnaryElementwiseFunc(
-    "expm1", ti._expm1_result_type, ti._expm1, _expm1_docstring
+    "expm1", tei._expm1_result_type, tei._expm1, _expm1_docstring
 )
 
 # U15: ==== FLOOR         (x)
@@ -692,7 +703,7 @@ Returns:
 """
 
 floor = UnaryElementwiseFunc(
-    "floor", ti._floor_result_type, ti._floor, _floor_docstring
+    "floor", tei._floor_result_type, tei._floor, _floor_docstring
 )
 
 # B10: ==== FLOOR_DIVIDE  (x1, x2)
@@ -717,8 +728,8 @@ Returns:
 
 floor_divide = BinaryElementwiseFunc(
     "floor_divide",
-    ti._floor_divide_result_type,
-    ti._floor_divide,
+    tei._floor_divide_result_type,
+    tei._floor_divide,
     _floor_divide_docstring_,
 )
 
@@ -745,7 +756,7 @@ Returns:
 """
 
 greater = BinaryElementwiseFunc(
-    "greater", ti._greater_result_type, ti._greater, _greater_docstring_
+    "greater", tei._greater_result_type, tei._greater, _greater_docstring_
 )
 
 # B12: ==== GREATER_EQUAL (x1, x2)
@@ -773,8 +784,8 @@ Returns:
 
 greater_equal = BinaryElementwiseFunc(
     "greater_equal",
-    ti._greater_equal_result_type,
-    ti._greater_equal,
+    tei._greater_equal_result_type,
+    tei._greater_equal,
     _greater_equal_docstring_,
 )
 
@@ -803,7 +814,7 @@ Returns:
 """
 
 imag = UnaryElementwiseFunc(
-    "imag", ti._imag_result_type, ti._imag, _imag_docstring
+    "imag", tei._imag_result_type, tei._imag, _imag_docstring
 )
 
 # U17: ==== ISFINITE    (x)
@@ -829,7 +840,7 @@ Returns:
 """
 
 isfinite = UnaryElementwiseFunc(
-    "isfinite", ti._isfinite_result_type, ti._isfinite, _isfinite_docstring_
+    "isfinite", tei._isfinite_result_type, tei._isfinite, _isfinite_docstring_
 )
 
 # U18: ==== ISINF       (x)
@@ -854,7 +865,7 @@ Returns:
 """
 
 isinf = UnaryElementwiseFunc(
-    "isinf", ti._isinf_result_type, ti._isinf, _isinf_docstring_
+    "isinf", tei._isinf_result_type, tei._isinf, _isinf_docstring_
 )
 
 # U19: ==== ISNAN       (x)
@@ -879,7 +890,7 @@ Returns:
 """
 
 isnan = UnaryElementwiseFunc(
-    "isnan", ti._isnan_result_type, ti._isnan, _isnan_docstring_
+    "isnan", tei._isnan_result_type, tei._isnan, _isnan_docstring_
 )
 
 # B13: ==== LESS        (x1, x2)
@@ -907,7 +918,7 @@ Returns:
 """
 
 less = BinaryElementwiseFunc(
-    "less", ti._less_result_type, ti._less, _less_docstring_
+    "less", tei._less_result_type, tei._less, _less_docstring_
 )
 
 # B14: ==== LESS_EQUAL  (x1, x2)
@@ -934,8 +945,8 @@ Returns:
 
 less_equal = BinaryElementwiseFunc(
     "less_equal",
-    ti._less_equal_result_type,
-    ti._less_equal,
+    tei._less_equal_result_type,
+    tei._less_equal,
     _less_equal_docstring_,
 )
 
@@ -959,7 +970,9 @@ Return:
         Promotion Rules.
 """
 
-log = UnaryElementwiseFunc("log", ti._log_result_type, ti._log, _log_docstring)
+log = UnaryElementwiseFunc(
+    "log", tei._log_result_type, tei._log, _log_docstring
+)
 
 # U21: ==== LOG1P       (x)
 _log1p_docstring = """
@@ -981,7 +994,7 @@ Return:
 """
 
 log1p = UnaryElementwiseFunc(
-    "log1p", ti._log1p_result_type, ti._log1p, _log1p_docstring
+    "log1p", tei._log1p_result_type, tei._log1p, _log1p_docstring
 )
 
 # U22: ==== LOG2        (x)
@@ -1007,7 +1020,7 @@ Returns:
 """
 
 log2 = UnaryElementwiseFunc(
-    "log2", ti._log2_result_type, ti._log2, _log2_docstring_
+    "log2", tei._log2_result_type, tei._log2, _log2_docstring_
 )
 
 # U23: ==== LOG10       (x)
@@ -1033,7 +1046,7 @@ Returns:
 """
 
 log10 = UnaryElementwiseFunc(
-    "log10", ti._log10_result_type, ti._log10, _log10_docstring_
+    "log10", tei._log10_result_type, tei._log10, _log10_docstring_
 )
 
 # B15: ==== LOGADDEXP   (x1, x2)
@@ -1061,7 +1074,10 @@ Returns:
 """
 
 logaddexp = BinaryElementwiseFunc(
-    "logaddexp", ti._logaddexp_result_type, ti._logaddexp, _logaddexp_docstring_
+    "logaddexp",
+    tei._logaddexp_result_type,
+    tei._logaddexp,
+    _logaddexp_docstring_,
 )
 
 # B16: ==== LOGICAL_AND (x1, x2)
@@ -1088,8 +1104,8 @@ Returns:
 """
 logical_and = BinaryElementwiseFunc(
     "logical_and",
-    ti._logical_and_result_type,
-    ti._logical_and,
+    tei._logical_and_result_type,
+    tei._logical_and,
     _logical_and_docstring_,
 )
 
@@ -1113,8 +1129,8 @@ Return:
 
 logical_not = UnaryElementwiseFunc(
     "logical_not",
-    ti._logical_not_result_type,
-    ti._logical_not,
+    tei._logical_not_result_type,
+    tei._logical_not,
     _logical_not_docstring,
 )
 
@@ -1142,8 +1158,8 @@ Returns:
 """
 logical_or = BinaryElementwiseFunc(
     "logical_or",
-    ti._logical_or_result_type,
-    ti._logical_or,
+    tei._logical_or_result_type,
+    tei._logical_or,
     _logical_or_docstring_,
 )
 
@@ -1171,8 +1187,8 @@ Returns:
 """
 logical_xor = BinaryElementwiseFunc(
     "logical_xor",
-    ti._logical_xor_result_type,
-    ti._logical_xor,
+    tei._logical_xor_result_type,
+    tei._logical_xor,
     _logical_xor_docstring_,
 )
 
@@ -1201,8 +1217,8 @@ Returns:
 """
 maximum = BinaryElementwiseFunc(
     "maximum",
-    ti._maximum_result_type,
-    ti._maximum,
+    tei._maximum_result_type,
+    tei._maximum,
     _maximum_docstring_,
 )
 
@@ -1231,8 +1247,8 @@ Returns:
 """
 minimum = BinaryElementwiseFunc(
     "minimum",
-    ti._minimum_result_type,
-    ti._minimum,
+    tei._minimum_result_type,
+    tei._minimum,
     _minimum_docstring_,
 )
 
@@ -1261,10 +1277,10 @@ Returns:
 """
 multiply = BinaryElementwiseFunc(
     "multiply",
-    ti._multiply_result_type,
-    ti._multiply,
+    tei._multiply_result_type,
+    tei._multiply,
     _multiply_docstring_,
-    ti._multiply_inplace,
+    tei._multiply_inplace,
 )
 
 # U25: ==== NEGATIVE    (x)
@@ -1287,7 +1303,7 @@ Return:
 """
 
 negative = UnaryElementwiseFunc(
-    "negative", ti._negative_result_type, ti._negative, _negative_docstring_
+    "negative", tei._negative_result_type, tei._negative, _negative_docstring_
 )
 
 # B20: ==== NOT_EQUAL   (x1, x2)
@@ -1315,7 +1331,10 @@ Returns:
 """
 
 not_equal = BinaryElementwiseFunc(
-    "not_equal", ti._not_equal_result_type, ti._not_equal, _not_equal_docstring_
+    "not_equal",
+    tei._not_equal_result_type,
+    tei._not_equal,
+    _not_equal_docstring_,
 )
 
 # U26: ==== POSITIVE    (x)
@@ -1338,7 +1357,7 @@ Return:
 """
 
 positive = UnaryElementwiseFunc(
-    "positive", ti._positive_result_type, ti._positive, _positive_docstring_
+    "positive", tei._positive_result_type, tei._positive, _positive_docstring_
 )
 
 # B21: ==== POW         (x1, x2)
@@ -1359,7 +1378,7 @@ Returns:
         the returned array is determined by the Type Promotion Rules.
 """
 pow = BinaryElementwiseFunc(
-    "pow", ti._pow_result_type, ti._pow, _pow_docstring_
+    "pow", tei._pow_result_type, tei._pow, _pow_docstring_
 )
 
 # U??: ==== PROJ        (x)
@@ -1384,7 +1403,7 @@ Returns:
 """
 
 proj = UnaryElementwiseFunc(
-    "proj", ti._proj_result_type, ti._proj, _proj_docstring
+    "proj", tei._proj_result_type, tei._proj, _proj_docstring
 )
 
 # U27: ==== REAL        (x)
@@ -1412,7 +1431,7 @@ Returns:
 """
 
 real = UnaryElementwiseFunc(
-    "real", ti._real_result_type, ti._real, _real_docstring
+    "real", tei._real_result_type, tei._real, _real_docstring
 )
 
 # B22: ==== REMAINDER   (x1, x2)
@@ -1441,7 +1460,10 @@ Returns:
         the returned array is determined by the Type Promotion Rules.
 """
 remainder = BinaryElementwiseFunc(
-    "remainder", ti._remainder_result_type, ti._remainder, _remainder_docstring_
+    "remainder",
+    tei._remainder_result_type,
+    tei._remainder,
+    _remainder_docstring_,
 )
 
 # U28: ==== ROUND       (x)
@@ -1467,7 +1489,7 @@ Returns:
 """
 
 round = UnaryElementwiseFunc(
-    "round", ti._round_result_type, ti._round, _round_docstring
+    "round", tei._round_result_type, tei._round, _round_docstring
 )
 
 # U29: ==== SIGN        (x)
@@ -1496,7 +1518,7 @@ Returns:
 """
 
 sign = UnaryElementwiseFunc(
-    "sign", ti._sign_result_type, ti._sign, _sign_docstring
+    "sign", tei._sign_result_type, tei._sign, _sign_docstring
 )
 
 # ==== SIGNBIT        (x)
@@ -1522,7 +1544,7 @@ Returns:
 """
 
 signbit = UnaryElementwiseFunc(
-    "signbit", ti._signbit_result_type, ti._signbit, _signbit_docstring
+    "signbit", tei._signbit_result_type, tei._signbit, _signbit_docstring
 )
 
 # U30: ==== SIN         (x)
@@ -1546,7 +1568,9 @@ Returns:
         returned array is determined by the Type Promotion Rules.
 """
 
-sin = UnaryElementwiseFunc("sin", ti._sin_result_type, ti._sin, _sin_docstring)
+sin = UnaryElementwiseFunc(
+    "sin", tei._sin_result_type, tei._sin, _sin_docstring
+)
 
 # U31: ==== SINH        (x)
 _sinh_docstring = """
@@ -1570,7 +1594,7 @@ Returns:
 """
 
 sinh = UnaryElementwiseFunc(
-    "sinh", ti._sinh_result_type, ti._sinh, _sinh_docstring
+    "sinh", tei._sinh_result_type, tei._sinh, _sinh_docstring
 )
 
 # U32: ==== SQUARE      (x)
@@ -1595,7 +1619,7 @@ Returns:
 """
 
 square = UnaryElementwiseFunc(
-    "square", ti._square_result_type, ti._square, _square_docstring_
+    "square", tei._square_result_type, tei._square, _square_docstring_
 )
 
 # U33: ==== SQRT        (x)
@@ -1621,7 +1645,7 @@ Returns:
 """
 
 sqrt = UnaryElementwiseFunc(
-    "sqrt", ti._sqrt_result_type, ti._sqrt, _sqrt_docstring_
+    "sqrt", tei._sqrt_result_type, tei._sqrt, _sqrt_docstring_
 )
 
 # B23: ==== SUBTRACT    (x1, x2)
@@ -1649,10 +1673,10 @@ Returns:
 """
 subtract = BinaryElementwiseFunc(
     "subtract",
-    ti._subtract_result_type,
-    ti._subtract,
+    tei._subtract_result_type,
+    tei._subtract,
     _subtract_docstring_,
-    ti._subtract_inplace,
+    tei._subtract_inplace,
 )
 
 
@@ -1677,7 +1701,9 @@ Returns:
         of the returned array is determined by the Type Promotion Rules.
 """
 
-tan = UnaryElementwiseFunc("tan", ti._tan_result_type, ti._tan, _tan_docstring)
+tan = UnaryElementwiseFunc(
+    "tan", tei._tan_result_type, tei._tan, _tan_docstring
+)
 
 # U35: ==== TANH        (x)
 _tanh_docstring = """
@@ -1701,7 +1727,7 @@ Returns:
 """
 
 tanh = UnaryElementwiseFunc(
-    "tanh", ti._tanh_result_type, ti._tanh, _tanh_docstring
+    "tanh", tei._tanh_result_type, tei._tanh, _tanh_docstring
 )
 
 # U36: ==== TRUNC       (x)
@@ -1728,7 +1754,7 @@ Returns:
         of the returned array is determined by the Type Promotion Rules.
 """
 trunc = UnaryElementwiseFunc(
-    "trunc", ti._trunc_result_type, ti._trunc, _trunc_docstring
+    "trunc", tei._trunc_result_type, tei._trunc, _trunc_docstring
 )
 
 
@@ -1757,5 +1783,150 @@ Returns:
 """
 
 hypot = BinaryElementwiseFunc(
-    "hypot", ti._hypot_result_type, ti._hypot, _hypot_docstring_
+    "hypot", tei._hypot_result_type, tei._hypot, _hypot_docstring_
+)
+
+
+# T01: ==== CLIP        (x, min, max)
+_clip_docstring_ = """
+clip(x, min=None, max=None, out=None, order='K')
+
+Clamps each element `x_i` of the input array `x` to the range
+[`min_i`, `max_i`]. Bounds are evaluated together with `x` by a single
+kernel.
+
+Args:
+    x (usm_ndarray):
+        Input array, expected to have a real-valued data type.
+    min ({None, usm_ndarray, scalar}, optional):
+        Lower bound, broadcast against `x` and cast to the data type of `x`.
+        If `None`, no lower bound is applied. Default: `None`.
+    max ({None, usm_ndarray, scalar}, optional):
+        Upper bound, broadcast against `x` and cast to the data type of `x`.
+        If `None`, no upper bound is applied. Default: `None`.
+    out ({None, usm_ndarray}, optional):
+        Output array to populate.
+        Array have the correct shape and the expected data type.
+    order ("C","F","A","K", optional):
+        Memory layout of the newly output array, if parameter `out` is `None`.
+        Default: "K".
+Returns:
+    usm_narray:
+        An array containing the element-wise clamped values. NaN values in
+        any of the arguments propagate to the result. The returned array
+        has the same data type as `x`.
+"""
+
+
+def _clip_common_dtype(x_dtype, min_dtype, max_dtype, sycl_dev):
+    "Bounds are cast to the data type of `x`"
+    return x_dtype
+
+
+_clip = TernaryElementwiseFunc(
+    "clip",
+    tei._clip_result_type,
+    tei._clip,
+    _clip_docstring_,
+    common_dtype_fn=_clip_common_dtype,
+)
+
+
+def _clip_bound(b, x):
+    """Casts bound `b` to the data type of `x`, so that one-sided clips
+    evaluated by `minimum` or `maximum` do not promote it"""
+    if isinstance(b, dpt.usm_ndarray):
+        return dpt.astype(b, x.dtype, copy=False)
+    return dpt.asarray(
+        b, dtype=x.dtype, usm_type=x.usm_type, sycl_queue=x.sycl_queue
+    )
+
+
+def clip(x, min=None, max=None, out=None, order="K"):
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    if x.dtype.kind not in "iuf":
+        raise TypeError(
+            f"function 'clip' does not support input type ({x.dtype})"
+        )
+    if min is None and max is None:
+        if out is None:
+            return dpt.copy(x, order=order)
+        out[...] = x
+        return out
+    if min is None:
+        return minimum(x, _clip_bound(max, x), out=out, order=order)
+    if max is None:
+        return maximum(x, _clip_bound(min, x), out=out, order=order)
+    return _clip(x, min, max, out=out, order=order)
+
+
+clip.__doc__ = _clip_docstring_
+
+
+# T02: ==== FMA         (x1, x2, x3)
+_fma_docstring_ = """
+fma(x1, x2, x3, out=None, order='K')
+
+Computes `x1_i * x2_i + x3_i` for each element of the input arrays, as if
+with infinite precision, rounding only the final result.
+
+Args:
+    x1 (usm_ndarray):
+        First input array, expected to have a floating-point data type.
+    x2 (usm_ndarray):
+        Second input array, expected to have a floating-point data type.
+    x3 (usm_ndarray):
+        Third input array, expected to have a floating-point data type.
+    out ({None, usm_ndarray}, optional):
+        Output array to populate.
+        Array have the correct shape and the expected data type.
+    order ("C","F","A","K", optional):
+        Memory layout of the newly output array, if parameter `out` is `None`.
+        Default: "K".
+Returns:
+    usm_narray:
+        An array containing the element-wise results. The data type of the
+        returned array is determined by the Type Promotion Rules. For
+        complex data types, the product is rounded before the addition.
+"""
+
+fma = TernaryElementwiseFunc(
+    "fma", tei._fma_result_type, tei._fma, _fma_docstring_
+)
+
+
+# T03: ==== LERP        (start, end, w)
+_lerp_docstring_ = """
+lerp(start, end, weight, out=None, order='K')
+
+Computes linear interpolation `start_i + weight_i * (end_i - start_i)` for
+each element of the input arrays. The result is exact for `weight_i` equal
+to 0 or 1.
+
+Args:
+    start (usm_ndarray):
+        Array of start points, expected to have a real-valued floating-point
+        data type.
+    end (usm_ndarray):
+        Array of end points, expected to have a real-valued floating-point
+        data type.
+    weight (usm_ndarray):
+        Array of interpolation weights, expected to have a real-valued
+        floating-point data type.
+    out ({None, usm_ndarray}, optional):
+        Output array to populate.
+        Array have the correct shape and the expected data type.
+    order ("C","F","A","K", optional):
+        Memory layout of the newly output array, if parameter `out` is `None`.
+        Default: "K".
+Returns:
+    usm_narray:
+        An array containing the element-wise interpolated values. The data
+        type of the returned array is determined by the Type Promotion
+        Rules.
+"""
+
+lerp = TernaryElementwiseFunc(
+    "lerp", tei._lerp_result_type, tei._lerp, _lerp_docstring_
 )
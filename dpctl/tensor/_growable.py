@@ -0,0 +1,237 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import math
+import operator
+
+import numpy as np
+
+import dpctl.tensor as dpt
+
+__doc__ = "Implementation of usm_ndarray growable along its first axis"
+
+
+class GrowableArray:
+    """GrowableArray(record_shape=(), dtype=None, *, capacity=0, \
+growth_factor=2, device=None, usm_type="device", sycl_queue=None)
+
+    Array growing along its first axis, to which records of shape
+    `record_shape` are appended, e.g. batches of a stream.
+
+    Records are stored in a USM allocation with room for `capacity`
+    records. When an append does not fit, the allocation is replaced with
+    one `growth_factor` times larger, or large enough for the append, and
+    filled records are copied over. Appending `k` records thus takes
+    amortized `O(k)` time, whereas concatenating each batch to an array of
+    `n` records takes `O(n + k)`.
+
+    :meth:`view` gives a read-only :class:`dpctl.tensor.usm_ndarray` of
+    records filled so far without copying them. A view remains valid after
+    further appends, but only sees records filled when it was taken, until
+    :meth:`clear` lets appends overwrite them.
+
+    :Example:
+        .. code-block:: python
+
+            import dpctl.tensor as dpt
+
+            acc = dpt.GrowableArray((3,), dtype="f4")
+            for batch in stream:
+                acc.append(batch)
+            total = dpt.sum(acc.view(), axis=0)
+
+    Args:
+        record_shape (Tuple[int, ...]):
+            shape of a record. Default: `()`.
+        dtype (optional):
+            data type of records, as for :func:`dpctl.tensor.empty`.
+            Default: `None`.
+        capacity (int):
+            number of records to allocate room for initially. Default: `0`.
+        growth_factor (float):
+            factor by which the capacity grows, greater than `1`.
+            Default: `2`.
+        device, usm_type, sycl_queue:
+            placement of the allocation, as for :func:`dpctl.tensor.empty`.
+    """
+
+    def __init__(
+        self,
+        record_shape=(),
+        dtype=None,
+        *,
+        capacity=0,
+        growth_factor=2,
+        device=None,
+        usm_type="device",
+        sycl_queue=None,
+    ):
+        if isinstance(record_shape, (tuple, list)):
+            record_shape = tuple(operator.index(s) for s in record_shape)
+        else:
+            record_shape = (operator.index(record_shape),)
+        if any(s < 0 for s in record_shape):
+            raise ValueError(
+                f"`record_shape` must be non-negative, got {record_shape}"
+            )
+        capacity = operator.index(capacity)
+        if capacity < 0:
+            raise ValueError(
+                f"`capacity` must be non-negative, got {capacity}"
+            )
+        if not growth_factor > 1:
+            raise ValueError(
+                f"`growth_factor` must be greater than 1, got {growth_factor}"
+            )
+        self._record_shape = record_shape
+        self._growth_factor = growth_factor
+        self._buf = dpt.empty(
+            (capacity,) + record_shape,
+            dtype=dtype,
+            device=device,
+            usm_type=usm_type,
+            sycl_queue=sycl_queue,
+        )
+        self._size = 0
+
+    def __repr__(self):
+        return (
+            f"GrowableArray(len={self._size}, capacity={self.capacity}, "
+            f"record_shape={self._record_shape}, dtype={self.dtype})"
+        )
+
+    def __len__(self):
+        return self._size
+
+    @property
+    def capacity(self):
+        "Number of records the current allocation has room for"
+        return self._buf.shape[0]
+
+    @property
+    def record_shape(self):
+        "Shape of a record"
+        return self._record_shape
+
+    @property
+    def shape(self):
+        "Shape of the array of filled records"
+        return (self._size,) + self._record_shape
+
+    @property
+    def dtype(self):
+        "Data type of records"
+        return self._buf.dtype
+
+    @property
+    def usm_type(self):
+        "USM type of the allocation"
+        return self._buf.usm_type
+
+    @property
+    def sycl_queue(self):
+        "Queue the allocation is associated with"
+        return self._buf.sycl_queue
+
+    @property
+    def device(self):
+        "Device of the allocation"
+        return self._buf.device
+
+    def reserve(self, capacity):
+        """reserve(capacity)
+
+        Makes room for at least `capacity` records, so that appends up to
+        that many records do not reallocate.
+        """
+        capacity = operator.index(capacity)
+        if capacity > self.capacity:
+            self._reallocate(capacity)
+
+    def shrink_to_fit(self):
+        """shrink_to_fit()
+
+        Replaces the allocation with one just large enough for the filled
+        records.
+        """
+        if self._size < self.capacity:
+            self._reallocate(self._size)
+
+    def clear(self):
+        """clear()
+
+        Discards filled records, keeping the allocation.
+        """
+        self._size = 0
+
+    def _reallocate(self, capacity):
+        old = self._buf
+        self._buf = dpt.empty(
+            (capacity,) + self._record_shape,
+            dtype=old.dtype,
+            usm_type=old.usm_type,
+            sycl_queue=old.sycl_queue,
+        )
+        if self._size:
+            self._buf[: self._size] = old[: self._size]
+
+    def append(self, values):
+        """append(values)
+
+        Appends a record of shape `record_shape`, or a batch of records of
+        shape `(k,) + record_shape`, to filled records. Values are cast to
+        the data type of the array, as by assignment into a
+        :class:`dpctl.tensor.usm_ndarray`.
+
+        Args:
+            values (Union[usm_ndarray, numpy.ndarray, Sequence, scalar]):
+                record or batch of records.
+        """
+        if not isinstance(values, dpt.usm_ndarray):
+            if hasattr(values, "__sycl_usm_array_interface__"):
+                values = dpt.asarray(values)
+            else:
+                values = np.asarray(values)
+        rs = self._record_shape
+        if values.shape == rs:
+            values = values[np.newaxis, ...]
+        elif values.shape[1:] != rs:
+            raise ValueError(
+                f"Expected record of shape {rs} or batch of records of "
+                f"shape (k,) + {rs}, got shape {values.shape}"
+            )
+        k = values.shape[0]
+        if k == 0:
+            return
+        n = self._size
+        if n + k > self.capacity:
+            self._reallocate(
+                max(n + k, math.ceil(self.capacity * self._growth_factor))
+            )
+        self._buf[n : n + k] = values
+        self._size = n + k
+
+    def view(self):
+        """view()
+
+        Returns:
+            usm_ndarray:
+                read-only view of shape `(len(self),) + record_shape` of
+                filled records.
+        """
+        v = self._buf[: self._size]
+        v.flags.writable = False
+        return v
@@ -21,7 +21,7 @@ from numpy.core.numeric import normalize_axis_index
 
 import dpctl
 import dpctl.tensor as dpt
-import dpctl.tensor._tensor_impl as ti
+from dpctl.tensor._lazy_extension import tensor_indexing_impl as tii
 
 from ._copy_utils import _extract_impl, _nonzero_impl
 
@@ -114,7 +114,7 @@ def take(x, indices, /, *, axis=None, mode="wrap"):
         res_shape, dtype=x.dtype, usm_type=res_usm_type, sycl_queue=exec_q
     )
 
-    hev, _ = ti._take(x, (indices,), res, axis, mode, sycl_queue=exec_q)
+    hev, _ = tii._take(x, (indices,), res, axis, mode, sycl_queue=exec_q)
     hev.wait()
 
     return res
@@ -210,7 +210,7 @@ def put(x, indices, vals, /, *, axis=None, mode="wrap"):
 
     vals = dpt.broadcast_to(vals, val_shape)
 
-    hev, _ = ti._put(x, (indices,), vals, axis, mode, sycl_queue=exec_q)
+    hev, _ = tii._put(x, (indices,), vals, axis, mode, sycl_queue=exec_q)
     hev.wait()
 
 
@@ -301,7 +301,7 @@ def place(arr, mask, vals):
     if arr.shape != mask.shape or vals.ndim != 1:
         raise ValueError("Array sizes are not as required")
     cumsum = dpt.empty(mask.size, dtype="i8", sycl_queue=exec_q)
-    nz_count = ti.mask_positions(mask, cumsum, sycl_queue=exec_q)
+    nz_count = tii.mask_positions(mask, cumsum, sycl_queue=exec_q)
     if nz_count == 0:
         return
     if vals.size == 0:
@@ -310,7 +310,7 @@ def place(arr, mask, vals):
         rhs = vals
     else:
         rhs = dpt.astype(vals, arr.dtype)
-    hev, _ = ti._place(
+    hev, _ = tii._place(
         dst=arr,
         cumsum=cumsum,
         axis_start=0,
@@ -0,0 +1,69 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import importlib
+
+__doc__ = (
+    "Stand-ins for extensions of `dpctl.tensor` with kernels of a single "
+    "function family, which are imported on first use."
+)
+
+
+class LazyExtension:
+    """
+    LazyExtension(name)
+    Stand-in for extension module `name`, which is imported on first
+    access of any of its attributes.
+
+    Once the module is imported, its attributes are copied into the
+    stand-in, so that further accesses cost the same as accesses of
+    module attributes. Attributes set on the stand-in, e.g. by
+    :class:`dpctl.utils.TensorProfiler`, take precedence over those of
+    the module.
+    """
+
+    def __init__(self, name):
+        self.__dict__["_lazy_name_"] = name
+
+    def _load(self):
+        "Imports the extension module, if needed, and returns it"
+        mod = importlib.import_module(self._lazy_name_)
+        d = self.__dict__
+        for k, v in vars(mod).items():
+            if not k.startswith("__"):
+                d.setdefault(k, v)
+        return mod
+
+    def __getattr__(self, name):
+        # only called for attributes not yet copied from the module
+        if name.startswith("__"):
+            raise AttributeError(name)
+        return getattr(self._load(), name)
+
+    def __dir__(self):
+        return dir(self._load())
+
+    def __repr__(self):
+        return f"<LazyExtension '{self._lazy_name_}'>"
+
+
+tensor_elementwise_impl = LazyExtension(
+    "dpctl.tensor._tensor_elementwise_impl"
+)
+tensor_indexing_impl = LazyExtension("dpctl.tensor._tensor_indexing_impl")
+tensor_reductions_impl = LazyExtension("dpctl.tensor._tensor_reductions_impl")
+tensor_sorting_impl = LazyExtension("dpctl.tensor._tensor_sorting_impl")
+tensor_random_impl = LazyExtension("dpctl.tensor._tensor_random_impl")
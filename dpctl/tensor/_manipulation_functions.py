@@ -26,6 +26,8 @@ import dpctl
 import dpctl.tensor as dpt
 import dpctl.tensor._tensor_impl as ti
 import dpctl.utils as dputils
+from dpctl.tensor._lazy_extension import tensor_indexing_impl as tii
+from dpctl.tensor._usmarray import _strided_view
 
 from ._copy_utils import _broadcast_strides
 from ._type_utils import _to_device_supported_dtype
@@ -199,13 +201,7 @@ def permute_dims(X, axes):
         )
     newstrides = tuple(X.strides[i] for i in axes)
     newshape = tuple(X.shape[i] for i in axes)
-    return dpt.usm_ndarray(
-        shape=newshape,
-        dtype=X.dtype,
-        buffer=X,
-        strides=newstrides,
-        offset=X.__sycl_usm_array_interface__.get("offset", 0),
-    )
+    return _strided_view(X, newshape, newstrides)
 
 
 def expand_dims(X, axis):
@@ -325,13 +321,7 @@ def broadcast_to(X, shape):
         np.broadcast_to(np.empty(tuple(), dtype="u1"), X.shape), shape
     )
     new_sts = _broadcast_strides(X.shape, X.strides, new_array.ndim)
-    return dpt.usm_ndarray(
-        shape=new_array.shape,
-        dtype=X.dtype,
-        buffer=X,
-        strides=new_sts,
-        offset=X.__sycl_usm_array_interface__.get("offset", 0),
-    )
+    return _strided_view(X, new_array.shape, new_sts)
 
 
 def broadcast_arrays(*args):
@@ -1052,7 +1042,7 @@ def repeat(x, repeats, axis=None):
             res_shape, dtype=x.dtype, usm_type=usm_type, sycl_queue=exec_q
         )
         if res_axis_size > 0:
-            ht_rep_ev, _ = ti._repeat_by_scalar(
+            ht_rep_ev, _ = tii._repeat_by_scalar(
                 src=x,
                 dst=res,
                 reps=repeats,
@@ -1078,7 +1068,7 @@ def repeat(x, repeats, axis=None):
                 sycl_queue=exec_q,
             )
             # _cumsum_1d synchronizes so `depends` ends here safely
-            res_axis_size = ti._cumsum_1d(
+            res_axis_size = tii._cumsum_1d(
                 rep_buf, cumsum, sycl_queue=exec_q, depends=[copy_ev]
             )
             res_shape = x_shape[:axis] + (res_axis_size,) + x_shape[axis + 1 :]
@@ -1086,7 +1076,7 @@ def repeat(x, repeats, axis=None):
                 res_shape, dtype=x.dtype, usm_type=usm_type, sycl_queue=exec_q
             )
             if res_axis_size > 0:
-                ht_rep_ev, _ = ti._repeat_by_sequence(
+                ht_rep_ev, _ = tii._repeat_by_sequence(
                     src=x,
                     dst=res,
                     reps=rep_buf,
@@ -1104,13 +1094,13 @@ def repeat(x, repeats, axis=None):
                 sycl_queue=exec_q,
             )
             # _cumsum_1d synchronizes so `depends` ends here safely
-            res_axis_size = ti._cumsum_1d(repeats, cumsum, sycl_queue=exec_q)
+            res_axis_size = tii._cumsum_1d(repeats, cumsum, sycl_queue=exec_q)
             res_shape = x_shape[:axis] + (res_axis_size,) + x_shape[axis + 1 :]
             res = dpt.empty(
                 res_shape, dtype=x.dtype, usm_type=usm_type, sycl_queue=exec_q
             )
             if res_axis_size > 0:
-                ht_rep_ev, _ = ti._repeat_by_sequence(
+                ht_rep_ev, _ = tii._repeat_by_sequence(
                     src=x,
                     dst=res,
                     reps=repeats,
@@ -0,0 +1,236 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+
+import numpy as np
+from numpy.lib import format as npy_format
+
+import dpctl.memory as dpm
+import dpctl.tensor as dpt
+
+__doc__ = (
+    "Implementation of functions to load and save "
+    ":class:`dpctl.tensor.usm_ndarray` in NumPy `.npy` format"
+)
+
+# size of each of the two host staging buffers
+_staging_nbytes = 1 << 24
+
+
+def _open(file, mode):
+    "Returns file object and a flag whether it must be closed by the caller"
+    if isinstance(file, (str, bytes, os.PathLike)):
+        return open(file, mode), True
+    return file, False
+
+
+def _byte_view(X):
+    """Returns 1D usm_ndarray of bytes viewing memory of C- or F-contiguous
+    usm_ndarray `X`"""
+    mem = dpm.as_usm_memory(X)
+    return dpt.usm_ndarray((mem.nbytes,), dtype="u1", buffer=mem)
+
+
+def _staging_buffers(nbytes, itemsize, exec_q):
+    "Allocates pair of USM-host buffers holding whole number of elements"
+    chunk = max(itemsize, (_staging_nbytes // itemsize) * itemsize)
+    chunk = min(chunk, nbytes)
+    return (
+        [dpm.MemoryUSMHost(chunk, queue=exec_q) for _ in range(2)],
+        chunk,
+    )
+
+
+def _readinto_full(f, mv):
+    "Reads into memoryview `mv` until it is filled or the file ends"
+    n_read = 0
+    while n_read < len(mv):
+        k = f.readinto(mv[n_read:])
+        if not k:
+            break
+        n_read += k
+    return n_read
+
+
+def _byteswap_inplace(buf, n, dtype):
+    "Swaps byte order of elements in first `n` bytes of host buffer `buf`"
+    h = np.ndarray(n // dtype.itemsize, dtype=dtype, buffer=buf)
+    h.byteswap(inplace=True)
+
+
+def load(file, device=None, usm_type="device", sycl_queue=None):
+    """
+    load(file, device=None, usm_type="device", sycl_queue=None)
+
+    Loads an array saved in NumPy `.npy` format into a new
+    :class:`dpctl.tensor.usm_ndarray`.
+
+    The data are read in chunks into a pair of USM-host staging buffers,
+    so that reading of a chunk from the file overlaps with the copy of the
+    previous chunk to the array, and host memory used does not depend on
+    the size of the array.
+
+    Args:
+        file (str, os.PathLike, file-like):
+            Name of the file, or file-like object opened for reading in
+            binary mode, positioned at the start of the `.npy` data.
+        device (optional): array API concept of device where the output
+            array is created. See :func:`dpctl.tensor.empty`.
+        usm_type (str, optional): The type of USM allocation for the output
+            array. Default: `"device"`.
+        sycl_queue (:class:`dpctl.SyclQueue`, optional): The SYCL queue
+            to use for output array allocation and copying.
+    Returns:
+        usm_ndarray: array with data, shape, data type and memory layout
+        (C- or F-contiguous) as saved in the file. Data type of the array
+        has native byte order.
+    """
+    f, own_file = _open(file, "rb")
+    # copies from staging buffers, which must complete before the buffers
+    # are freed, including when reading fails
+    events = [None, None]
+    try:
+        version = npy_format.read_magic(f)
+        if version == (1, 0):
+            shape, fortran_order, dt = npy_format.read_array_header_1_0(f)
+        elif version in [(2, 0), (3, 0)]:
+            shape, fortran_order, dt = npy_format.read_array_header_2_0(f)
+        else:
+            raise ValueError(f"Unsupported .npy format version {version}")
+        if dt.hasobject or dt.fields is not None or dt.subdtype is not None:
+            raise ValueError(
+                f"Arrays of data type {dt} can not be loaded into usm_ndarray"
+            )
+        res = dpt.empty(
+            shape,
+            dtype=dt.newbyteorder("="),
+            order="F" if fortran_order else "C",
+            device=device,
+            usm_type=usm_type,
+            sycl_queue=sycl_queue,
+        )
+        nbytes = res.nbytes
+        if nbytes == 0:
+            return res
+        exec_q = res.sycl_queue
+        swap = not dt.isnative
+        dst = _byte_view(res)
+        staging, chunk = _staging_buffers(nbytes, dt.itemsize, exec_q)
+        for k, start in enumerate(range(0, nbytes, chunk)):
+            n = min(chunk, nbytes - start)
+            i = k % 2
+            # buffer is reused once its copy from two iterations ago is done
+            if events[i] is not None:
+                events[i].wait()
+            buf = staging[i]
+            n_read = _readinto_full(f, memoryview(buf)[:n])
+            if n_read != n:
+                raise ValueError(
+                    f"File ended after {start + n_read} of {nbytes} bytes "
+                    "of array data"
+                )
+            if swap:
+                _byteswap_inplace(buf, n, dt)
+            events[i] = exec_q.memcpy_async(
+                dpm.as_usm_memory(dst[start : start + n]), buf, n
+            )
+        return res
+    finally:
+        for ev in events:
+            if ev is not None:
+                ev.wait()
+        if own_file:
+            f.close()
+
+
+def save(file, arr):
+    """
+    save(file, arr)
+
+    Saves :class:`dpctl.tensor.usm_ndarray` into a file in NumPy `.npy`
+    format.
+
+    C- and F-contiguous arrays are written from their own memory,
+    other arrays are first copied into a C-contiguous temporary. The data
+    are copied to the host in chunks through a pair of USM-host staging
+    buffers, so that writing of a chunk into the file overlaps with the
+    copy of the next chunk, and host memory used does not depend on the
+    size of the array.
+
+    Args:
+        file (str, os.PathLike, file-like):
+            Name of the file, or file-like object opened for writing in
+            binary mode.
+        arr (usm_ndarray):
+            Array to save.
+    """
+    if not isinstance(arr, dpt.usm_ndarray):
+        raise TypeError(
+            f"Expected dpctl.tensor.usm_ndarray type, got {type(arr)}."
+        )
+    fl = arr.flags
+    if fl.c_contiguous:
+        fortran_order = False
+    elif fl.f_contiguous:
+        fortran_order = True
+    else:
+        arr = dpt.copy(arr, order="C")
+        fortran_order = False
+    header = {
+        "descr": npy_format.dtype_to_descr(arr.dtype),
+        "fortran_order": fortran_order,
+        "shape": arr.shape,
+    }
+    f, own_file = _open(file, "wb")
+    # copy into a staging buffer, which must complete before the buffers
+    # are freed, including when writing fails
+    pending = None
+    try:
+        try:
+            npy_format.write_array_header_1_0(f, header)
+        except ValueError:
+            # header does not fit into 64KiB allowed by version 1.0
+            npy_format.write_array_header_2_0(f, header)
+        nbytes = arr.nbytes
+        if nbytes == 0:
+            return
+        exec_q = arr.sycl_queue
+        src = _byte_view(arr)
+        staging, chunk = _staging_buffers(nbytes, arr.itemsize, exec_q)
+        starts = range(0, nbytes, chunk)
+
+        def _submit(k):
+            start = starts[k]
+            n = min(chunk, nbytes - start)
+            ev = exec_q.memcpy_async(
+                staging[k % 2], dpm.as_usm_memory(src[start : start + n]), n
+            )
+            return ev, n
+
+        pending = _submit(0)
+        for k in range(len(starts)):
+            ev, n = pending
+            ev.wait()
+            # next chunk is copied while this one is written out
+            if k + 1 < len(starts):
+                pending = _submit(k + 1)
+            f.write(memoryview(staging[k % 2])[:n])
+    finally:
+        if pending is not None:
+            pending[0].wait()
+        if own_file:
+            f.close()
@@ -0,0 +1,261 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import itertools
+import operator
+import threading
+from concurrent.futures import ThreadPoolExecutor, wait
+
+import dpctl
+import dpctl.tensor as dpt
+from dpctl.tensor._device import normalize_queue_device
+
+__doc__ = "Implementation of pool of queues and round-robin execution policy"
+
+_pools = dict()
+_pools_lock = threading.Lock()
+
+
+class QueuePool:
+    """QueuePool(device=None, /, *, size=4)
+
+    Pool of queues targeting the same device and sharing the SYCL context
+    of the queue implied by `device`, so that USM allocations made with
+    any of them can be used with every other one.
+
+    The first queue of the pool is the queue implied by `device`, e.g. the
+    cached queue of the default-selected device if `device` is `None`.
+    Other queues are created with the same in-order and profiling
+    properties. On backends which map queues to separate command lists or
+    streams, commands submitted to different queues of the pool may
+    execute concurrently.
+
+    Args:
+        device (Optional[object]):
+            array API concept of device, or :class:`dpctl.SyclQueue`.
+        size (int):
+            number of queues in the pool. Default: `4`.
+    """
+
+    def __init__(self, device=None, /, *, size=4):
+        size = operator.index(size)
+        if size < 1:
+            raise ValueError(f"Pool must have at least one queue, got {size}")
+        q0 = normalize_queue_device(device=device)
+        prop = []
+        if q0.is_in_order:
+            prop.append("in_order")
+        if q0.has_enable_profiling:
+            prop.append("enable_profiling")
+        self._queues = (q0,) + tuple(
+            dpctl.SyclQueue(q0.sycl_context, q0.sycl_device, property=prop)
+            for _ in range(size - 1)
+        )
+        self._counter = itertools.count()
+
+    def __repr__(self):
+        return f"QueuePool({self.sycl_device}, size={len(self._queues)})"
+
+    def __len__(self):
+        return len(self._queues)
+
+    def __getitem__(self, i):
+        return self._queues[i]
+
+    def __iter__(self):
+        return iter(self._queues)
+
+    @property
+    def sycl_queue(self):
+        "First queue of the pool, the queue implied by `device`"
+        return self._queues[0]
+
+    @property
+    def sycl_context(self):
+        "Context shared by queues of the pool"
+        return self._queues[0].sycl_context
+
+    @property
+    def sycl_device(self):
+        "Device targeted by queues of the pool"
+        return self._queues[0].sycl_device
+
+    def next_queue(self):
+        """next_queue()
+
+        Returns queues of the pool in round-robin order. Safe to call from
+        several threads.
+        """
+        return self._queues[next(self._counter) % len(self._queues)]
+
+    def wait(self):
+        """wait()
+
+        Waits for completion of commands submitted to every queue of the
+        pool.
+        """
+        for q in self._queues:
+            q.wait()
+
+
+def get_device_queue_pool(device=None, /, *, size=4):
+    """get_device_queue_pool(device=None, size=4)
+
+    Returns :class:`dpctl.tensor.QueuePool` of `size` queues for `device`,
+    cached for the queue implied by `device` and the size of the pool, so
+    that all users of the device share the same pool.
+    """
+    q0 = normalize_queue_device(device=device)
+    key = (q0, operator.index(size))
+    with _pools_lock:
+        pool = _pools.get(key)
+        if pool is None:
+            pool = QueuePool(q0, size=size)
+            _pools[key] = pool
+    return pool
+
+
+def _to_queue(obj, q):
+    """Returns `obj` with arrays, also in lists, tuples and dictionaries,
+    replaced by views associated with queue `q`. Queue `q` waits for
+    commands submitted to queues of the arrays before it runs commands
+    submitted after."""
+    if isinstance(obj, dpt.usm_ndarray):
+        if obj.sycl_queue == q:
+            return obj
+        if obj.sycl_context != q.sycl_context:
+            raise dpctl.utils.ExecutionPlacementError(
+                "Array is not allocated in the context of the queue pool"
+            )
+        return obj.to_device(q, stream=q)
+    if isinstance(obj, (list, tuple)):
+        return type(obj)(_to_queue(o, q) for o in obj)
+    if isinstance(obj, dict):
+        return {k: _to_queue(v, q) for k, v in obj.items()}
+    return obj
+
+
+class RoundRobinPolicy:
+    """RoundRobinPolicy(pool=None, /)
+
+    Execution policy spreading independent operations over queues of
+    :class:`dpctl.tensor.QueuePool` `pool`.
+
+    Each call to :meth:`submit` takes the next queue of the pool, makes
+    views of array arguments associated with that queue, and calls the
+    function in a worker thread, so that operations submitted one after
+    another overlap. Arrays returned by the function are associated with
+    that queue. :meth:`join` is the explicit join point, which waits for
+    submitted operations and associates arrays they returned with the
+    first queue of the pool, e.g. the queue of arrays allocated with
+    `device` keyword, so that they can be used with such arrays.
+
+    Operations submitted to the policy must not depend on each other,
+    except through arrays returned by :meth:`join`.
+
+    :Example:
+        .. code-block:: python
+
+            import dpctl.tensor as dpt
+
+            x = dpt.ones(10**6)
+            y = dpt.ones(10**6)
+            with dpt.RoundRobinPolicy() as policy:
+                fx = policy.submit(dpt.sum, x)
+                fy = policy.submit(dpt.exp, y)
+                s, e = policy.join(fx, fy)
+
+    Args:
+        pool (Optional[QueuePool]):
+            pool of queues. Default: `None`, for the pool of the
+            default-selected device returned by
+            :func:`dpctl.tensor.get_device_queue_pool`.
+    """
+
+    def __init__(self, pool=None, /):
+        if pool is None:
+            pool = get_device_queue_pool()
+        if not isinstance(pool, QueuePool):
+            raise TypeError(f"Expected QueuePool, got {type(pool)}")
+        self._pool = pool
+        self._executor = ThreadPoolExecutor(
+            max_workers=len(pool), thread_name_prefix="dpctl_policy"
+        )
+        self._pending = set()
+        self._lock = threading.Lock()
+
+    @property
+    def pool(self):
+        "Pool of queues of the policy"
+        return self._pool
+
+    def submit(self, fn, /, *args, **kwargs):
+        """submit(fn, *args, **kwargs)
+
+        Calls `fn(*args, **kwargs)` in a worker thread with arrays among
+        arguments associated with the next queue of the pool.
+
+        Returns:
+            concurrent.futures.Future: future of the result of `fn`.
+        """
+        q = self._pool.next_queue()
+        args = _to_queue(args, q)
+        kwargs = _to_queue(kwargs, q)
+        fut = self._executor.submit(fn, *args, **kwargs)
+        with self._lock:
+            self._pending.add(fut)
+        return fut
+
+    def join(self, *futures):
+        """join(*futures)
+
+        Waits for operations of `futures`, or for all submitted operations
+        if none are given.
+
+        Returns:
+            Union[object, Tuple[object, ...]]:
+                result of the operation of a single future, or tuple of
+                results, with arrays associated with the first queue of the
+                pool. `None` if no futures are given.
+        """
+        with self._lock:
+            if futures:
+                self._pending.difference_update(futures)
+                to_wait = futures
+            else:
+                to_wait = tuple(self._pending)
+                self._pending.clear()
+        wait(to_wait)
+        if not futures:
+            # raises exception of the first failed operation, if any
+            for f in to_wait:
+                f.result()
+            return None
+        q0 = self._pool.sycl_queue
+        res = tuple(_to_queue(f.result(), q0) for f in to_wait)
+        return res[0] if len(res) == 1 else res
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        try:
+            if exc_type is None:
+                self.join()
+        finally:
+            # waits for pending operations
+            self._executor.shutdown(wait=True)
+        return False
@@ -0,0 +1,370 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import math
+import operator
+import secrets
+
+import numpy as np
+
+import dpctl
+import dpctl.tensor as dpt
+import dpctl.utils
+from dpctl.tensor._data_types import _get_dtype
+from dpctl.tensor._device import normalize_queue_device
+from dpctl.tensor._lazy_extension import tensor_random_impl as trng
+
+_engines = ("philox", "threefry")
+_mask64 = (1 << 64) - 1
+
+
+def _splitmix64(z):
+    "Finalizer of SplitMix64 generator, a bijection of 64-bit integers"
+    z = (z + 0x9E3779B97F4A7C15) & _mask64
+    z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9) & _mask64
+    z = ((z ^ (z >> 27)) * 0x94D049BB133111EB) & _mask64
+    return z ^ (z >> 31)
+
+
+def _uint64_arg(v, name):
+    v = operator.index(v)
+    if v < 0 or v > _mask64:
+        raise ValueError(f"`{name}` must be in the range [0, 2**64), got {v}")
+    return v
+
+
+def _shape_arg(size):
+    if size is None:
+        return tuple()
+    if isinstance(size, (list, tuple)):
+        return tuple(operator.index(s) for s in size)
+    return (operator.index(size),)
+
+
+class Generator:
+    """Generator(seed=None, /, *, engine="philox", stream=0, device=None, \
+sycl_queue=None)
+
+    Generator of random numbers by a counter-based engine, which fills
+    arrays directly on the device.
+
+    The engine maps a 128-bit counter to a block of four random 32-bit
+    words, keyed by the seed. The low 64 bits of the counter number blocks
+    of a stream, and its high 64 bits number streams. Every work-item
+    computes its own block, so that generated arrays only depend on the
+    seed, the stream, and the number of blocks consumed before, but not on
+    the device or the launch configuration.
+
+    Args:
+        seed (Optional[int]):
+            64-bit seed. If `None`, a seed is drawn from the operating
+            system entropy source. Default: `None`.
+        engine (str):
+            `"philox"` for Philox4x32-10, or `"threefry"` for
+            Threefry4x32-20 engine. Default: `"philox"`.
+        stream (int):
+            64-bit index of the stream. Default: `0`.
+        device (Optional[object]):
+            array API concept of device where arrays are allocated.
+        sycl_queue (Optional[dpctl.SyclQueue]):
+            queue used for allocation of arrays and generation of numbers.
+    """
+
+    def __init__(
+        self,
+        seed=None,
+        /,
+        *,
+        engine="philox",
+        stream=0,
+        device=None,
+        sycl_queue=None,
+    ):
+        if engine not in _engines:
+            raise ValueError(
+                f"`engine` must be 'philox' or 'threefry', got {engine}"
+            )
+        if seed is None:
+            seed = secrets.randbits(64)
+        self._seed = _uint64_arg(seed, "seed")
+        self._stream = _uint64_arg(stream, "stream")
+        self._engine = engine
+        self._sycl_queue = normalize_queue_device(
+            sycl_queue=sycl_queue, device=device
+        )
+        self._offset = 0
+        self._n_spawned = 0
+
+    def __repr__(self):
+        return (
+            f"Generator(seed={self._seed}, engine='{self._engine}', "
+            f"stream={self._stream}, offset={self._offset})"
+        )
+
+    @property
+    def seed(self):
+        "Seed keying the engine"
+        return self._seed
+
+    @property
+    def engine(self):
+        "Name of the engine, `'philox'` or `'threefry'`"
+        return self._engine
+
+    @property
+    def stream(self):
+        "Index of the stream of blocks of the generator"
+        return self._stream
+
+    @property
+    def offset(self):
+        "Index of the next block of the stream to be generated"
+        return self._offset
+
+    @property
+    def sycl_queue(self):
+        "Queue used to allocate and fill arrays"
+        return self._sycl_queue
+
+    @property
+    def sycl_device(self):
+        "Device where arrays are allocated"
+        return self._sycl_queue.sycl_device
+
+    def advance(self, n_blocks):
+        """advance(n_blocks)
+
+        Skips `n_blocks` blocks of the stream, each of four 32-bit words.
+        Counters are moved directly, so skipping costs nothing.
+
+        Returns:
+            Generator: this generator.
+        """
+        n_blocks = operator.index(n_blocks)
+        if n_blocks < 0:
+            raise ValueError("Generator can only be advanced forward")
+        self._offset = (self._offset + n_blocks) & _mask64
+        return self
+
+    def spawn(self, sycl_queues):
+        """spawn(sycl_queues)
+
+        Creates generators of independent streams, e.g. one for each
+        sub-device of a partitioned device.
+
+        Children share the seed and the engine of this generator. Their
+        streams are derived from the stream of this generator and from the
+        number of children spawned before, so that repeated spawns give
+        distinct streams, and the same sequence of spawns gives the same
+        streams.
+
+        Args:
+            sycl_queues (Sequence[Union[dpctl.SyclQueue, object]]):
+                queues of children, or devices, as accepted by the
+                `device` keyword.
+
+        Returns:
+            List[Generator]: one child for each queue.
+        """
+        children = []
+        for q in sycl_queues:
+            if not isinstance(q, dpctl.SyclQueue):
+                q = normalize_queue_device(device=q)
+            self._n_spawned += 1
+            child_stream = _splitmix64(
+                self._stream ^ _splitmix64(self._n_spawned)
+            )
+            children.append(
+                Generator(
+                    self._seed,
+                    engine=self._engine,
+                    stream=child_stream,
+                    sycl_queue=q,
+                )
+            )
+        return children
+
+    def _empty(self, size, dtype, usm_type):
+        dpctl.utils.validate_usm_type(usm_type, allow_none=False)
+        return dpt.empty(
+            _shape_arg(size),
+            dtype=dtype,
+            usm_type=usm_type,
+            sycl_queue=self._sycl_queue,
+        )
+
+    def _fill(self, fn, dst, per_block, **kwargs):
+        "Fills `dst` with numbers of `per_block` per block of the stream"
+        n = dst.size
+        if n > 0:
+            hev, _ = fn(
+                dst=dst,
+                engine=self._engine,
+                seed=self._seed,
+                stream=self._stream,
+                offset=self._offset,
+                sycl_queue=self._sycl_queue,
+                **kwargs,
+            )
+            hev.wait()
+        self.advance(math.ceil(n / per_block))
+        return dst
+
+    def random_raw(self, size=None, *, usm_type="device"):
+        """random_raw(size=None, usm_type="device")
+
+        Returns array of raw 32-bit words generated by the engine, four
+        words per block.
+
+        Returns:
+            usm_ndarray: array of shape `size` with `uint32` data type.
+        """
+        dst = self._empty(size, dpt.uint32, usm_type)
+        return self._fill(trng._random_bits, dst, 4)
+
+    def uniform(
+        self, low=0.0, high=1.0, size=None, *, dtype=None, usm_type="device"
+    ):
+        """uniform(low=0.0, high=1.0, size=None, dtype=None, \
+usm_type="device")
+
+        Returns array of numbers uniformly distributed in `[low, high)`.
+
+        A block gives four numbers with 24 random bits, or two numbers with
+        53 random bits for `float64`.
+
+        Args:
+            low (float): lower bound. Default: `0.0`.
+            high (float): upper bound. Default: `1.0`.
+            size (Optional[Union[int, Tuple[int, ...]]]):
+                shape of the result. Default: `None`, for a zero-dimensional
+                array.
+            dtype (Optional[dtype]):
+                real floating-point data type of the result. Default:
+                `None`, for the default floating-point data type of the
+                device.
+            usm_type (str): USM allocation type. Default: `"device"`.
+
+        Returns:
+            usm_ndarray: array of random numbers.
+        """
+        low, high = float(low), float(high)
+        if not (np.isfinite(low) and np.isfinite(high)):
+            raise ValueError("Bounds of uniform distribution must be finite")
+        dtype = _get_dtype(dtype, self._sycl_queue)
+        if dtype.kind != "f":
+            raise ValueError(
+                f"Real floating-point data type expected, got {dtype}"
+            )
+        dst = self._empty(size, dtype, usm_type)
+        per_block = 2 if dtype == dpt.float64 else 4
+        return self._fill(
+            trng._random_uniform, dst, per_block, low=low, high=high
+        )
+
+    def normal(
+        self, loc=0.0, scale=1.0, size=None, *, dtype=None, usm_type="device"
+    ):
+        """normal(loc=0.0, scale=1.0, size=None, dtype=None, \
+usm_type="device")
+
+        Returns array of normally distributed numbers, computed by the
+        Box-Muller transform.
+
+        A block gives four numbers, or two numbers for `float64`.
+
+        Args:
+            loc (float): mean of the distribution. Default: `0.0`.
+            scale (float):
+                non-negative standard deviation of the distribution.
+                Default: `1.0`.
+            size (Optional[Union[int, Tuple[int, ...]]]):
+                shape of the result. Default: `None`, for a zero-dimensional
+                array.
+            dtype (Optional[dtype]):
+                real floating-point data type of the result. Default:
+                `None`, for the default floating-point data type of the
+                device.
+            usm_type (str): USM allocation type. Default: `"device"`.
+
+        Returns:
+            usm_ndarray: array of random numbers.
+        """
+        loc, scale = float(loc), float(scale)
+        if not (np.isfinite(loc) and np.isfinite(scale)) or scale < 0:
+            raise ValueError(
+                "Mean must be finite and scale must be finite and "
+                "non-negative"
+            )
+        dtype = _get_dtype(dtype, self._sycl_queue)
+        if dtype.kind != "f":
+            raise ValueError(
+                f"Real floating-point data type expected, got {dtype}"
+            )
+        dst = self._empty(size, dtype, usm_type)
+        per_block = 2 if dtype == dpt.float64 else 4
+        return self._fill(
+            trng._random_normal, dst, per_block, loc=loc, scale=scale
+        )
+
+    def integers(
+        self, low, high=None, size=None, *, dtype="i8", usm_type="device"
+    ):
+        """integers(low, high=None, size=None, dtype="i8", \
+usm_type="device")
+
+        Returns array of integers uniformly distributed in `[low, high)`,
+        or in `[0, low)` if `high` is `None`.
+
+        A block gives two numbers, each mapped from 64 random bits to the
+        range by multiplication. This biases the distribution by at most
+        `(high - low) / 2**64`.
+
+        Args:
+            low (int): lower bound, or upper bound if `high` is `None`.
+            high (Optional[int]): upper bound, excluded. Default: `None`.
+            size (Optional[Union[int, Tuple[int, ...]]]):
+                shape of the result. Default: `None`, for a zero-dimensional
+                array.
+            dtype (dtype): integral data type of the result. Default:
+                `"i8"`.
+            usm_type (str): USM allocation type. Default: `"device"`.
+
+        Returns:
+            usm_ndarray: array of random integers.
+        """
+        if high is None:
+            low, high = 0, low
+        low, high = operator.index(low), operator.index(high)
+        dtype = _get_dtype(dtype, self._sycl_queue)
+        if dtype.kind not in "iu":
+            raise ValueError(f"Integral data type expected, got {dtype}")
+        info = dpt.iinfo(dtype)
+        if low >= high:
+            raise ValueError(f"`low` must be less than `high`, got {low}")
+        if low < info.min or high - 1 > info.max:
+            raise ValueError(
+                f"Range [{low}, {high}) is out of bounds of {dtype}"
+            )
+        dst = self._empty(size, dtype, usm_type)
+        # the range of 2**64 is passed as 0
+        return self._fill(
+            trng._random_integers,
+            dst,
+            2,
+            low=low & _mask64,
+            range=(high - low) & _mask64,
+        )
@@ -19,8 +19,12 @@ from numpy.core.numeric import normalize_axis_tuple
 import dpctl
 import dpctl.tensor as dpt
 import dpctl.tensor._tensor_impl as ti
+from dpctl.tensor._lazy_extension import tensor_reductions_impl as tri
+from dpctl.tensor._usmarray import _strided_view
 
+from ._stride_tricks import _overlapping_window_axes
 from ._type_utils import _to_device_supported_dtype
+from ._usm_advice import prefetch_for_kernel
 
 
 def _default_reduction_dtype(inp_dt, q):
@@ -52,6 +56,52 @@ def _default_reduction_dtype(inp_dt, q):
     return res_dt
 
 
+def _windowed_sum(arr, red_axis, res):
+    """Sums array `arr` over axis `red_axis` into array `res` by the kernel
+    for overlapping windows, if `arr` is a view of windows along that axis,
+    such as made by :func:`dpctl.tensor.sliding_window_view`.
+
+    Returns event of the host task, or `None` if the kernel does not
+    apply."""
+    pair = _overlapping_window_axes(arr)
+    if pair is None or red_axis not in pair:
+        return None
+    pos_axis = pair[0] if red_axis == pair[1] else pair[1]
+    shape, strides = arr.shape, arr.strides
+    n_windows, window_size = shape[pos_axis], shape[red_axis]
+    if window_size > n_windows:
+        # few long windows are summed faster by the reduction over axis
+        return None
+
+    def _res_axis(k):
+        return k if k < red_axis else k - 1
+
+    # all other axes must merge into a single axis of rows
+    res_strides = res.strides
+    n_rows, src_rs, dst_rs = 1, 0, 0
+    for k in range(arr.ndim):
+        if k in pair or shape[k] == 1:
+            continue
+        src_st, dst_st = strides[k], res_strides[_res_axis(k)]
+        if n_rows == 1:
+            n_rows, src_rs, dst_rs = shape[k], src_st, dst_st
+        elif src_rs == src_st * shape[k] and dst_rs == dst_st * shape[k]:
+            n_rows, src_rs, dst_rs = n_rows * shape[k], src_st, dst_st
+        else:
+            return None
+
+    src = _strided_view(
+        arr,
+        (n_rows, n_windows, window_size),
+        (src_rs, strides[pos_axis], strides[red_axis]),
+    )
+    dst = _strided_view(
+        res, (n_rows, n_windows), (dst_rs, res_strides[_res_axis(pos_axis)])
+    )
+    ht_e, _ = tri._windowed_sum(src=src, dst=dst, sycl_queue=res.sycl_queue)
+    return ht_e
+
+
 def sum(arr, axis=None, dtype=None, keepdims=False):
     """sum(x, axis=None, dtype=None, keepdims=False)
 
@@ -133,14 +183,17 @@ def sum(arr, axis=None, dtype=None, keepdims=False):
     if red_nd == 0:
         return dpt.astype(arr, res_dt, copy=False)
 
+    prefetch_for_kernel(q, arr)
     host_tasks_list = []
-    if ti._sum_over_axis_dtype_supported(inp_dt, res_dt, res_usm_type, q):
+    if tri._sum_over_axis_dtype_supported(inp_dt, res_dt, res_usm_type, q):
         res = dpt.empty(
             res_shape, dtype=res_dt, usm_type=res_usm_type, sycl_queue=q
         )
-        ht_e, _ = ti._sum_over_axis(
-            src=arr2, trailing_dims_to_reduce=red_nd, dst=res, sycl_queue=q
-        )
+        ht_e = _windowed_sum(arr, axis[0], res) if red_nd == 1 else None
+        if ht_e is None:
+            ht_e, _ = tri._sum_over_axis(
+                src=arr2, trailing_dims_to_reduce=red_nd, dst=res, sycl_queue=q
+            )
         host_tasks_list.append(ht_e)
     else:
         if dtype is None:
@@ -152,7 +205,7 @@ def sum(arr, axis=None, dtype=None, keepdims=False):
         tmp = dpt.empty(
             res_shape, dtype=tmp_dt, usm_type=res_usm_type, sycl_queue=q
         )
-        ht_e_tmp, r_e = ti._sum_over_axis(
+        ht_e_tmp, r_e = tri._sum_over_axis(
             src=arr2, trailing_dims_to_reduce=red_nd, dst=tmp, sycl_queue=q
         )
         host_tasks_list.append(ht_e_tmp)
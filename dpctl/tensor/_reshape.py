@@ -24,6 +24,7 @@ from dpctl.tensor._tensor_impl import (
     _ravel_multi_index,
     _unravel_index,
 )
+from dpctl.tensor._usmarray import _strided_view
 
 __doc__ = "Implementation module for :func:`dpctl.tensor.reshape`."
 
@@ -177,10 +178,4 @@ def reshape(X, shape, order="C", copy=None):
             tuple(shape), dtype=X.dtype, buffer=flat_res, order=order
         )
     # can form a view
-    return dpt.usm_ndarray(
-        shape,
-        dtype=X.dtype,
-        buffer=X,
-        strides=tuple(newsts),
-        offset=X.__sycl_usm_array_interface__.get("offset", 0),
-    )
+    return _strided_view(X, shape, tuple(newsts))
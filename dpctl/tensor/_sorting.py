@@ -0,0 +1,106 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import operator
+from collections import namedtuple
+
+from numpy.core.numeric import normalize_axis_index
+
+import dpctl.tensor as dpt
+import dpctl.tensor._tensor_impl as ti
+from dpctl.tensor._lazy_extension import tensor_sorting_impl as tsi
+
+TopKResult = namedtuple("TopKResult", ["values", "indices"])
+
+
+def top_k(x, k, /, *, axis=-1, mode="largest"):
+    """top_k(x, k, axis=-1, mode="largest")
+
+    Returns the `k` largest, or smallest, elements of the input array `x`
+    along the given axis, and their indices.
+
+    Elements are selected on the device without sorting the whole axis:
+    for small `k` each work-group keeps sorted lists of leading elements
+    in local memory, for larger `k` the k-th element is found by radix
+    selection.
+
+    Args:
+        x (usm_ndarray):
+            input array with real-valued data type.
+        k (int):
+            number of elements to select, `0 <= k <= x.shape[axis]`.
+        axis (int):
+            axis along which elements are selected. Default: `-1`.
+        mode (str):
+            `"largest"` to select largest elements, `"smallest"` to select
+            smallest elements. Default: `"largest"`.
+
+    Returns:
+        TopKResult:
+            named tuple `(values, indices)` of arrays with the shape of `x`
+            except for the size `k` of the axis `axis`. Selected elements
+            are ordered starting from the largest for `mode="largest"`, and
+            from the smallest for `mode="smallest"`. Of equal elements, the
+            one with the smaller index comes first. NaNs compare greater
+            than all other values, as in :func:`numpy.sort`. Indices have
+            the default array index data type for the device of `x`.
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    if mode not in ("largest", "smallest"):
+        raise ValueError(f"`mode` must be 'largest' or 'smallest', got {mode}")
+    if x.dtype.kind == "c":
+        raise TypeError("Top-k selection is not defined for complex arrays")
+    if x.ndim == 0:
+        raise ValueError("Top-k selection requires array of positive rank")
+    axis = normalize_axis_index(operator.index(axis), x.ndim)
+    k = operator.index(k)
+    n = x.shape[axis]
+    if k < 0 or k > n:
+        raise ValueError(
+            f"`k` must be in the range [0, {n}] for axis of size {n}, got {k}"
+        )
+
+    exec_q = x.sycl_queue
+    x_last = dpt.moveaxis(x, axis, -1)
+    batch_shape = x_last.shape[:-1]
+    vals = dpt.empty(
+        batch_shape + (k,),
+        dtype=x.dtype,
+        usm_type=x.usm_type,
+        sycl_queue=exec_q,
+    )
+    inds = dpt.empty(
+        batch_shape + (k,),
+        dtype=ti.default_device_index_type(exec_q.sycl_device),
+        usm_type=x.usm_type,
+        sycl_queue=exec_q,
+    )
+    if k > 0 and vals.size > 0:
+        # reshape is a view whenever batch dimensions can be merged
+        src = dpt.reshape(x_last, (-1, n))
+        hev, _ = tsi._topk(
+            src=src,
+            k=k,
+            largest=(mode == "largest"),
+            vals=dpt.reshape(vals, (-1, k)),
+            inds=dpt.reshape(inds, (-1, k)),
+            sycl_queue=exec_q,
+        )
+        hev.wait()
+    return TopKResult(
+        dpt.moveaxis(vals, -1, axis), dpt.moveaxis(inds, -1, axis)
+    )
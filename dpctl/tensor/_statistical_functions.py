@@ -0,0 +1,347 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import operator
+
+import numpy as np
+
+import dpctl.tensor as dpt
+import dpctl.tensor._tensor_impl as ti
+from dpctl.tensor._lazy_extension import tensor_reductions_impl as tri
+
+# number of bins of histograms used to locate order statistics
+_quantile_bins = 1024
+# order statistics are found by sorting elements of a bin on the host,
+# once the bin holds at most this many elements
+_quantile_host_sort_max = 1 << 14
+
+
+def _validate_real_array(x):
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    if x.dtype.kind == "c":
+        raise TypeError("Complex-valued arrays are not supported")
+
+
+def _edge_dtype(q):
+    "Data type of bin edges and of values compared with them"
+    return dpt.dtype(ti.default_device_fp_type(q))
+
+
+def _bin_edges_array(bins, edge_dt, exec_q, usm_type, min_size):
+    "Validates monotonically increasing bin edges and copies them to device"
+    edges = dpt.asarray(
+        bins, dtype=edge_dt, usm_type=usm_type, sycl_queue=exec_q
+    )
+    if edges.ndim != 1:
+        raise ValueError("`bins` must be one-dimensional")
+    if edges.size < min_size:
+        raise ValueError(f"`bins` must have at least {min_size} elements")
+    if not edges.flags.c_contiguous:
+        edges = dpt.copy(edges, order="C")
+    if edges.size > 1 and bool(dpt.any(dpt.less(edges[1:], edges[:-1]))):
+        raise ValueError("`bins` must increase monotonically")
+    return edges
+
+
+def _value_range(xf, lo, hi, edge_dt):
+    """Smallest and largest elements of one-dimensional array `xf` within
+    `[lo, hi]`, ignoring NaNs, as scalars of data type `edge_dt`"""
+    exec_q = xf.sycl_queue
+    res = dpt.empty(2, dtype=edge_dt, sycl_queue=exec_q)
+    hev, _ = tri._minmax(
+        src=xf, lo=float(lo), hi=float(hi), dst=res, sycl_queue=exec_q
+    )
+    hev.wait()
+    mn, mx = dpt.asnumpy(res)
+    return mn, mx
+
+
+def _uniform_histogram(xf, lo, hi, n_bins, edge_dt, usm_type, uniform=True):
+    """Counts and edges of `n_bins` equal bins spanning `[lo, hi]`.
+
+    Unless `uniform`, bins of elements are found by comparison with edges,
+    as :func:`digitize` does, rather than from their offsets, which may
+    differ from comparison when edges are not distinct."""
+    exec_q = xf.sycl_queue
+    edges = dpt.linspace(
+        float(lo),
+        float(hi),
+        n_bins + 1,
+        dtype=edge_dt,
+        usm_type=usm_type,
+        sycl_queue=exec_q,
+    )
+    counts = dpt.empty(
+        n_bins, dtype=dpt.int64, usm_type=usm_type, sycl_queue=exec_q
+    )
+    hev, _ = tri._histogram(
+        src=xf,
+        edges=edges,
+        uniform=bool(uniform),
+        counts=counts,
+        sycl_queue=exec_q,
+    )
+    hev.wait()
+    return counts, edges
+
+
+def histogram(x, /, bins=10, range=None):
+    """histogram(x, bins=10, range=None)
+
+    Computes the histogram of elements of the input array `x`, as
+    :func:`numpy.histogram` does.
+
+    Each work-group counts elements into its own histogram in local
+    memory, which is then added to the result with atomics. On CPU
+    devices each thread counts into its own histogram.
+
+    Args:
+        x (usm_ndarray):
+            input array with real-valued data type. The histogram is
+            computed over the flattened array.
+        bins (Union[int, Sequence[float], usm_ndarray]):
+            number of equal-width bins, or monotonically increasing bin
+            edges, including the rightmost edge. Default: `10`.
+        range (Optional[Tuple[float, float]]):
+            lower and upper range of equal-width bins. If `None`, the
+            smallest and the largest elements of `x` are used. Ignored if
+            `bins` are edges. Default: `None`.
+
+    Returns:
+        Tuple[usm_ndarray, usm_ndarray]:
+            counts of elements in bins, with `int64` data type, and bin
+            edges, with the default floating-point data type for the
+            device of `x`. All bins but the last are half-open, the last
+            bin also includes its right edge. Elements outside of edges
+            and NaNs are not counted.
+    """
+    _validate_real_array(x)
+    exec_q = x.sycl_queue
+    usm_type = x.usm_type
+    edge_dt = _edge_dtype(exec_q)
+    xf = dpt.reshape(x, -1)
+
+    if isinstance(bins, (dpt.usm_ndarray, np.ndarray, list, tuple)):
+        edges = _bin_edges_array(bins, edge_dt, exec_q, usm_type, 2)
+        counts = dpt.empty(
+            edges.size - 1,
+            dtype=dpt.int64,
+            usm_type=usm_type,
+            sycl_queue=exec_q,
+        )
+        hev, _ = tri._histogram(
+            src=xf,
+            edges=edges,
+            uniform=False,
+            counts=counts,
+            sycl_queue=exec_q,
+        )
+        hev.wait()
+        return counts, edges
+
+    n_bins = operator.index(bins)
+    if n_bins < 1:
+        raise ValueError("`bins` must be positive, when an integer")
+    if range is not None:
+        lo, hi = range
+        if lo > hi:
+            raise ValueError("max must be larger than min in range parameter")
+        if not (np.isfinite(lo) and np.isfinite(hi)):
+            raise ValueError(f"supplied range of [{lo}, {hi}] is not finite")
+    elif xf.size == 0:
+        lo, hi = 0, 1
+    else:
+        lo, hi = _value_range(xf, -np.inf, np.inf, edge_dt)
+        if not (np.isfinite(lo) and np.isfinite(hi)):
+            raise ValueError(
+                f"autodetected range of [{lo}, {hi}] is not finite"
+            )
+    if lo == hi:
+        lo, hi = lo - 0.5, hi + 0.5
+    return _uniform_histogram(xf, lo, hi, n_bins, edge_dt, usm_type)
+
+
+def digitize(x, bins, /, *, right=False):
+    """digitize(x, bins, right=False)
+
+    Returns indices of bins to which elements of the input array `x`
+    belong, as :func:`numpy.digitize` does for increasing bins.
+
+    Args:
+        x (usm_ndarray):
+            input array with real-valued data type.
+        bins (Union[Sequence[float], usm_ndarray]):
+            monotonically increasing bin edges.
+        right (bool):
+            whether bins include their right edge instead of the left one.
+            Default: `False`.
+
+    Returns:
+        usm_ndarray:
+            array of shape of `x` with `int64` data type. Element `i` of
+            the result is such that `bins[i-1] <= x < bins[i]`, or
+            `bins[i-1] < x <= bins[i]` if `right`, with elements below the
+            first edge given index `0`, and elements above the last edge
+            and NaNs given index `len(bins)`.
+    """
+    _validate_real_array(x)
+    exec_q = x.sycl_queue
+    edges = _bin_edges_array(bins, _edge_dtype(exec_q), exec_q, x.usm_type, 0)
+    xf = dpt.reshape(x, -1)
+    res = dpt.empty(
+        xf.shape, dtype=dpt.int64, usm_type=x.usm_type, sycl_queue=exec_q
+    )
+    hev, _ = tri._digitize(
+        src=xf, edges=edges, right=bool(right), dst=res, sycl_queue=exec_q
+    )
+    hev.wait()
+    return dpt.reshape(res, x.shape)
+
+
+def _rank_bin(counts_np, r):
+    "Bin containing element of rank `r`, and number of elements before it"
+    cum = np.cumsum(counts_np)
+    i = int(np.searchsorted(cum, r, side="right"))
+    return i, (int(cum[i - 1]) if i > 0 else 0)
+
+
+def _elements_between(xe, a, b, closed):
+    "Elements of `xe` in `[a, b]` if `closed`, or in `[a, b)`, on the host"
+    upper = dpt.less_equal(xe, b) if closed else dpt.less(xe, b)
+    mask = dpt.logical_and(dpt.greater_equal(xe, a), upper)
+    return dpt.asnumpy(xe[mask])
+
+
+def _order_statistic(xe, r, counts_np, edges_np, usm_type):
+    """Element of rank `r` of one-dimensional array `xe` with histogram
+    `counts_np` with edges `edges_np` spanning all its elements, counted
+    by comparison with edges.
+
+    The bin holding the element is narrowed to the range of elements in it,
+    and its histogram is computed, until either all elements of the bin are
+    equal, or they are few enough to be sorted on the host. Elements are
+    also sorted on the host once the range is too narrow for edges of its
+    histogram to be distinct, since narrowing then stops separating them."""
+    edge_dt = xe.dtype
+    while True:
+        if edges_np[0] == edges_np[-1]:
+            return edge_dt.type(edges_np[0])
+        if np.any(edges_np[1:] <= edges_np[:-1]):
+            vals = _elements_between(xe, edges_np[0], edges_np[-1], True)
+            return np.sort(vals)[r]
+        i, below = _rank_bin(counts_np, r)
+        r -= below
+        c = int(counts_np[i])
+        last = i + 1 == counts_np.size
+        a = edge_dt.type(edges_np[i])
+        b = edge_dt.type(edges_np[i + 1])
+        if c <= _quantile_host_sort_max:
+            return np.sort(_elements_between(xe, a, b, last))[r]
+        if not last:
+            b = np.nextafter(b, edge_dt.type(-np.inf))
+        lo, hi = _value_range(xe, a, b, edge_dt)
+        if lo == hi:
+            return lo
+        counts, edges = _uniform_histogram(
+            xe, lo, hi, _quantile_bins, edge_dt, usm_type, uniform=False
+        )
+        counts_np, edges_np = dpt.asnumpy(counts), dpt.asnumpy(edges)
+
+
+def _approximate_order_statistic(r, counts_np, edges_np):
+    "Element of rank `r` interpolated within the bin holding it"
+    i, below = _rank_bin(counts_np, r)
+    a, b = edges_np[i], edges_np[i + 1]
+    return a + (b - a) * ((r - below + 0.5) / counts_np[i])
+
+
+def quantile(x, q, /, *, exact=True):
+    """quantile(x, q, exact=True)
+
+    Computes quantiles of elements of the input array `x`, as
+    :func:`numpy.quantile` does with the default `"linear"` method.
+
+    Quantiles are located with histograms of the array computed on the
+    device. Approximate quantiles are interpolated within the bin of the
+    histogram of all elements which holds them. Exact quantiles are found
+    by repeatedly computing histograms of the bin holding them, narrowed
+    to the range of its elements, until the bin is small enough to be
+    sorted on the host.
+
+    Args:
+        x (usm_ndarray):
+            input array with real-valued data type. Quantiles are computed
+            over the flattened array.
+        q (Union[float, Sequence[float]]):
+            quantiles to compute, in the range `[0, 1]`.
+        exact (bool):
+            whether to compute exact quantiles, instead of approximate.
+            Default: `True`.
+
+    Returns:
+        usm_ndarray:
+            array of the shape of `q` with the default floating-point data
+            type for the device of `x`. If `x` contains NaNs, all
+            quantiles are NaN.
+    """
+    _validate_real_array(x)
+    q_np = np.asarray(q, dtype="f8")
+    if np.any(np.isnan(q_np)) or np.any(q_np < 0) or np.any(q_np > 1):
+        raise ValueError("Quantiles must be in the range [0, 1]")
+    n = x.size
+    if n == 0:
+        raise ValueError("Quantiles of an empty array are not defined")
+
+    exec_q = x.sycl_queue
+    usm_type = x.usm_type
+    edge_dt = _edge_dtype(exec_q)
+    xe = dpt.astype(dpt.reshape(x, -1), edge_dt, copy=False)
+
+    res_np = np.full(q_np.shape, np.nan, dtype=edge_dt)
+    lo, hi = _value_range(xe, -np.inf, np.inf, edge_dt)
+    if lo <= hi:
+        # elements of bins of exact quantiles are selected by comparison
+        # with edges, so they are counted the same way
+        counts, edges = _uniform_histogram(
+            xe, lo, hi, _quantile_bins, edge_dt, usm_type, uniform=not exact
+        )
+        counts_np, edges_np = dpt.asnumpy(counts), dpt.asnumpy(edges)
+        # NaNs are not counted
+        if int(counts_np.sum()) == n:
+            cache = dict()
+
+            def _stat(r):
+                if r not in cache:
+                    if exact:
+                        cache[r] = _order_statistic(
+                            xe, r, counts_np, edges_np, usm_type
+                        )
+                    else:
+                        cache[r] = _approximate_order_statistic(
+                            r, counts_np, edges_np
+                        )
+                return cache[r]
+
+            for idx in np.ndindex(q_np.shape):
+                pos = q_np[idx] * (n - 1)
+                r_lo = int(np.floor(pos))
+                frac = pos - r_lo
+                v = _stat(r_lo)
+                if frac > 0:
+                    v = v + (_stat(r_lo + 1) - v) * frac
+                res_np[idx] = v
+    return dpt.asarray(res_np, usm_type=usm_type, sycl_queue=exec_q)
@@ -0,0 +1,221 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import operator
+
+from numpy.core.numeric import normalize_axis_tuple
+
+import dpctl.tensor as dpt
+from dpctl.tensor._usmarray import _strided_view
+
+
+def _int_tuple(v, name):
+    try:
+        return tuple(operator.index(e) for e in v)
+    except TypeError:
+        raise TypeError(f"`{name}` must be a sequence of integers, got {v}")
+
+
+def as_strided(x, /, shape, strides, *, writeable=True):
+    """as_strided(x, shape, strides, writeable=True)
+
+    Returns a view into memory of the input array `x` with the given shape
+    and strides, without copying data.
+
+    Unlike :func:`numpy.lib.stride_tricks.as_strided`, the view is checked
+    to only address elements of the memory allocation of `x`. Elements of
+    the view may overlap, e.g. a stride may be zero, in which case writing
+    into the view is usually a mistake.
+
+    Args:
+        x (usm_ndarray):
+            input array.
+        shape (Tuple[int, ...]):
+            shape of the view.
+        strides (Tuple[int, ...]):
+            strides of the view, in elements, as
+            :attr:`dpctl.tensor.usm_ndarray.strides`.
+        writeable (bool):
+            whether the view is writable, if `x` is. Default: `True`.
+
+    Returns:
+        usm_ndarray:
+            view whose zero-index element is the zero-index element of `x`.
+
+    Raises:
+        ValueError:
+            if the view addresses memory outside of the allocation of `x`.
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    shape = _int_tuple(shape, "shape")
+    strides = _int_tuple(strides, "strides")
+    if len(shape) != len(strides):
+        raise ValueError("`shape` and `strides` must have the same length")
+    if any(s < 0 for s in shape):
+        raise ValueError(f"`shape` must be non-negative, got {shape}")
+
+    if all(s > 0 for s in shape):
+        min_disp = sum(st * (s - 1) for s, st in zip(shape, strides) if st < 0)
+        max_disp = sum(st * (s - 1) for s, st in zip(shape, strides) if st > 0)
+        offset = x._element_offset
+        n_alloc = x.usm_data.nbytes // x.itemsize
+        if offset + min_disp < 0 or offset + max_disp >= n_alloc:
+            raise ValueError(
+                f"View of shape {shape} with strides {strides} addresses "
+                "memory outside of the allocation of the input array"
+            )
+    res = _strided_view(x, shape, strides)
+    if not writeable:
+        res.flags.writable = False
+    return res
+
+
+def sliding_window_view(x, window_shape, /, axis=None, *, writeable=False):
+    """sliding_window_view(x, window_shape, axis=None, writeable=False)
+
+    Returns a view of the input array `x` of all windows of the given shape,
+    as :func:`numpy.lib.stride_tricks.sliding_window_view` does.
+
+    Windows overlap, so the view is read-only by default. Sums over the
+    window axis, and unary elementwise functions, recognize such views and
+    read each element of `x` once per work-group, or evaluate the function
+    once per element of `x`, instead of once per window which holds it.
+
+    Args:
+        x (usm_ndarray):
+            input array.
+        window_shape (Union[int, Tuple[int, ...]]):
+            size of the window along each axis in `axis`.
+        axis (Optional[Union[int, Tuple[int, ...]]]):
+            axes along which windows slide. If `None`, `window_shape` must
+            have an entry for every axis of `x`. Default: `None`.
+        writeable (bool):
+            whether the view is writable, if `x` is. Default: `False`.
+
+    Returns:
+        usm_ndarray:
+            view of shape `x.shape`, with sizes of axes in `axis` reduced by
+            the window size less one, followed by `window_shape`.
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    if isinstance(window_shape, (tuple, list)):
+        window_shape = _int_tuple(window_shape, "window_shape")
+    else:
+        window_shape = (operator.index(window_shape),)
+    if any(w < 0 for w in window_shape):
+        raise ValueError("`window_shape` cannot contain negative values")
+
+    if axis is None:
+        axis = tuple(range(x.ndim))
+        if len(window_shape) != len(axis):
+            raise ValueError(
+                f"Since axis is `None`, must provide window_shape for all "
+                f"dimensions of `x`; got {len(window_shape)} window_shape "
+                f"elements and `x.ndim` is {x.ndim}."
+            )
+    else:
+        axis = normalize_axis_tuple(axis, x.ndim, allow_duplicate=True)
+        if len(window_shape) != len(axis):
+            raise ValueError(
+                f"Must provide matching length window_shape and axis; got "
+                f"{len(window_shape)} window_shape elements and {len(axis)} "
+                "axes elements."
+            )
+
+    shape = list(x.shape)
+    for ax, w in zip(axis, window_shape):
+        if shape[ax] < w:
+            raise ValueError(
+                "window shape cannot be larger than input array shape"
+            )
+        shape[ax] -= w - 1
+    strides = x.strides
+    res = _strided_view(
+        x,
+        tuple(shape) + window_shape,
+        strides + tuple(strides[ax] for ax in axis),
+    )
+    if not writeable:
+        res.flags.writable = False
+    return res
+
+
+def _is_nonoverlapping(shape, strides):
+    """Whether no two elements of a layout share memory. Sufficient check:
+    axes sorted by stride must each step over all elements spanned by axes
+    with smaller strides."""
+    if any(s == 0 for s in shape):
+        return True
+    span = 0
+    for s, st in sorted(
+        ((s, abs(st)) for s, st in zip(shape, strides) if s > 1),
+        key=lambda e: e[1],
+    ):
+        if st <= span:
+            return False
+        span += st * (s - 1)
+    return True
+
+
+def _overlapping_window_axes(x):
+    """Pair of axes `(i, j)`, `i < j`, of array `x` with equal non-zero
+    strides, such as the sliding and the window axis of a view made by
+    :func:`sliding_window_view`, if `x` has exactly one such pair, and
+    `None` otherwise"""
+    shape, strides = x.shape, x.strides
+    pairs = [
+        (i, j)
+        for i in range(x.ndim)
+        for j in range(i + 1, x.ndim)
+        if shape[i] > 1
+        and shape[j] > 1
+        and strides[i] == strides[j]
+        and strides[i] != 0
+    ]
+    return pairs[0] if len(pairs) == 1 else None
+
+
+def _window_base(x):
+    """For array `x` of overlapping windows, returns `(base, axes)`, where
+    `base` is a view of elements of `x` in which no elements overlap, and
+    element of `x` at index `idx` is element of `base` at index with
+    `idx[k]` summed along axis `axes[k]`. Returns `None` if `x` is not such
+    an array."""
+    pair = _overlapping_window_axes(x)
+    if pair is None:
+        return None
+    i, j = pair
+    shape = list(x.shape)
+    shape[i] += shape[j] - 1
+    del shape[j]
+    strides = list(x.strides)
+    del strides[j]
+    if not _is_nonoverlapping(shape, strides):
+        return None
+    axes = tuple(
+        k if k < j else (i if k == j else k - 1) for k in range(x.ndim)
+    )
+    return _strided_view(x, tuple(shape), tuple(strides)), axes
+
+
+def _windows_of(base, axes, shape):
+    "View of `base` of windows laid out as the array `base` was taken from"
+    base_strides = base.strides
+    return _strided_view(
+        base, shape, tuple(base_strides[ax] for ax in axes)
+    )
@@ -42,13 +42,128 @@ cdef Py_ssize_t shape_to_elem_count(int nd, Py_ssize_t *shape_arr):
     return count
 
 
+cdef Py_ssize_t* _meta_alloc(int nd, Py_ssize_t *inline_buf):
+    """
+    Returns storage for `nd` shape or strides values: `inline_buf` if it is
+    given and is large enough, newly allocated memory otherwise.
+    """
+    if (inline_buf and nd <= USM_ARRAY_INLINE_NDIM):
+        return inline_buf
+    return <Py_ssize_t*>PyMem_Malloc(nd * sizeof(Py_ssize_t))
+
+
+cdef void _meta_free(Py_ssize_t *ptr, Py_ssize_t *inline_buf):
+    """
+    Frees storage obtained from _meta_alloc
+    """
+    if (ptr and ptr != inline_buf):
+        PyMem_Free(ptr)
+
+
+cdef int _strided_contig_flag(
+    int nd, const Py_ssize_t *shape_arr, const Py_ssize_t *strides_arr,
+    Py_ssize_t elem_count, Py_ssize_t min_shift, Py_ssize_t max_shift):
+    """
+    Arguments: nd, shape, strides of non-empty array, number of its elements,
+        min and max displacement of its elements
+    Returns: enumeration for array contiguity
+    """
+    cdef int i
+    cdef int j
+    cdef bint all_incr = 1
+    cdef bint all_decr = 1
+    cdef bint strides_inspected = 0
+
+    if max_shift != min_shift + (elem_count - 1):
+        return 0  # non-contiguous
+    if elem_count == 1:
+        return (USM_ARRAY_C_CONTIGUOUS | USM_ARRAY_F_CONTIGUOUS)
+    if nd == 1:
+        if strides_arr[0] == 1:
+            return USM_ARRAY_C_CONTIGUOUS | USM_ARRAY_F_CONTIGUOUS
+        else:
+            return 0
+    i = 0
+    while i < nd:
+        if shape_arr[i] == 1:
+            i = i + 1
+            continue
+        j = i + 1
+        while (j < nd and shape_arr[j] == 1):
+            j = j + 1
+        if j < nd:
+            strides_inspected = 1
+            if all_incr:
+                all_incr = (
+                    (strides_arr[i] > 0) and
+                    (strides_arr[j] > 0) and
+                    (strides_arr[i] <= strides_arr[j])
+                )
+            if all_decr:
+                all_decr = (
+                    (strides_arr[i] > 0) and
+                    (strides_arr[j] > 0) and
+                    (strides_arr[i] >= strides_arr[j])
+                )
+            i = j
+        else:
+            if not strides_inspected:
+                # all dimensions have size 1 except
+                # dimension 'i'. Array is both C and F
+                # contiguous
+                strides_inspected = 1
+                all_incr = (strides_arr[i] == 1)
+                all_decr = all_incr
+            break
+    # should only set contig flags on actually obtained
+    # values, rather than default values
+    all_incr = all_incr and strides_inspected
+    all_decr = all_decr and strides_inspected
+    if all_incr and all_decr:
+        return (USM_ARRAY_C_CONTIGUOUS | USM_ARRAY_F_CONTIGUOUS)
+    elif all_incr:
+        return USM_ARRAY_F_CONTIGUOUS
+    elif all_decr:
+        return USM_ARRAY_C_CONTIGUOUS
+    return 0
+
+
+cdef int _contig_flag_from_shape_strides(
+    int nd, const Py_ssize_t *shape_arr, const Py_ssize_t *strides_arr):
+    """
+    Returns enumeration for contiguity of array with given shape and
+    strides C-arrays, computed as in _from_input_shape_strides
+    """
+    cdef int i
+    cdef Py_ssize_t elem_count = 1
+    cdef Py_ssize_t min_shift = 0
+    cdef Py_ssize_t max_shift = 0
+    cdef Py_ssize_t str_i
+
+    for i in range(nd):
+        elem_count *= shape_arr[i]
+    if elem_count == 0 or nd == 0:
+        return (USM_ARRAY_C_CONTIGUOUS | USM_ARRAY_F_CONTIGUOUS)
+    for i in range(nd):
+        str_i = strides_arr[i]
+        if str_i > 0:
+            max_shift += str_i * (shape_arr[i] - 1)
+        else:
+            min_shift += str_i * (shape_arr[i] - 1)
+    return _strided_contig_flag(
+        nd, shape_arr, strides_arr, elem_count, min_shift, max_shift)
+
+
 cdef int _from_input_shape_strides(
     int nd, object shape, object strides, int itemsize, char order,
     Py_ssize_t **shape_ptr, Py_ssize_t **strides_ptr,
     Py_ssize_t *nelems, Py_ssize_t *min_disp, Py_ssize_t *max_disp,
-    int *contig):
+    int *contig, Py_ssize_t *inline_shape, Py_ssize_t *inline_strides):
     """
-    Arguments: nd, shape, strides, itemsize, order
+    Arguments: nd, shape, strides, itemsize, order,
+        inline_shape, inline_strides - storage of USM_ARRAY_INLINE_NDIM
+            elements used instead of allocation for arrays of small
+            dimensionality, or NULL
     Modifies:
         shape_ptr - pointer to C array for shape values
         stride_ptr - pointer to C array for strides values
@@ -62,9 +177,6 @@ cdef int _from_input_shape_strides(
     """
     cdef int i
     cdef int j
-    cdef bint all_incr = 1
-    cdef bint all_decr = 1
-    cdef bint strides_inspected = 0
     cdef Py_ssize_t elem_count = 1
     cdef Py_ssize_t min_shift = 0
     cdef Py_ssize_t max_shift = 0
@@ -82,7 +194,7 @@ cdef int _from_input_shape_strides(
         strides_ptr[0] = <Py_ssize_t *>(<size_t>0)
         return 0
 
-    shape_arr = <Py_ssize_t*>PyMem_Malloc(nd * sizeof(Py_ssize_t))
+    shape_arr = _meta_alloc(nd, inline_shape)
     if (not shape_arr):
         return ERROR_MALLOC
     shape_ptr[0] = shape_arr
@@ -97,9 +209,9 @@ cdef int _from_input_shape_strides(
         if strides is None:
             strides_ptr[0] = <Py_ssize_t *>(<size_t>0)
         else:
-            strides_arr = <Py_ssize_t*>PyMem_Malloc(nd * sizeof(Py_ssize_t))
+            strides_arr = _meta_alloc(nd, inline_strides)
             if (not strides_arr):
-                PyMem_Free(shape_ptr[0]);
+                _meta_free(shape_ptr[0], inline_shape)
                 shape_ptr[0] = <Py_ssize_t *>(<size_t>0)
                 return ERROR_MALLOC
             strides_ptr[0] = strides_arr
@@ -110,7 +222,7 @@ cdef int _from_input_shape_strides(
     if (strides is None):
         # no need to allocate and populate strides
         if (int(order) not in [ord('C'), ord('F'), ord('c'), ord('f')]):
-            PyMem_Free(shape_ptr[0]);
+            _meta_free(shape_ptr[0], inline_shape)
             shape_ptr[0] = <Py_ssize_t *>(<size_t>0)
             return ERROR_INCORRECT_ORDER
         if order == <char> ord('C') or order == <char> ord('c'):
@@ -132,9 +244,9 @@ cdef int _from_input_shape_strides(
         return 0
     elif ((isinstance(strides, (list, tuple)) or hasattr(strides, 'tolist'))
           and len(strides) == nd):
-        strides_arr = <Py_ssize_t*>PyMem_Malloc(nd * sizeof(Py_ssize_t))
+        strides_arr = _meta_alloc(nd, inline_strides)
         if (not strides_arr):
-            PyMem_Free(shape_ptr[0]);
+            _meta_free(shape_ptr[0], inline_shape)
             shape_ptr[0] = <Py_ssize_t *>(<size_t>0)
             return ERROR_MALLOC
         strides_ptr[0] = strides_arr
@@ -147,66 +259,11 @@ cdef int _from_input_shape_strides(
                 min_shift += str_i * (shape_arr[i] - 1)
         min_disp[0] = min_shift
         max_disp[0] = max_shift
-        if max_shift == min_shift + (elem_count - 1):
-            if elem_count == 1:
-                contig[0] = (USM_ARRAY_C_CONTIGUOUS | USM_ARRAY_F_CONTIGUOUS)
-                return 0
-            if nd == 1:
-                if strides_arr[0] == 1:
-                    contig[0] = USM_ARRAY_C_CONTIGUOUS | USM_ARRAY_F_CONTIGUOUS
-                else:
-                    contig[0] = 0
-                return 0
-            i = 0
-            while i < nd:
-                if shape_arr[i] == 1:
-                    i = i + 1
-                    continue
-                j = i + 1
-                while (j < nd and shape_arr[j] == 1):
-                    j = j + 1
-                if j < nd:
-                    strides_inspected = 1
-                    if all_incr:
-                        all_incr = (
-                            (strides_arr[i] > 0) and
-                            (strides_arr[j] > 0) and
-                            (strides_arr[i] <= strides_arr[j])
-                        )
-                    if all_decr:
-                        all_decr = (
-                            (strides_arr[i] > 0) and
-                            (strides_arr[j] > 0) and
-                            (strides_arr[i] >= strides_arr[j])
-                        )
-                    i = j
-                else:
-                    if not strides_inspected:
-                        # all dimensions have size 1 except
-                        # dimension 'i'. Array is both C and F
-                        # contiguous
-                        strides_inspected = 1
-                        all_incr = (strides_arr[i] == 1)
-                        all_decr = all_incr
-                    break
-            # should only set contig flags on actually obtained
-            # values, rather than default values
-            all_incr = all_incr and strides_inspected
-            all_decr = all_decr and strides_inspected
-            if all_incr and all_decr:
-                contig[0] = (USM_ARRAY_C_CONTIGUOUS | USM_ARRAY_F_CONTIGUOUS)
-            elif all_incr:
-                contig[0] = USM_ARRAY_F_CONTIGUOUS
-            elif all_decr:
-                contig[0] = USM_ARRAY_C_CONTIGUOUS
-            else:
-                contig[0] = 0
-            return 0
-        else:
-            contig[0] = 0  # non-contiguous
+        contig[0] = _strided_contig_flag(
+            nd, shape_arr, strides_arr, elem_count, min_shift, max_shift)
         return 0
     else:
-        PyMem_Free(shape_ptr[0]);
+        _meta_free(shape_ptr[0], inline_shape)
         shape_ptr[0] = <Py_ssize_t *>(<size_t>0)
         return ERROR_UNEXPECTED_STRIDES
     # return ERROR_INTERNAL
@@ -229,26 +286,6 @@ cdef object _make_int_tuple(int nd, const Py_ssize_t *ary):
         return None
 
 
-cdef object _make_reversed_int_tuple(int nd, const Py_ssize_t *ary):
-    """
-    Makes Python reversed tuple from C array
-    """
-    cdef tuple res
-    cdef object tmp
-    cdef int i
-    cdef int nd_1
-    if (ary):
-        res = PyTuple_New(nd)
-        nd_1 = nd - 1
-        for i in range(nd):
-            tmp = <object>ary[i]
-            Py_INCREF(tmp)  # SetItem steals the reference
-            PyTuple_SetItem(res, nd_1 - i, tmp)
-        return res
-    else:
-        return None
-
-
 cdef object _c_contig_strides(int nd, Py_ssize_t *shape):
     """
     Makes Python tuple for strides of C-contiguous array
@@ -275,28 +312,3 @@ cdef object _f_contig_strides(int nd, Py_ssize_t *shape):
         PyTuple_SetItem(fc_strides, i, si)
         si = si * shape[i]
     return fc_strides
-
-cdef object _swap_last_two(tuple t):
-    """
-    Swap last two elements of a tuple
-    """
-    cdef int nd = len(t)
-    cdef tuple res
-    cdef int i
-    cdef object tmp
-    if (nd < 2):
-        return t
-    res = PyTuple_New(nd)
-    # copy all elements except the last two
-    for i in range(0, nd-2):
-        tmp = t[i]
-        Py_INCREF(tmp)  # SetItem steals the reference
-        PyTuple_SetItem(res, i, tmp)
-    # swap the last two elements
-    tmp = t[nd-1]
-    Py_INCREF(tmp)  # SetItem steals
-    PyTuple_SetItem(res, nd - 2, tmp)
-    tmp = t[nd-2]
-    Py_INCREF(tmp)  # SetItem steals
-    PyTuple_SetItem(res, nd - 1, tmp)
-    return res
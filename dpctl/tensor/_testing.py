@@ -19,95 +19,15 @@ import numpy as np
 import dpctl.tensor as dpt
 import dpctl.utils as du
 
+from ._lazy_extension import tensor_elementwise_impl as tei
 from ._manipulation_functions import _broadcast_shape_impl
 from ._type_utils import _to_device_supported_dtype
 
 
-def _allclose_complex_fp(z1, z2, atol, rtol, equal_nan):
-    z1r = dpt.real(z1)
-    z1i = dpt.imag(z1)
-    z2r = dpt.real(z2)
-    z2i = dpt.imag(z2)
-    if equal_nan:
-        check1 = dpt.all(dpt.isnan(z1r) == dpt.isnan(z2r)) and dpt.all(
-            dpt.isnan(z1i) == dpt.isnan(z2i)
-        )
-    else:
-        check1 = (
-            dpt.logical_not(dpt.any(dpt.isnan(z1r)))
-            and dpt.logical_not(dpt.any(dpt.isnan(z1i)))
-        ) and (
-            dpt.logical_not(dpt.any(dpt.isnan(z2r)))
-            and dpt.logical_not(dpt.any(dpt.isnan(z2i)))
-        )
-    if not check1:
-        return check1
-    mr = dpt.isinf(z1r)
-    mi = dpt.isinf(z1i)
-    check2 = dpt.all(mr == dpt.isinf(z2r)) and dpt.all(mi == dpt.isinf(z2i))
-    if not check2:
-        return check2
-    check3 = dpt.all(z1r[mr] == z2r[mr]) and dpt.all(z1i[mi] == z2i[mi])
-    if not check3:
-        return check3
-    mr = dpt.isfinite(z1r)
-    mi = dpt.isfinite(z1i)
-    mv1 = z1r[mr]
-    mv2 = z2r[mr]
-    check4 = dpt.all(
-        dpt.abs(mv1 - mv2)
-        < dpt.maximum(atol, rtol * dpt.maximum(dpt.abs(mv1), dpt.abs(mv2)))
-    )
-    if not check4:
-        return check4
-    mv1 = z1i[mi]
-    mv2 = z2i[mi]
-    check5 = dpt.all(
-        dpt.abs(mv1 - mv2)
-        <= dpt.maximum(atol, rtol * dpt.maximum(dpt.abs(mv1), dpt.abs(mv2)))
-    )
-    return check5
-
-
-def _allclose_real_fp(r1, r2, atol, rtol, equal_nan):
-    if equal_nan:
-        check1 = dpt.all(dpt.isnan(r1) == dpt.isnan(r2))
-    else:
-        check1 = dpt.logical_not(dpt.any(dpt.isnan(r1))) and dpt.logical_not(
-            dpt.any(dpt.isnan(r2))
-        )
-    if not check1:
-        return check1
-    mr = dpt.isinf(r1)
-    check2 = dpt.all(mr == dpt.isinf(r2))
-    if not check2:
-        return check2
-    check3 = dpt.all(r1[mr] == r2[mr])
-    if not check3:
-        return check3
-    m = dpt.isfinite(r1)
-    mv1 = r1[m]
-    mv2 = r2[m]
-    check4 = dpt.all(
-        dpt.abs(mv1 - mv2)
-        <= dpt.maximum(atol, rtol * dpt.maximum(dpt.abs(mv1), dpt.abs(mv2)))
-    )
-    return check4
-
-
-def _allclose_others(r1, r2):
-    return dpt.all(r1 == r2)
-
-
-def allclose(a1, a2, atol=1e-8, rtol=1e-5, equal_nan=False):
-    """allclose(a1, a2, atol=1e-8, rtol=1e-5, equal_nan=False)
-
-    Returns True if two arrays are element-wise equal within tolerances.
-
-    The testing is based on the following elementwise comparison:
-
-           abs(a - b) <= max(atol, rtol * max(abs(a), abs(b)))
-    """
+def _closeness_args(a1, a2, atol, rtol, equal_nan):
+    """Validates arguments of `isclose` and `allclose`, and returns inputs
+    cast to their common data type and broadcast to the common shape, along
+    with execution queue, USM type of the result and tolerances"""
     if not isinstance(a1, dpt.usm_ndarray):
         raise TypeError(
             f"Expected dpctl.tensor.usm_ndarray type, got {type(a1)}."
@@ -129,12 +49,11 @@ def allclose(a1, a2, atol=1e-8, rtol=1e-5, equal_nan=False):
             "Execution placement can not be unambiguously inferred "
             "from input arguments."
         )
+    res_usm_type = du.get_coerced_usm_type((a1.usm_type, a2.usm_type))
     res_sh = _broadcast_shape_impl([a1.shape, a2.shape])
     b1 = a1
     b2 = a2
-    if b1.dtype == b2.dtype:
-        res_dt = b1.dtype
-    else:
+    if b1.dtype != b2.dtype:
         res_dt = np.promote_types(b1.dtype, b2.dtype)
         res_dt = _to_device_supported_dtype(res_dt, exec_q.sycl_device)
         b1 = dpt.astype(b1, res_dt)
@@ -142,11 +61,74 @@ def allclose(a1, a2, atol=1e-8, rtol=1e-5, equal_nan=False):
 
     b1 = dpt.broadcast_to(b1, res_sh)
     b2 = dpt.broadcast_to(b2, res_sh)
+    return b1, b2, exec_q, res_usm_type, atol, rtol, equal_nan
+
+
+def isclose(a1, a2, atol=1e-8, rtol=1e-5, equal_nan=False):
+    """isclose(a1, a2, atol=1e-8, rtol=1e-5, equal_nan=False)
+
+    Returns a boolean array whose elements are True where elements of two
+    arrays are equal within tolerances.
 
-    k = b1.dtype.kind
-    if k == "c":
-        return _allclose_complex_fp(b1, b2, atol, rtol, equal_nan)
-    elif k == "f":
-        return _allclose_real_fp(b1, b2, atol, rtol, equal_nan)
-    else:
-        return _allclose_others(b1, b2)
+    Floating point elements are close if both are NaN and `equal_nan`
+    is True, if both are infinities of the same sign, or if both are
+    finite and
+
+           abs(a - b) <= max(atol, rtol * max(abs(a), abs(b)))
+
+    Complex elements are close if both their real and imaginary parts
+    are close. Elements of integral data types are close if they satisfy
+    the same inequality, as in :func:`numpy.isclose`. Elements of boolean
+    data type are close if they are equal.
+
+    The test is performed by a single kernel.
+    """
+    b1, b2, exec_q, usm_type, atol, rtol, equal_nan = _closeness_args(
+        a1, a2, atol, rtol, equal_nan
+    )
+    res = dpt.empty(
+        b1.shape, dtype=dpt.bool, usm_type=usm_type, sycl_queue=exec_q
+    )
+    ht_ev, _ = tei._isclose(
+        src1=b1,
+        src2=b2,
+        dst=res,
+        atol=atol,
+        rtol=rtol,
+        equal_nan=equal_nan,
+        sycl_queue=exec_q,
+    )
+    ht_ev.wait()
+    return res
+
+
+def allclose(a1, a2, atol=1e-8, rtol=1e-5, equal_nan=False):
+    """allclose(a1, a2, atol=1e-8, rtol=1e-5, equal_nan=False)
+
+    Returns True if two arrays are element-wise equal within tolerances.
+
+    The testing is based on the following elementwise comparison:
+
+           abs(a - b) <= max(atol, rtol * max(abs(a), abs(b)))
+
+    See :func:`dpctl.tensor.isclose` for treatment of NaN, infinite,
+    complex and integral values. The result is a zero-dimensional boolean array
+    computed by a single reduction kernel without intermediate arrays.
+    """
+    b1, b2, exec_q, usm_type, atol, rtol, equal_nan = _closeness_args(
+        a1, a2, atol, rtol, equal_nan
+    )
+    res = dpt.empty(
+        tuple(), dtype=dpt.bool, usm_type=usm_type, sycl_queue=exec_q
+    )
+    ht_ev, _ = tei._allclose(
+        src1=b1,
+        src2=b2,
+        dst=res,
+        atol=atol,
+        rtol=rtol,
+        equal_nan=equal_nan,
+        sycl_queue=exec_q,
+    )
+    ht_ev.wait()
+    return res
@@ -0,0 +1,239 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import os
+import threading
+import weakref
+from collections import deque
+
+import dpctl
+import dpctl.memory as dpm
+import dpctl.tensor as dpt
+
+__doc__ = (
+    "Implementation of prefetching and memory advice for arrays allocated "
+    "in shared USM"
+)
+
+_HOST = "host"
+_DEVICE = "device"
+
+_prefetch_enabled = os.environ.get(
+    "DPCTL_TENSOR_SHARED_PREFETCH", "1"
+).lower() not in ("0", "false", "off")
+
+_lock = threading.Lock()
+# Allocations are identified by the address of their first byte, shared by
+# all views. Memory objects do not support weak references, so a record is
+# dropped once the arrays which used the allocation are all deleted, before
+# the address can be reused.
+_records = dict()
+# weak references to arrays counted by records, by id of the array
+_arrays = dict()
+# references to deleted arrays, appended by weak reference callbacks, which
+# may run while the lock is held, and processed under the lock
+_deleted = deque()
+# prefetches which may still be running, with allocations they migrate
+_pending = []
+
+# values of advice setting and clearing read-mostly hint, by backend
+_read_mostly_advice = {
+    # ze_memory_advice_t
+    dpctl.backend_type.level_zero: (0, 1),
+    # PI_MEM_ADVICE_CUDA_SET_READ_MOSTLY, PI_MEM_ADVICE_CUDA_UNSET_READ_MOSTLY
+    dpctl.backend_type.cuda: (1, 2),
+}
+
+
+class _Record:
+    __slots__ = ("side", "prefetch", "read_mostly", "n_arrays")
+
+    def __init__(self):
+        self.side = None
+        self.prefetch = True
+        self.read_mostly = False
+        self.n_arrays = 0
+
+
+class _ArrayRef(weakref.ref):
+    __slots__ = ("array_id", "key")
+
+
+def _shared_data(x):
+    "USM allocation of array `x`, if it is shared, `None` otherwise"
+    if isinstance(x, dpt.usm_ndarray):
+        m = x.usm_data
+        if isinstance(m, dpm.MemoryUSMShared):
+            return m
+    return None
+
+
+def _purge():
+    "Drops records of deleted arrays and completed prefetches, under lock"
+    while _deleted:
+        ref = _deleted.popleft()
+        if _arrays.get(ref.array_id) is ref:
+            del _arrays[ref.array_id]
+        rec = _records.get(ref.key)
+        if rec is not None:
+            rec.n_arrays -= 1
+            if rec.n_arrays == 0:
+                del _records[ref.key]
+    if _pending:
+        _pending[:] = [
+            (e, m)
+            for e, m in _pending
+            if e.execution_status != dpctl.event_status_type.complete
+        ]
+
+
+def _record(x, m, create=True):
+    """Record of shared USM allocation `m` of array `x`, counting `x` among
+    arrays which keep it, under lock"""
+    _purge()
+    key = m._pointer
+    rec = _records.get(key)
+    if rec is None:
+        if not create:
+            return None
+        rec = _Record()
+        _records[key] = rec
+    i = id(x)
+    ref = _arrays.get(i)
+    if ref is None or ref() is not x:
+        ref = _ArrayRef(x, _deleted.append)
+        ref.array_id = i
+        ref.key = key
+        _arrays[i] = ref
+        rec.n_arrays += 1
+    return rec
+
+
+def _last_access_side(x):
+    """Side, `"host"` or `"device"`, which last accessed the shared USM
+    allocation of array `x`, or `None` if it is not known"""
+    m = _shared_data(x)
+    if m is None:
+        return None
+    with _lock:
+        rec = _record(x, m, create=False)
+        return None if rec is None else rec.side
+
+
+def _mark_host_access(x):
+    """Records that host code accessed the shared USM allocation of `x`"""
+    m = _shared_data(x)
+    if m is not None:
+        with _lock:
+            _record(x, m).side = _HOST
+
+
+def prefetch_for_kernel(q, *arrays):
+    """Submits to queue `q` migration of shared USM allocations of arrays
+    among `arrays`, which kernels about to be submitted to `q` access,
+    unless they were last accessed on the device, and records that they
+    were. Arguments which are not arrays are ignored.
+
+    Prefetching is a hint which does not affect results, so kernels need
+    not depend on it."""
+    if not _prefetch_enabled:
+        return
+    to_prefetch = []
+    with _lock:
+        for x in arrays:
+            m = _shared_data(x)
+            if m is None:
+                continue
+            rec = _record(x, m)
+            if rec.side != _DEVICE and rec.prefetch:
+                to_prefetch.append(m)
+            rec.side = _DEVICE
+    for m in to_prefetch:
+        e = q.prefetch_async(m)
+        with _lock:
+            _pending.append((e, m))
+
+
+def set_usm_advice(x, /, *, read_mostly=None, prefetch=None):
+    """set_usm_advice(x, read_mostly=None, prefetch=None)
+
+    Sets how memory of array `x`, allocated in shared USM, is handled when
+    `dpctl.tensor` functions use it. Settings apply to the whole USM
+    allocation of `x`, i.e. to all arrays viewing it. Arrays allocated in
+    other kinds of USM are left unchanged.
+
+    Before functions submit kernels which read shared USM arrays last
+    accessed on the host, such as arrays wrapping memory populated by
+    host code, the allocations are prefetched to the device. Prefetching
+    may be disabled altogether by setting environment variable
+    ``DPCTL_TENSOR_SHARED_PREFETCH`` to ``0``.
+
+    Settings are kept as long as an array viewing the allocation, which was
+    passed to this function or to a `dpctl.tensor` function, is alive.
+
+    Args:
+        x (usm_ndarray):
+            array.
+        read_mostly (Optional[bool]):
+            if `True`, advises the runtime that the allocation is mostly
+            read, so that it may keep copies of its pages on both the host
+            and the device instead of migrating them. If `False`, clears
+            the advice. Only applied on Level Zero and CUDA devices.
+            Default: `None`, which leaves the advice unchanged.
+        prefetch (Optional[bool]):
+            whether the allocation is prefetched before kernels read it.
+            Default: `None`, which leaves the setting unchanged.
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    m = _shared_data(x)
+    if m is None:
+        return
+    with _lock:
+        rec = _record(x, m)
+        if prefetch is not None:
+            rec.prefetch = bool(prefetch)
+        apply_advice = (
+            read_mostly is not None and bool(read_mostly) != rec.read_mostly
+        )
+        if apply_advice:
+            rec.read_mostly = bool(read_mostly)
+    if apply_advice:
+        q = x.sycl_queue
+        advice = _read_mostly_advice.get(q.sycl_device.backend)
+        if advice is not None:
+            q.mem_advise(m, m.nbytes, advice[0 if read_mostly else 1])
+
+
+def get_usm_advice(x, /):
+    """get_usm_advice(x)
+
+    Returns settings of :func:`dpctl.tensor.set_usm_advice` for the USM
+    allocation of array `x`.
+
+    Returns:
+        dict:
+            dictionary with keys `"read_mostly"` and `"prefetch"`, or
+            `None` if `x` is not allocated in shared USM.
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    m = _shared_data(x)
+    if m is None:
+        return None
+    with _lock:
+        rec = _record(x, m, create=False) or _Record()
+        return {"read_mostly": rec.read_mostly, "prefetch": rec.prefetch}
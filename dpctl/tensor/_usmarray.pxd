@@ -43,6 +43,12 @@ cdef public api int UAR_TYPE_SENTINEL
 cdef public api int UAR_HALF
 
 
+# arrays with at most this many dimensions keep their shape and strides
+# in storage inline in the array object
+cdef enum:
+    USM_ARRAY_INLINE_NDIM = 8
+
+
 cdef api class usm_ndarray [object PyUSMArrayObject, type PyUSMArrayType]:
     # data fields
     cdef char* data_
@@ -55,6 +61,10 @@ cdef api class usm_ndarray [object PyUSMArrayObject, type PyUSMArrayType]:
     cdef object array_namespace_
     # make usm_ndarray weak-referenceable
     cdef object __weakref__
+    # appended after fields of the public struct, whose layout extensions
+    # compiled against earlier versions rely on
+    cdef Py_ssize_t inline_shape_[USM_ARRAY_INLINE_NDIM]
+    cdef Py_ssize_t inline_strides_[USM_ARRAY_INLINE_NDIM]
 
     cdef void _reset(usm_ndarray self)
     cdef void _cleanup(usm_ndarray self)
@@ -30,6 +30,7 @@ from ._device import Device
 from ._print import usm_ndarray_repr, usm_ndarray_str
 
 from cpython.mem cimport PyMem_Free
+from cpython.slice cimport PySlice_GetIndicesEx
 from cpython.tuple cimport PyTuple_New, PyTuple_SetItem
 
 cimport dpctl as c_dpctl
@@ -52,6 +53,11 @@ cdef class InternalUSMArrayError(Exception):
     pass
 
 
+# passed as shape to usm_ndarray.__new__ by _make_view, which populates
+# the array metadata itself
+cdef object _view_token = object()
+
+
 cdef object _as_zero_dim_ndarray(object usm_ary):
     "Convert size-1 array to NumPy 0d array"
     mem_view = dpmem.as_usm_memory(usm_ary)
@@ -151,10 +157,8 @@ cdef class usm_ndarray:
         self.flags_ = 0
 
     cdef void _cleanup(usm_ndarray self):
-        if (self.shape_):
-            PyMem_Free(self.shape_)
-        if (self.strides_):
-            PyMem_Free(self.strides_)
+        _meta_free(self.shape_, self.inline_shape_)
+        _meta_free(self.strides_, self.inline_strides_)
         self._reset()
 
     def __cinit__(self, shape, dtype=None, strides=None, buffer='device',
@@ -182,6 +186,8 @@ cdef class usm_ndarray:
         cdef bint is_fp16 = False
 
         self._reset()
+        if shape is _view_token:
+            return
         if (not isinstance(shape, (list, tuple))
                 and not hasattr(shape, 'tolist')):
             try:
@@ -214,7 +220,8 @@ cdef class usm_ndarray:
         err = _from_input_shape_strides(
             nd, shape, strides, itemsize, <char> ord(order),
             &shape_ptr, &strides_ptr, &ary_nelems,
-            &ary_min_displacement, &ary_max_displacement, &contig_flag
+            &ary_min_displacement, &ary_max_displacement, &contig_flag,
+            self.inline_shape_, self.inline_strides_
         )
         if (err):
             self._cleanup()
@@ -532,13 +539,12 @@ cdef class usm_ndarray:
             self.get_itemsize(),
             b"C",
             &shape_ptr, &strides_ptr,
-            &nelems, &min_disp, &max_disp, &contig_flag
+            &nelems, &min_disp, &max_disp, &contig_flag,
+            NULL, NULL
         )
         if (err == 0):
-            if (self.shape_):
-                PyMem_Free(self.shape_)
-            if (self.strides_):
-                PyMem_Free(self.strides_)
+            _meta_free(self.shape_, self.inline_shape_)
+            _meta_free(self.strides_, self.inline_strides_)
             self.flags_ = contig_flag
             self.nd_ = new_nd
             self.shape_ = shape_ptr
@@ -698,13 +704,19 @@ cdef class usm_ndarray:
             return _imag_view(self)
 
     def __getitem__(self, ind):
-        cdef tuple _meta = _basic_slice_meta(
-            ind, (<object>self).shape, (<object> self).strides,
-            self.get_offset())
+        cdef tuple _meta
         cdef usm_ndarray res
         cdef int i = 0
         cdef bint matching = 1
 
+        # views for indices without arrays are made from C-level metadata
+        res = _basic_view(self, ind)
+        if res is not None:
+            return res
+
+        _meta = _basic_slice_meta(
+            ind, (<object>self).shape, (<object> self).strides,
+            self.get_offset())
         if len(_meta) < 5:
             raise RuntimeError
 
@@ -725,7 +737,11 @@ cdef class usm_ndarray:
         if adv_ind_start_p < 0:
             return res
 
-        from ._copy_utils import _extract_impl, _nonzero_impl, _take_multi_index
+        from ._copy_utils import (
+            _adv_ind_to_integer,
+            _extract_impl,
+            _take_multi_index,
+        )
         if len(adv_ind) == 1 and adv_ind[0].dtype == dpt_bool:
             key_ = adv_ind[0]
             adv_ind_end_p = key_.ndim + adv_ind_start_p
@@ -743,13 +759,10 @@ cdef class usm_ndarray:
             return res
 
         if any(ind.dtype == dpt_bool for ind in adv_ind):
-            adv_ind_int = list()
-            for ind in adv_ind:
-                if ind.dtype == dpt_bool:
-                    adv_ind_int.extend(_nonzero_impl(ind))
-                else:
-                    adv_ind_int.append(ind)
-            return _take_multi_index(res, tuple(adv_ind_int), adv_ind_start_p)
+            res, adv_ind_int = _adv_ind_to_integer(
+                res, adv_ind, adv_ind_start_p
+            )
+            return _take_multi_index(res, adv_ind_int, adv_ind_start_p)
 
         return _take_multi_index(res, adv_ind, adv_ind_start_p)
 
@@ -1040,9 +1053,9 @@ cdef class usm_ndarray:
         Xv.array_namespace_ = self.array_namespace_
 
         from ._copy_utils import (
+            _adv_ind_to_integer,
             _copy_from_numpy_into,
             _copy_from_usm_ndarray_to_usm_ndarray,
-            _nonzero_impl,
             _place_impl,
             _put_multi_index,
         )
@@ -1087,13 +1100,10 @@ cdef class usm_ndarray:
             return
 
         if any(ind.dtype == dpt_bool for ind in adv_ind):
-            adv_ind_int = list()
-            for ind in adv_ind:
-                if ind.dtype == dpt_bool:
-                    adv_ind_int.extend(_nonzero_impl(ind))
-                else:
-                    adv_ind_int.append(ind)
-            _put_multi_index(Xv, tuple(adv_ind_int), adv_ind_start_p, rhs)
+            Xv, adv_ind_int = _adv_ind_to_integer(
+                Xv, adv_ind, adv_ind_start_p
+            )
+            _put_multi_index(Xv, adv_ind_int, adv_ind_start_p, rhs)
             return
 
         _put_multi_index(Xv, adv_ind, adv_ind_start_p, rhs)
@@ -1197,45 +1207,205 @@ cdef class usm_ndarray:
     def __repr__(self):
         return usm_ndarray_repr(self)
 
+    def __reduce_ex__(self, protocol):
+        """
+        Supports pickling. Elements are pickled by the
+        :class:`dpctl.memory.MemoryUSM*` object holding them, which
+        uses out-of-band buffers with pickle protocol 5. Arrays which do
+        not span their whole allocation contiguously are copied first.
+        """
+        cdef usm_ndarray ary = self
+        cdef bint is_contig = (
+            (self.flags_ & USM_ARRAY_C_CONTIGUOUS) or
+            (self.flags_ & USM_ARRAY_F_CONTIGUOUS)
+        )
+        if self.size == 0:
+            return _usm_ndarray_from_pickle, (
+                self.shape, self.dtype, None, self.usm_type,
+                bool(self.flags_ & USM_ARRAY_WRITABLE)
+            )
+        if (not is_contig or self.get_offset() != 0 or
+                self.nbytes != self.usm_data.nbytes):
+            ary = dpctl.tensor.copy(self, order="K")
+        return _usm_ndarray_from_pickle, (
+            ary.shape, ary.dtype, ary.strides, ary.usm_data,
+            bool(self.flags_ & USM_ARRAY_WRITABLE)
+        )
+
 
-cdef usm_ndarray _real_view(usm_ndarray ary):
+cdef usm_ndarray _make_view(
+    usm_ndarray parent, int nd, const Py_ssize_t *shape,
+    const Py_ssize_t *strides, char *data, int typenum
+):
     """
-    View into real parts of a complex type array
+    Construct view into memory of `parent` with given shape, strides in
+    elements, pointer to zero-index element and type number, bypassing
+    validation done by the constructor. Writable flag and array namespace
+    are inherited from `parent`.
     """
-    cdef int r_typenum_ = -1
-    cdef usm_ndarray r = None
-    cdef Py_ssize_t offset_elems = 0
+    cdef usm_ndarray r = usm_ndarray.__new__(usm_ndarray, _view_token)
+    cdef Py_ssize_t *shape_arr = NULL
+    cdef Py_ssize_t *strides_arr = NULL
+    cdef int i
+
+    if nd > 0:
+        shape_arr = _meta_alloc(nd, r.inline_shape_)
+        strides_arr = _meta_alloc(nd, r.inline_strides_)
+        if (not shape_arr or not strides_arr):
+            _meta_free(shape_arr, r.inline_shape_)
+            _meta_free(strides_arr, r.inline_strides_)
+            raise MemoryError("Memory allocation for shape/strides "
+                              "array failed.")
+        for i in range(nd):
+            shape_arr[i] = shape[i]
+            strides_arr[i] = strides[i]
+    r.base_ = parent.base_
+    r.data_ = data
+    r.nd_ = nd
+    r.shape_ = shape_arr
+    r.strides_ = strides_arr
+    r.typenum_ = typenum
+    r.flags_ = (
+        _contig_flag_from_shape_strides(nd, shape_arr, strides_arr) |
+        (parent.flags_ & USM_ARRAY_WRITABLE)
+    )
+    r.array_namespace_ = parent.array_namespace_
+    return r
 
-    if (ary.typenum_ == UAR_CFLOAT):
-        r_typenum_ = UAR_FLOAT
-    elif (ary.typenum_ == UAR_CDOUBLE):
-        r_typenum_ = UAR_DOUBLE
+
+cdef void _fill_strides(usm_ndarray ary, Py_ssize_t *out):
+    """
+    Write strides of `ary` into `out`, including strides of contiguous
+    arrays which are not stored
+    """
+    cdef int nd = ary.nd_
+    cdef int i
+    cdef Py_ssize_t si = 1
+
+    if (ary.strides_):
+        for i in range(nd):
+            out[i] = ary.strides_[i]
+    elif (ary.flags_ & USM_ARRAY_C_CONTIGUOUS):
+        for i in range(nd - 1, -1, -1):
+            out[i] = si
+            si *= ary.shape_[i]
     else:
-        raise InternalUSMArrayError(
-            "_real_view call on array of non-complex type.")
-
-    offset_elems = ary.get_offset() * 2
-    r = usm_ndarray.__new__(
-        usm_ndarray,
-        _make_int_tuple(ary.nd_, ary.shape_) if ary.nd_ > 0 else tuple(),
-        dtype=_make_typestr(r_typenum_),
-        strides=tuple(2 * si for si in ary.strides),
-        buffer=ary.base_,
-        offset=offset_elems,
-        order=('C' if (ary.flags_ & USM_ARRAY_C_CONTIGUOUS) else 'F')
+        for i in range(nd):
+            out[i] = si
+            si *= ary.shape_[i]
+
+
+cdef usm_ndarray _basic_view(usm_ndarray ary, object ind):
+    """
+    Make view for basic index `ind` composed of integers, slices, `None`
+    and an `Ellipsis`, computing its layout from metadata of `ary`
+    directly. Returns `None` for other indices, and for indices that are
+    out of range, which are left to `_basic_slice_meta`.
+    """
+    cdef Py_ssize_t *shape = ary.shape_
+    cdef Py_ssize_t strides[USM_ARRAY_INLINE_NDIM]
+    cdef Py_ssize_t new_shape[USM_ARRAY_INLINE_NDIM]
+    cdef Py_ssize_t new_strides[USM_ARRAY_INLINE_NDIM]
+    cdef int nd = ary.nd_
+    cdef int new_nd = 0
+    cdef int axes_referenced = 0
+    cdef int ellipsis_len = 0
+    cdef int i = 0
+    cdef int j = 0
+    cdef int k = 0
+    cdef bint has_ellipsis = False
+    cdef bint is_empty = False
+    cdef Py_ssize_t disp = 0
+    cdef Py_ssize_t sl_start = 0
+    cdef Py_ssize_t sl_stop = 0
+    cdef Py_ssize_t sl_step = 0
+    cdef Py_ssize_t sh_i = 0
+    cdef Py_ssize_t ind_i = 0
+    cdef tuple ind_t
+
+    if nd > USM_ARRAY_INLINE_NDIM:
+        return None
+    if type(ind) is tuple:
+        ind_t = <tuple>ind
+    else:
+        ind_t = (ind,)
+    for o in ind_t:
+        if type(o) is int or type(o) is slice:
+            axes_referenced += 1
+        elif o is Ellipsis:
+            if has_ellipsis:
+                return None
+            has_ellipsis = True
+        elif o is not None:
+            return None
+    if axes_referenced > nd:
+        return None
+    if has_ellipsis:
+        ellipsis_len = nd - axes_referenced
+    _fill_strides(ary, strides)
+    for o in ind_t:
+        if o is None:
+            if new_nd == USM_ARRAY_INLINE_NDIM:
+                return None
+            new_shape[new_nd] = 1
+            new_strides[new_nd] = 0
+            new_nd += 1
+        elif o is Ellipsis:
+            if new_nd + ellipsis_len > USM_ARRAY_INLINE_NDIM:
+                return None
+            for j in range(ellipsis_len):
+                new_shape[new_nd] = shape[k]
+                new_strides[new_nd] = strides[k]
+                if shape[k] == 0:
+                    is_empty = True
+                    disp = 0
+                new_nd += 1
+                k += 1
+        elif type(o) is slice:
+            if new_nd == USM_ARRAY_INLINE_NDIM:
+                return None
+            PySlice_GetIndicesEx(
+                o, shape[k], &sl_start, &sl_stop, &sl_step, &sh_i)
+            new_shape[new_nd] = sh_i
+            new_strides[new_nd] = (1 if sh_i == 0 else sl_step) * strides[k]
+            if sh_i > 0 and not is_empty:
+                disp += sl_start * strides[k]
+            if sh_i == 0:
+                is_empty = True
+                disp = 0
+            new_nd += 1
+            k += 1
+        else:
+            if not (-shape[k] <= o < shape[k]):
+                return None
+            ind_i = o
+            if ind_i < 0:
+                ind_i += shape[k]
+            if not is_empty:
+                disp += ind_i * strides[k]
+            k += 1
+    if new_nd + (nd - k) > USM_ARRAY_INLINE_NDIM:
+        return None
+    for j in range(k, nd):
+        new_shape[new_nd] = shape[j]
+        new_strides[new_nd] = strides[j]
+        new_nd += 1
+    return _make_view(
+        ary, new_nd, new_shape, new_strides,
+        ary.data_ + disp * ary.get_itemsize(), ary.typenum_
     )
-    r.flags_ |= (ary.flags_ & USM_ARRAY_WRITABLE)
-    r.array_namespace_ = ary.array_namespace_
-    return r
 
 
-cdef usm_ndarray _imag_view(usm_ndarray ary):
+cdef usm_ndarray _component_view(usm_ndarray ary, int part):
     """
-    View into imaginary parts of a complex type array
+    View into real (`part` is 0) or imaginary (`part` is 1) parts of a
+    complex type array
     """
     cdef int r_typenum_ = -1
-    cdef usm_ndarray r = None
-    cdef Py_ssize_t offset_elems = 0
+    cdef int nd = ary.nd_
+    cdef int i
+    cdef Py_ssize_t buf[USM_ARRAY_INLINE_NDIM]
+    cdef Py_ssize_t *strides = NULL
 
     if (ary.typenum_ == UAR_CFLOAT):
         r_typenum_ = UAR_FLOAT
@@ -1243,58 +1413,117 @@ cdef usm_ndarray _imag_view(usm_ndarray ary):
         r_typenum_ = UAR_DOUBLE
     else:
         raise InternalUSMArrayError(
-            "_imag_view call on array of non-complex type.")
-
-    # displace pointer to imaginary part
-    offset_elems = 2 * ary.get_offset() + 1
-    r = usm_ndarray.__new__(
-        usm_ndarray,
-        _make_int_tuple(ary.nd_, ary.shape_) if ary.nd_ > 0 else tuple(),
-        dtype=_make_typestr(r_typenum_),
-        strides=tuple(2 * si for si in ary.strides),
-        buffer=ary.base_,
-        offset=offset_elems,
-        order=('C' if (ary.flags_ & USM_ARRAY_C_CONTIGUOUS) else 'F')
-    )
-    r.flags_ |= (ary.flags_ & USM_ARRAY_WRITABLE)
-    r.array_namespace_ = ary.array_namespace_
-    return r
+            "_component_view call on array of non-complex type.")
+
+    strides = _meta_alloc(nd, buf)
+    if not strides:
+        raise MemoryError
+    try:
+        _fill_strides(ary, strides)
+        for i in range(nd):
+            strides[i] *= 2
+        # imaginary part follows the real part
+        return _make_view(
+            ary, nd, ary.shape_, strides,
+            ary.data_ + part * type_bytesize(r_typenum_), r_typenum_
+        )
+    finally:
+        _meta_free(strides, buf)
+
+
+cdef usm_ndarray _real_view(usm_ndarray ary):
+    """
+    View into real parts of a complex type array
+    """
+    return _component_view(ary, 0)
+
+
+cdef usm_ndarray _imag_view(usm_ndarray ary):
+    """
+    View into imaginary parts of a complex type array
+    """
+    return _component_view(ary, 1)
+
+
+cdef usm_ndarray _transposed_view(usm_ndarray ary, bint reverse_all):
+    """
+    Construct view with all dimensions of `ary` reversed, or with its last
+    two dimensions swapped, without copying the data
+    """
+    cdef int nd = ary.nd_
+    cdef int i
+    cdef int j
+    cdef Py_ssize_t shape_buf[USM_ARRAY_INLINE_NDIM]
+    cdef Py_ssize_t strides_buf[USM_ARRAY_INLINE_NDIM]
+    cdef Py_ssize_t *shape = _meta_alloc(nd, shape_buf)
+    cdef Py_ssize_t *strides = _meta_alloc(nd, strides_buf)
+
+    try:
+        if (not shape or not strides):
+            raise MemoryError
+        _fill_strides(ary, strides)
+        for i in range(nd):
+            shape[i] = ary.shape_[i]
+        if reverse_all:
+            for i in range(nd // 2):
+                j = nd - 1 - i
+                shape[i], shape[j] = shape[j], shape[i]
+                strides[i], strides[j] = strides[j], strides[i]
+        elif nd > 1:
+            i = nd - 2
+            j = nd - 1
+            shape[i], shape[j] = shape[j], shape[i]
+            strides[i], strides[j] = strides[j], strides[i]
+        return _make_view(ary, nd, shape, strides, ary.data_, ary.typenum_)
+    finally:
+        _meta_free(shape, shape_buf)
+        _meta_free(strides, strides_buf)
 
 
 cdef usm_ndarray _transpose(usm_ndarray ary):
     """
     Construct transposed array without copying the data
     """
-    cdef usm_ndarray r = usm_ndarray.__new__(
-        usm_ndarray,
-        _make_reversed_int_tuple(ary.nd_, ary.shape_),
-        dtype=_make_typestr(ary.typenum_),
-        strides=(
-            _make_reversed_int_tuple(ary.nd_, ary.strides_)
-            if (ary.strides_) else None),
-        buffer=ary.base_,
-        order=('F' if (ary.flags_ & USM_ARRAY_C_CONTIGUOUS) else 'C'),
-        offset=ary.get_offset()
-    )
-    r.flags_ |= (ary.flags_ & USM_ARRAY_WRITABLE)
-    return r
+    return _transposed_view(ary, True)
 
 
 cdef usm_ndarray _m_transpose(usm_ndarray ary):
     """
     Construct matrix transposed array
     """
-    cdef usm_ndarray r = usm_ndarray.__new__(
-        usm_ndarray,
-        _swap_last_two(_make_int_tuple(ary.nd_, ary.shape_)),
-        dtype=_make_typestr(ary.typenum_),
-        strides=_swap_last_two(ary.strides),
-        buffer=ary.base_,
-        order=('F' if (ary.flags_ & USM_ARRAY_C_CONTIGUOUS) else 'C'),
-        offset=ary.get_offset()
-    )
-    r.flags_ |= (ary.flags_ & USM_ARRAY_WRITABLE)
-    return r
+    return _transposed_view(ary, False)
+
+
+def _strided_view(usm_ndarray X, shape, strides, Py_ssize_t offset=0):
+    """
+    Returns view into memory of `X` with given `shape` and `strides`, whose
+    zero-index element is displaced by `offset` elements from that of `X`.
+
+    The layout is not validated; callers must ensure that the view only
+    addresses elements of the allocation of `X`.
+    """
+    cdef int nd = len(shape)
+    cdef int i
+    cdef Py_ssize_t shape_buf[USM_ARRAY_INLINE_NDIM]
+    cdef Py_ssize_t strides_buf[USM_ARRAY_INLINE_NDIM]
+    cdef Py_ssize_t *shape_arr = _meta_alloc(nd, shape_buf)
+    cdef Py_ssize_t *strides_arr = _meta_alloc(nd, strides_buf)
+
+    try:
+        if (not shape_arr or not strides_arr):
+            raise MemoryError
+        if len(strides) != nd:
+            raise ValueError("strides={} is not understood".format(strides))
+        for i in range(nd):
+            shape_arr[i] = shape[i]
+            strides_arr[i] = strides[i]
+        return _make_view(
+            X, nd, shape_arr, strides_arr,
+            X.data_ + offset * X.get_itemsize(), X.typenum_
+        )
+    finally:
+        _meta_free(shape_arr, shape_buf)
+        _meta_free(strides_arr, strides_buf)
 
 
 cdef usm_ndarray _zero_like(usm_ndarray ary):
@@ -1530,6 +1759,16 @@ cdef api object UsmNDArray_MakeFromPtr(
     return arr
 
 
+def _usm_ndarray_from_pickle(shape, dtype, strides, buffer, writable):
+    """Reconstructs :class:`dpctl.tensor.usm_ndarray` from pickle"""
+    cdef usm_ndarray res = usm_ndarray(
+        shape, dtype=dtype, strides=strides, buffer=buffer
+    )
+    if not writable:
+        res._set_writable_flag(0)
+    return res
+
+
 def _is_object_with_buffer_protocol(o):
    "Returns True if object support Python buffer protocol"
    return _is_buffer(o)
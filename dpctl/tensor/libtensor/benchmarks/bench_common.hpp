@@ -0,0 +1,237 @@
+//===-- bench_common.hpp - Common utilities for libtensor benchmarks -*-C++-*-//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines utilities shared by micro-benchmarks of libtensor
+/// kernels: selection of the execution queue, USM temporaries, timing of
+/// submitted work and reporting of throughput against memcpy roofline.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace benchmarks
+{
+
+namespace py = pybind11;
+
+/*! @brief Queue used by all benchmarks.
+ *
+ * OpenCL CPU device is preferred, so that benchmarks can run in CI
+ * environments without GPUs. Selection can be overridden with
+ * ONEAPI_DEVICE_SELECTOR environment variable.
+ */
+inline sycl::queue &get_bench_queue()
+{
+    static sycl::queue q = []() {
+        auto selector = [](const sycl::device &d) -> int {
+            int score = 0;
+            if (d.is_cpu()) {
+                score += 100;
+            }
+            if (d.get_backend() == sycl::backend::opencl) {
+                score += 10;
+            }
+            return score;
+        };
+        return sycl::queue(selector, {sycl::property::queue::in_order()});
+    }();
+    return q;
+}
+
+template <typename T> bool type_supported(const sycl::queue &q)
+{
+    const sycl::device &d = q.get_device();
+    if constexpr (std::is_same_v<T, double>) {
+        return d.has(sycl::aspect::fp64);
+    }
+    else if constexpr (std::is_same_v<T, sycl::half>) {
+        return d.has(sycl::aspect::fp16);
+    }
+    return true;
+}
+
+/*! @brief RAII owner of USM allocation used by benchmarks, of USM-device
+ * memory unless `kind` says otherwise */
+template <typename T> class usm_buffer
+{
+    sycl::queue q_;
+    T *ptr_;
+    size_t n_;
+
+public:
+    usm_buffer(sycl::queue &q,
+               size_t n,
+               T fill_value = T(1),
+               sycl::usm::alloc kind = sycl::usm::alloc::device)
+        : q_(q), ptr_(sycl::malloc<T>(n, q, kind)), n_(n)
+    {
+        if (ptr_ == nullptr) {
+            throw std::runtime_error("Unable to allocate USM memory");
+        }
+        q_.fill<T>(ptr_, fill_value, n_).wait();
+    }
+
+    usm_buffer(const usm_buffer &) = delete;
+    usm_buffer &operator=(const usm_buffer &) = delete;
+
+    ~usm_buffer()
+    {
+        sycl::free(ptr_, q_);
+    }
+
+    T *get() const
+    {
+        return ptr_;
+    }
+
+    char *get_char() const
+    {
+        return reinterpret_cast<char *>(ptr_);
+    }
+
+    size_t size() const
+    {
+        return n_;
+    }
+};
+
+/*! @brief Copies packed shape and strides into USM-device allocation */
+inline std::unique_ptr<usm_buffer<py::ssize_t>>
+pack_shape_strides(sycl::queue &q, const std::vector<py::ssize_t> &packed)
+{
+    auto buf = std::make_unique<usm_buffer<py::ssize_t>>(q, packed.size(),
+                                                         py::ssize_t(0));
+    q.copy<py::ssize_t>(packed.data(), buf->get(), packed.size()).wait();
+    return buf;
+}
+
+/*! @brief Runs benchmark loop timing `submit_fn` until its event completes.
+ *
+ * The benchmark must be registered with `UseManualTime()`.
+ */
+template <typename SubmitFnT>
+void run_timed(benchmark::State &state, sycl::queue &q, SubmitFnT &&submit_fn)
+{
+    // warm-up: JIT-compilation and first touch of pages
+    submit_fn().wait();
+    q.wait();
+
+    for (auto _ : state) {
+        auto t0 = std::chrono::steady_clock::now();
+        sycl::event ev = submit_fn();
+        ev.wait();
+        auto t1 = std::chrono::steady_clock::now();
+        state.SetIterationTime(
+            std::chrono::duration<double>(t1 - t0).count());
+    }
+}
+
+/*! @brief Measures bandwidth of USM-device to USM-device memcpy of
+ * `nbytes` bytes, in bytes per second. Values are cached per size. */
+inline double memcpy_roofline(sycl::queue &q, size_t nbytes)
+{
+    static std::map<size_t, double> cache;
+    static std::mutex mtx;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = cache.find(nbytes);
+    if (it != cache.end()) {
+        return it->second;
+    }
+
+    usm_buffer<char> src(q, nbytes, char(0));
+    usm_buffer<char> dst(q, nbytes, char(0));
+    q.memcpy(dst.get(), src.get(), nbytes).wait();
+
+    constexpr int n_reps = 10;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < n_reps; ++i) {
+        q.memcpy(dst.get(), src.get(), nbytes);
+    }
+    q.wait();
+    auto t1 = std::chrono::steady_clock::now();
+
+    double dt = std::chrono::duration<double>(t1 - t0).count() / n_reps;
+    // memcpy reads and writes nbytes
+    double bw = (dt > 0) ? (2.0 * nbytes) / dt : 0.0;
+    cache.emplace(nbytes, bw);
+    return bw;
+}
+
+/*! @brief Sets throughput counters of the benchmark.
+ *
+ * Reports elements per second, GB/s of memory traffic given by
+ * `bytes_per_iter`, and the ratio of attained bandwidth to memcpy
+ * bandwidth for a buffer of the same size.
+ */
+inline void report_throughput(benchmark::State &state,
+                              sycl::queue &q,
+                              size_t nelems,
+                              size_t bytes_per_iter)
+{
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(nelems));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(bytes_per_iter));
+    state.counters["GB/s"] = benchmark::Counter(
+        static_cast<double>(bytes_per_iter) * 1e-9,
+        benchmark::Counter::kIsIterationInvariantRate);
+
+    // memcpy of half the traffic moves bytes_per_iter bytes
+    double roofline = memcpy_roofline(q, bytes_per_iter / 2);
+    state.counters["memcpy_GB/s"] = roofline * 1e-9;
+    state.counters["roofline_frac"] = benchmark::Counter(
+        (roofline > 0) ? static_cast<double>(bytes_per_iter) / roofline : 0.0,
+        benchmark::Counter::kIsIterationInvariantRate);
+}
+
+/*! @brief Size sweep shared by benchmarks: 2**10 to 2**24 elements */
+inline void size_sweep(benchmark::internal::Benchmark *b)
+{
+    b->RangeMultiplier(8)->Range(1 << 10, 1 << 24)->UseManualTime();
+}
+
+/*! @brief Sizes of arrays of a few elements, for which kernel submission
+ * dominates */
+inline void tiny_size_sweep(benchmark::internal::Benchmark *b)
+{
+    b->RangeMultiplier(4)->Range(1, 256)->UseManualTime();
+}
+
+} // namespace benchmarks
+} // namespace tensor
+} // namespace dpctl
@@ -0,0 +1,131 @@
+//===-- bench_copy_and_cast.cpp - Benchmarks of copy kernels    -*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines micro-benchmarks of copy-and-cast kernels, and of
+/// USM memcpy which serves as the roofline for the other benchmarks.
+//===----------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+
+#include "bench_common.hpp"
+#include "kernels/copy_and_cast.hpp"
+
+namespace bench_ns = dpctl::tensor::benchmarks;
+namespace py = pybind11;
+
+namespace
+{
+
+template <typename T> void BM_memcpy(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    size_t nelems = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_buffer<T> src(q, nelems);
+    bench_ns::usm_buffer<T> dst(q, nelems);
+
+    bench_ns::run_timed(state, q, [&]() {
+        return q.memcpy(dst.get(), src.get(), nelems * sizeof(T));
+    });
+    bench_ns::report_throughput(state, q, nelems, 2 * nelems * sizeof(T));
+}
+
+template <typename srcT, typename dstT>
+void BM_copy_and_cast_contig(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<srcT>(q) ||
+        !bench_ns::type_supported<dstT>(q))
+    {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    size_t nelems = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_buffer<srcT> src(q, nelems);
+    bench_ns::usm_buffer<dstT> dst(q, nelems);
+
+    using dpctl::tensor::kernels::copy_and_cast::copy_and_cast_contig_impl;
+    bench_ns::run_timed(state, q, [&]() {
+        return copy_and_cast_contig_impl<dstT, srcT>(
+            q, nelems, src.get_char(), dst.get_char(), {});
+    });
+    bench_ns::report_throughput(state, q, nelems,
+                                nelems * (sizeof(srcT) + sizeof(dstT)));
+}
+
+/*! @brief Copy of F-contiguous matrix into C-contiguous one */
+template <typename srcT, typename dstT>
+void BM_copy_and_cast_strided(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<srcT>(q) ||
+        !bench_ns::type_supported<dstT>(q))
+    {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    size_t n1 = static_cast<size_t>(
+        std::sqrt(static_cast<double>(state.range(0))));
+    n1 = (n1 == 0) ? 1 : n1;
+    size_t n0 = static_cast<size_t>(state.range(0)) / n1;
+    size_t nelems = n0 * n1;
+
+    bench_ns::usm_buffer<srcT> src(q, nelems);
+    bench_ns::usm_buffer<dstT> dst(q, nelems);
+
+    const py::ssize_t s0 = static_cast<py::ssize_t>(n0);
+    const py::ssize_t s1 = static_cast<py::ssize_t>(n1);
+    auto shape_strides =
+        bench_ns::pack_shape_strides(q, {s0, s1, 1, s0, s1, 1});
+
+    using dpctl::tensor::kernels::copy_and_cast::copy_and_cast_generic_impl;
+    bench_ns::run_timed(state, q, [&]() {
+        return copy_and_cast_generic_impl<dstT, srcT>(
+            q, nelems, 2, shape_strides->get(), src.get_char(), 0,
+            dst.get_char(), 0, {}, {});
+    });
+    bench_ns::report_throughput(state, q, nelems,
+                                nelems * (sizeof(srcT) + sizeof(dstT)));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_memcpy, float)->Apply(bench_ns::size_sweep);
+
+BENCHMARK_TEMPLATE(BM_copy_and_cast_contig, float, float)
+    ->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_copy_and_cast_contig, float, double)
+    ->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_copy_and_cast_contig, std::int32_t, float)
+    ->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_copy_and_cast_contig, bool, std::int64_t)
+    ->Apply(bench_ns::size_sweep);
+
+BENCHMARK_TEMPLATE(BM_copy_and_cast_strided, float, float)
+    ->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_copy_and_cast_strided, float, double)
+    ->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_copy_and_cast_strided, std::int32_t, float)
+    ->Apply(bench_ns::size_sweep);
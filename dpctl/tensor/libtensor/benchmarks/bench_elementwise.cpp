@@ -0,0 +1,322 @@
+//===-- bench_elementwise.cpp - Benchmarks of elementwise kernels -*-C++-*-/=//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines micro-benchmarks of contiguous, strided and
+/// broadcasting code paths of elementwise kernels.
+//===----------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "kernels/elementwise_functions/add.hpp"
+#include "kernels/elementwise_functions/sin.hpp"
+#include "utils/sycl_utils.hpp"
+
+namespace bench_ns = dpctl::tensor::benchmarks;
+namespace su_ns = dpctl::tensor::sycl_utils;
+namespace py = pybind11;
+
+namespace
+{
+
+// number of columns of matrices used by strided and broadcasting benchmarks
+size_t n_cols_for(size_t nelems)
+{
+    size_t n1 = static_cast<size_t>(std::sqrt(static_cast<double>(nelems)));
+    return (n1 == 0) ? 1 : n1;
+}
+
+template <typename T> void BM_add_contig(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    size_t nelems = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_buffer<T> x1(q, nelems);
+    bench_ns::usm_buffer<T> x2(q, nelems);
+    bench_ns::usm_buffer<T> res(q, nelems);
+
+    using dpctl::tensor::kernels::add::add_contig_impl;
+    bench_ns::run_timed(state, q, [&]() {
+        return add_contig_impl<T, T>(q, nelems, x1.get_char(), 0,
+                                     x2.get_char(), 0, res.get_char(), 0, {});
+    });
+    bench_ns::report_throughput(state, q, nelems, 3 * nelems * sizeof(T));
+}
+
+/*! @brief Contiguous code path with fixed launch mode of work-groups, to
+ * compare grid-stride persistent launch with one work-group per block */
+template <typename T, su_ns::elementwise_launch_mode mode>
+void BM_add_contig_launch(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    size_t nelems = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_buffer<T> x1(q, nelems);
+    bench_ns::usm_buffer<T> x2(q, nelems);
+    bench_ns::usm_buffer<T> res(q, nelems);
+
+    const su_ns::elementwise_launch_mode saved_mode =
+        su_ns::get_elementwise_launch_mode();
+    su_ns::set_elementwise_launch_mode(mode);
+
+    using dpctl::tensor::kernels::add::add_contig_impl;
+    bench_ns::run_timed(state, q, [&]() {
+        return add_contig_impl<T, T>(q, nelems, x1.get_char(), 0,
+                                     x2.get_char(), 0, res.get_char(), 0, {});
+    });
+    su_ns::set_elementwise_launch_mode(saved_mode);
+    bench_ns::report_throughput(state, q, nelems, 3 * nelems * sizeof(T));
+}
+
+/*! @brief Contiguous code path on arrays of a few elements in USM-shared
+ * memory, evaluated on the calling thread or by a kernel, to compare cost of
+ * both and choose DPCTL_TENSOR_HOST_FASTPATH_MAX_ELEMS */
+template <typename T, bool on_host>
+void BM_add_contig_tiny(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    size_t nelems = static_cast<size_t>(state.range(0));
+
+    constexpr auto shared = sycl::usm::alloc::shared;
+    bench_ns::usm_buffer<T> x1(q, nelems, T(1), shared);
+    bench_ns::usm_buffer<T> x2(q, nelems, T(1), shared);
+    bench_ns::usm_buffer<T> res(q, nelems, T(1), shared);
+
+    const size_t saved_max_elems = su_ns::get_host_fastpath_max_elems();
+    su_ns::set_host_fastpath_max_elems(on_host ? nelems : 0);
+
+    using dpctl::tensor::kernels::add::add_contig_impl;
+    bench_ns::run_timed(state, q, [&]() {
+        return add_contig_impl<T, T>(q, nelems, x1.get_char(), 0,
+                                     x2.get_char(), 0, res.get_char(), 0, {});
+    });
+    su_ns::set_host_fastpath_max_elems(saved_max_elems);
+    state.SetItemsProcessed(state.iterations() * nelems);
+}
+
+/*! @brief Strided code path: first argument is F-contiguous matrix, second
+ * argument and result are C-contiguous */
+template <typename T> void BM_add_strided(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    size_t n1 = n_cols_for(static_cast<size_t>(state.range(0)));
+    size_t n0 = static_cast<size_t>(state.range(0)) / n1;
+    size_t nelems = n0 * n1;
+
+    bench_ns::usm_buffer<T> x1(q, nelems);
+    bench_ns::usm_buffer<T> x2(q, nelems);
+    bench_ns::usm_buffer<T> res(q, nelems);
+
+    const py::ssize_t s0 = static_cast<py::ssize_t>(n0);
+    const py::ssize_t s1 = static_cast<py::ssize_t>(n1);
+    // shape, src1 strides, src2 strides, dst strides
+    auto shape_strides =
+        bench_ns::pack_shape_strides(q, {s0, s1, 1, s0, s1, 1, s1, 1});
+
+    using dpctl::tensor::kernels::add::add_strided_impl;
+    bench_ns::run_timed(state, q, [&]() {
+        return add_strided_impl<T, T>(q, nelems, 2, shape_strides->get(),
+                                      x1.get_char(), 0, x2.get_char(), 0,
+                                      res.get_char(), 0, {}, {});
+    });
+    bench_ns::report_throughput(state, q, nelems, 3 * nelems * sizeof(T));
+}
+
+/*! @brief Broadcasting of contiguous row over C-contiguous matrix via
+ * generic strided code path */
+template <typename T> void BM_add_broadcast_strided(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    size_t n1 = n_cols_for(static_cast<size_t>(state.range(0)));
+    size_t n0 = static_cast<size_t>(state.range(0)) / n1;
+    size_t nelems = n0 * n1;
+
+    bench_ns::usm_buffer<T> mat(q, nelems);
+    bench_ns::usm_buffer<T> row(q, n1);
+    bench_ns::usm_buffer<T> res(q, nelems);
+
+    const py::ssize_t s0 = static_cast<py::ssize_t>(n0);
+    const py::ssize_t s1 = static_cast<py::ssize_t>(n1);
+    auto shape_strides =
+        bench_ns::pack_shape_strides(q, {s0, s1, s1, 1, 0, 1, s1, 1});
+
+    using dpctl::tensor::kernels::add::add_strided_impl;
+    bench_ns::run_timed(state, q, [&]() {
+        return add_strided_impl<T, T>(q, nelems, 2, shape_strides->get(),
+                                      mat.get_char(), 0, row.get_char(), 0,
+                                      res.get_char(), 0, {}, {});
+    });
+    bench_ns::report_throughput(state, q, nelems,
+                                (2 * nelems + n1) * sizeof(T));
+}
+
+/*! @brief Broadcasting of contiguous row over C-contiguous matrix via
+ * dedicated matrix-row kernel */
+template <typename T> void BM_add_broadcast_row(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    size_t n1 = n_cols_for(static_cast<size_t>(state.range(0)));
+    size_t n0 = static_cast<size_t>(state.range(0)) / n1;
+    size_t nelems = n0 * n1;
+
+    bench_ns::usm_buffer<T> mat(q, nelems);
+    bench_ns::usm_buffer<T> row(q, n1);
+    bench_ns::usm_buffer<T> res(q, nelems);
+
+    using dpctl::tensor::kernels::add::
+        add_contig_matrix_contig_row_broadcast_impl;
+    std::vector<sycl::event> host_tasks;
+    bench_ns::run_timed(state, q, [&]() {
+        host_tasks.clear();
+        sycl::event comp_ev =
+            add_contig_matrix_contig_row_broadcast_impl<T, T, T>(
+                q, host_tasks, n0, n1, mat.get_char(), 0, row.get_char(), 0,
+                res.get_char(), 0, {});
+        // include release of padded row temporary in the timing
+        sycl::event::wait(host_tasks);
+        return comp_ev;
+    });
+    bench_ns::report_throughput(state, q, nelems,
+                                (2 * nelems + n1) * sizeof(T));
+}
+
+template <typename T> void BM_sin_contig(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    size_t nelems = static_cast<size_t>(state.range(0));
+
+    bench_ns::usm_buffer<T> x(q, nelems);
+    bench_ns::usm_buffer<T> res(q, nelems);
+
+    using dpctl::tensor::kernels::sin::sin_contig_impl;
+    bench_ns::run_timed(state, q, [&]() {
+        return sin_contig_impl<T>(q, nelems, x.get_char(), res.get_char(), {});
+    });
+    bench_ns::report_throughput(state, q, nelems, 2 * nelems * sizeof(T));
+}
+
+template <typename T> void BM_sin_strided(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    size_t n1 = n_cols_for(static_cast<size_t>(state.range(0)));
+    size_t n0 = static_cast<size_t>(state.range(0)) / n1;
+    size_t nelems = n0 * n1;
+
+    bench_ns::usm_buffer<T> x(q, nelems);
+    bench_ns::usm_buffer<T> res(q, nelems);
+
+    const py::ssize_t s0 = static_cast<py::ssize_t>(n0);
+    const py::ssize_t s1 = static_cast<py::ssize_t>(n1);
+    // shape, F-contiguous source strides, C-contiguous destination strides
+    auto shape_strides =
+        bench_ns::pack_shape_strides(q, {s0, s1, 1, s0, s1, 1});
+
+    using dpctl::tensor::kernels::sin::sin_strided_impl;
+    bench_ns::run_timed(state, q, [&]() {
+        return sin_strided_impl<T>(q, nelems, 2, shape_strides->get(),
+                                   x.get_char(), 0, res.get_char(), 0, {}, {});
+    });
+    bench_ns::report_throughput(state, q, nelems, 2 * nelems * sizeof(T));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_add_contig, std::int32_t)->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_add_contig, float)->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_add_contig, double)->Apply(bench_ns::size_sweep);
+
+BENCHMARK_TEMPLATE(BM_add_contig_launch,
+                   float,
+                   su_ns::elementwise_launch_mode::full)
+    ->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_add_contig_launch,
+                   float,
+                   su_ns::elementwise_launch_mode::persistent)
+    ->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_add_contig_launch,
+                   double,
+                   su_ns::elementwise_launch_mode::full)
+    ->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_add_contig_launch,
+                   double,
+                   su_ns::elementwise_launch_mode::persistent)
+    ->Apply(bench_ns::size_sweep);
+
+BENCHMARK_TEMPLATE(BM_add_contig_tiny, float, true)
+    ->Apply(bench_ns::tiny_size_sweep);
+BENCHMARK_TEMPLATE(BM_add_contig_tiny, float, false)
+    ->Apply(bench_ns::tiny_size_sweep);
+BENCHMARK_TEMPLATE(BM_add_contig_tiny, double, true)
+    ->Apply(bench_ns::tiny_size_sweep);
+BENCHMARK_TEMPLATE(BM_add_contig_tiny, double, false)
+    ->Apply(bench_ns::tiny_size_sweep);
+
+BENCHMARK_TEMPLATE(BM_add_strided, std::int32_t)->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_add_strided, float)->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_add_strided, double)->Apply(bench_ns::size_sweep);
+
+BENCHMARK_TEMPLATE(BM_add_broadcast_strided, float)
+    ->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_add_broadcast_strided, double)
+    ->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_add_broadcast_row, float)->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_add_broadcast_row, double)->Apply(bench_ns::size_sweep);
+
+BENCHMARK_TEMPLATE(BM_sin_contig, float)->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_sin_contig, double)->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_sin_strided, float)->Apply(bench_ns::size_sweep);
+BENCHMARK_TEMPLATE(BM_sin_strided, double)->Apply(bench_ns::size_sweep);
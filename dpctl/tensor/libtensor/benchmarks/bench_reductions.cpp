@@ -0,0 +1,217 @@
+//===-- bench_reductions.cpp - Benchmarks of reduction kernels  -*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines micro-benchmarks of sum reduction kernels comparing
+/// implementations using atomics with those using temporaries.
+//===----------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "kernels/reductions.hpp"
+#include "utils/sycl_utils.hpp"
+
+namespace bench_ns = dpctl::tensor::benchmarks;
+namespace su_ns = dpctl::tensor::sycl_utils;
+namespace py = pybind11;
+
+namespace
+{
+
+// state.range(0) - total number of elements
+// state.range(1) - number of elements in each reduction
+struct reduction_problem
+{
+    size_t iter_nelems;
+    size_t reduction_nelems;
+
+    reduction_problem(const benchmark::State &state)
+        : iter_nelems(0), reduction_nelems(static_cast<size_t>(state.range(1)))
+    {
+        iter_nelems =
+            std::max<size_t>(1, static_cast<size_t>(state.range(0)) /
+                                    reduction_nelems);
+    }
+
+    size_t nelems() const
+    {
+        return iter_nelems * reduction_nelems;
+    }
+};
+
+/*! @brief Reduction over rows of C-contiguous matrix using strided kernels,
+ * selecting atomic or temporaries based implementation with `use_atomics` */
+template <typename T, bool use_atomics>
+void BM_sum_over_axis_strided(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    reduction_problem p(state);
+    size_t nelems = p.nelems();
+
+    bench_ns::usm_buffer<T> x(q, nelems);
+    bench_ns::usm_buffer<T> res(q, p.iter_nelems, T(0));
+
+    const py::ssize_t n0 = static_cast<py::ssize_t>(p.iter_nelems);
+    const py::ssize_t n1 = static_cast<py::ssize_t>(p.reduction_nelems);
+    // iteration: shape, source strides, result strides
+    // reduction: shape, source strides
+    auto packed = bench_ns::pack_shape_strides(q, {n0, n1, 1, n1, 1});
+    const py::ssize_t *iter_shape_strides = packed->get();
+    const py::ssize_t *red_shape_strides = packed->get() + 3;
+
+    bench_ns::run_timed(state, q, [&]() {
+        if constexpr (use_atomics) {
+            using dpctl::tensor::kernels::
+                sum_reduction_over_group_with_atomics_strided_impl;
+            return sum_reduction_over_group_with_atomics_strided_impl<T, T>(
+                q, p.iter_nelems, p.reduction_nelems, x.get_char(),
+                res.get_char(), 1, iter_shape_strides, 0, 0, 1,
+                red_shape_strides, 0, {});
+        }
+        else {
+            using dpctl::tensor::kernels::
+                sum_reduction_over_group_temps_strided_impl;
+            return sum_reduction_over_group_temps_strided_impl<T, T>(
+                q, p.iter_nelems, p.reduction_nelems, x.get_char(),
+                res.get_char(), 1, iter_shape_strides, 0, 0, 1,
+                red_shape_strides, 0, {});
+        }
+    });
+    bench_ns::report_throughput(state, q, nelems,
+                                (nelems + p.iter_nelems) * sizeof(T));
+}
+
+/*! @brief Reduction over rows (axis1) or columns (axis0) of C-contiguous
+ * matrix using dedicated contiguous kernels with atomics */
+template <typename T, int axis>
+void BM_sum_over_axis_contig_atomic(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    reduction_problem p(state);
+    size_t nelems = p.nelems();
+
+    bench_ns::usm_buffer<T> x(q, nelems);
+    bench_ns::usm_buffer<T> res(q, p.iter_nelems, T(0));
+
+    bench_ns::run_timed(state, q, [&]() {
+        if constexpr (axis == 1) {
+            using dpctl::tensor::kernels::
+                sum_reduction_axis1_over_group_with_atomics_contig_impl;
+            return sum_reduction_axis1_over_group_with_atomics_contig_impl<T,
+                                                                           T>(
+                q, p.iter_nelems, p.reduction_nelems, x.get_char(),
+                res.get_char(), 0, 0, 0, {});
+        }
+        else {
+            using dpctl::tensor::kernels::
+                sum_reduction_axis0_over_group_with_atomics_contig_impl;
+            return sum_reduction_axis0_over_group_with_atomics_contig_impl<T,
+                                                                           T>(
+                q, p.iter_nelems, p.reduction_nelems, x.get_char(),
+                res.get_char(), 0, 0, 0, {});
+        }
+    });
+    bench_ns::report_throughput(state, q, nelems,
+                                (nelems + p.iter_nelems) * sizeof(T));
+}
+
+/*! @brief Sum of a vector of a few elements in USM-shared memory, computed
+ * on the calling thread or by a kernel */
+template <typename T, bool on_host>
+void BM_sum_contig_tiny(benchmark::State &state)
+{
+    sycl::queue &q = bench_ns::get_bench_queue();
+    if (!bench_ns::type_supported<T>(q)) {
+        state.SkipWithError("type is not supported by device");
+        return;
+    }
+    size_t nelems = static_cast<size_t>(state.range(0));
+
+    constexpr auto shared = sycl::usm::alloc::shared;
+    bench_ns::usm_buffer<T> x(q, nelems, T(1), shared);
+    bench_ns::usm_buffer<T> res(q, 1, T(0), shared);
+
+    const size_t saved_max_elems = su_ns::get_host_fastpath_max_elems();
+    su_ns::set_host_fastpath_max_elems(on_host ? nelems : 0);
+
+    using dpctl::tensor::kernels::
+        sum_reduction_axis1_over_group_with_atomics_contig_impl;
+    bench_ns::run_timed(state, q, [&]() {
+        return sum_reduction_axis1_over_group_with_atomics_contig_impl<T, T>(
+            q, 1, nelems, x.get_char(), res.get_char(), 0, 0, 0, {});
+    });
+    su_ns::set_host_fastpath_max_elems(saved_max_elems);
+    state.SetItemsProcessed(state.iterations() * nelems);
+}
+
+// sweep of total sizes and lengths of reductions
+void reduction_sweep(benchmark::internal::Benchmark *b)
+{
+    for (int64_t n = 1 << 12; n <= 1 << 24; n *= 16) {
+        for (int64_t r : {int64_t(7), int64_t(256), int64_t(1) << 12, n}) {
+            if (r <= n) {
+                b->Args({n, r});
+            }
+        }
+    }
+    b->ArgNames({"nelems", "red_nelems"})->UseManualTime();
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_sum_over_axis_strided, float, true)
+    ->Apply(reduction_sweep);
+BENCHMARK_TEMPLATE(BM_sum_over_axis_strided, float, false)
+    ->Apply(reduction_sweep);
+BENCHMARK_TEMPLATE(BM_sum_over_axis_strided, double, true)
+    ->Apply(reduction_sweep);
+BENCHMARK_TEMPLATE(BM_sum_over_axis_strided, double, false)
+    ->Apply(reduction_sweep);
+BENCHMARK_TEMPLATE(BM_sum_over_axis_strided, std::int64_t, true)
+    ->Apply(reduction_sweep);
+BENCHMARK_TEMPLATE(BM_sum_over_axis_strided, std::int64_t, false)
+    ->Apply(reduction_sweep);
+
+BENCHMARK_TEMPLATE(BM_sum_over_axis_contig_atomic, float, 1)
+    ->Apply(reduction_sweep);
+BENCHMARK_TEMPLATE(BM_sum_over_axis_contig_atomic, float, 0)
+    ->Apply(reduction_sweep);
+BENCHMARK_TEMPLATE(BM_sum_over_axis_contig_atomic, double, 1)
+    ->Apply(reduction_sweep);
+BENCHMARK_TEMPLATE(BM_sum_over_axis_contig_atomic, double, 0)
+    ->Apply(reduction_sweep);
+
+BENCHMARK_TEMPLATE(BM_sum_contig_tiny, float, true)
+    ->Apply(bench_ns::tiny_size_sweep);
+BENCHMARK_TEMPLATE(BM_sum_contig_tiny, float, false)
+    ->Apply(bench_ns::tiny_size_sweep);
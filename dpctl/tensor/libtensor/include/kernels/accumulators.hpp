@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "utils/offset_utils.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 
 namespace dpctl
@@ -43,6 +44,10 @@ namespace kernels
 namespace accumulators
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+using dpctl::tensor::alloc_utils::sycl_malloc_host;
+using dpctl::tensor::alloc_utils::sycl_malloc_device;
+
 namespace py = pybind11;
 
 using namespace dpctl::tensor::offset_utils;
@@ -176,7 +181,8 @@ sycl::event inclusive_scan_rec(sycl::queue exec_q,
 
     sycl::event out_event = inc_scan_phase1_ev;
     if (n_groups > 1) {
-        outputT *temp = sycl::malloc_device<outputT>(n_groups - 1, exec_q);
+        outputT *temp = sycl_malloc_device<outputT>(n_groups - 1, exec_q,
+                                                    "inclusive_scan_rec");
 
         auto chunk_size = wg_size * n_wi;
 
@@ -204,7 +210,7 @@ sycl::event inclusive_scan_rec(sycl::queue exec_q,
         sycl::event e4 = exec_q.submit([&](sycl::handler &cgh) {
             cgh.depends_on(e3);
             auto ctx = exec_q.get_context();
-            cgh.host_task([ctx, temp]() { sycl::free(temp, ctx); });
+            cgh.host_task([ctx, temp]() { sycl_free_noexcept(temp, ctx); });
         });
 
         out_event = e4;
@@ -243,7 +249,8 @@ size_t accumulate_contig_impl(sycl::queue q,
 
     cumsumT *last_elem = cumsum_data_ptr + (n_elems - 1);
 
-    cumsumT *last_elem_host_usm = sycl::malloc_host<cumsumT>(1, q);
+    cumsumT *last_elem_host_usm =
+        sycl_malloc_host<cumsumT>(1, q, "accumulate_contig_impl");
 
     if (last_elem_host_usm == nullptr) {
         throw std::bad_alloc();
@@ -252,7 +259,7 @@ size_t accumulate_contig_impl(sycl::queue q,
         q.copy<cumsumT>(last_elem, last_elem_host_usm, 1, {comp_ev});
     copy_e.wait();
     size_t return_val = static_cast<size_t>(*last_elem_host_usm);
-    sycl::free(last_elem_host_usm, q);
+    sycl_free_noexcept(last_elem_host_usm, q);
 
     return return_val;
 }
@@ -329,7 +336,8 @@ size_t accumulate_strided_impl(sycl::queue q,
 
     cumsumT *last_elem = cumsum_data_ptr + (n_elems - 1);
 
-    cumsumT *last_elem_host_usm = sycl::malloc_host<cumsumT>(1, q);
+    cumsumT *last_elem_host_usm =
+        sycl_malloc_host<cumsumT>(1, q, "accumulate_strided_impl");
 
     if (last_elem_host_usm == nullptr) {
         throw std::bad_alloc();
@@ -338,7 +346,7 @@ size_t accumulate_strided_impl(sycl::queue q,
         q.copy<cumsumT>(last_elem, last_elem_host_usm, 1, {comp_ev});
     copy_e.wait();
     size_t return_val = static_cast<size_t>(*last_elem_host_usm);
-    sycl::free(last_elem_host_usm, q);
+    sycl_free_noexcept(last_elem_host_usm, q);
 
     return return_val;
 }
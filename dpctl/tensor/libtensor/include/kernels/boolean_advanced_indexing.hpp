@@ -30,6 +30,7 @@
 #include <utility>
 #include <vector>
 
+#include "kernels/constructors.hpp"
 #include "utils/offset_utils.hpp"
 #include "utils/type_dispatch.hpp"
 
@@ -544,6 +545,267 @@ struct MaskPlaceSomeSlicesStridedFactoryForInt64
     }
 };
 
+// ======= Masked assignment ================================
+
+/*! @brief Functor setting dst[i] = rhs[i] for every i where mask[i] is set.
+ *
+ * Mask and right-hand side have the shape of the destination, possibly by
+ * broadcasting, so positions of set mask elements need not be known and
+ * no prefix sum of the mask is computed. Indexer returns offsets of the
+ * mask, of the right-hand side and of the destination.
+ */
+template <typename IndexerT, typename dataT> struct MaskedAssignFunctor
+{
+    MaskedAssignFunctor(const char *mask_data_p,
+                        const char *rhs_data_p,
+                        char *dst_data_p,
+                        IndexerT mask_rhs_dst_indexer_)
+        : mask_cp(mask_data_p), rhs_cp(rhs_data_p), dst_cp(dst_data_p),
+          indexer(mask_rhs_dst_indexer_)
+    {
+    }
+
+    void operator()(sycl::id<1> idx) const
+    {
+        const bool *mask_data = reinterpret_cast<const bool *>(mask_cp);
+        const dataT *rhs_data = reinterpret_cast<const dataT *>(rhs_cp);
+        dataT *dst_data = reinterpret_cast<dataT *>(dst_cp);
+
+        const auto &offsets = indexer(static_cast<py::ssize_t>(idx[0]));
+        if (mask_data[offsets.get_first_offset()]) {
+            dst_data[offsets.get_third_offset()] =
+                rhs_data[offsets.get_second_offset()];
+        }
+    }
+
+private:
+    const char *mask_cp = nullptr;
+    const char *rhs_cp = nullptr;
+    char *dst_cp = nullptr;
+    IndexerT indexer;
+};
+
+/*! @brief Functor setting dst[i] = value for every i where mask[i] is set.
+ *
+ * Indexer returns offsets of the mask and of the destination.
+ */
+template <typename IndexerT, typename dataT> struct MaskedFillFunctor
+{
+    MaskedFillFunctor(const char *mask_data_p,
+                      dataT fill_v,
+                      char *dst_data_p,
+                      IndexerT mask_dst_indexer_)
+        : mask_cp(mask_data_p), value(fill_v), dst_cp(dst_data_p),
+          indexer(mask_dst_indexer_)
+    {
+    }
+
+    void operator()(sycl::id<1> idx) const
+    {
+        const bool *mask_data = reinterpret_cast<const bool *>(mask_cp);
+        dataT *dst_data = reinterpret_cast<dataT *>(dst_cp);
+
+        const auto &offsets = indexer(static_cast<py::ssize_t>(idx[0]));
+        if (mask_data[offsets.get_first_offset()]) {
+            dst_data[offsets.get_second_offset()] = value;
+        }
+    }
+
+private:
+    const char *mask_cp = nullptr;
+    dataT value;
+    char *dst_cp = nullptr;
+    IndexerT indexer;
+};
+
+template <typename IndexerT, typename dataT> class masked_assign_krn;
+
+typedef sycl::event (*masked_assign_contig_impl_fn_ptr_t)(
+    sycl::queue,
+    size_t,       // nelems
+    const char *, // mask_p
+    const char *, // rhs_p
+    char *,       // dst_p
+    std::vector<sycl::event> const &);
+
+template <typename dataT>
+sycl::event masked_assign_contig_impl(sycl::queue exec_q,
+                                      size_t nelems,
+                                      const char *mask_p,
+                                      const char *rhs_p,
+                                      char *dst_p,
+                                      std::vector<sycl::event> const &depends)
+{
+    using IndexerT =
+        ThreeOffsets_CombinedIndexer<NoOpIndexer, NoOpIndexer, NoOpIndexer>;
+    const IndexerT indexer{NoOpIndexer{}, NoOpIndexer{}, NoOpIndexer{}};
+
+    sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+        cgh.parallel_for<class masked_assign_krn<IndexerT, dataT>>(
+            sycl::range<1>(nelems),
+            MaskedAssignFunctor<IndexerT, dataT>(mask_p, rhs_p, dst_p,
+                                                 indexer));
+    });
+
+    return comp_ev;
+}
+
+typedef sycl::event (*masked_assign_strided_impl_fn_ptr_t)(
+    sycl::queue,
+    size_t,              // nelems
+    int,                 // nd
+    const py::ssize_t *, // packed shape, mask, rhs and dst strides
+    const char *,        // mask_p
+    py::ssize_t,         // mask_offset
+    const char *,        // rhs_p
+    py::ssize_t,         // rhs_offset
+    char *,              // dst_p
+    py::ssize_t,         // dst_offset
+    std::vector<sycl::event> const &);
+
+template <typename dataT>
+sycl::event
+masked_assign_strided_impl(sycl::queue exec_q,
+                           size_t nelems,
+                           int nd,
+                           const py::ssize_t *packed_shape_strides,
+                           const char *mask_p,
+                           py::ssize_t mask_offset,
+                           const char *rhs_p,
+                           py::ssize_t rhs_offset,
+                           char *dst_p,
+                           py::ssize_t dst_offset,
+                           std::vector<sycl::event> const &depends)
+{
+    using IndexerT = ThreeOffsets_StridedIndexer;
+    const IndexerT indexer{nd, mask_offset, rhs_offset, dst_offset,
+                           packed_shape_strides};
+
+    sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+        cgh.parallel_for<class masked_assign_krn<IndexerT, dataT>>(
+            sycl::range<1>(nelems),
+            MaskedAssignFunctor<IndexerT, dataT>(mask_p, rhs_p, dst_p,
+                                                 indexer));
+    });
+
+    return comp_ev;
+}
+
+template <typename fnT, typename T> struct MaskAssignContigFactory
+{
+    fnT get()
+    {
+        fnT fn = masked_assign_contig_impl<T>;
+        return fn;
+    }
+};
+
+template <typename fnT, typename T> struct MaskAssignStridedFactory
+{
+    fnT get()
+    {
+        fnT fn = masked_assign_strided_impl<T>;
+        return fn;
+    }
+};
+
+template <typename IndexerT, typename dataT> class masked_fill_krn;
+
+typedef sycl::event (*masked_fill_contig_impl_fn_ptr_t)(
+    sycl::queue,
+    size_t,       // nelems
+    const char *, // mask_p
+    py::object,   // value
+    char *,       // dst_p
+    std::vector<sycl::event> const &);
+
+template <typename dataT>
+sycl::event masked_fill_contig_impl(sycl::queue exec_q,
+                                    size_t nelems,
+                                    const char *mask_p,
+                                    py::object py_value,
+                                    char *dst_p,
+                                    std::vector<sycl::event> const &depends)
+{
+    using dpctl::tensor::kernels::constructors::unbox_py_scalar;
+    const dataT fill_v = unbox_py_scalar<dataT>(py_value);
+
+    using IndexerT = TwoOffsets_CombinedIndexer<NoOpIndexer, NoOpIndexer>;
+    const IndexerT indexer{NoOpIndexer{}, NoOpIndexer{}};
+
+    sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+        cgh.parallel_for<class masked_fill_krn<IndexerT, dataT>>(
+            sycl::range<1>(nelems),
+            MaskedFillFunctor<IndexerT, dataT>(mask_p, fill_v, dst_p,
+                                               indexer));
+    });
+
+    return comp_ev;
+}
+
+typedef sycl::event (*masked_fill_strided_impl_fn_ptr_t)(
+    sycl::queue,
+    size_t,              // nelems
+    int,                 // nd
+    const py::ssize_t *, // packed shape, mask and dst strides
+    const char *,        // mask_p
+    py::ssize_t,         // mask_offset
+    py::object,          // value
+    char *,              // dst_p
+    py::ssize_t,         // dst_offset
+    std::vector<sycl::event> const &);
+
+template <typename dataT>
+sycl::event
+masked_fill_strided_impl(sycl::queue exec_q,
+                         size_t nelems,
+                         int nd,
+                         const py::ssize_t *packed_shape_strides,
+                         const char *mask_p,
+                         py::ssize_t mask_offset,
+                         py::object py_value,
+                         char *dst_p,
+                         py::ssize_t dst_offset,
+                         std::vector<sycl::event> const &depends)
+{
+    using dpctl::tensor::kernels::constructors::unbox_py_scalar;
+    const dataT fill_v = unbox_py_scalar<dataT>(py_value);
+
+    using IndexerT = TwoOffsets_StridedIndexer;
+    const IndexerT indexer{nd, mask_offset, dst_offset, packed_shape_strides};
+
+    sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+        cgh.parallel_for<class masked_fill_krn<IndexerT, dataT>>(
+            sycl::range<1>(nelems),
+            MaskedFillFunctor<IndexerT, dataT>(mask_p, fill_v, dst_p,
+                                               indexer));
+    });
+
+    return comp_ev;
+}
+
+template <typename fnT, typename T> struct MaskFillContigFactory
+{
+    fnT get()
+    {
+        fnT fn = masked_fill_contig_impl<T>;
+        return fn;
+    }
+};
+
+template <typename fnT, typename T> struct MaskFillStridedFactory
+{
+    fnT get()
+    {
+        fnT fn = masked_fill_strided_impl<T>;
+        return fn;
+    }
+};
+
 // Non-zero
 
 template <typename T1, typename T2> class non_zero_indexes_krn;
@@ -0,0 +1,184 @@
+//=== clip.hpp - Ternary function CLIP ------------------------- *-C++-*--/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===---------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels for elementwise evaluation of CLIP(x, lo, hi)
+/// function.
+//===---------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "utils/offset_utils.hpp"
+#include "utils/type_dispatch.hpp"
+#include "utils/type_utils.hpp"
+
+#include "kernels/elementwise_functions/common_nary.hpp"
+#include <pybind11/pybind11.h>
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace clip
+{
+
+namespace py = pybind11;
+namespace td_ns = dpctl::tensor::type_dispatch;
+namespace tu_ns = dpctl::tensor::type_utils;
+
+template <typename argT> struct ClipFunctor
+{
+
+    using supports_sg_loadstore = std::true_type;
+
+    argT operator()(const argT &x, const argT &lo, const argT &hi) const
+    {
+        if constexpr (std::is_floating_point_v<argT> ||
+                      std::is_same_v<argT, sycl::half>)
+        {
+            // NaN in any of the arguments propagates to the result
+            if (sycl::isnan(x) || sycl::isnan(lo) || sycl::isnan(hi)) {
+                return std::numeric_limits<argT>::quiet_NaN();
+            }
+        }
+        const argT res = (x < lo) ? lo : x;
+        return (res > hi) ? hi : res;
+    }
+};
+
+template <typename T> struct ClipOutputType
+{
+    using value_type = typename std::disjunction< // disjunction is C++17
+                                                  // feature, supported by DPC++
+        td_ns::TypeMapResultEntry<T, std::uint8_t>,
+        td_ns::TypeMapResultEntry<T, std::uint16_t>,
+        td_ns::TypeMapResultEntry<T, std::uint32_t>,
+        td_ns::TypeMapResultEntry<T, std::uint64_t>,
+        td_ns::TypeMapResultEntry<T, std::int8_t>,
+        td_ns::TypeMapResultEntry<T, std::int16_t>,
+        td_ns::TypeMapResultEntry<T, std::int32_t>,
+        td_ns::TypeMapResultEntry<T, std::int64_t>,
+        td_ns::TypeMapResultEntry<T, sycl::half>,
+        td_ns::TypeMapResultEntry<T, float>,
+        td_ns::TypeMapResultEntry<T, double>,
+        td_ns::DefaultResultEntry<void>>::result_type;
+};
+
+template <typename T, unsigned int vec_sz, unsigned int n_vecs>
+class clip_contig_kernel;
+
+template <typename argTy>
+sycl::event
+clip_contig_impl(sycl::queue exec_q,
+                 size_t nelems,
+                 const std::array<const char *, 3> &arg_ps,
+                 const std::array<py::ssize_t, 3> &arg_offsets,
+                 char *res_p,
+                 py::ssize_t res_offset,
+                 const std::vector<sycl::event> &depends = {})
+{
+    constexpr unsigned int vec_sz = 4;
+    constexpr unsigned int n_vecs = 2;
+
+    using resTy = typename ClipOutputType<argTy>::value_type;
+    return elementwise_common::nary_contig_impl<
+        resTy, ClipFunctor<argTy>, clip_contig_kernel<argTy, vec_sz, n_vecs>,
+        vec_sz, n_vecs, argTy, argTy, argTy>(exec_q, nelems, arg_ps,
+                                             arg_offsets, res_p, res_offset,
+                                             depends);
+}
+
+template <typename fnT, typename T> struct ClipContigFactory
+{
+    fnT get()
+    {
+        if constexpr (std::is_same_v<typename ClipOutputType<T>::value_type,
+                                     void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = clip_contig_impl<T>;
+            return fn;
+        }
+    }
+};
+
+template <typename fnT, typename T> struct ClipTypeMapFactory
+{
+    /*! @brief get typeid for output type of clip(T x, T lo, T hi) */
+    std::enable_if_t<std::is_same<fnT, int>::value, int> get()
+    {
+        using rT = typename ClipOutputType<T>::value_type;
+        return td_ns::GetTypeid<rT>{}.get();
+    }
+};
+
+template <typename T> class clip_strided_kernel;
+
+template <typename argTy>
+sycl::event
+clip_strided_impl(sycl::queue exec_q,
+                  size_t nelems,
+                  int nd,
+                  const py::ssize_t *shape_and_strides,
+                  const std::array<const char *, 3> &arg_ps,
+                  const std::array<py::ssize_t, 3> &arg_offsets,
+                  char *res_p,
+                  py::ssize_t res_offset,
+                  const std::vector<sycl::event> &depends,
+                  const std::vector<sycl::event> &additional_depends)
+{
+    using resTy = typename ClipOutputType<argTy>::value_type;
+    return elementwise_common::nary_strided_impl<
+        resTy, ClipFunctor<argTy>, clip_strided_kernel<argTy>, argTy, argTy,
+        argTy>(exec_q, nelems, nd, shape_and_strides, arg_ps, arg_offsets,
+               res_p, res_offset, depends, additional_depends);
+}
+
+template <typename fnT, typename T> struct ClipStridedFactory
+{
+    fnT get()
+    {
+        if constexpr (std::is_same_v<typename ClipOutputType<T>::value_type,
+                                     void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = clip_strided_impl<T>;
+            return fn;
+        }
+    }
+};
+
+} // namespace clip
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
@@ -28,6 +28,9 @@
 #include <cstdint>
 #include <pybind11/pybind11.h>
 
+#include "utils/sycl_alloc_utils.hpp"
+#include "utils/sycl_utils.hpp"
+
 namespace dpctl
 {
 namespace tensor
@@ -37,6 +40,9 @@ namespace kernels
 namespace elementwise_common
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+using dpctl::tensor::alloc_utils::sycl_malloc_device;
+
 /*! @brief Functor for unary function evaluation on contiguous array */
 template <typename argT,
           typename resT,
@@ -56,7 +62,36 @@ public:
     {
     }
 
+    /*! @brief Evaluates operator on the calling thread, for arrays of few
+     * elements accessible from the host */
+    void host_eval() const
+    {
+        UnaryOperatorT op{};
+        for (size_t k = 0; k < nelems_; ++k) {
+            if constexpr (UnaryOperatorT::is_constant::value) {
+                out[k] = UnaryOperatorT::constant_value;
+            }
+            else {
+                out[k] = op(in[k]);
+            }
+        }
+    }
+
     void operator()(sycl::nd_item<1> ndit) const
+    {
+        // work-groups loop over blocks of elements with a stride equal to
+        // the number of launched work-groups, see elementwise_n_groups
+        const size_t elems_per_group =
+            n_vecs * vec_sz * ndit.get_local_range(0);
+        const size_t n_groups = ndit.get_group_range(0);
+        for (size_t group_id = ndit.get_group(0);
+             group_id * elems_per_group < nelems_; group_id += n_groups)
+        {
+            process_group(ndit, group_id);
+        }
+    }
+
+    void process_group(const sycl::nd_item<1> &ndit, size_t group_id) const
     {
         UnaryOperatorT op{};
         /* Each work-item processes vec_sz elements, contiguous in memory */
@@ -70,7 +105,7 @@ public:
             std::uint8_t sgSize = sg.get_local_range()[0];
             std::uint8_t max_sgSize = sg.get_max_local_range()[0];
             size_t base = n_vecs * vec_sz *
-                          (ndit.get_group(0) * ndit.get_local_range(0) +
+                          (group_id * ndit.get_local_range(0) +
                            sg.get_group_id()[0] * sgSize);
             if (base + n_vecs * vec_sz * sgSize < nelems_ &&
                 max_sgSize == sgSize) {
@@ -98,7 +133,7 @@ public:
             std::uint16_t sgSize = sg.get_local_range()[0];
             std::uint16_t max_sgSize = sg.get_max_local_range()[0];
             size_t base = n_vecs * vec_sz *
-                          (ndit.get_group(0) * ndit.get_local_range(0) +
+                          (group_id * ndit.get_local_range(0) +
                            sg.get_group_id()[0] * max_sgSize);
             if (base + n_vecs * vec_sz * sgSize < nelems_ &&
                 sgSize == max_sgSize) {
@@ -135,7 +170,7 @@ public:
             std::uint8_t sgSize = sg.get_local_range()[0];
             std::uint8_t maxsgSize = sg.get_max_local_range()[0];
             size_t base = n_vecs * vec_sz *
-                          (ndit.get_group(0) * ndit.get_local_range(0) +
+                          (group_id * ndit.get_local_range(0) +
                            sg.get_group_id()[0] * maxsgSize);
 
             if ((base + n_vecs * vec_sz * sgSize < nelems_) &&
@@ -173,7 +208,7 @@ public:
             std::uint8_t sgSize = sg.get_local_range()[0];
             std::uint8_t maxsgSize = sg.get_max_local_range()[0];
             size_t base = n_vecs * vec_sz *
-                          (ndit.get_group(0) * ndit.get_local_range(0) +
+                          (group_id * ndit.get_local_range(0) +
                            sg.get_group_id()[0] * maxsgSize);
 
             if ((base + n_vecs * vec_sz * sgSize < nelems_) &&
@@ -207,7 +242,8 @@ public:
         }
         else {
             std::uint8_t sgSize = ndit.get_sub_group().get_local_range()[0];
-            size_t base = ndit.get_global_linear_id();
+            size_t base =
+                group_id * ndit.get_local_range(0) + ndit.get_local_linear_id();
 
             base = (base / sgSize) * sgSize * n_vecs * vec_sz + (base % sgSize);
             for (size_t offset = base;
@@ -263,19 +299,26 @@ sycl::event unary_contig_impl(sycl::queue exec_q,
                               char *res_p,
                               const std::vector<sycl::event> &depends = {})
 {
+    using resTy = typename UnaryOutputType<argTy>::value_type;
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_p);
+    resTy *res_tp = reinterpret_cast<resTy *>(res_p);
+
+    if (sycl_utils::use_host_fastpath(exec_q, nelems, {arg_p, res_p},
+                                      depends)) {
+        ContigFunctorT<argTy, resTy, vec_sz, n_vecs>(arg_tp, res_tp, nelems)
+            .host_eval();
+        return sycl::event();
+    }
+
     sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends);
 
         size_t lws = 64;
-        const size_t n_groups =
-            ((nelems + lws * n_vecs * vec_sz - 1) / (lws * n_vecs * vec_sz));
+        const size_t n_groups = sycl_utils::elementwise_n_groups(
+            exec_q, nelems, lws, n_vecs * vec_sz);
         const auto gws_range = sycl::range<1>(n_groups * lws);
         const auto lws_range = sycl::range<1>(lws);
 
-        using resTy = typename UnaryOutputType<argTy>::value_type;
-        const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_p);
-        resTy *res_tp = reinterpret_cast<resTy *>(res_p);
-
         cgh.parallel_for<kernel_name<argTy, resTy, vec_sz, n_vecs>>(
             sycl::nd_range<1>(gws_range, lws_range),
             ContigFunctorT<argTy, resTy, vec_sz, n_vecs>(arg_tp, res_tp,
@@ -346,7 +389,31 @@ public:
     {
     }
 
+    /*! @brief Evaluates operator on the calling thread, for arrays of few
+     * elements accessible from the host */
+    void host_eval() const
+    {
+        BinaryOperatorT op{};
+        for (size_t k = 0; k < nelems_; ++k) {
+            out[k] = op(in1[k], in2[k]);
+        }
+    }
+
     void operator()(sycl::nd_item<1> ndit) const
+    {
+        // work-groups loop over blocks of elements with a stride equal to
+        // the number of launched work-groups, see elementwise_n_groups
+        const size_t elems_per_group =
+            n_vecs * vec_sz * ndit.get_local_range(0);
+        const size_t n_groups = ndit.get_group_range(0);
+        for (size_t group_id = ndit.get_group(0);
+             group_id * elems_per_group < nelems_; group_id += n_groups)
+        {
+            process_group(ndit, group_id);
+        }
+    }
+
+    void process_group(const sycl::nd_item<1> &ndit, size_t group_id) const
     {
         BinaryOperatorT op{};
         /* Each work-item processes vec_sz elements, contiguous in memory */
@@ -359,7 +426,7 @@ public:
             std::uint8_t maxsgSize = sg.get_max_local_range()[0];
 
             size_t base = n_vecs * vec_sz *
-                          (ndit.get_group(0) * ndit.get_local_range(0) +
+                          (group_id * ndit.get_local_range(0) +
                            sg.get_group_id()[0] * sgSize);
 
             if ((base + n_vecs * vec_sz * sgSize < nelems_) &&
@@ -399,7 +466,7 @@ public:
             std::uint8_t maxsgSize = sg.get_max_local_range()[0];
 
             size_t base = n_vecs * vec_sz *
-                          (ndit.get_group(0) * ndit.get_local_range(0) +
+                          (group_id * ndit.get_local_range(0) +
                            sg.get_group_id()[0] * sgSize);
 
             if ((base + n_vecs * vec_sz * sgSize < nelems_) &&
@@ -439,7 +506,8 @@ public:
         }
         else {
             std::uint8_t sgSize = ndit.get_sub_group().get_local_range()[0];
-            size_t base = ndit.get_global_linear_id();
+            size_t base =
+                group_id * ndit.get_local_range(0) + ndit.get_local_linear_id();
 
             base = (base / sgSize) * sgSize * n_vecs * vec_sz + (base % sgSize);
             for (size_t offset = base;
@@ -717,23 +785,32 @@ sycl::event binary_contig_impl(sycl::queue exec_q,
                                py::ssize_t res_offset,
                                const std::vector<sycl::event> &depends = {})
 {
+    using resTy = typename BinaryOutputType<argTy1, argTy2>::value_type;
+
+    const argTy1 *arg1_tp =
+        reinterpret_cast<const argTy1 *>(arg1_p) + arg1_offset;
+    const argTy2 *arg2_tp =
+        reinterpret_cast<const argTy2 *>(arg2_p) + arg2_offset;
+    resTy *res_tp = reinterpret_cast<resTy *>(res_p) + res_offset;
+
+    if (sycl_utils::use_host_fastpath(exec_q, nelems,
+                                      {arg1_tp, arg2_tp, res_tp}, depends))
+    {
+        BinaryContigFunctorT<argTy1, argTy2, resTy, vec_sz, n_vecs>(
+            arg1_tp, arg2_tp, res_tp, nelems)
+            .host_eval();
+        return sycl::event();
+    }
+
     sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends);
 
         size_t lws = 64;
-        const size_t n_groups =
-            ((nelems + lws * n_vecs * vec_sz - 1) / (lws * n_vecs * vec_sz));
+        const size_t n_groups = sycl_utils::elementwise_n_groups(
+            exec_q, nelems, lws, n_vecs * vec_sz);
         const auto gws_range = sycl::range<1>(n_groups * lws);
         const auto lws_range = sycl::range<1>(lws);
 
-        using resTy = typename BinaryOutputType<argTy1, argTy2>::value_type;
-
-        const argTy1 *arg1_tp =
-            reinterpret_cast<const argTy1 *>(arg1_p) + arg1_offset;
-        const argTy2 *arg2_tp =
-            reinterpret_cast<const argTy2 *>(arg2_p) + arg2_offset;
-        resTy *res_tp = reinterpret_cast<resTy *>(res_p) + res_offset;
-
         cgh.parallel_for<kernel_name<argTy1, argTy2, resTy, vec_sz, n_vecs>>(
             sycl::nd_range<1>(gws_range, lws_range),
             BinaryContigFunctorT<argTy1, argTy2, resTy, vec_sz, n_vecs>(
@@ -819,7 +896,8 @@ sycl::event binary_contig_matrix_contig_row_broadcast_impl(
         *(std::max_element(std::begin(sg_sizes), std::end(sg_sizes)));
 
     size_t n1_padded = n1 + max_sgSize;
-    argT2 *padded_vec = sycl::malloc_device<argT2>(n1_padded, exec_q);
+    argT2 *padded_vec = sycl_malloc_device<argT2>(
+        n1_padded, exec_q, "binary_contig_matrix_contig_row_broadcast_impl");
 
     if (padded_vec == nullptr) {
         throw std::runtime_error("Could not allocate memory on the device");
@@ -858,7 +936,8 @@ sycl::event binary_contig_matrix_contig_row_broadcast_impl(
     sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(comp_ev);
         sycl::context ctx = exec_q.get_context();
-        cgh.host_task([ctx, padded_vec]() { sycl::free(padded_vec, ctx); });
+        cgh.host_task(
+            [ctx, padded_vec]() { sycl_free_noexcept(padded_vec, ctx); });
     });
     host_tasks.push_back(tmp_cleanup_ev);
 
@@ -897,7 +976,8 @@ sycl::event binary_contig_row_contig_matrix_broadcast_impl(
         *(std::max_element(std::begin(sg_sizes), std::end(sg_sizes)));
 
     size_t n1_padded = n1 + max_sgSize;
-    argT2 *padded_vec = sycl::malloc_device<argT2>(n1_padded, exec_q);
+    argT2 *padded_vec = sycl_malloc_device<argT2>(
+        n1_padded, exec_q, "binary_contig_row_contig_matrix_broadcast_impl");
 
     if (padded_vec == nullptr) {
         throw std::runtime_error("Could not allocate memory on the device");
@@ -937,7 +1017,8 @@ sycl::event binary_contig_row_contig_matrix_broadcast_impl(
     sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(comp_ev);
         sycl::context ctx = exec_q.get_context();
-        cgh.host_task([ctx, padded_vec]() { sycl::free(padded_vec, ctx); });
+        cgh.host_task(
+            [ctx, padded_vec]() { sycl_free_noexcept(padded_vec, ctx); });
     });
     host_tasks.push_back(tmp_cleanup_ev);
 
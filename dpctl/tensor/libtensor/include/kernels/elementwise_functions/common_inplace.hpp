@@ -29,6 +29,9 @@
 #include <cstdint>
 #include <pybind11/pybind11.h>
 
+#include "utils/sycl_alloc_utils.hpp"
+#include "utils/sycl_utils.hpp"
+
 namespace dpctl
 {
 namespace tensor
@@ -38,6 +41,9 @@ namespace kernels
 namespace elementwise_common
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+using dpctl::tensor::alloc_utils::sycl_malloc_device;
+
 template <typename argT,
           typename resT,
           typename BinaryInplaceOperatorT,
@@ -58,7 +64,31 @@ public:
     {
     }
 
+    /*! @brief Evaluates operator on the calling thread, for arrays of few
+     * elements accessible from the host */
+    void host_eval() const
+    {
+        BinaryInplaceOperatorT op{};
+        for (size_t k = 0; k < nelems_; ++k) {
+            op(lhs[k], rhs[k]);
+        }
+    }
+
     void operator()(sycl::nd_item<1> ndit) const
+    {
+        // work-groups loop over blocks of elements with a stride equal to
+        // the number of launched work-groups, see elementwise_n_groups
+        const size_t elems_per_group =
+            n_vecs * vec_sz * ndit.get_local_range(0);
+        const size_t n_groups = ndit.get_group_range(0);
+        for (size_t group_id = ndit.get_group(0);
+             group_id * elems_per_group < nelems_; group_id += n_groups)
+        {
+            process_group(ndit, group_id);
+        }
+    }
+
+    void process_group(const sycl::nd_item<1> &ndit, size_t group_id) const
     {
         BinaryInplaceOperatorT op{};
         /* Each work-item processes vec_sz elements, contiguous in memory */
@@ -71,7 +101,7 @@ public:
             std::uint8_t maxsgSize = sg.get_max_local_range()[0];
 
             size_t base = n_vecs * vec_sz *
-                          (ndit.get_group(0) * ndit.get_local_range(0) +
+                          (group_id * ndit.get_local_range(0) +
                            sg.get_group_id()[0] * sgSize);
 
             if ((base + n_vecs * vec_sz * sgSize < nelems_) &&
@@ -110,7 +140,7 @@ public:
             std::uint8_t maxsgSize = sg.get_max_local_range()[0];
 
             size_t base = n_vecs * vec_sz *
-                          (ndit.get_group(0) * ndit.get_local_range(0) +
+                          (group_id * ndit.get_local_range(0) +
                            sg.get_group_id()[0] * sgSize);
 
             if ((base + n_vecs * vec_sz * sgSize < nelems_) &&
@@ -145,7 +175,8 @@ public:
         }
         else {
             std::uint8_t sgSize = ndit.get_sub_group().get_local_range()[0];
-            size_t base = ndit.get_global_linear_id();
+            size_t base =
+                group_id * ndit.get_local_range(0) + ndit.get_local_linear_id();
 
             base = (base / sgSize) * sgSize * n_vecs * vec_sz + (base % sgSize);
             for (size_t offset = base;
@@ -296,19 +327,26 @@ binary_inplace_contig_impl(sycl::queue exec_q,
                            py::ssize_t lhs_offset,
                            const std::vector<sycl::event> &depends = {})
 {
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(rhs_p) + rhs_offset;
+    resTy *res_tp = reinterpret_cast<resTy *>(lhs_p) + lhs_offset;
+
+    if (sycl_utils::use_host_fastpath(exec_q, nelems, {arg_tp, res_tp},
+                                      depends)) {
+        BinaryInplaceContigFunctorT<argTy, resTy, vec_sz, n_vecs>(
+            arg_tp, res_tp, nelems)
+            .host_eval();
+        return sycl::event();
+    }
+
     sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends);
 
         size_t lws = 64;
-        const size_t n_groups =
-            ((nelems + lws * n_vecs * vec_sz - 1) / (lws * n_vecs * vec_sz));
+        const size_t n_groups = sycl_utils::elementwise_n_groups(
+            exec_q, nelems, lws, n_vecs * vec_sz);
         const auto gws_range = sycl::range<1>(n_groups * lws);
         const auto lws_range = sycl::range<1>(lws);
 
-        const argTy *arg_tp =
-            reinterpret_cast<const argTy *>(rhs_p) + rhs_offset;
-        resTy *res_tp = reinterpret_cast<resTy *>(lhs_p) + lhs_offset;
-
         cgh.parallel_for<kernel_name<argTy, resTy, vec_sz, n_vecs>>(
             sycl::nd_range<1>(gws_range, lws_range),
             BinaryInplaceContigFunctorT<argTy, resTy, vec_sz, n_vecs>(
@@ -381,7 +419,8 @@ sycl::event binary_inplace_row_matrix_broadcast_impl(
         *(std::max_element(std::begin(sg_sizes), std::end(sg_sizes)));
 
     size_t n1_padded = n1 + max_sgSize;
-    argT *padded_vec = sycl::malloc_device<argT>(n1_padded, exec_q);
+    argT *padded_vec = sycl_malloc_device<argT>(
+        n1_padded, exec_q, "binary_inplace_row_matrix_broadcast_impl");
 
     if (padded_vec == nullptr) {
         throw std::runtime_error("Could not allocate memory on the device");
@@ -420,7 +459,8 @@ sycl::event binary_inplace_row_matrix_broadcast_impl(
     sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(comp_ev);
         sycl::context ctx = exec_q.get_context();
-        cgh.host_task([ctx, padded_vec]() { sycl::free(padded_vec, ctx); });
+        cgh.host_task(
+            [ctx, padded_vec]() { sycl_free_noexcept(padded_vec, ctx); });
     });
     host_tasks.push_back(tmp_cleanup_ev);
 
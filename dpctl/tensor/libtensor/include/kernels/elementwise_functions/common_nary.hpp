@@ -0,0 +1,370 @@
+//=== common_nary.hpp - Common code for N-ary elementwise ops -- *-C++-*--/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===---------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines common code for elementwise tensor operations with an
+/// arbitrary number of inputs, e.g. clip(x, lo, hi), evaluated in a single
+/// pass over memory.
+//===---------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <pybind11/pybind11.h>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "utils/offset_utils.hpp"
+#include "utils/sycl_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace elementwise_common
+{
+
+namespace py = pybind11;
+
+namespace detail
+{
+
+template <unsigned int vec_sz, typename T>
+sycl::vec<T, vec_sz> sg_load_vec(const sycl::sub_group &sg, const T *ptr)
+{
+    auto multi_ptr = sycl::address_space_cast<
+        sycl::access::address_space::global_space,
+        sycl::access::decorated::yes>(ptr);
+    return sg.load<vec_sz>(multi_ptr);
+}
+
+} // namespace detail
+
+/*! @brief Functor for evaluation of N-ary function on contiguous arrays.
+ *
+ * Operator `NaryOperatorT` is called with one scalar argument per input.
+ * If it supports sub-group loads and stores, all inputs are read with
+ * sub-group block loads, same as in BinaryContigFunctor.
+ */
+template <typename resT,
+          typename NaryOperatorT,
+          unsigned int vec_sz,
+          unsigned int n_vecs,
+          typename... argTs>
+struct NaryContigFunctor
+{
+private:
+    std::tuple<const argTs *...> in;
+    resT *out = nullptr;
+    const size_t nelems_;
+
+    template <std::size_t... Is>
+    resT apply_at(NaryOperatorT &op,
+                  size_t k,
+                  std::index_sequence<Is...>) const
+    {
+        return op(std::get<Is>(in)[k]...);
+    }
+
+    template <std::size_t... Is>
+    void apply_sg(NaryOperatorT &op,
+                  const sycl::sub_group &sg,
+                  size_t offset,
+                  std::index_sequence<Is...>) const
+    {
+        const std::tuple<sycl::vec<argTs, vec_sz>...> arg_vecs{
+            detail::sg_load_vec<vec_sz>(sg, std::get<Is>(in) + offset)...};
+        sycl::vec<resT, vec_sz> res_vec;
+#pragma unroll
+        for (std::uint8_t vec_id = 0; vec_id < vec_sz; ++vec_id) {
+            res_vec[vec_id] = op(std::get<Is>(arg_vecs)[vec_id]...);
+        }
+        auto out_multi_ptr = sycl::address_space_cast<
+            sycl::access::address_space::global_space,
+            sycl::access::decorated::yes>(&out[offset]);
+        sg.store<vec_sz>(out_multi_ptr, res_vec);
+    }
+
+public:
+    NaryContigFunctor(const std::tuple<const argTs *...> &inps,
+                      resT *res,
+                      const size_t n_elems)
+        : in(inps), out(res), nelems_(n_elems)
+    {
+    }
+
+    /*! @brief Evaluates operator on the calling thread, for arrays of few
+     * elements accessible from the host */
+    void host_eval() const
+    {
+        NaryOperatorT op{};
+        constexpr auto is = std::index_sequence_for<argTs...>{};
+        for (size_t k = 0; k < nelems_; ++k) {
+            out[k] = apply_at(op, k, is);
+        }
+    }
+
+    void operator()(sycl::nd_item<1> ndit) const
+    {
+        // work-groups loop over blocks of elements with a stride equal to
+        // the number of launched work-groups, see elementwise_n_groups
+        const size_t elems_per_group =
+            n_vecs * vec_sz * ndit.get_local_range(0);
+        const size_t n_groups = ndit.get_group_range(0);
+        for (size_t group_id = ndit.get_group(0);
+             group_id * elems_per_group < nelems_; group_id += n_groups)
+        {
+            process_group(ndit, group_id);
+        }
+    }
+
+    void process_group(const sycl::nd_item<1> &ndit, size_t group_id) const
+    {
+        NaryOperatorT op{};
+        constexpr auto is = std::index_sequence_for<argTs...>{};
+        /* Each work-item processes vec_sz elements, contiguous in memory */
+
+        if constexpr (NaryOperatorT::supports_sg_loadstore::value) {
+            auto sg = ndit.get_sub_group();
+            std::uint8_t sgSize = sg.get_local_range()[0];
+            std::uint8_t maxsgSize = sg.get_max_local_range()[0];
+
+            size_t base = n_vecs * vec_sz *
+                          (group_id * ndit.get_local_range(0) +
+                           sg.get_group_id()[0] * sgSize);
+
+            if ((base + n_vecs * vec_sz * sgSize < nelems_) &&
+                (sgSize == maxsgSize)) {
+#pragma unroll
+                for (std::uint8_t it = 0; it < n_vecs * vec_sz; it += vec_sz) {
+                    apply_sg(op, sg, base + it * sgSize, is);
+                }
+            }
+            else {
+                for (size_t k = base + sg.get_local_id()[0]; k < nelems_;
+                     k += sgSize) {
+                    out[k] = apply_at(op, k, is);
+                }
+            }
+        }
+        else {
+            std::uint8_t sgSize = ndit.get_sub_group().get_local_range()[0];
+            size_t base =
+                group_id * ndit.get_local_range(0) + ndit.get_local_linear_id();
+
+            base = (base / sgSize) * sgSize * n_vecs * vec_sz + (base % sgSize);
+            for (size_t offset = base;
+                 offset < std::min(nelems_, base + sgSize * (n_vecs * vec_sz));
+                 offset += sgSize)
+            {
+                out[offset] = apply_at(op, offset, is);
+            }
+        }
+    }
+};
+
+/*! @brief Functor for evaluation of N-ary function on strided arrays.
+ *
+ * Indexer returns `sizeof...(argTs) + 1` offsets, the offset of the output
+ * being the last one.
+ */
+template <typename resT,
+          typename IndexerT,
+          typename NaryOperatorT,
+          typename... argTs>
+struct NaryStridedFunctor
+{
+private:
+    std::tuple<const argTs *...> in;
+    resT *out = nullptr;
+    IndexerT indexer_;
+
+    template <typename OffsetsT, std::size_t... Is>
+    resT apply_at(NaryOperatorT &op,
+                  const OffsetsT &offsets,
+                  std::index_sequence<Is...>) const
+    {
+        return op(std::get<Is>(in)[offsets.get_offset(Is)]...);
+    }
+
+public:
+    NaryStridedFunctor(const std::tuple<const argTs *...> &inps,
+                       resT *res,
+                       IndexerT inps_res_indexer)
+        : in(inps), out(res), indexer_(inps_res_indexer)
+    {
+    }
+
+    void operator()(sycl::id<1> wid) const
+    {
+        const auto &offsets_ = indexer_(static_cast<py::ssize_t>(wid.get(0)));
+        const auto &out_offset = offsets_.get_offset(sizeof...(argTs));
+
+        NaryOperatorT op{};
+        out[out_offset] =
+            apply_at(op, offsets_, std::index_sequence_for<argTs...>{});
+    }
+};
+
+// Typedefs for function pointers
+
+template <std::size_t nargs>
+using nary_contig_impl_fn_ptr_t =
+    sycl::event (*)(sycl::queue,
+                    size_t,
+                    const std::array<const char *, nargs> &,
+                    const std::array<py::ssize_t, nargs> &,
+                    char *,
+                    py::ssize_t,
+                    const std::vector<sycl::event> &);
+
+template <std::size_t nargs>
+using nary_strided_impl_fn_ptr_t =
+    sycl::event (*)(sycl::queue,
+                    size_t,
+                    int,
+                    const py::ssize_t *,
+                    const std::array<const char *, nargs> &,
+                    const std::array<py::ssize_t, nargs> &,
+                    char *,
+                    py::ssize_t,
+                    const std::vector<sycl::event> &,
+                    const std::vector<sycl::event> &);
+
+namespace detail
+{
+
+template <typename... argTs, std::size_t... Is>
+std::tuple<const argTs *...>
+typed_pointers(const std::array<const char *, sizeof...(argTs)> &arg_ps,
+               const std::array<py::ssize_t, sizeof...(argTs)> &arg_offsets,
+               std::index_sequence<Is...>)
+{
+    return std::tuple<const argTs *...>{
+        reinterpret_cast<const argTs *>(arg_ps[Is]) + arg_offsets[Is]...};
+}
+
+} // namespace detail
+
+template <typename resTy,
+          typename NaryOperatorT,
+          typename kernel_name,
+          unsigned int vec_sz,
+          unsigned int n_vecs,
+          typename... argTys>
+sycl::event
+nary_contig_impl(sycl::queue exec_q,
+                 size_t nelems,
+                 const std::array<const char *, sizeof...(argTys)> &arg_ps,
+                 const std::array<py::ssize_t, sizeof...(argTys)> &arg_offsets,
+                 char *res_p,
+                 py::ssize_t res_offset,
+                 const std::vector<sycl::event> &depends = {})
+{
+    constexpr std::size_t nargs = sizeof...(argTys);
+    const auto args_tp = detail::typed_pointers<argTys...>(
+        arg_ps, arg_offsets, std::index_sequence_for<argTys...>{});
+    resTy *res_tp = reinterpret_cast<resTy *>(res_p) + res_offset;
+
+    using ContigFunctorT =
+        NaryContigFunctor<resTy, NaryOperatorT, vec_sz, n_vecs, argTys...>;
+
+    std::array<const void *, nargs + 1> ptrs;
+    for (std::size_t i = 0; i < nargs; ++i) {
+        ptrs[i] = arg_ps[i];
+    }
+    ptrs[nargs] = res_tp;
+    if (sycl_utils::use_host_fastpath(exec_q, nelems, ptrs.data(),
+                                      ptrs.size(), depends))
+    {
+        ContigFunctorT(args_tp, res_tp, nelems).host_eval();
+        return sycl::event();
+    }
+
+    sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        size_t lws = 64;
+        const size_t n_groups = sycl_utils::elementwise_n_groups(
+            exec_q, nelems, lws, n_vecs * vec_sz);
+        const auto gws_range = sycl::range<1>(n_groups * lws);
+        const auto lws_range = sycl::range<1>(lws);
+
+        cgh.parallel_for<kernel_name>(sycl::nd_range<1>(gws_range, lws_range),
+                                      ContigFunctorT(args_tp, res_tp, nelems));
+    });
+    return comp_ev;
+}
+
+template <typename resTy,
+          typename NaryOperatorT,
+          typename kernel_name,
+          typename... argTys>
+sycl::event
+nary_strided_impl(sycl::queue exec_q,
+                  size_t nelems,
+                  int nd,
+                  const py::ssize_t *shape_and_strides,
+                  const std::array<const char *, sizeof...(argTys)> &arg_ps,
+                  const std::array<py::ssize_t, sizeof...(argTys)> &arg_offsets,
+                  char *res_p,
+                  py::ssize_t res_offset,
+                  const std::vector<sycl::event> &depends,
+                  const std::vector<sycl::event> &additional_depends)
+{
+    constexpr int nargs = static_cast<int>(sizeof...(argTys));
+
+    sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+        cgh.depends_on(additional_depends);
+
+        using IndexerT =
+            dpctl::tensor::offset_utils::NOffsets_StridedIndexer<nargs + 1>;
+
+        std::array<py::ssize_t, nargs + 1> offsets;
+        for (int k = 0; k < nargs; ++k) {
+            offsets[k] = arg_offsets[k];
+        }
+        offsets[nargs] = res_offset;
+        IndexerT indexer{nd, offsets, shape_and_strides};
+
+        const auto &args_tp = detail::typed_pointers<argTys...>(
+            arg_ps, std::array<py::ssize_t, sizeof...(argTys)>{},
+            std::index_sequence_for<argTys...>{});
+        resTy *res_tp = reinterpret_cast<resTy *>(res_p);
+
+        using StridedFunctorT =
+            NaryStridedFunctor<resTy, IndexerT, NaryOperatorT, argTys...>;
+
+        cgh.parallel_for<kernel_name>(
+            {nelems}, StridedFunctorT(args_tp, res_tp, indexer));
+    });
+    return comp_ev;
+}
+
+} // namespace elementwise_common
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
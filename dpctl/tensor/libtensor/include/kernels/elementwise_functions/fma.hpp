@@ -0,0 +1,175 @@
+//=== fma.hpp - Ternary function FMA --------------------------- *-C++-*--/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===---------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels for elementwise evaluation of FMA(x1, x2, x3)
+/// function, i.e. x1 * x2 + x3 with a single rounding.
+//===---------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "utils/offset_utils.hpp"
+#include "utils/type_dispatch.hpp"
+#include "utils/type_utils.hpp"
+
+#include "kernels/elementwise_functions/common_nary.hpp"
+#include <pybind11/pybind11.h>
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace fma
+{
+
+namespace py = pybind11;
+namespace td_ns = dpctl::tensor::type_dispatch;
+namespace tu_ns = dpctl::tensor::type_utils;
+
+template <typename argT> struct FmaFunctor
+{
+
+    using supports_sg_loadstore = std::negation<tu_ns::is_complex<argT>>;
+
+    argT operator()(const argT &x1, const argT &x2, const argT &x3) const
+    {
+        if constexpr (tu_ns::is_complex<argT>::value) {
+            return x1 * x2 + x3;
+        }
+        else {
+            // product is not rounded before the addition
+            return sycl::fma(x1, x2, x3);
+        }
+    }
+};
+
+template <typename T> struct FmaOutputType
+{
+    using value_type = typename std::disjunction< // disjunction is C++17
+                                                  // feature, supported by DPC++
+        td_ns::TypeMapResultEntry<T, sycl::half>,
+        td_ns::TypeMapResultEntry<T, float>,
+        td_ns::TypeMapResultEntry<T, double>,
+        td_ns::TypeMapResultEntry<T, std::complex<float>>,
+        td_ns::TypeMapResultEntry<T, std::complex<double>>,
+        td_ns::DefaultResultEntry<void>>::result_type;
+};
+
+template <typename T, unsigned int vec_sz, unsigned int n_vecs>
+class fma_contig_kernel;
+
+template <typename argTy>
+sycl::event
+fma_contig_impl(sycl::queue exec_q,
+                size_t nelems,
+                const std::array<const char *, 3> &arg_ps,
+                const std::array<py::ssize_t, 3> &arg_offsets,
+                char *res_p,
+                py::ssize_t res_offset,
+                const std::vector<sycl::event> &depends = {})
+{
+    constexpr unsigned int vec_sz = 4;
+    constexpr unsigned int n_vecs = 2;
+
+    using resTy = typename FmaOutputType<argTy>::value_type;
+    return elementwise_common::nary_contig_impl<
+        resTy, FmaFunctor<argTy>, fma_contig_kernel<argTy, vec_sz, n_vecs>,
+        vec_sz, n_vecs, argTy, argTy, argTy>(exec_q, nelems, arg_ps,
+                                             arg_offsets, res_p, res_offset,
+                                             depends);
+}
+
+template <typename fnT, typename T> struct FmaContigFactory
+{
+    fnT get()
+    {
+        if constexpr (std::is_same_v<typename FmaOutputType<T>::value_type,
+                                     void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = fma_contig_impl<T>;
+            return fn;
+        }
+    }
+};
+
+template <typename fnT, typename T> struct FmaTypeMapFactory
+{
+    /*! @brief get typeid for output type of fma(T x1, T x2, T x3) */
+    std::enable_if_t<std::is_same<fnT, int>::value, int> get()
+    {
+        using rT = typename FmaOutputType<T>::value_type;
+        return td_ns::GetTypeid<rT>{}.get();
+    }
+};
+
+template <typename T> class fma_strided_kernel;
+
+template <typename argTy>
+sycl::event
+fma_strided_impl(sycl::queue exec_q,
+                 size_t nelems,
+                 int nd,
+                 const py::ssize_t *shape_and_strides,
+                 const std::array<const char *, 3> &arg_ps,
+                 const std::array<py::ssize_t, 3> &arg_offsets,
+                 char *res_p,
+                 py::ssize_t res_offset,
+                 const std::vector<sycl::event> &depends,
+                 const std::vector<sycl::event> &additional_depends)
+{
+    using resTy = typename FmaOutputType<argTy>::value_type;
+    return elementwise_common::nary_strided_impl<
+        resTy, FmaFunctor<argTy>, fma_strided_kernel<argTy>, argTy, argTy,
+        argTy>(exec_q, nelems, nd, shape_and_strides, arg_ps, arg_offsets,
+               res_p, res_offset, depends, additional_depends);
+}
+
+template <typename fnT, typename T> struct FmaStridedFactory
+{
+    fnT get()
+    {
+        if constexpr (std::is_same_v<typename FmaOutputType<T>::value_type,
+                                     void>) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = fma_strided_impl<T>;
+            return fn;
+        }
+    }
+};
+
+} // namespace fma
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
@@ -0,0 +1,612 @@
+//=== histogram.hpp - Implementation of histogram kernels ---*-C++-*--/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels of histogram, bin search and range of values
+/// of one-dimensional arrays.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <pybind11/pybind11.h>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "utils/sycl_alloc_utils.hpp"
+#include "utils/sycl_utils.hpp"
+#include "utils/type_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace histogram
+{
+
+namespace py = pybind11;
+
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+using dpctl::tensor::alloc_utils::sycl_malloc_device;
+
+/*! @brief Number of elements processed by each work-item per iteration of
+ * the grid-stride loop, as in reduction kernels */
+static constexpr size_t histogram_elems_per_wi = 16;
+
+/*! @brief Converts value of input array into the data type of bin edges */
+template <typename T, typename edgeT> inline edgeT to_edge_type(const T &v)
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        return (v) ? edgeT(1) : edgeT(0);
+    }
+    else {
+        return static_cast<edgeT>(v);
+    }
+}
+
+/*! @brief Number of the first `n` elements of sorted `edges` not exceeding
+ * `v`, or less than `v` if `strict` */
+template <typename edgeT>
+inline size_t
+count_edges_below(const edgeT *edges, size_t n, edgeT v, bool strict)
+{
+    size_t lo = 0;
+    size_t hi = n;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        const bool below = (strict) ? (edges[mid] < v) : (edges[mid] <= v);
+        if (below) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/*! @brief Index of bin among `n_bins` bins with sorted `edges` containing
+ * value `v` from the range `[edges[0], edges[n_bins]]`. The last bin is
+ * closed, other bins are half-open.
+ *
+ * For uniform bins the index is computed from the offset of the value,
+ * and then corrected by comparison with edges, as in `numpy.histogram`. */
+template <typename edgeT>
+inline size_t
+find_bin(const edgeT *edges, size_t n_bins, bool uniform, edgeT v)
+{
+    if (uniform) {
+        const edgeT lo = edges[0];
+        const edgeT hi = edges[n_bins];
+        // relative offset is computed first, as number of bins divided by
+        // a narrow range may overflow
+        const edgeT rel = (v - lo) / (hi - lo);
+        size_t bin = static_cast<size_t>(rel * static_cast<edgeT>(n_bins));
+        bin = std::min(bin, n_bins - 1);
+        if (v < edges[bin]) {
+            --bin;
+        }
+        else if (bin + 1 < n_bins && v >= edges[bin + 1]) {
+            ++bin;
+        }
+        return bin;
+    }
+    return count_edges_below(edges + 1, n_bins - 1, v, false);
+}
+
+/*! @brief Each work-group counts elements of a strided array into a
+ * private histogram in local memory, visiting elements in grid-stride
+ * loop, and adds it to the global histogram with atomics.
+ *
+ * Work-groups of a single work-item, used on CPU devices, count without
+ * atomics, which amounts to per-thread privatization. If the histogram
+ * does not fit into local memory, `privatized` is false and elements are
+ * counted directly in the global histogram. */
+template <typename T, typename edgeT, typename countT, bool privatized>
+class HistogramFunctor
+{
+private:
+    const T *src_ = nullptr;
+    size_t n_ = 0;
+    py::ssize_t stride_ = 1;
+    const edgeT *edges_ = nullptr;
+    size_t n_bins_ = 0;
+    bool uniform_ = true;
+    countT *counts_ = nullptr;
+    sycl::local_accessor<std::uint32_t, 1> slm_hist_;
+
+public:
+    HistogramFunctor(const T *src,
+                     size_t n,
+                     py::ssize_t stride,
+                     const edgeT *edges,
+                     size_t n_bins,
+                     bool uniform,
+                     countT *counts,
+                     sycl::local_accessor<std::uint32_t, 1> slm_hist)
+        : src_(src), n_(n), stride_(stride), edges_(edges), n_bins_(n_bins),
+          uniform_(uniform), counts_(counts), slm_hist_(slm_hist)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const size_t lid = it.get_local_id(0);
+        const size_t lws = it.get_local_range(0);
+        const size_t gws = it.get_global_range(0);
+
+        if constexpr (privatized) {
+            for (size_t b = lid; b < n_bins_; b += lws) {
+                slm_hist_[b] = 0;
+            }
+            it.barrier(sycl::access::fence_space::local_space);
+        }
+
+        const edgeT lo = edges_[0];
+        const edgeT hi = edges_[n_bins_];
+        for (size_t i = it.get_global_id(0); i < n_; i += gws) {
+            const edgeT v = to_edge_type<T, edgeT>(
+                src_[static_cast<py::ssize_t>(i) * stride_]);
+            // NaNs fail both comparisons
+            if (!(v >= lo && v <= hi)) {
+                continue;
+            }
+            const size_t bin = find_bin(edges_, n_bins_, uniform_, v);
+            if constexpr (privatized) {
+                if (lws == 1) {
+                    slm_hist_[bin] += 1;
+                }
+                else {
+                    sycl::atomic_ref<std::uint32_t, sycl::memory_order::relaxed,
+                                     sycl::memory_scope::work_group,
+                                     sycl::access::address_space::local_space>
+                        bin_ref(slm_hist_[bin]);
+                    bin_ref += 1;
+                }
+            }
+            else {
+                sycl::atomic_ref<countT, sycl::memory_order::relaxed,
+                                 sycl::memory_scope::device,
+                                 sycl::access::address_space::global_space>
+                    bin_ref(counts_[bin]);
+                bin_ref += 1;
+            }
+        }
+
+        if constexpr (privatized) {
+            it.barrier(sycl::access::fence_space::local_space);
+            for (size_t b = lid; b < n_bins_; b += lws) {
+                const std::uint32_t c = slm_hist_[b];
+                if (c) {
+                    sycl::atomic_ref<countT, sycl::memory_order::relaxed,
+                                     sycl::memory_scope::device,
+                                     sycl::access::address_space::global_space>
+                        bin_ref(counts_[b]);
+                    bin_ref += static_cast<countT>(c);
+                }
+            }
+        }
+    }
+};
+
+template <typename T, typename edgeT, typename countT, bool privatized>
+class histogram_krn;
+
+template <typename countT> class histogram_copy_counts_krn;
+
+typedef sycl::event (*histogram_fn_ptr_t)(sycl::queue,
+                                          size_t,
+                                          const char *,
+                                          py::ssize_t,
+                                          const char *,
+                                          size_t,
+                                          bool,
+                                          char *,
+                                          const std::vector<sycl::event> &);
+
+template <typename T, typename edgeT, typename countT>
+sycl::event histogram_with_counts_impl(sycl::queue exec_q,
+                                       size_t n,
+                                       const T *src,
+                                       py::ssize_t stride,
+                                       const edgeT *edges,
+                                       size_t n_bins,
+                                       bool uniform,
+                                       std::int64_t *res,
+                                       const std::vector<sycl::event> &depends)
+{
+    const sycl::device &d = exec_q.get_device();
+    const auto &dev_info =
+        dpctl::tensor::sycl_utils::detail::get_launch_device_info(d);
+    const size_t max_wg = d.get_info<sycl::info::device::max_work_group_size>();
+    const size_t slm_size = d.get_info<sycl::info::device::local_mem_size>();
+
+    // work-groups of a single work-item on CPU, so each thread counts into
+    // its own histogram
+    const size_t lws =
+        (dev_info.is_cpu) ? size_t(1) : std::min<size_t>(max_wg, 256);
+    const bool privatized = (n_bins * sizeof(std::uint32_t) <= slm_size / 2);
+
+    const size_t max_groups = (dev_info.is_cpu)
+                                  ? dev_info.n_compute_units
+                                  : 8 * dev_info.n_compute_units;
+    const size_t n_groups = std::max<size_t>(
+        1, std::min(max_groups, (n + lws * histogram_elems_per_wi - 1) /
+                                    (lws * histogram_elems_per_wi)));
+
+    // counts are accumulated in USM-device temporary, which supports
+    // atomics regardless of the allocation type of the result
+    countT *tmp_counts = sycl_malloc_device<countT>(
+        n_bins, exec_q, "histogram_with_counts_impl");
+    if (tmp_counts == nullptr) {
+        throw std::runtime_error("Unable to allocate device memory");
+    }
+
+    sycl::event fill_ev = exec_q.fill<countT>(tmp_counts, countT(0), n_bins);
+
+    sycl::event hist_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+        cgh.depends_on(fill_ev);
+
+        const size_t slm_n = (privatized) ? n_bins : 1;
+        sycl::local_accessor<std::uint32_t, 1> slm_hist(slm_n, cgh);
+
+        const sycl::nd_range<1> ndRange(n_groups * lws, lws);
+        if (privatized) {
+            using KernelName = class histogram_krn<T, edgeT, countT, true>;
+            cgh.parallel_for<KernelName>(
+                ndRange, HistogramFunctor<T, edgeT, countT, true>(
+                             src, n, stride, edges, n_bins, uniform,
+                             tmp_counts, slm_hist));
+        }
+        else {
+            using KernelName = class histogram_krn<T, edgeT, countT, false>;
+            cgh.parallel_for<KernelName>(
+                ndRange, HistogramFunctor<T, edgeT, countT, false>(
+                             src, n, stride, edges, n_bins, uniform,
+                             tmp_counts, slm_hist));
+        }
+    });
+
+    sycl::event copy_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(hist_ev);
+
+        using KernelName = class histogram_copy_counts_krn<countT>;
+        cgh.parallel_for<KernelName>(sycl::range<1>(n_bins),
+                                     [=](sycl::id<1> id) {
+                                         res[id[0]] = static_cast<std::int64_t>(
+                                             tmp_counts[id[0]]);
+                                     });
+    });
+
+    return exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(copy_ev);
+        sycl::context ctx = exec_q.get_context();
+
+        cgh.host_task(
+            [ctx, tmp_counts] { sycl_free_noexcept(tmp_counts, ctx); });
+    });
+}
+
+/*!
+ * @brief Counts elements of one-dimensional strided array into `n_bins`
+ * bins with sorted edges. Values outside of the range of edges and NaNs
+ * are not counted.
+ *
+ * @param exec_q  Execution queue
+ * @param n       Number of elements of the source array
+ * @param src_cp  Pointer to the first element of the source array
+ * @param stride  Stride of the source array, in elements
+ * @param edges_cp Pointer to C-contiguous array of `n_bins + 1` edges
+ * @param n_bins  Number of bins
+ * @param uniform Whether edges are equally spaced
+ * @param res_cp  Pointer to C-contiguous array of `n_bins` counts of type
+ * `std::int64_t`
+ * @param depends List of events to wait for before starting computations
+ * @return Event to wait for to ensure that computations are complete
+ */
+template <typename T, typename edgeT>
+sycl::event histogram_impl(sycl::queue exec_q,
+                           size_t n,
+                           const char *src_cp,
+                           py::ssize_t stride,
+                           const char *edges_cp,
+                           size_t n_bins,
+                           bool uniform,
+                           char *res_cp,
+                           const std::vector<sycl::event> &depends)
+{
+    const T *src = reinterpret_cast<const T *>(src_cp);
+    const edgeT *edges = reinterpret_cast<const edgeT *>(edges_cp);
+    std::int64_t *res = reinterpret_cast<std::int64_t *>(res_cp);
+
+    if (exec_q.get_device().has(sycl::aspect::atomic64)) {
+        return histogram_with_counts_impl<T, edgeT, std::uint64_t>(
+            exec_q, n, src, stride, edges, n_bins, uniform, res, depends);
+    }
+    else {
+        return histogram_with_counts_impl<T, edgeT, std::uint32_t>(
+            exec_q, n, src, stride, edges, n_bins, uniform, res, depends);
+    }
+}
+
+/*! @brief Whether data types are supported by histogram kernels: real-valued
+ * input, and single or double precision edges */
+template <typename T, typename edgeT> struct HistogramTypePairSupported
+{
+    static constexpr bool is_defined =
+        !std::is_same_v<T, std::complex<float>> &&
+        !std::is_same_v<T, std::complex<double>> &&
+        (std::is_same_v<edgeT, float> || std::is_same_v<edgeT, double>);
+};
+
+template <typename fnT, typename T, typename edgeT> struct HistogramFactory
+{
+    fnT get()
+    {
+        if constexpr (HistogramTypePairSupported<T, edgeT>::is_defined) {
+            fnT fn = histogram_impl<T, edgeT>;
+            return fn;
+        }
+        else {
+            fnT fn = nullptr;
+            return fn;
+        }
+    }
+};
+
+/* ================================ Digitize ================================ */
+
+template <typename T, typename edgeT> class digitize_krn;
+
+typedef sycl::event (*digitize_fn_ptr_t)(sycl::queue,
+                                         size_t,
+                                         const char *,
+                                         py::ssize_t,
+                                         const char *,
+                                         size_t,
+                                         bool,
+                                         char *,
+                                         const std::vector<sycl::event> &);
+
+/*!
+ * @brief Writes for each element of one-dimensional strided array the
+ * number of sorted `edges` not exceeding it, or less than it if `right`,
+ * into C-contiguous array of type `std::int64_t`. NaNs are placed after
+ * all edges, as in `numpy.digitize`.
+ */
+template <typename T, typename edgeT>
+sycl::event digitize_impl(sycl::queue exec_q,
+                          size_t n,
+                          const char *src_cp,
+                          py::ssize_t stride,
+                          const char *edges_cp,
+                          size_t n_edges,
+                          bool right,
+                          char *res_cp,
+                          const std::vector<sycl::event> &depends)
+{
+    const T *src = reinterpret_cast<const T *>(src_cp);
+    const edgeT *edges = reinterpret_cast<const edgeT *>(edges_cp);
+    std::int64_t *res = reinterpret_cast<std::int64_t *>(res_cp);
+
+    return exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        using KernelName = class digitize_krn<T, edgeT>;
+        cgh.parallel_for<KernelName>(sycl::range<1>(n), [=](sycl::id<1> id) {
+            const size_t i = id[0];
+            const edgeT v = to_edge_type<T, edgeT>(
+                src[static_cast<py::ssize_t>(i) * stride]);
+            res[i] = static_cast<std::int64_t>(
+                (sycl::isnan(v)) ? n_edges
+                                 : count_edges_below(edges, n_edges, v, right));
+        });
+    });
+}
+
+template <typename fnT, typename T, typename edgeT> struct DigitizeFactory
+{
+    fnT get()
+    {
+        if constexpr (HistogramTypePairSupported<T, edgeT>::is_defined) {
+            fnT fn = digitize_impl<T, edgeT>;
+            return fn;
+        }
+        else {
+            fnT fn = nullptr;
+            return fn;
+        }
+    }
+};
+
+/* ============================= Range of values ============================ */
+
+/*! @brief Each work-group finds the smallest and the largest of elements
+ * of a strided array within `[lo, hi]`, visiting elements in grid-stride
+ * loop, and writes them into a temporary of partial results. */
+template <typename T, typename edgeT> class MinMaxPartialFunctor
+{
+private:
+    const T *src_ = nullptr;
+    size_t n_ = 0;
+    py::ssize_t stride_ = 1;
+    edgeT lo_;
+    edgeT hi_;
+    edgeT *partials_ = nullptr;
+
+public:
+    MinMaxPartialFunctor(const T *src,
+                         size_t n,
+                         py::ssize_t stride,
+                         edgeT lo,
+                         edgeT hi,
+                         edgeT *partials)
+        : src_(src), n_(n), stride_(stride), lo_(lo), hi_(hi),
+          partials_(partials)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        constexpr edgeT inf = std::numeric_limits<edgeT>::infinity();
+        edgeT local_min = inf;
+        edgeT local_max = -inf;
+
+        const size_t gws = it.get_global_range(0);
+        for (size_t i = it.get_global_id(0); i < n_; i += gws) {
+            const edgeT v = to_edge_type<T, edgeT>(
+                src_[static_cast<py::ssize_t>(i) * stride_]);
+            if (v >= lo_ && v <= hi_) {
+                local_min = std::min(local_min, v);
+                local_max = std::max(local_max, v);
+            }
+        }
+
+        auto wg = it.get_group();
+        const edgeT wg_min =
+            sycl::reduce_over_group(wg, local_min, sycl::minimum<edgeT>());
+        const edgeT wg_max =
+            sycl::reduce_over_group(wg, local_max, sycl::maximum<edgeT>());
+        if (wg.leader()) {
+            const size_t group_id = it.get_group(0);
+            partials_[2 * group_id] = wg_min;
+            partials_[2 * group_id + 1] = wg_max;
+        }
+    }
+};
+
+template <typename T, typename edgeT> class minmax_partial_krn;
+template <typename edgeT> class minmax_final_krn;
+
+typedef sycl::event (*minmax_fn_ptr_t)(sycl::queue,
+                                       size_t,
+                                       const char *,
+                                       py::ssize_t,
+                                       double,
+                                       double,
+                                       char *,
+                                       const std::vector<sycl::event> &);
+
+/*!
+ * @brief Writes the smallest and the largest of elements of one-dimensional
+ * strided array within `[lo, hi]` into C-contiguous array of two elements.
+ * NaNs are ignored. If no element is within the range, infinity and
+ * negative infinity are written.
+ */
+template <typename T, typename edgeT>
+sycl::event minmax_impl(sycl::queue exec_q,
+                        size_t n,
+                        const char *src_cp,
+                        py::ssize_t stride,
+                        double lo,
+                        double hi,
+                        char *res_cp,
+                        const std::vector<sycl::event> &depends)
+{
+    const T *src = reinterpret_cast<const T *>(src_cp);
+    edgeT *res = reinterpret_cast<edgeT *>(res_cp);
+
+    const sycl::device &d = exec_q.get_device();
+    const auto &dev_info =
+        dpctl::tensor::sycl_utils::detail::get_launch_device_info(d);
+    const size_t max_wg = d.get_info<sycl::info::device::max_work_group_size>();
+    const size_t lws = std::min<size_t>(max_wg, 256);
+    const size_t n_groups = std::max<size_t>(
+        1, std::min(8 * dev_info.n_compute_units,
+                    (n + lws * histogram_elems_per_wi - 1) /
+                        (lws * histogram_elems_per_wi)));
+
+    edgeT *partials =
+        sycl_malloc_device<edgeT>(2 * n_groups, exec_q, "minmax_impl");
+    if (partials == nullptr) {
+        throw std::runtime_error("Unable to allocate device memory");
+    }
+
+    const edgeT lo_ = static_cast<edgeT>(lo);
+    const edgeT hi_ = static_cast<edgeT>(hi);
+    sycl::event partial_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        using KernelName = class minmax_partial_krn<T, edgeT>;
+        cgh.parallel_for<KernelName>(
+            sycl::nd_range<1>(n_groups * lws, lws),
+            MinMaxPartialFunctor<T, edgeT>(src, n, stride, lo_, hi_,
+                                           partials));
+    });
+
+    sycl::event final_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(partial_ev);
+
+        using KernelName = class minmax_final_krn<edgeT>;
+        cgh.parallel_for<KernelName>(
+            sycl::nd_range<1>(lws, lws), [=](sycl::nd_item<1> it) {
+                constexpr edgeT inf = std::numeric_limits<edgeT>::infinity();
+                edgeT local_min = inf;
+                edgeT local_max = -inf;
+                for (size_t g = it.get_local_id(0); g < n_groups; g += lws) {
+                    local_min = std::min(local_min, partials[2 * g]);
+                    local_max = std::max(local_max, partials[2 * g + 1]);
+                }
+                auto wg = it.get_group();
+                const edgeT wg_min = sycl::reduce_over_group(
+                    wg, local_min, sycl::minimum<edgeT>());
+                const edgeT wg_max = sycl::reduce_over_group(
+                    wg, local_max, sycl::maximum<edgeT>());
+                if (wg.leader()) {
+                    res[0] = wg_min;
+                    res[1] = wg_max;
+                }
+            });
+    });
+
+    return exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(final_ev);
+        sycl::context ctx = exec_q.get_context();
+
+        cgh.host_task([ctx, partials] { sycl_free_noexcept(partials, ctx); });
+    });
+}
+
+template <typename fnT, typename T, typename edgeT> struct MinMaxFactory
+{
+    fnT get()
+    {
+        if constexpr (HistogramTypePairSupported<T, edgeT>::is_defined) {
+            fnT fn = minmax_impl<T, edgeT>;
+            return fn;
+        }
+        else {
+            fnT fn = nullptr;
+            return fn;
+        }
+    }
+};
+
+} // namespace histogram
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
@@ -87,6 +87,39 @@ public:
     }
 };
 
+/*! @brief Offset of element of n-th index array, which varies along at most
+ * one axis of the common shape of indices, as in x[i[:, None], j].
+ *
+ * Packed data hold, for each index array, the product of extents of axes
+ * following its varying axis, the extent of that axis and the stride of the
+ * index array along it, so the offset is found without unraveling the
+ * multi-index over all axes.
+ */
+struct OuterIndexStrideOffset
+{
+    OuterIndexStrideOffset(int k,
+                           py::ssize_t const *_offsets,
+                           py::ssize_t const *_packed_divisors_extents_strides)
+        : k_(k), offsets(_offsets),
+          divisors_extents_strides(_packed_divisors_extents_strides)
+    {
+    }
+
+    size_t operator()(py::ssize_t gid, int n) const
+    {
+        const py::ssize_t i =
+            (gid / divisors_extents_strides[n]) %
+            divisors_extents_strides[k_ + n];
+
+        return i * divisors_extents_strides[2 * k_ + n] + offsets[n];
+    }
+
+private:
+    int k_;
+    py::ssize_t const *offsets;
+    py::ssize_t const *divisors_extents_strides;
+};
+
 template <typename ProjectorT,
           typename OrthogStrider,
           typename IndicesStrider,
@@ -170,6 +203,7 @@ typedef sycl::event (*take_fn_ptr_t)(sycl::queue,
                                      py::ssize_t,
                                      py::ssize_t,
                                      const py::ssize_t *,
+                                     bool,
                                      const std::vector<sycl::event> &);
 
 template <typename ProjectorT, typename Ty, typename indT>
@@ -188,6 +222,7 @@ sycl::event take_impl(sycl::queue q,
                       py::ssize_t src_offset,
                       py::ssize_t dst_offset,
                       const py::ssize_t *ind_offsets,
+                      bool outer_ind,
                       const std::vector<sycl::event> &depends)
 {
     dpctl::tensor::type_utils::validate_type_for_device<Ty>(q);
@@ -197,21 +232,39 @@ sycl::event take_impl(sycl::queue q,
 
         TwoOffsets_StridedIndexer orthog_indexer{nd, src_offset, dst_offset,
                                                  orthog_shape_and_strides};
-        NthStrideOffset indices_indexer{ind_nd, ind_offsets,
-                                        ind_shape_and_strides};
         StridedIndexer axes_indexer{ind_nd, 0,
                                     axes_shape_and_strides + (2 * k)};
 
         const size_t gws = orthog_nelems * ind_nelems;
 
-        cgh.parallel_for<
-            take_kernel<ProjectorT, TwoOffsets_StridedIndexer, NthStrideOffset,
-                        StridedIndexer, Ty, indT>>(
-            sycl::range<1>(gws),
-            TakeFunctor<ProjectorT, TwoOffsets_StridedIndexer, NthStrideOffset,
-                        StridedIndexer, Ty, indT>(
-                src_p, dst_p, ind_p, k, ind_nelems, axes_shape_and_strides,
-                orthog_indexer, indices_indexer, axes_indexer));
+        if (outer_ind) {
+            // ind_shape_and_strides holds divisors, extents and strides
+            OuterIndexStrideOffset indices_indexer{k, ind_offsets,
+                                                   ind_shape_and_strides};
+
+            using KernelName =
+                take_kernel<ProjectorT, TwoOffsets_StridedIndexer,
+                            OuterIndexStrideOffset, StridedIndexer, Ty, indT>;
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(gws),
+                TakeFunctor<ProjectorT, TwoOffsets_StridedIndexer,
+                            OuterIndexStrideOffset, StridedIndexer, Ty, indT>(
+                    src_p, dst_p, ind_p, k, ind_nelems, axes_shape_and_strides,
+                    orthog_indexer, indices_indexer, axes_indexer));
+        }
+        else {
+            NthStrideOffset indices_indexer{ind_nd, ind_offsets,
+                                            ind_shape_and_strides};
+
+            cgh.parallel_for<
+                take_kernel<ProjectorT, TwoOffsets_StridedIndexer,
+                            NthStrideOffset, StridedIndexer, Ty, indT>>(
+                sycl::range<1>(gws),
+                TakeFunctor<ProjectorT, TwoOffsets_StridedIndexer,
+                            NthStrideOffset, StridedIndexer, Ty, indT>(
+                    src_p, dst_p, ind_p, k, ind_nelems, axes_shape_and_strides,
+                    orthog_indexer, indices_indexer, axes_indexer));
+        }
     });
 
     return take_ev;
@@ -300,6 +353,7 @@ typedef sycl::event (*put_fn_ptr_t)(sycl::queue,
                                     py::ssize_t,
                                     py::ssize_t,
                                     const py::ssize_t *,
+                                    bool,
                                     const std::vector<sycl::event> &);
 
 template <typename ProjectorT, typename Ty, typename indT>
@@ -318,6 +372,7 @@ sycl::event put_impl(sycl::queue q,
                      py::ssize_t dst_offset,
                      py::ssize_t val_offset,
                      const py::ssize_t *ind_offsets,
+                     bool outer_ind,
                      const std::vector<sycl::event> &depends)
 {
     dpctl::tensor::type_utils::validate_type_for_device<Ty>(q);
@@ -327,20 +382,39 @@ sycl::event put_impl(sycl::queue q,
 
         TwoOffsets_StridedIndexer orthog_indexer{nd, dst_offset, val_offset,
                                                  orthog_shape_and_strides};
-        NthStrideOffset indices_indexer{ind_nd, ind_offsets,
-                                        ind_shape_and_strides};
         StridedIndexer axes_indexer{ind_nd, 0,
                                     axes_shape_and_strides + (2 * k)};
 
         const size_t gws = orthog_nelems * ind_nelems;
 
-        cgh.parallel_for<put_kernel<ProjectorT, TwoOffsets_StridedIndexer,
-                                    NthStrideOffset, StridedIndexer, Ty, indT>>(
-            sycl::range<1>(gws),
-            PutFunctor<ProjectorT, TwoOffsets_StridedIndexer, NthStrideOffset,
-                       StridedIndexer, Ty, indT>(
-                dst_p, val_p, ind_p, k, ind_nelems, axes_shape_and_strides,
-                orthog_indexer, indices_indexer, axes_indexer));
+        if (outer_ind) {
+            // ind_shape_and_strides holds divisors, extents and strides
+            OuterIndexStrideOffset indices_indexer{k, ind_offsets,
+                                                   ind_shape_and_strides};
+
+            using KernelName =
+                put_kernel<ProjectorT, TwoOffsets_StridedIndexer,
+                           OuterIndexStrideOffset, StridedIndexer, Ty, indT>;
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(gws),
+                PutFunctor<ProjectorT, TwoOffsets_StridedIndexer,
+                           OuterIndexStrideOffset, StridedIndexer, Ty, indT>(
+                    dst_p, val_p, ind_p, k, ind_nelems, axes_shape_and_strides,
+                    orthog_indexer, indices_indexer, axes_indexer));
+        }
+        else {
+            NthStrideOffset indices_indexer{ind_nd, ind_offsets,
+                                            ind_shape_and_strides};
+
+            cgh.parallel_for<
+                put_kernel<ProjectorT, TwoOffsets_StridedIndexer,
+                           NthStrideOffset, StridedIndexer, Ty, indT>>(
+                sycl::range<1>(gws),
+                PutFunctor<ProjectorT, TwoOffsets_StridedIndexer,
+                           NthStrideOffset, StridedIndexer, Ty, indT>(
+                    dst_p, val_p, ind_p, k, ind_nelems, axes_shape_and_strides,
+                    orthog_indexer, indices_indexer, axes_indexer));
+        }
     });
 
     return put_ev;
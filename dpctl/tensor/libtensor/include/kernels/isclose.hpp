@@ -0,0 +1,525 @@
+//=== isclose.hpp - Implementation of isclose and allclose -------*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels for dpctl.tensor.isclose and
+/// dpctl.tensor.allclose.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <pybind11/pybind11.h>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "utils/offset_utils.hpp"
+#include "utils/sycl_alloc_utils.hpp"
+#include "utils/type_dispatch.hpp"
+#include "utils/type_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace isclose
+{
+
+namespace py = pybind11;
+namespace td_ns = dpctl::tensor::type_dispatch;
+namespace tu_ns = dpctl::tensor::type_utils;
+
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+using dpctl::tensor::alloc_utils::sycl_malloc_device;
+
+/*! @brief Floating point type used to compare elements of type `T` */
+template <typename T>
+using closeness_fp_t =
+    std::conditional_t<std::is_same_v<T, double> ||
+                           std::is_same_v<T, std::complex<double>>,
+                       double,
+                       float>;
+
+/*! @brief Predicate testing closeness of two elements.
+ *
+ * Real floating point values are close if both are NaN and `equal_nan` is
+ * set, if both are infinities of the same sign, or if both are finite and
+ * `abs(a - b) <= max(atol, rtol * max(abs(a), abs(b)))`. Complex values are
+ * close if their real and imaginary parts are. Values of integral types
+ * are close if they satisfy the same inequality, with the difference
+ * computed exactly. Boolean values are close if they are equal.
+ */
+template <typename T> struct IsClosePredicate
+{
+    using fpT = closeness_fp_t<T>;
+
+    IsClosePredicate(double atol, double rtol, bool equal_nan)
+        : atol_(static_cast<fpT>(atol)), rtol_(static_cast<fpT>(rtol)),
+          equal_nan_(equal_nan)
+    {
+    }
+
+    bool operator()(const T &a, const T &b) const
+    {
+        if constexpr (tu_ns::is_complex<T>::value) {
+            return is_close_fp(std::real(a), std::real(b)) &&
+                   is_close_fp(std::imag(a), std::imag(b));
+        }
+        else if constexpr (std::is_floating_point_v<T> ||
+                           std::is_same_v<T, sycl::half>)
+        {
+            return is_close_fp(static_cast<fpT>(a), static_cast<fpT>(b));
+        }
+        else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+        {
+            return is_close_int(a, b);
+        }
+        else {
+            return a == b;
+        }
+    }
+
+private:
+    fpT atol_;
+    fpT rtol_;
+    bool equal_nan_;
+
+    bool is_close_fp(const fpT &a, const fpT &b) const
+    {
+        const bool a_nan = sycl::isnan(a);
+        const bool b_nan = sycl::isnan(b);
+        if (a_nan || b_nan) {
+            return equal_nan_ && a_nan && b_nan;
+        }
+        if (sycl::isinf(a) || sycl::isinf(b)) {
+            return a == b;
+        }
+        const fpT abs_max = sycl::max(sycl::fabs(a), sycl::fabs(b));
+        return sycl::fabs(a - b) <= sycl::max(atol_, rtol_ * abs_max);
+    }
+
+    bool is_close_int(const T &a, const T &b) const
+    {
+        using uT = std::make_unsigned_t<T>;
+        // difference of values of type `T` fits into unsigned type of the
+        // same size
+        const uT diff = (a < b) ? static_cast<uT>(static_cast<uT>(b) -
+                                                  static_cast<uT>(a))
+                                : static_cast<uT>(static_cast<uT>(a) -
+                                                  static_cast<uT>(b));
+        if (diff == 0) {
+            return true;
+        }
+        const fpT abs_max = sycl::max(sycl::fabs(static_cast<fpT>(a)),
+                                      sycl::fabs(static_cast<fpT>(b)));
+        return static_cast<fpT>(diff) <= sycl::max(atol_, rtol_ * abs_max);
+    }
+};
+
+template <typename T> class IsCloseContigFunctor
+{
+private:
+    const T *a_p = nullptr;
+    const T *b_p = nullptr;
+    bool *dst_p = nullptr;
+    IsClosePredicate<T> pred_;
+
+public:
+    IsCloseContigFunctor(const T *a_p_,
+                         const T *b_p_,
+                         bool *dst_p_,
+                         const IsClosePredicate<T> &pred)
+        : a_p(a_p_), b_p(b_p_), dst_p(dst_p_), pred_(pred)
+    {
+    }
+
+    void operator()(sycl::id<1> id) const
+    {
+        const size_t i = id[0];
+        dst_p[i] = pred_(a_p[i], b_p[i]);
+    }
+};
+
+template <typename T, typename IndexerT> class IsCloseStridedFunctor
+{
+private:
+    const T *a_p = nullptr;
+    const T *b_p = nullptr;
+    bool *dst_p = nullptr;
+    IndexerT indexer_;
+    IsClosePredicate<T> pred_;
+
+public:
+    IsCloseStridedFunctor(const T *a_p_,
+                          const T *b_p_,
+                          bool *dst_p_,
+                          IndexerT indexer,
+                          const IsClosePredicate<T> &pred)
+        : a_p(a_p_), b_p(b_p_), dst_p(dst_p_), indexer_(indexer), pred_(pred)
+    {
+    }
+
+    void operator()(sycl::id<1> id) const
+    {
+        const auto &offsets = indexer_(static_cast<py::ssize_t>(id[0]));
+        dst_p[offsets.get_third_offset()] = pred_(
+            a_p[offsets.get_first_offset()], b_p[offsets.get_second_offset()]);
+    }
+};
+
+/*! @brief Functor testing closeness of all pairs of elements.
+ *
+ * Each work-item tests `elems_per_wi` pairs, strided by the size of the
+ * work-group. Work-groups which found a pair of elements which are not
+ * close clear the flag, which must be set to 1 before the launch.
+ */
+template <typename T, typename IndexerT> class AllCloseFunctor
+{
+private:
+    const T *a_p = nullptr;
+    const T *b_p = nullptr;
+    std::int32_t *flag_p = nullptr;
+    size_t nelems_;
+    size_t elems_per_wi_;
+    IndexerT indexer_;
+    IsClosePredicate<T> pred_;
+
+public:
+    AllCloseFunctor(const T *a_p_,
+                    const T *b_p_,
+                    std::int32_t *flag_p_,
+                    size_t nelems,
+                    size_t elems_per_wi,
+                    IndexerT indexer,
+                    const IsClosePredicate<T> &pred)
+        : a_p(a_p_), b_p(b_p_), flag_p(flag_p_), nelems_(nelems),
+          elems_per_wi_(elems_per_wi), indexer_(indexer), pred_(pred)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> ndit) const
+    {
+        const size_t lws = ndit.get_local_range(0);
+        const size_t start =
+            ndit.get_group(0) * lws * elems_per_wi_ + ndit.get_local_id(0);
+        const size_t end = std::min(nelems_, start + lws * elems_per_wi_);
+
+        bool all_close = true;
+        for (size_t i = start; i < end; i += lws) {
+            const auto &offsets = indexer_(static_cast<py::ssize_t>(i));
+            all_close = all_close && pred_(a_p[offsets.get_first_offset()],
+                                           b_p[offsets.get_second_offset()]);
+        }
+
+        auto wg = ndit.get_group();
+        const bool wg_all_close = sycl::all_of_group(wg, all_close);
+        if (wg.leader() && !wg_all_close) {
+            sycl::atomic_ref<std::int32_t, sycl::memory_order::relaxed,
+                             sycl::memory_scope::device,
+                             sycl::access::address_space::global_space>
+                flag_ref(*flag_p);
+            flag_ref.store(0);
+        }
+    }
+};
+
+typedef sycl::event (*isclose_contig_impl_fn_ptr_t)(
+    sycl::queue,
+    size_t,
+    const char *,
+    const char *,
+    char *,
+    double,
+    double,
+    bool,
+    const std::vector<sycl::event> &);
+
+template <typename T> class isclose_contig_kernel;
+
+template <typename T>
+sycl::event isclose_contig_impl(sycl::queue exec_q,
+                                size_t nelems,
+                                const char *a_cp,
+                                const char *b_cp,
+                                char *dst_cp,
+                                double atol,
+                                double rtol,
+                                bool equal_nan,
+                                const std::vector<sycl::event> &depends)
+{
+    const T *a_tp = reinterpret_cast<const T *>(a_cp);
+    const T *b_tp = reinterpret_cast<const T *>(b_cp);
+    bool *dst_tp = reinterpret_cast<bool *>(dst_cp);
+
+    sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        const IsClosePredicate<T> pred(atol, rtol, equal_nan);
+        cgh.parallel_for<isclose_contig_kernel<T>>(
+            sycl::range<1>(nelems),
+            IsCloseContigFunctor<T>(a_tp, b_tp, dst_tp, pred));
+    });
+    return comp_ev;
+}
+
+template <typename fnT, typename T> struct IsCloseContigFactory
+{
+    fnT get()
+    {
+        fnT fn = isclose_contig_impl<T>;
+        return fn;
+    }
+};
+
+typedef sycl::event (*isclose_strided_impl_fn_ptr_t)(
+    sycl::queue,
+    size_t,
+    int,
+    const py::ssize_t *,
+    const char *,
+    py::ssize_t,
+    const char *,
+    py::ssize_t,
+    char *,
+    py::ssize_t,
+    double,
+    double,
+    bool,
+    const std::vector<sycl::event> &);
+
+template <typename T, typename IndexerT> class isclose_strided_kernel;
+
+template <typename T>
+sycl::event isclose_strided_impl(sycl::queue exec_q,
+                                 size_t nelems,
+                                 int nd,
+                                 const py::ssize_t *shape_and_strides,
+                                 const char *a_cp,
+                                 py::ssize_t a_offset,
+                                 const char *b_cp,
+                                 py::ssize_t b_offset,
+                                 char *dst_cp,
+                                 py::ssize_t dst_offset,
+                                 double atol,
+                                 double rtol,
+                                 bool equal_nan,
+                                 const std::vector<sycl::event> &depends)
+{
+    const T *a_tp = reinterpret_cast<const T *>(a_cp);
+    const T *b_tp = reinterpret_cast<const T *>(b_cp);
+    bool *dst_tp = reinterpret_cast<bool *>(dst_cp);
+
+    sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        using IndexerT =
+            dpctl::tensor::offset_utils::ThreeOffsets_StridedIndexer;
+        const IndexerT indexer{nd, a_offset, b_offset, dst_offset,
+                               shape_and_strides};
+
+        cgh.parallel_for<isclose_strided_kernel<T, IndexerT>>(
+            sycl::range<1>(nelems),
+            IsCloseStridedFunctor<T, IndexerT>(
+                a_tp, b_tp, dst_tp, indexer,
+                IsClosePredicate<T>(atol, rtol, equal_nan)));
+    });
+    return comp_ev;
+}
+
+template <typename fnT, typename T> struct IsCloseStridedFactory
+{
+    fnT get()
+    {
+        fnT fn = isclose_strided_impl<T>;
+        return fn;
+    }
+};
+
+template <typename T, typename IndexerT> class allclose_kernel;
+
+/*! @brief Tests closeness of all `nelems` pairs of elements, whose offsets
+ * are given by `indexer`, and writes the result into boolean `dst_p`.
+ *
+ * The test is performed by a single kernel, which clears a temporary
+ * flag. Event of the host task freeing the flag is appended to
+ * `host_tasks`. Expects `nelems` to be positive.
+ */
+template <typename T, typename IndexerT>
+sycl::event allclose_impl(sycl::queue exec_q,
+                          std::vector<sycl::event> &host_tasks,
+                          size_t nelems,
+                          const T *a_tp,
+                          const T *b_tp,
+                          bool *dst_p,
+                          const IndexerT &indexer,
+                          double atol,
+                          double rtol,
+                          bool equal_nan,
+                          const std::vector<sycl::event> &depends)
+{
+    std::int32_t *flag_p =
+        sycl_malloc_device<std::int32_t>(1, exec_q, "allclose");
+    if (flag_p == nullptr) {
+        throw std::runtime_error("Unable to allocate device memory");
+    }
+
+    sycl::event fill_ev = exec_q.fill<std::int32_t>(flag_p, 1, 1);
+
+    const sycl::device &d = exec_q.get_device();
+    const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
+    const size_t lws =
+        4 * (*std::max_element(std::begin(sg_sizes), std::end(sg_sizes)));
+    constexpr size_t preferred_elems_per_wi = 8;
+    const size_t elems_per_wi =
+        (nelems < preferred_elems_per_wi * lws) ? ((nelems + lws - 1) / lws)
+                                                : preferred_elems_per_wi;
+    const size_t n_groups =
+        (nelems + elems_per_wi * lws - 1) / (elems_per_wi * lws);
+
+    sycl::event red_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+        cgh.depends_on(fill_ev);
+
+        cgh.parallel_for<allclose_kernel<T, IndexerT>>(
+            sycl::nd_range<1>(sycl::range<1>(n_groups * lws),
+                              sycl::range<1>(lws)),
+            AllCloseFunctor<T, IndexerT>(
+                a_tp, b_tp, flag_p, nelems, elems_per_wi, indexer,
+                IsClosePredicate<T>(atol, rtol, equal_nan)));
+    });
+
+    sycl::event res_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(red_ev);
+        cgh.single_task([=]() { *dst_p = (*flag_p != 0); });
+    });
+
+    sycl::event cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(res_ev);
+        const auto &ctx = exec_q.get_context();
+        cgh.host_task([ctx, flag_p]() { sycl_free_noexcept(flag_p, ctx); });
+    });
+    host_tasks.push_back(cleanup_ev);
+
+    return res_ev;
+}
+
+typedef sycl::event (*allclose_contig_impl_fn_ptr_t)(
+    sycl::queue,
+    std::vector<sycl::event> &,
+    size_t,
+    const char *,
+    const char *,
+    char *,
+    double,
+    double,
+    bool,
+    const std::vector<sycl::event> &);
+
+template <typename T>
+sycl::event allclose_contig_impl(sycl::queue exec_q,
+                                 std::vector<sycl::event> &host_tasks,
+                                 size_t nelems,
+                                 const char *a_cp,
+                                 const char *b_cp,
+                                 char *dst_cp,
+                                 double atol,
+                                 double rtol,
+                                 bool equal_nan,
+                                 const std::vector<sycl::event> &depends)
+{
+    using dpctl::tensor::offset_utils::NoOpIndexer;
+    using IndexerT = dpctl::tensor::offset_utils::TwoOffsets_CombinedIndexer<
+        NoOpIndexer, NoOpIndexer>;
+    const IndexerT indexer{NoOpIndexer{}, NoOpIndexer{}};
+
+    return allclose_impl<T, IndexerT>(
+        exec_q, host_tasks, nelems, reinterpret_cast<const T *>(a_cp),
+        reinterpret_cast<const T *>(b_cp), reinterpret_cast<bool *>(dst_cp),
+        indexer, atol, rtol, equal_nan, depends);
+}
+
+template <typename fnT, typename T> struct AllCloseContigFactory
+{
+    fnT get()
+    {
+        fnT fn = allclose_contig_impl<T>;
+        return fn;
+    }
+};
+
+typedef sycl::event (*allclose_strided_impl_fn_ptr_t)(
+    sycl::queue,
+    std::vector<sycl::event> &,
+    size_t,
+    int,
+    const py::ssize_t *,
+    const char *,
+    py::ssize_t,
+    const char *,
+    py::ssize_t,
+    char *,
+    double,
+    double,
+    bool,
+    const std::vector<sycl::event> &);
+
+template <typename T>
+sycl::event allclose_strided_impl(sycl::queue exec_q,
+                                  std::vector<sycl::event> &host_tasks,
+                                  size_t nelems,
+                                  int nd,
+                                  const py::ssize_t *shape_and_strides,
+                                  const char *a_cp,
+                                  py::ssize_t a_offset,
+                                  const char *b_cp,
+                                  py::ssize_t b_offset,
+                                  char *dst_cp,
+                                  double atol,
+                                  double rtol,
+                                  bool equal_nan,
+                                  const std::vector<sycl::event> &depends)
+{
+    using IndexerT = dpctl::tensor::offset_utils::TwoOffsets_StridedIndexer;
+    const IndexerT indexer{nd, a_offset, b_offset, shape_and_strides};
+
+    return allclose_impl<T, IndexerT>(
+        exec_q, host_tasks, nelems, reinterpret_cast<const T *>(a_cp),
+        reinterpret_cast<const T *>(b_cp), reinterpret_cast<bool *>(dst_cp),
+        indexer, atol, rtol, equal_nan, depends);
+}
+
+template <typename fnT, typename T> struct AllCloseStridedFactory
+{
+    fnT get()
+    {
+        fnT fn = allclose_strided_impl<T>;
+        return fn;
+    }
+};
+
+} // namespace isclose
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
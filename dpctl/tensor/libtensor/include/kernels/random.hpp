@@ -0,0 +1,563 @@
+//=== random.hpp - Counter-based random number generation  ---*-C++-*--/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels filling contiguous arrays with random numbers
+/// generated by counter-based Philox4x32-10 and Threefry4x32-20 engines.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "utils/type_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace random
+{
+
+/*! @brief Identifiers of random number engines */
+enum class rng_engine : int
+{
+    philox4x32x10 = 0,
+    threefry4x32x20 = 1
+};
+
+using rng_block_t = std::array<std::uint32_t, 4>;
+
+/*! @brief Counter of the block `block_id` of the stream `stream_id`.
+ *
+ * Blocks of a stream are numbered by the low 64 bits of the counter, and
+ * streams by its high 64 bits, so streams never overlap. */
+inline rng_block_t make_rng_counter(std::uint64_t block_id,
+                                    std::uint64_t stream_id)
+{
+    return {static_cast<std::uint32_t>(block_id),
+            static_cast<std::uint32_t>(block_id >> 32),
+            static_cast<std::uint32_t>(stream_id),
+            static_cast<std::uint32_t>(stream_id >> 32)};
+}
+
+/*! @brief Philox4x32-10 bijection of Salmon et al., "Parallel random
+ * numbers: as easy as 1, 2, 3", keyed by 64-bit seed. */
+struct Philox4x32x10
+{
+    static rng_block_t generate(rng_block_t ctr, std::uint64_t seed)
+    {
+        constexpr std::uint64_t M0 = 0xD2511F53;
+        constexpr std::uint64_t M1 = 0xCD9E8D57;
+        constexpr std::uint32_t W0 = 0x9E3779B9;
+        constexpr std::uint32_t W1 = 0xBB67AE85;
+
+        std::uint32_t k0 = static_cast<std::uint32_t>(seed);
+        std::uint32_t k1 = static_cast<std::uint32_t>(seed >> 32);
+
+#pragma unroll
+        for (int r = 0; r < 10; ++r) {
+            const std::uint64_t p0 = M0 * ctr[0];
+            const std::uint64_t p1 = M1 * ctr[2];
+            ctr = {static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ k0,
+                   static_cast<std::uint32_t>(p1),
+                   static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ k1,
+                   static_cast<std::uint32_t>(p0)};
+            k0 += W0;
+            k1 += W1;
+        }
+        return ctr;
+    }
+};
+
+/*! @brief Threefry4x32-20 bijection of Salmon et al., "Parallel random
+ * numbers: as easy as 1, 2, 3", keyed by 64-bit seed in the low words of
+ * its 128-bit key. */
+struct Threefry4x32x20
+{
+    static std::uint32_t rotl(std::uint32_t x, unsigned int n)
+    {
+        return (x << n) | (x >> (32 - n));
+    }
+
+    static rng_block_t generate(rng_block_t x, std::uint64_t seed)
+    {
+        constexpr unsigned int rot[8][2] = {{10, 26}, {11, 21}, {13, 27},
+                                            {23, 5},  {6, 20},  {17, 11},
+                                            {25, 10}, {18, 20}};
+        constexpr std::uint32_t parity = 0x1BD11BDA;
+
+        const std::uint32_t k0 = static_cast<std::uint32_t>(seed);
+        const std::uint32_t k1 = static_cast<std::uint32_t>(seed >> 32);
+        const std::uint32_t ks[5] = {k0, k1, 0, 0, parity ^ k0 ^ k1};
+
+#pragma unroll
+        for (int i = 0; i < 4; ++i) {
+            x[i] += ks[i];
+        }
+
+#pragma unroll
+        for (int r = 0; r < 20; ++r) {
+            if (r % 2 == 0) {
+                x[0] += x[1];
+                x[1] = rotl(x[1], rot[r % 8][0]) ^ x[0];
+                x[2] += x[3];
+                x[3] = rotl(x[3], rot[r % 8][1]) ^ x[2];
+            }
+            else {
+                x[0] += x[3];
+                x[3] = rotl(x[3], rot[r % 8][0]) ^ x[0];
+                x[2] += x[1];
+                x[1] = rotl(x[1], rot[r % 8][1]) ^ x[2];
+            }
+            if (r % 4 == 3) {
+                // key injection after every four rounds
+                const unsigned int s = (r + 1) / 4;
+#pragma unroll
+                for (int i = 0; i < 4; ++i) {
+                    x[i] += ks[(s + i) % 5];
+                }
+                x[3] += s;
+            }
+        }
+        return x;
+    }
+};
+
+/*! @brief Combines two 32-bit words into a 64-bit word */
+inline std::uint64_t rng_join(std::uint32_t hi, std::uint32_t lo)
+{
+    return (static_cast<std::uint64_t>(hi) << 32) | lo;
+}
+
+/*! @brief Computational type of real distributions: `float` for
+ * `sycl::half` and `float`, and `double` for `double` */
+template <typename T>
+using rng_real_t =
+    std::conditional_t<std::is_same_v<T, double>, double, float>;
+
+/*! @brief Uniform number in `[0, 1)` from the high 24 bits of a word */
+inline float rng_unit_float(std::uint32_t w)
+{
+    return static_cast<float>(w >> 8) * (1.0f / 16777216.0f);
+}
+
+/*! @brief Uniform number in `[0, 1)` from the high 53 bits of two words */
+inline double rng_unit_double(std::uint32_t hi, std::uint32_t lo)
+{
+    return static_cast<double>(rng_join(hi, lo) >> 11) *
+           (1.0 / 9007199254740992.0);
+}
+
+/*! @brief Raw 32-bit words of a block */
+template <typename T> struct RandomBitsTransform
+{
+    static constexpr int n_out = 4;
+
+    sycl::vec<T, n_out> operator()(const rng_block_t &b) const
+    {
+        return sycl::vec<T, n_out>(b[0], b[1], b[2], b[3]);
+    }
+};
+
+/*! @brief Numbers uniformly distributed in `[low, low + scale)`. A block
+ * gives 4 numbers with 24 random bits, or 2 numbers with 53 random bits
+ * for `double`. */
+template <typename T> struct UniformTransform
+{
+    using realT = rng_real_t<T>;
+    static constexpr int n_out = std::is_same_v<realT, double> ? 2 : 4;
+
+    realT low;
+    realT scale;
+
+    sycl::vec<T, n_out> operator()(const rng_block_t &b) const
+    {
+        sycl::vec<T, n_out> res;
+        if constexpr (n_out == 2) {
+            res[0] = low + scale * rng_unit_double(b[0], b[1]);
+            res[1] = low + scale * rng_unit_double(b[2], b[3]);
+        }
+        else {
+#pragma unroll
+            for (int i = 0; i < n_out; ++i) {
+                res[i] = static_cast<T>(low + scale * rng_unit_float(b[i]));
+            }
+        }
+        return res;
+    }
+};
+
+/*! @brief Normally distributed numbers with mean `loc` and standard
+ * deviation `scale`, by the Box-Muller transform of pairs of uniform
+ * numbers. A block gives 4 numbers, or 2 numbers for `double`. */
+template <typename T> struct NormalTransform
+{
+    using realT = rng_real_t<T>;
+    static constexpr int n_out = std::is_same_v<realT, double> ? 2 : 4;
+
+    realT loc;
+    realT scale;
+
+    sycl::vec<T, n_out> operator()(const rng_block_t &b) const
+    {
+        constexpr realT two_pi = realT(6.283185307179586476925286766559);
+
+        sycl::vec<T, n_out> res;
+#pragma unroll
+        for (int i = 0; i < n_out; i += 2) {
+            realT u1, u2;
+            if constexpr (n_out == 2) {
+                // in (0, 1], so that the logarithm is finite
+                u1 = realT(1) - rng_unit_double(b[0], b[1]);
+                u2 = rng_unit_double(b[2], b[3]);
+            }
+            else {
+                u1 = realT(1) - rng_unit_float(b[i]);
+                u2 = rng_unit_float(b[i + 1]);
+            }
+            const realT rad = sycl::sqrt(realT(-2) * sycl::log(u1));
+            const realT theta = two_pi * u2;
+            res[i] = static_cast<T>(loc + scale * rad * sycl::cos(theta));
+            res[i + 1] = static_cast<T>(loc + scale * rad * sycl::sin(theta));
+        }
+        return res;
+    }
+};
+
+/*! @brief Integers uniformly distributed in `[low, low + range)`, where
+ * `range == 0` stands for 2**64. A block gives 2 numbers.
+ *
+ * 64 random bits are mapped to the range by the high word of their
+ * product with `range`, which biases the distribution by at most
+ * `range / 2**64`, i.e. negligibly for ranges of 32-bit types. */
+template <typename T> struct IntegersTransform
+{
+    static constexpr int n_out = 2;
+
+    std::uint64_t low;
+    std::uint64_t range;
+
+    sycl::vec<T, n_out> operator()(const rng_block_t &b) const
+    {
+        sycl::vec<T, n_out> res;
+#pragma unroll
+        for (int i = 0; i < n_out; ++i) {
+            const std::uint64_t w = rng_join(b[2 * i], b[2 * i + 1]);
+            const std::uint64_t v = (range == 0) ? w : sycl::mul_hi(w, range);
+            res[i] = static_cast<T>(low + v);
+        }
+        return res;
+    }
+};
+
+/*! @brief Work-item `i` generates block `offset + i` of the stream, and
+ * writes its `n_out` numbers to elements `i * n_out` to `i * n_out + n_out
+ * - 1` of the destination.
+ *
+ * Each element thus only depends on the seed, the stream, the offset and
+ * its position, but not on the launch configuration. Numbers of full
+ * blocks are written with a vector store if `vec_store`, i.e. if the
+ * destination is aligned for it. */
+template <typename T, typename EngineT, typename TransformT, bool vec_store>
+class RandomFillFunctor
+{
+private:
+    T *dst = nullptr;
+    size_t nelems;
+    std::uint64_t seed;
+    std::uint64_t stream_id;
+    std::uint64_t offset;
+    TransformT transform;
+
+public:
+    RandomFillFunctor(T *dst_,
+                      size_t nelems_,
+                      std::uint64_t seed_,
+                      std::uint64_t stream_id_,
+                      std::uint64_t offset_,
+                      TransformT transform_)
+        : dst(dst_), nelems(nelems_), seed(seed_), stream_id(stream_id_),
+          offset(offset_), transform(transform_)
+    {
+    }
+
+    void operator()(sycl::id<1> id) const
+    {
+        constexpr int n_out = TransformT::n_out;
+
+        const size_t block_id = id[0];
+        const rng_block_t bits =
+            EngineT::generate(make_rng_counter(offset + block_id, stream_id),
+                              seed);
+        const sycl::vec<T, n_out> res = transform(bits);
+
+        const size_t base = block_id * n_out;
+        if (vec_store && base + n_out <= nelems) {
+            auto dst_multi_ptr = sycl::address_space_cast<
+                sycl::access::address_space::global_space,
+                sycl::access::decorated::yes>(&dst[base]);
+            res.store(0, dst_multi_ptr);
+        }
+        else {
+#pragma unroll
+            for (int i = 0; i < n_out; ++i) {
+                if (base + i < nelems) {
+                    dst[base + i] = res[i];
+                }
+            }
+        }
+    }
+};
+
+template <typename T, typename EngineT, typename TransformT, bool vec_store>
+class random_fill_krn;
+
+/*! @brief Number of blocks needed to fill `nelems` elements */
+template <typename TransformT> size_t random_n_blocks(size_t nelems)
+{
+    return (nelems + TransformT::n_out - 1) / TransformT::n_out;
+}
+
+template <typename T, typename EngineT, typename TransformT>
+sycl::event submit_random_fill(sycl::queue exec_q,
+                               size_t nelems,
+                               T *dst,
+                               std::uint64_t seed,
+                               std::uint64_t stream_id,
+                               std::uint64_t offset,
+                               TransformT transform,
+                               const std::vector<sycl::event> &depends)
+{
+    constexpr size_t vec_bytes = sizeof(T) * TransformT::n_out;
+    const bool aligned =
+        (reinterpret_cast<std::uintptr_t>(dst) % vec_bytes) == 0;
+    const size_t n_blocks = random_n_blocks<TransformT>(nelems);
+
+    sycl::event fill_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        if (aligned) {
+            using KernelName = random_fill_krn<T, EngineT, TransformT, true>;
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(n_blocks),
+                RandomFillFunctor<T, EngineT, TransformT, true>(
+                    dst, nelems, seed, stream_id, offset, transform));
+        }
+        else {
+            using KernelName = random_fill_krn<T, EngineT, TransformT, false>;
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(n_blocks),
+                RandomFillFunctor<T, EngineT, TransformT, false>(
+                    dst, nelems, seed, stream_id, offset, transform));
+        }
+    });
+
+    return fill_ev;
+}
+
+template <typename T, typename TransformT>
+sycl::event random_fill_impl(sycl::queue exec_q,
+                             size_t nelems,
+                             char *dst_p,
+                             rng_engine engine,
+                             std::uint64_t seed,
+                             std::uint64_t stream_id,
+                             std::uint64_t offset,
+                             TransformT transform,
+                             const std::vector<sycl::event> &depends)
+{
+    dpctl::tensor::type_utils::validate_type_for_device<T>(exec_q);
+
+    T *dst = reinterpret_cast<T *>(dst_p);
+    if (engine == rng_engine::threefry4x32x20) {
+        return submit_random_fill<T, Threefry4x32x20, TransformT>(
+            exec_q, nelems, dst, seed, stream_id, offset, transform, depends);
+    }
+    return submit_random_fill<T, Philox4x32x10, TransformT>(
+        exec_q, nelems, dst, seed, stream_id, offset, transform, depends);
+}
+
+typedef sycl::event (*random_bits_fn_ptr_t)(sycl::queue,
+                                            size_t,
+                                            char *,
+                                            rng_engine,
+                                            std::uint64_t,
+                                            std::uint64_t,
+                                            std::uint64_t,
+                                            const std::vector<sycl::event> &);
+
+/*! @brief Fills `nelems` elements of C-contiguous array of `std::uint32_t`
+ * with raw words generated by `engine` */
+inline sycl::event random_bits_impl(sycl::queue exec_q,
+                                    size_t nelems,
+                                    char *dst_p,
+                                    rng_engine engine,
+                                    std::uint64_t seed,
+                                    std::uint64_t stream_id,
+                                    std::uint64_t offset,
+                                    const std::vector<sycl::event> &depends)
+{
+    return random_fill_impl<std::uint32_t>(
+        exec_q, nelems, dst_p, engine, seed, stream_id, offset,
+        RandomBitsTransform<std::uint32_t>{}, depends);
+}
+
+typedef sycl::event (*random_real_fn_ptr_t)(sycl::queue,
+                                            size_t,
+                                            char *,
+                                            rng_engine,
+                                            std::uint64_t,
+                                            std::uint64_t,
+                                            std::uint64_t,
+                                            double,
+                                            double,
+                                            const std::vector<sycl::event> &);
+
+template <typename T>
+sycl::event random_uniform_impl(sycl::queue exec_q,
+                                size_t nelems,
+                                char *dst_p,
+                                rng_engine engine,
+                                std::uint64_t seed,
+                                std::uint64_t stream_id,
+                                std::uint64_t offset,
+                                double low,
+                                double high,
+                                const std::vector<sycl::event> &depends)
+{
+    using realT = typename UniformTransform<T>::realT;
+    const UniformTransform<T> transform{static_cast<realT>(low),
+                                        static_cast<realT>(high - low)};
+    return random_fill_impl<T>(exec_q, nelems, dst_p, engine, seed,
+                               stream_id, offset, transform, depends);
+}
+
+template <typename T>
+sycl::event random_normal_impl(sycl::queue exec_q,
+                               size_t nelems,
+                               char *dst_p,
+                               rng_engine engine,
+                               std::uint64_t seed,
+                               std::uint64_t stream_id,
+                               std::uint64_t offset,
+                               double loc,
+                               double scale,
+                               const std::vector<sycl::event> &depends)
+{
+    using realT = typename NormalTransform<T>::realT;
+    const NormalTransform<T> transform{static_cast<realT>(loc),
+                                       static_cast<realT>(scale)};
+    return random_fill_impl<T>(exec_q, nelems, dst_p, engine, seed,
+                               stream_id, offset, transform, depends);
+}
+
+template <typename T> struct RandomRealTypeSupported
+{
+    static constexpr bool is_defined = std::is_same_v<T, sycl::half> ||
+                                       std::is_same_v<T, float> ||
+                                       std::is_same_v<T, double>;
+};
+
+template <typename fnT, typename T> struct RandomUniformFactory
+{
+    fnT get()
+    {
+        if constexpr (RandomRealTypeSupported<T>::is_defined) {
+            fnT fn = random_uniform_impl<T>;
+            return fn;
+        }
+        else {
+            fnT fn = nullptr;
+            return fn;
+        }
+    }
+};
+
+template <typename fnT, typename T> struct RandomNormalFactory
+{
+    fnT get()
+    {
+        if constexpr (RandomRealTypeSupported<T>::is_defined) {
+            fnT fn = random_normal_impl<T>;
+            return fn;
+        }
+        else {
+            fnT fn = nullptr;
+            return fn;
+        }
+    }
+};
+
+typedef sycl::event (*random_integers_fn_ptr_t)(
+    sycl::queue,
+    size_t,
+    char *,
+    rng_engine,
+    std::uint64_t,
+    std::uint64_t,
+    std::uint64_t,
+    std::uint64_t,
+    std::uint64_t,
+    const std::vector<sycl::event> &);
+
+/*! @brief Fills array with integers in `[low, low + range)`, where `low` is
+ * given modulo 2**64, and `range == 0` stands for 2**64 */
+template <typename T>
+sycl::event random_integers_impl(sycl::queue exec_q,
+                                 size_t nelems,
+                                 char *dst_p,
+                                 rng_engine engine,
+                                 std::uint64_t seed,
+                                 std::uint64_t stream_id,
+                                 std::uint64_t offset,
+                                 std::uint64_t low,
+                                 std::uint64_t range,
+                                 const std::vector<sycl::event> &depends)
+{
+    const IntegersTransform<T> transform{low, range};
+    return random_fill_impl<T>(exec_q, nelems, dst_p, engine, seed,
+                               stream_id, offset, transform, depends);
+}
+
+template <typename fnT, typename T> struct RandomIntegersFactory
+{
+    fnT get()
+    {
+        if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+            fnT fn = random_integers_impl<T>;
+            return fn;
+        }
+        else {
+            fnT fn = nullptr;
+            return fn;
+        }
+    }
+};
+
+} // namespace random
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
@@ -32,6 +32,7 @@
 
 #include "pybind11/pybind11.h"
 #include "utils/offset_utils.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/sycl_utils.hpp"
 #include "utils/type_dispatch.hpp"
 #include "utils/type_utils.hpp"
@@ -46,6 +47,9 @@ namespace tensor
 namespace kernels
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+using dpctl::tensor::alloc_utils::sycl_malloc_device;
+
 template <typename argT,
           typename outT,
           typename ReductionOp,
@@ -399,6 +403,29 @@ sycl::event sum_reduction_axis1_over_group_with_atomics_contig_impl(
     using ReductionOpT = sycl::plus<resTy>;
     constexpr resTy identity_val = resTy{0};
 
+    if (sycl_utils::use_host_fastpath(exec_q, iter_nelems * reduction_nelems,
+                                      {arg_tp, res_tp}, depends))
+    {
+        using InputIterIndexerT = dpctl::tensor::offset_utils::Strided1DIndexer;
+        using NoOpIndexerT = dpctl::tensor::offset_utils::NoOpIndexer;
+        using InputOutputIterIndexerT =
+            dpctl::tensor::offset_utils::TwoOffsets_CombinedIndexer<
+                InputIterIndexerT, NoOpIndexerT>;
+
+        InputOutputIterIndexerT in_out_iter_indexer{
+            InputIterIndexerT{0, static_cast<py::ssize_t>(iter_nelems),
+                              static_cast<py::ssize_t>(reduction_nelems)},
+            NoOpIndexerT{}};
+        const SequentialReduction<argTy, resTy, ReductionOpT,
+                                  InputOutputIterIndexerT, NoOpIndexerT>
+            reduction(arg_tp, res_tp, ReductionOpT(), identity_val,
+                      in_out_iter_indexer, NoOpIndexerT{}, reduction_nelems);
+        for (size_t i = 0; i < iter_nelems; ++i) {
+            reduction(sycl::id<1>(i));
+        }
+        return sycl::event();
+    }
+
     const sycl::device &d = exec_q.get_device();
     const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
     size_t wg = choose_workgroup_size<4>(reduction_nelems, sg_sizes);
@@ -510,6 +537,31 @@ sycl::event sum_reduction_axis0_over_group_with_atomics_contig_impl(
     using ReductionOpT = sycl::plus<resTy>;
     constexpr resTy identity_val = resTy{0};
 
+    if (sycl_utils::use_host_fastpath(exec_q, iter_nelems * reduction_nelems,
+                                      {arg_tp, res_tp}, depends))
+    {
+        using NoOpIndexerT = dpctl::tensor::offset_utils::NoOpIndexer;
+        using ColsIndexerT = dpctl::tensor::offset_utils::Strided1DIndexer;
+        using InputOutputIterIndexerT =
+            dpctl::tensor::offset_utils::TwoOffsets_CombinedIndexer<
+                NoOpIndexerT, NoOpIndexerT>;
+
+        InputOutputIterIndexerT in_out_iter_indexer{NoOpIndexerT{},
+                                                    NoOpIndexerT{}};
+        ColsIndexerT reduction_indexer{
+            0, static_cast<py::ssize_t>(reduction_nelems),
+            static_cast<py::ssize_t>(iter_nelems)};
+        const SequentialReduction<argTy, resTy, ReductionOpT,
+                                  InputOutputIterIndexerT, ColsIndexerT>
+            reduction(arg_tp, res_tp, ReductionOpT(), identity_val,
+                      in_out_iter_indexer, reduction_indexer,
+                      reduction_nelems);
+        for (size_t i = 0; i < iter_nelems; ++i) {
+            reduction(sycl::id<1>(i));
+        }
+        return sycl::event();
+    }
+
     const sycl::device &d = exec_q.get_device();
     const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
     size_t wg = choose_workgroup_size<4>(reduction_nelems, sg_sizes);
@@ -747,9 +799,9 @@ sycl::event sum_reduction_over_group_temps_strided_impl(
             (reduction_groups + preferrered_reductions_per_wi * wg - 1) /
             (preferrered_reductions_per_wi * wg);
 
-        resTy *partially_reduced_tmp = sycl::malloc_device<resTy>(
+        resTy *partially_reduced_tmp = sycl_malloc_device<resTy>(
             iter_nelems * (reduction_groups + second_iter_reduction_groups_),
-            exec_q);
+            exec_q, "sum_reduction_over_group_temps_strided_impl");
         resTy *partially_reduced_tmp2 = nullptr;
 
         if (partially_reduced_tmp == nullptr) {
@@ -918,7 +970,7 @@ sycl::event sum_reduction_over_group_temps_strided_impl(
                 sycl::context ctx = exec_q.get_context();
 
                 cgh.host_task([ctx, partially_reduced_tmp] {
-                    sycl::free(partially_reduced_tmp, ctx);
+                    sycl_free_noexcept(partially_reduced_tmp, ctx);
                 });
             });
 
@@ -0,0 +1,766 @@
+//=== topk.hpp - Implementation of top-k selection kernels ---*-C++-*--/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels selecting k largest, or smallest, elements
+/// along the last axis of a two-dimensional array.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <pybind11/pybind11.h>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "utils/sycl_alloc_utils.hpp"
+#include "utils/type_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace sorting
+{
+
+namespace py = pybind11;
+
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+using dpctl::tensor::alloc_utils::sycl_malloc_device;
+
+/*! @brief Largest `k` selected by per-work-item sorted lists, merged in
+ * local memory. Larger `k` use radix selection. */
+static constexpr size_t topk_small_k_max = 32;
+
+/*! @brief Unsigned integer type of the same size as `T`, used as the key of
+ * selection. */
+template <typename T> struct TopKKeyType
+{
+    using type = std::conditional_t<
+        sizeof(T) == 1,
+        std::uint8_t,
+        std::conditional_t<
+            sizeof(T) == 2,
+            std::uint16_t,
+            std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+};
+
+/*! @brief Maps value to unsigned integer key, such that the larger key
+ * corresponds to the value to be selected first.
+ *
+ * NaNs compare greater than any other value, as in `numpy.sort`, so they
+ * are selected first by the largest, and last by the smallest. Negative
+ * and positive zeros map to the same key, so they are ordered by index. */
+template <typename T, typename keyT> keyT topk_key(T v, bool largest)
+{
+    constexpr unsigned int n_bits = 8 * sizeof(keyT);
+    constexpr keyT sign_bit = static_cast<keyT>(keyT(1) << (n_bits - 1));
+
+    keyT key;
+    if constexpr (std::is_same_v<T, bool>) {
+        key = static_cast<keyT>(v);
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>) {
+        key = static_cast<keyT>(v);
+    }
+    else if constexpr (std::is_integral_v<T>) {
+        key = static_cast<keyT>(sycl::bit_cast<keyT>(v) ^ sign_bit);
+    }
+    else {
+        if (sycl::isnan(v)) {
+            key = std::numeric_limits<keyT>::max();
+        }
+        else {
+            // -0.0 compares equal to +0.0
+            const T canonical_v = (v == T(0)) ? T(0) : v;
+            const keyT bits = sycl::bit_cast<keyT>(canonical_v);
+            key = (bits & sign_bit) ? static_cast<keyT>(~bits)
+                                    : static_cast<keyT>(bits | sign_bit);
+        }
+    }
+    return (largest) ? key : static_cast<keyT>(~key);
+}
+
+/*! @brief Whether candidate `(key_a, id_a)` is selected before
+ * `(key_b, id_b)`. Of equal keys, one with the smaller index is selected. */
+template <typename keyT, typename indT>
+inline bool topk_precedes(keyT key_a, indT id_a, keyT key_b, indT id_b)
+{
+    return (key_a > key_b) || (key_a == key_b && id_a < id_b);
+}
+
+/*! @brief Index of padding candidates, which are preceded by any other */
+template <typename indT> constexpr indT topk_sentinel_id()
+{
+    return std::numeric_limits<indT>::max();
+}
+
+/*! @brief Reads candidates from elements of strided array of shape
+ * `(n_rows, n)` */
+template <typename T, typename keyT, typename indT> struct TopKSourceReader
+{
+    const T *src_ = nullptr;
+    py::ssize_t row_stride_ = 0;
+    py::ssize_t elem_stride_ = 0;
+    bool largest_ = true;
+
+    TopKSourceReader(const T *src,
+                     py::ssize_t row_stride,
+                     py::ssize_t elem_stride,
+                     bool largest)
+        : src_(src), row_stride_(row_stride), elem_stride_(elem_stride),
+          largest_(largest)
+    {
+    }
+
+    void operator()(size_t row, size_t j, keyT &key, indT &id) const
+    {
+        const py::ssize_t offset = static_cast<py::ssize_t>(row) * row_stride_ +
+                                   static_cast<py::ssize_t>(j) * elem_stride_;
+        key = topk_key<T, keyT>(src_[offset], largest_);
+        id = static_cast<indT>(j);
+    }
+};
+
+/*! @brief Reads candidates from C-contiguous temporaries of shape
+ * `(n_rows, row_size)` */
+template <typename keyT, typename indT> struct TopKCandidateReader
+{
+    const keyT *keys_ = nullptr;
+    const indT *ids_ = nullptr;
+    size_t row_size_ = 0;
+
+    TopKCandidateReader(const keyT *keys, const indT *ids, size_t row_size)
+        : keys_(keys), ids_(ids), row_size_(row_size)
+    {
+    }
+
+    void operator()(size_t row, size_t j, keyT &key, indT &id) const
+    {
+        const size_t pos = row * row_size_ + j;
+        key = keys_[pos];
+        id = ids_[pos];
+    }
+};
+
+/*! @brief Writes selected candidates into C-contiguous temporaries of shape
+ * `(n_rows, row_size)` */
+template <typename keyT, typename indT> struct TopKCandidateWriter
+{
+    keyT *keys_ = nullptr;
+    indT *ids_ = nullptr;
+    size_t row_size_ = 0;
+
+    TopKCandidateWriter(keyT *keys, indT *ids, size_t row_size)
+        : keys_(keys), ids_(ids), row_size_(row_size)
+    {
+    }
+
+    void operator()(size_t row, size_t i, keyT key, indT id) const
+    {
+        const size_t pos = row * row_size_ + i;
+        keys_[pos] = key;
+        ids_[pos] = id;
+    }
+};
+
+/*! @brief Writes values and indices of selected elements into C-contiguous
+ * arrays of shape `(n_rows, k)` */
+template <typename T, typename keyT, typename indT> struct TopKResultWriter
+{
+    const T *src_ = nullptr;
+    py::ssize_t row_stride_ = 0;
+    py::ssize_t elem_stride_ = 0;
+    T *vals_ = nullptr;
+    indT *inds_ = nullptr;
+    size_t k_ = 0;
+
+    TopKResultWriter(const T *src,
+                     py::ssize_t row_stride,
+                     py::ssize_t elem_stride,
+                     T *vals,
+                     indT *inds,
+                     size_t k)
+        : src_(src), row_stride_(row_stride), elem_stride_(elem_stride),
+          vals_(vals), inds_(inds), k_(k)
+    {
+    }
+
+    void operator()(size_t row, size_t i, keyT, indT id) const
+    {
+        const py::ssize_t offset = static_cast<py::ssize_t>(row) * row_stride_ +
+                                   static_cast<py::ssize_t>(id) * elem_stride_;
+        const size_t pos = row * k_ + i;
+        vals_[pos] = src_[offset];
+        inds_[pos] = id;
+    }
+};
+
+/* ========================= Selection of small k ========================= */
+
+/*! @brief Each work-group selects `k` leading candidates of a segment of a
+ * row. Work-items keep sorted lists of `k` leading candidates of elements
+ * they visit in private memory, which are then merged pairwise in local
+ * memory. */
+template <typename keyT, typename indT, typename ReaderT, typename WriterT>
+class TopKSmallFunctor
+{
+private:
+    ReaderT reader_;
+    WriterT writer_;
+    size_t n_ = 0;
+    size_t k_ = 0;
+    size_t n_segs_ = 1;
+    size_t seg_size_ = 0;
+    sycl::local_accessor<keyT, 1> slm_keys_;
+    sycl::local_accessor<indT, 1> slm_ids_;
+
+public:
+    TopKSmallFunctor(ReaderT reader,
+                     WriterT writer,
+                     size_t n,
+                     size_t k,
+                     size_t n_segs,
+                     sycl::local_accessor<keyT, 1> slm_keys,
+                     sycl::local_accessor<indT, 1> slm_ids)
+        : reader_(reader), writer_(writer), n_(n), k_(k), n_segs_(n_segs),
+          seg_size_((n + n_segs - 1) / n_segs), slm_keys_(slm_keys),
+          slm_ids_(slm_ids)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const size_t group_id = it.get_group(0);
+        const size_t row = group_id / n_segs_;
+        const size_t seg = group_id - row * n_segs_;
+        const size_t lid = it.get_local_id(0);
+        const size_t lws = it.get_local_range(0);
+
+        const size_t seg_start = seg * seg_size_;
+        const size_t seg_end = std::min(n_, seg_start + seg_size_);
+
+        keyT keys[topk_small_k_max];
+        indT ids[topk_small_k_max];
+        size_t count = 0;
+
+        for (size_t j = seg_start + lid; j < seg_end; j += lws) {
+            keyT key;
+            indT id;
+            reader_(row, j, key, id);
+
+            size_t pos;
+            if (count < k_) {
+                pos = count++;
+            }
+            else if (topk_precedes(key, id, keys[k_ - 1], ids[k_ - 1])) {
+                pos = k_ - 1;
+            }
+            else {
+                continue;
+            }
+            while (pos > 0 &&
+                   topk_precedes(key, id, keys[pos - 1], ids[pos - 1]))
+            {
+                keys[pos] = keys[pos - 1];
+                ids[pos] = ids[pos - 1];
+                --pos;
+            }
+            keys[pos] = key;
+            ids[pos] = id;
+        }
+
+        const size_t slm_offset = lid * k_;
+        for (size_t i = 0; i < k_; ++i) {
+            slm_keys_[slm_offset + i] = (i < count) ? keys[i] : keyT(0);
+            slm_ids_[slm_offset + i] =
+                (i < count) ? ids[i] : topk_sentinel_id<indT>();
+        }
+        it.barrier(sycl::access::fence_space::local_space);
+
+        // lists of work-items lid and lid + step are merged into the list
+        // of lid, until the list of the leader holds the result
+        for (size_t step = 1; step < lws; step <<= 1) {
+            if ((lid % (2 * step) == 0) && (lid + step < lws)) {
+                size_t a = slm_offset;
+                size_t b = slm_offset + step * k_;
+                for (size_t i = 0; i < k_; ++i) {
+                    if (topk_precedes(slm_keys_[a], slm_ids_[a], slm_keys_[b],
+                                      slm_ids_[b]))
+                    {
+                        keys[i] = slm_keys_[a];
+                        ids[i] = slm_ids_[a];
+                        ++a;
+                    }
+                    else {
+                        keys[i] = slm_keys_[b];
+                        ids[i] = slm_ids_[b];
+                        ++b;
+                    }
+                }
+                for (size_t i = 0; i < k_; ++i) {
+                    slm_keys_[slm_offset + i] = keys[i];
+                    slm_ids_[slm_offset + i] = ids[i];
+                }
+            }
+            it.barrier(sycl::access::fence_space::local_space);
+        }
+
+        for (size_t i = lid; i < k_; i += lws) {
+            writer_(group_id, i, slm_keys_[i], slm_ids_[i]);
+        }
+    }
+};
+
+/* ========================= Selection of large k ========================= */
+
+/*! @brief Each work-group selects `k` leading candidates of a row by radix
+ * selection of the key of the k-th candidate, one byte per pass, and
+ * writes them unordered into a temporary row padded to `k_padded`
+ * candidates. */
+template <typename keyT, typename indT, typename ReaderT, typename WriterT>
+class TopKRadixSelectFunctor
+{
+private:
+    ReaderT reader_;
+    WriterT writer_;
+    size_t n_ = 0;
+    size_t k_ = 0;
+    size_t k_padded_ = 0;
+    sycl::local_accessor<std::uint32_t, 1> slm_hist_;
+
+public:
+    static constexpr size_t n_buckets = 256;
+
+    TopKRadixSelectFunctor(ReaderT reader,
+                           WriterT writer,
+                           size_t n,
+                           size_t k,
+                           size_t k_padded,
+                           sycl::local_accessor<std::uint32_t, 1> slm_hist)
+        : reader_(reader), writer_(writer), n_(n), k_(k), k_padded_(k_padded),
+          slm_hist_(slm_hist)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const size_t row = it.get_group(0);
+        const size_t lid = it.get_local_id(0);
+        const size_t lws = it.get_local_range(0);
+
+        keyT prefix(0);
+        keyT prefix_mask(0);
+        // number of candidates yet to be selected among those with the
+        // key matching the prefix
+        size_t remaining = k_;
+
+        for (int shift = 8 * sizeof(keyT) - 8; shift >= 0; shift -= 8) {
+            for (size_t b = lid; b < n_buckets; b += lws) {
+                slm_hist_[b] = 0;
+            }
+            it.barrier(sycl::access::fence_space::local_space);
+
+            for (size_t j = lid; j < n_; j += lws) {
+                keyT key;
+                indT id;
+                reader_(row, j, key, id);
+                if ((key & prefix_mask) == prefix) {
+                    sycl::atomic_ref<std::uint32_t, sycl::memory_order::relaxed,
+                                     sycl::memory_scope::work_group,
+                                     sycl::access::address_space::local_space>
+                        bucket_ref(slm_hist_[(key >> shift) & 0xFF]);
+                    bucket_ref += 1;
+                }
+            }
+            it.barrier(sycl::access::fence_space::local_space);
+
+            // all work-items find the bucket of the k-th candidate
+            size_t digit = 0;
+            size_t preceding = 0;
+            for (size_t b = n_buckets; b > 0; --b) {
+                const size_t c = slm_hist_[b - 1];
+                if (preceding + c >= remaining) {
+                    digit = b - 1;
+                    break;
+                }
+                preceding += c;
+            }
+            remaining -= preceding;
+            prefix |= static_cast<keyT>(static_cast<keyT>(digit) << shift);
+            prefix_mask |= static_cast<keyT>(static_cast<keyT>(0xFF) << shift);
+            it.barrier(sycl::access::fence_space::local_space);
+        }
+
+        // all candidates with keys greater than the threshold, and those
+        // with the smallest indices among equal to it, are selected
+        const keyT threshold = prefix;
+        const size_t n_greater = k_ - remaining;
+        auto wg = it.get_group();
+
+        size_t greater_base = 0;
+        size_t equal_base = 0;
+        for (size_t chunk = 0; chunk < n_; chunk += lws) {
+            const size_t j = chunk + lid;
+            keyT key(0);
+            indT id(0);
+            if (j < n_) {
+                reader_(row, j, key, id);
+            }
+            const size_t is_greater = (j < n_ && key > threshold) ? 1 : 0;
+            const size_t is_equal = (j < n_ && key == threshold) ? 1 : 0;
+
+            const size_t greater_pos = sycl::exclusive_scan_over_group(
+                wg, is_greater, sycl::plus<size_t>());
+            const size_t equal_pos = sycl::exclusive_scan_over_group(
+                wg, is_equal, sycl::plus<size_t>());
+
+            if (is_greater) {
+                writer_(row, greater_base + greater_pos, key, id);
+            }
+            if (is_equal && equal_base + equal_pos < remaining) {
+                writer_(row, n_greater + equal_base + equal_pos, key, id);
+            }
+
+            greater_base +=
+                sycl::reduce_over_group(wg, is_greater, sycl::plus<size_t>());
+            equal_base +=
+                sycl::reduce_over_group(wg, is_equal, sycl::plus<size_t>());
+            if (greater_base >= n_greater && equal_base >= remaining) {
+                break;
+            }
+        }
+
+        for (size_t i = k_ + lid; i < k_padded_; i += lws) {
+            writer_(row, i, keyT(0), topk_sentinel_id<indT>());
+        }
+    }
+};
+
+/*! @brief Each work-group sorts a row of `k_padded` candidates, a power of
+ * two, in place with bitonic network, and writes leading `k` of them. */
+template <typename keyT, typename indT, typename WriterT>
+class TopKBitonicSortFunctor
+{
+private:
+    keyT *keys_ = nullptr;
+    indT *ids_ = nullptr;
+    WriterT writer_;
+    size_t k_ = 0;
+    size_t k_padded_ = 0;
+
+public:
+    TopKBitonicSortFunctor(keyT *keys,
+                           indT *ids,
+                           WriterT writer,
+                           size_t k,
+                           size_t k_padded)
+        : keys_(keys), ids_(ids), writer_(writer), k_(k), k_padded_(k_padded)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const size_t row = it.get_group(0);
+        const size_t lid = it.get_local_id(0);
+        const size_t lws = it.get_local_range(0);
+
+        keyT *keys = keys_ + row * k_padded_;
+        indT *ids = ids_ + row * k_padded_;
+        const size_t n_pairs = k_padded_ / 2;
+
+        for (size_t size = 2; size <= k_padded_; size <<= 1) {
+            for (size_t stride = size / 2; stride > 0; stride >>= 1) {
+                for (size_t t = lid; t < n_pairs; t += lws) {
+                    const size_t i = 2 * t - (t & (stride - 1));
+                    const size_t l = i + stride;
+                    const bool leading_first = ((i & size) == 0);
+                    if (topk_precedes(keys[l], ids[l], keys[i], ids[i]) ==
+                        leading_first)
+                    {
+                        const keyT tmp_key = keys[i];
+                        const indT tmp_id = ids[i];
+                        keys[i] = keys[l];
+                        ids[i] = ids[l];
+                        keys[l] = tmp_key;
+                        ids[l] = tmp_id;
+                    }
+                }
+                it.barrier(sycl::access::fence_space::global_space);
+            }
+        }
+
+        for (size_t i = lid; i < k_; i += lws) {
+            writer_(row, i, keys[i], ids[i]);
+        }
+    }
+};
+
+template <typename T, typename keyT, typename indT>
+class topk_small_segments_krn;
+
+template <typename T, typename keyT, typename indT> class topk_small_rows_krn;
+
+template <typename T, typename keyT, typename indT>
+class topk_small_merge_krn;
+
+template <typename T, typename keyT, typename indT> class topk_radix_select_krn;
+
+template <typename T, typename keyT, typename indT> class topk_bitonic_sort_krn;
+
+typedef sycl::event (*topk_impl_fn_ptr_t)(sycl::queue,
+                                          size_t,
+                                          size_t,
+                                          size_t,
+                                          bool,
+                                          const char *,
+                                          py::ssize_t,
+                                          py::ssize_t,
+                                          char *,
+                                          char *,
+                                          const std::vector<sycl::event> &);
+
+/*!
+ * @brief Selects `k` largest, or smallest, elements of each row of array
+ * of shape `(n_rows, n)`, in the order of selection.
+ *
+ * For `k` not exceeding `topk_small_k_max` rows are split into segments
+ * processed by separate work-groups, if rows are too few to occupy the
+ * device, and leading candidates of segments are merged by the second
+ * kernel. Otherwise, candidates are found by radix selection and sorted
+ * with bitonic network.
+ *
+ * @param exec_q  Execution queue
+ * @param n_rows  Number of rows
+ * @param n       Number of elements in each row, `0 < k <= n`
+ * @param k       Number of elements to select from each row
+ * @param largest Whether largest elements are selected
+ * @param src_cp  Pointer to the source array
+ * @param row_stride  Stride between rows of the source array, in elements
+ * @param elem_stride Stride between elements of a row, in elements
+ * @param vals_cp Pointer to C-contiguous array of shape `(n_rows, k)` for
+ * values of selected elements
+ * @param inds_cp Pointer to C-contiguous array of shape `(n_rows, k)` for
+ * indices of selected elements
+ * @param depends List of events to wait for before starting computations
+ * @return Event to wait for to ensure that computations are complete
+ */
+template <typename T>
+sycl::event topk_impl(sycl::queue exec_q,
+                      size_t n_rows,
+                      size_t n,
+                      size_t k,
+                      bool largest,
+                      const char *src_cp,
+                      py::ssize_t row_stride,
+                      py::ssize_t elem_stride,
+                      char *vals_cp,
+                      char *inds_cp,
+                      const std::vector<sycl::event> &depends)
+{
+    using keyT = typename TopKKeyType<T>::type;
+    using indT = std::int64_t;
+
+    const T *src = reinterpret_cast<const T *>(src_cp);
+    T *vals = reinterpret_cast<T *>(vals_cp);
+    indT *inds = reinterpret_cast<indT *>(inds_cp);
+
+    using SourceReaderT = TopKSourceReader<T, keyT, indT>;
+    using ResultWriterT = TopKResultWriter<T, keyT, indT>;
+    using CandidateReaderT = TopKCandidateReader<keyT, indT>;
+    using CandidateWriterT = TopKCandidateWriter<keyT, indT>;
+
+    const SourceReaderT src_reader(src, row_stride, elem_stride, largest);
+    const ResultWriterT res_writer(src, row_stride, elem_stride, vals, inds, k);
+
+    const sycl::device &d = exec_q.get_device();
+    const size_t max_wg = d.get_info<sycl::info::device::max_work_group_size>();
+    const size_t slm_size = d.get_info<sycl::info::device::local_mem_size>();
+
+    if (k <= topk_small_k_max) {
+        // lists of all work-items are to fit into half of local memory
+        const size_t slm_per_wi = k * (sizeof(keyT) + sizeof(indT));
+        size_t lws = std::max<size_t>(1, slm_size / (2 * slm_per_wi));
+        lws = std::min({lws, max_wg, size_t(256)});
+
+        // rows are split into segments so that there are enough
+        // work-groups, unless segments would become too short
+        constexpr size_t min_elems_per_wi = 64;
+        const size_t n_cu =
+            d.get_info<sycl::info::device::max_compute_units>();
+        const size_t target_groups = 4 * std::max<size_t>(n_cu, 1);
+        const size_t max_segs_by_size =
+            std::max<size_t>(1, n / (lws * min_elems_per_wi));
+        const size_t n_segs =
+            (n_rows >= target_groups)
+                ? 1
+                : std::min(max_segs_by_size,
+                           (target_groups + n_rows - 1) / n_rows);
+
+        if (n_segs == 1) {
+            return exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(depends);
+
+                sycl::local_accessor<keyT, 1> slm_keys(lws * k, cgh);
+                sycl::local_accessor<indT, 1> slm_ids(lws * k, cgh);
+
+                using KernelName = class topk_small_rows_krn<T, keyT, indT>;
+                cgh.parallel_for<KernelName>(
+                    sycl::nd_range<1>(n_rows * lws, lws),
+                    TopKSmallFunctor<keyT, indT, SourceReaderT, ResultWriterT>(
+                        src_reader, res_writer, n, k, 1, slm_keys, slm_ids));
+            });
+        }
+
+        const size_t cand_row_size = n_segs * k;
+        keyT *cand_keys = sycl_malloc_device<keyT>(n_rows * cand_row_size,
+                                                   exec_q, "topk_impl");
+        indT *cand_ids = (cand_keys == nullptr)
+                             ? nullptr
+                             : sycl_malloc_device<indT>(n_rows * cand_row_size,
+                                                        exec_q, "topk_impl");
+        if (cand_ids == nullptr) {
+            sycl_free_noexcept(cand_keys, exec_q.get_context());
+            throw std::runtime_error("Unable to allocate device memory");
+        }
+
+        // candidates of segment `seg` of row `row` are written to the
+        // position `row * n_segs + seg` of the temporary
+        const CandidateWriterT cand_writer(cand_keys, cand_ids, k);
+        sycl::event segments_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
+
+            sycl::local_accessor<keyT, 1> slm_keys(lws * k, cgh);
+            sycl::local_accessor<indT, 1> slm_ids(lws * k, cgh);
+
+            using KernelName = class topk_small_segments_krn<T, keyT, indT>;
+            cgh.parallel_for<KernelName>(
+                sycl::nd_range<1>(n_rows * n_segs * lws, lws),
+                TopKSmallFunctor<keyT, indT, SourceReaderT, CandidateWriterT>(
+                    src_reader, cand_writer, n, k, n_segs, slm_keys,
+                    slm_ids));
+        });
+
+        const CandidateReaderT cand_reader(cand_keys, cand_ids, cand_row_size);
+        sycl::event merge_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(segments_ev);
+
+            sycl::local_accessor<keyT, 1> slm_keys(lws * k, cgh);
+            sycl::local_accessor<indT, 1> slm_ids(lws * k, cgh);
+
+            using KernelName = class topk_small_merge_krn<T, keyT, indT>;
+            cgh.parallel_for<KernelName>(
+                sycl::nd_range<1>(n_rows * lws, lws),
+                TopKSmallFunctor<keyT, indT, CandidateReaderT, ResultWriterT>(
+                    cand_reader, res_writer, cand_row_size, k, 1, slm_keys,
+                    slm_ids));
+        });
+
+        return exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(merge_ev);
+            sycl::context ctx = exec_q.get_context();
+
+            cgh.host_task([ctx, cand_keys, cand_ids] {
+                sycl_free_noexcept(cand_keys, ctx);
+                sycl_free_noexcept(cand_ids, ctx);
+            });
+        });
+    }
+
+    size_t k_padded = 1;
+    while (k_padded < k) {
+        k_padded <<= 1;
+    }
+    const size_t lws = std::min<size_t>(max_wg, 256);
+
+    keyT *cand_keys =
+        sycl_malloc_device<keyT>(n_rows * k_padded, exec_q, "topk_impl");
+    indT *cand_ids =
+        (cand_keys == nullptr)
+            ? nullptr
+            : sycl_malloc_device<indT>(n_rows * k_padded, exec_q, "topk_impl");
+    if (cand_ids == nullptr) {
+        sycl_free_noexcept(cand_keys, exec_q.get_context());
+        throw std::runtime_error("Unable to allocate device memory");
+    }
+
+    const CandidateWriterT cand_writer(cand_keys, cand_ids, k_padded);
+    sycl::event select_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        using FunctorT = TopKRadixSelectFunctor<keyT, indT, SourceReaderT,
+                                                CandidateWriterT>;
+        sycl::local_accessor<std::uint32_t, 1> slm_hist(FunctorT::n_buckets,
+                                                        cgh);
+
+        using KernelName = class topk_radix_select_krn<T, keyT, indT>;
+        cgh.parallel_for<KernelName>(
+            sycl::nd_range<1>(n_rows * lws, lws),
+            FunctorT(src_reader, cand_writer, n, k, k_padded, slm_hist));
+    });
+
+    sycl::event sort_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(select_ev);
+
+        using KernelName = class topk_bitonic_sort_krn<T, keyT, indT>;
+        cgh.parallel_for<KernelName>(
+            sycl::nd_range<1>(n_rows * lws, lws),
+            TopKBitonicSortFunctor<keyT, indT, ResultWriterT>(
+                cand_keys, cand_ids, res_writer, k, k_padded));
+    });
+
+    return exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(sort_ev);
+        sycl::context ctx = exec_q.get_context();
+
+        cgh.host_task([ctx, cand_keys, cand_ids] {
+            sycl_free_noexcept(cand_keys, ctx);
+            sycl_free_noexcept(cand_ids, ctx);
+        });
+    });
+}
+
+template <typename fnT, typename T> struct TopKFactory
+{
+    fnT get()
+    {
+        if constexpr (std::is_same_v<T, std::complex<float>> ||
+                      std::is_same_v<T, std::complex<double>>)
+        {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = topk_impl<T>;
+            return fn;
+        }
+    }
+};
+
+} // namespace sorting
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
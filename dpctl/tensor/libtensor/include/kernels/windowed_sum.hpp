@@ -0,0 +1,226 @@
+//=== windowed_sum.hpp - Sums over overlapping windows      ---*-C++-*--/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels summing elements of overlapping windows of
+/// rows, such as views made by sliding_window_view.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "kernels/reductions.hpp"
+#include "pybind11/pybind11.h"
+#include "utils/type_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+
+/*! @brief Sums `window_size` consecutive elements of rows of a signal,
+ * starting at each of `n_windows` positions.
+ *
+ * Work-group `g` of a row computes sums of windows starting at positions
+ * `g * lws` to `g * lws + lws - 1`. Elements these windows span are loaded
+ * into local memory in chunks of `chunk` window elements at a time, so
+ * that every element is read from global memory about twice per work-group,
+ * rather than once per window which holds it. Each work-item adds up the
+ * elements of its window in order, so sums do not depend on the launch
+ * configuration. */
+template <typename argT, typename resT> class WindowedSumFunctor
+{
+private:
+    const argT *src = nullptr;
+    resT *dst = nullptr;
+    size_t n_windows;
+    size_t window_size;
+    size_t chunk;
+    py::ssize_t src_row_stride;
+    py::ssize_t src_step;
+    py::ssize_t dst_row_stride;
+    py::ssize_t dst_step;
+    sycl::local_accessor<resT, 1> tile;
+
+public:
+    WindowedSumFunctor(const argT *src_,
+                       resT *dst_,
+                       size_t n_windows_,
+                       size_t window_size_,
+                       size_t chunk_,
+                       py::ssize_t src_row_stride_,
+                       py::ssize_t src_step_,
+                       py::ssize_t dst_row_stride_,
+                       py::ssize_t dst_step_,
+                       sycl::local_accessor<resT, 1> tile_)
+        : src(src_), dst(dst_), n_windows(n_windows_),
+          window_size(window_size_), chunk(chunk_),
+          src_row_stride(src_row_stride_), src_step(src_step_),
+          dst_row_stride(dst_row_stride_), dst_step(dst_step_), tile(tile_)
+    {
+    }
+
+    void operator()(sycl::nd_item<2> it) const
+    {
+        using dpctl::tensor::type_utils::convert_impl;
+
+        const size_t row_id = it.get_global_id(0);
+        const size_t lid = it.get_local_id(1);
+        const size_t lws = it.get_local_range(1);
+        const size_t first_window = it.get_group(1) * lws;
+        const size_t n_signal = n_windows + window_size - 1;
+
+        const argT *row = src + static_cast<py::ssize_t>(row_id) *
+                                    src_row_stride;
+
+        resT acc(0);
+        for (size_t c = 0; c < window_size; c += chunk) {
+            const size_t chunk_len = std::min(chunk, window_size - c);
+            const size_t tile_len = lws + chunk_len - 1;
+            for (size_t t = lid; t < tile_len; t += lws) {
+                const size_t pos = first_window + c + t;
+                tile[t] = (pos < n_signal)
+                              ? convert_impl<resT, argT>(
+                                    row[static_cast<py::ssize_t>(pos) *
+                                        src_step])
+                              : resT(0);
+            }
+            it.barrier(sycl::access::fence_space::local_space);
+
+            for (size_t j = 0; j < chunk_len; ++j) {
+                acc += tile[lid + j];
+            }
+            it.barrier(sycl::access::fence_space::local_space);
+        }
+
+        const size_t window_id = first_window + lid;
+        if (window_id < n_windows) {
+            dst[static_cast<py::ssize_t>(row_id) * dst_row_stride +
+                static_cast<py::ssize_t>(window_id) * dst_step] = acc;
+        }
+    }
+};
+
+template <typename T1, typename T2> class windowed_sum_krn;
+
+typedef sycl::event (*windowed_sum_impl_fn_ptr_t)(
+    sycl::queue,
+    size_t,
+    size_t,
+    size_t,
+    const char *,
+    py::ssize_t,
+    py::ssize_t,
+    char *,
+    py::ssize_t,
+    py::ssize_t,
+    const std::vector<sycl::event> &);
+
+/*!
+ * @brief Computes `dst[i, j] = sum(src[i, j + k] for k in range(window))`
+ * for `n_rows` rows and `n_windows` windows of a row.
+ *
+ * @param exec_q     Queue to submit the kernel to.
+ * @param n_rows     Number of rows.
+ * @param n_windows  Number of windows of each row.
+ * @param window_size  Number of elements of each window.
+ * @param src_cp     Pointer to the first element of the first row.
+ * @param src_row_stride  Stride between rows of the source, in elements.
+ * @param src_step   Stride between consecutive elements of a row.
+ * @param dst_cp     Pointer to the sum of the first window of first row.
+ * @param dst_row_stride  Stride between rows of the destination.
+ * @param dst_step   Stride between sums of consecutive windows of a row.
+ * @param depends    Events to wait for before starting computations.
+ *
+ * @return Event of the computation.
+ */
+template <typename argT, typename resT>
+sycl::event windowed_sum_impl(sycl::queue exec_q,
+                              size_t n_rows,
+                              size_t n_windows,
+                              size_t window_size,
+                              const char *src_cp,
+                              py::ssize_t src_row_stride,
+                              py::ssize_t src_step,
+                              char *dst_cp,
+                              py::ssize_t dst_row_stride,
+                              py::ssize_t dst_step,
+                              const std::vector<sycl::event> &depends)
+{
+    const argT *src = reinterpret_cast<const argT *>(src_cp);
+    resT *dst = reinterpret_cast<resT *>(dst_cp);
+
+    const sycl::device &d = exec_q.get_device();
+    const size_t max_wg =
+        d.template get_info<sycl::info::device::max_work_group_size>();
+    const size_t lws =
+        std::min<size_t>({max_wg, size_t(256), std::max<size_t>(n_windows, 1)});
+    const size_t chunk = std::min(window_size, lws);
+    const size_t n_groups = (n_windows + lws - 1) / lws;
+
+    sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        sycl::local_accessor<resT, 1> tile(sycl::range<1>(lws + chunk - 1),
+                                           cgh);
+
+        cgh.parallel_for<class windowed_sum_krn<argT, resT>>(
+            sycl::nd_range<2>(sycl::range<2>(n_rows, n_groups * lws),
+                              sycl::range<2>(1, lws)),
+            WindowedSumFunctor<argT, resT>(src, dst, n_windows, window_size,
+                                           chunk, src_row_stride, src_step,
+                                           dst_row_stride, dst_step, tile));
+    });
+
+    return comp_ev;
+}
+
+/*! @brief Pairs of types summed over windows, which are those summed by
+ * reductions over an axis */
+template <typename argT, typename resT> struct WindowedSumTypePairSupport
+{
+    static constexpr bool is_defined =
+        TypePairSupportDataForSumReductionAtomic<argT, resT>::is_defined ||
+        TypePairSupportDataForSumReductionTemps<argT, resT>::is_defined;
+};
+
+template <typename fnT, typename argT, typename resT>
+struct WindowedSumFactory
+{
+    fnT get() const
+    {
+        if constexpr (WindowedSumTypePairSupport<argT, resT>::is_defined) {
+            return windowed_sum_impl<argT, resT>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
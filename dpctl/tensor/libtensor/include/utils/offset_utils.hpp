@@ -28,11 +28,13 @@
 
 #include <CL/sycl.hpp>
 #include <algorithm>
+#include <array>
 #include <pybind11/pybind11.h>
 #include <tuple>
 #include <vector>
 
 #include "utils/strided_iters.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 
 namespace py = pybind11;
 
@@ -104,7 +106,8 @@ device_allocate_and_pack(sycl::queue q,
         std::make_shared<shT>(std::move(packed_shape_strides));
 
     auto sz = packed_shape_strides_owner->size();
-    indT *shape_strides = sycl::malloc_device<indT>(sz, q);
+    indT *shape_strides = dpctl::tensor::alloc_utils::sycl_malloc_device<indT>(
+        sz, q, "device_allocate_and_pack");
 
     if (shape_strides == nullptr) {
         return std::make_tuple(shape_strides, 0, sycl::event());
@@ -450,6 +453,33 @@ struct ThreeZeroOffsets_Indexer
     }
 };
 
+template <typename FirstIndexerT,
+          typename SecondIndexerT,
+          typename ThirdIndexerT>
+struct ThreeOffsets_CombinedIndexer
+{
+private:
+    FirstIndexerT first_indexer_;
+    SecondIndexerT second_indexer_;
+    ThirdIndexerT third_indexer_;
+
+public:
+    ThreeOffsets_CombinedIndexer(const FirstIndexerT &first_indexer,
+                                 const SecondIndexerT &second_indexer,
+                                 const ThirdIndexerT &third_indexer)
+        : first_indexer_(first_indexer), second_indexer_(second_indexer),
+          third_indexer_(third_indexer)
+    {
+    }
+
+    ThreeOffsets<py::ssize_t> operator()(py::ssize_t gid) const
+    {
+        return ThreeOffsets<py::ssize_t>(first_indexer_(gid),
+                                         second_indexer_(gid),
+                                         third_indexer_(gid));
+    }
+};
+
 template <typename displacementT> struct FourOffsets
 {
     FourOffsets()
@@ -559,6 +589,80 @@ struct FourZeroOffsets_Indexer
     }
 };
 
+/*! @brief Offsets of `N` arrays, e.g. of `N - 1` inputs and the output
+ * of an N-ary elementwise operation */
+template <typename displacementT, int N> struct NOffsets
+{
+    NOffsets() : offsets{} {}
+    NOffsets(const std::array<displacementT, N> &offsets_) : offsets(offsets_)
+    {
+    }
+
+    displacementT get_offset(int i) const
+    {
+        return offsets[i];
+    }
+
+private:
+    std::array<displacementT, N> offsets;
+};
+
+/*! @brief Computes offsets of `N` arrays sharing the common shape. Packed
+ * array contains the shape followed by strides of each array. */
+template <int N> struct NOffsets_StridedIndexer
+{
+    NOffsets_StridedIndexer(int common_nd,
+                            const std::array<py::ssize_t, N> &offsets_,
+                            py::ssize_t const *_packed_shape_strides)
+        : nd(common_nd), starting_offsets(offsets_),
+          shape_strides(_packed_shape_strides)
+    {
+    }
+
+    NOffsets<py::ssize_t, N> operator()(py::ssize_t gid) const
+    {
+        return compute_offsets(gid);
+    }
+
+    NOffsets<py::ssize_t, N> operator()(size_t gid) const
+    {
+        return compute_offsets(static_cast<py::ssize_t>(gid));
+    }
+
+private:
+    int nd;
+    std::array<py::ssize_t, N> starting_offsets;
+    py::ssize_t const *shape_strides;
+
+    NOffsets<py::ssize_t, N> compute_offsets(py::ssize_t gid) const
+    {
+        using dpctl::tensor::strides::CIndexer_vector;
+
+        CIndexer_vector _ind(nd);
+        std::array<const py::ssize_t *, N> strides;
+        for (int k = 0; k < N; ++k) {
+            strides[k] = shape_strides + (k + 1) * nd;
+        }
+        std::array<py::ssize_t, N> relative_offsets;
+        _ind.get_displacement<const py::ssize_t *, const py::ssize_t *, N>(
+            gid, shape_strides, strides, relative_offsets);
+        for (int k = 0; k < N; ++k) {
+            relative_offsets[k] += starting_offsets[k];
+        }
+        return NOffsets<py::ssize_t, N>(relative_offsets);
+    }
+};
+
+template <int N> struct NZeroOffsets_Indexer
+{
+    NZeroOffsets_Indexer() {}
+
+    NOffsets<py::ssize_t, N> operator()(py::ssize_t) const
+    {
+        return NOffsets<py::ssize_t, N>();
+    }
+};
+
 struct NthStrideOffset
 {
     NthStrideOffset(int common_nd,
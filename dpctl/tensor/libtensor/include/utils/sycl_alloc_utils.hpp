@@ -0,0 +1,138 @@
+//===-- sycl_alloc_utils.hpp - Allocation utilities for libtensor -*-C++-*-===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines wrappers around USM allocation and deallocation
+/// functions used for temporary allocations in tensor kernels. Wrappers
+/// register allocations with dpctl's USM accounting registry, see
+/// dpctl_usm_accounting.h.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <CL/sycl.hpp>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+
+#include "syclinterface/dpctl_usm_accounting.h"
+#include "syclinterface/dpctl_utils.h"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace alloc_utils
+{
+
+namespace detail
+{
+
+inline void record_alloc(void *ptr,
+                         std::size_t nbytes,
+                         DPCTLSyclUSMType kind,
+                         const sycl::queue &q,
+                         const char *call_site)
+{
+    if (DPCTLUSMAccounting_IsEnabled()) {
+        DPCTLUSMAccounting_RecordAlloc(
+            reinterpret_cast<DPCTLSyclUSMRef>(ptr), nbytes, kind,
+            reinterpret_cast<DPCTLSyclQueueRef>(const_cast<sycl::queue *>(&q)),
+            call_site);
+    }
+}
+
+/*! @brief Writes USM accounting report to std::cerr if accounting is
+ * enabled, to help diagnosing the allocation failure. */
+inline void report_alloc_failure(std::size_t nbytes, const char *call_site)
+{
+    if (DPCTLUSMAccounting_IsEnabled()) {
+        const char *report = DPCTLUSMAccounting_Report();
+        std::cerr << "USM allocation of " << nbytes << " bytes requested by "
+                  << call_site << " failed.\n"
+                  << ((report) ? report : "") << std::endl;
+        DPCTLCString_Delete(report);
+    }
+}
+
+} // namespace detail
+
+/*! @brief Allocates USM-device memory for `count` elements of type `T`,
+ * and records the allocation as made by `call_site`. Returns nullptr on
+ * failure. */
+template <typename T>
+T *sycl_malloc_device(std::size_t count,
+                      const sycl::queue &q,
+                      const char *call_site)
+{
+    T *ptr = sycl::malloc_device<T>(count, q);
+    if (ptr) {
+        detail::record_alloc(ptr, count * sizeof(T), DPCTL_USM_DEVICE, q,
+                             call_site);
+    }
+    else {
+        detail::report_alloc_failure(count * sizeof(T), call_site);
+    }
+    return ptr;
+}
+
+/*! @brief Allocates USM-host memory for `count` elements of type `T`,
+ * and records the allocation as made by `call_site`. Returns nullptr on
+ * failure. */
+template <typename T>
+T *sycl_malloc_host(std::size_t count,
+                    const sycl::queue &q,
+                    const char *call_site)
+{
+    T *ptr = sycl::malloc_host<T>(count, q);
+    if (ptr) {
+        detail::record_alloc(ptr, count * sizeof(T), DPCTL_USM_HOST, q,
+                             call_site);
+    }
+    else {
+        detail::report_alloc_failure(count * sizeof(T), call_site);
+    }
+    return ptr;
+}
+
+/*! @brief Frees USM memory allocated by `sycl_malloc_device` or
+ * `sycl_malloc_host`. Exceptions are reported to std::cerr, since the
+ * function is used in host tasks and destructors. */
+inline void sycl_free_noexcept(void *ptr, const sycl::context &ctx) noexcept
+{
+    if (ptr) {
+        DPCTLUSMAccounting_RecordFree(reinterpret_cast<DPCTLSyclUSMRef>(ptr));
+        try {
+            sycl::free(ptr, ctx);
+        } catch (const std::exception &e) {
+            std::cerr << "Exception caught when freeing USM memory: "
+                      << e.what() << std::endl;
+        }
+    }
+}
+
+inline void sycl_free_noexcept(void *ptr, const sycl::queue &q) noexcept
+{
+    sycl_free_noexcept(ptr, q.get_context());
+}
+
+} // namespace alloc_utils
+} // namespace tensor
+} // namespace dpctl
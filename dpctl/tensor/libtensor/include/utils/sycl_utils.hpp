@@ -25,7 +25,12 @@
 #pragma once
 #include <CL/sycl.hpp>
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <optional>
 #include <vector>
 
 namespace dpctl
@@ -66,6 +71,203 @@ size_t choose_workgroup_size(const size_t nelems,
     return wg;
 }
 
+/*! @brief Launch modes of kernels for contiguous elementwise operations.
+ *
+ * In `full` mode one work-group is launched per block of elements it
+ * processes. In `persistent` mode the number of work-groups is bounded by
+ * a small multiple of the number of compute units of the device and each
+ * work-group loops over blocks with a grid-sized stride.
+ */
+enum class elementwise_launch_mode
+{
+    full,
+    persistent
+};
+
+namespace detail
+{
+
+inline elementwise_launch_mode launch_mode_from_env()
+{
+    const char *v = std::getenv("DPCTL_TENSOR_ELEMENTWISE_LAUNCH");
+    if (v != nullptr && std::strcmp(v, "persistent") == 0) {
+        return elementwise_launch_mode::persistent;
+    }
+    return elementwise_launch_mode::full;
+}
+
+inline std::atomic<elementwise_launch_mode> &launch_mode_setting()
+{
+    static std::atomic<elementwise_launch_mode> mode{launch_mode_from_env()};
+    return mode;
+}
+
+struct launch_device_info
+{
+    bool is_cpu;
+    size_t n_compute_units;
+};
+
+/*! @brief Properties of device relevant for the choice of launch mode,
+ * cached for the most recently used device of the calling thread */
+inline launch_device_info get_launch_device_info(const sycl::device &d)
+{
+    thread_local std::optional<sycl::device> cached_dev{};
+    thread_local launch_device_info cached_info{false, 1};
+
+    if (!cached_dev.has_value() || cached_dev.value() != d) {
+        const size_t n_cu = d.get_info<sycl::info::device::max_compute_units>();
+        cached_info = launch_device_info{d.is_cpu(), std::max<size_t>(n_cu, 1)};
+        cached_dev = d;
+    }
+    return cached_info;
+}
+
+} // namespace detail
+
+/*! @brief Get launch mode of kernels for contiguous elementwise operations.
+ *
+ * Default value is read from environment variable
+ * `DPCTL_TENSOR_ELEMENTWISE_LAUNCH`, which may be set to "full", the
+ * default, or "persistent".
+ */
+inline elementwise_launch_mode get_elementwise_launch_mode()
+{
+    return detail::launch_mode_setting().load(std::memory_order_relaxed);
+}
+
+/*! @brief Set launch mode of kernels for contiguous elementwise operations,
+ * e.g. to compare modes in benchmarks */
+inline void set_elementwise_launch_mode(elementwise_launch_mode mode)
+{
+    detail::launch_mode_setting().store(mode, std::memory_order_relaxed);
+}
+
+/*! @brief Number of work-groups to launch to process `nelems` contiguous
+ * elements by work-groups of `lws` work-items, each processing
+ * `elems_per_wi` elements per block.
+ *
+ * Kernels launched with fewer work-groups than needed to cover all elements
+ * are expected to loop over blocks with stride equal to the number of
+ * work-groups.
+ */
+template <size_t groups_per_cu = 4>
+size_t elementwise_n_groups(const sycl::queue &q,
+                            size_t nelems,
+                            size_t lws,
+                            size_t elems_per_wi)
+{
+    const size_t elems_per_group = lws * elems_per_wi;
+    const size_t n_groups_full =
+        (nelems + elems_per_group - 1) / elems_per_group;
+
+    if (get_elementwise_launch_mode() == elementwise_launch_mode::full) {
+        return n_groups_full;
+    }
+
+    const auto &info = detail::get_launch_device_info(q.get_device());
+
+    // small arrays fit in a single wave of work-groups, in which case
+    // both launch modes coincide
+    const size_t n_groups_persistent = groups_per_cu * info.n_compute_units;
+    return std::min(n_groups_full, n_groups_persistent);
+}
+
+namespace detail
+{
+
+inline size_t host_fastpath_max_elems_from_env()
+{
+    const char *v = std::getenv("DPCTL_TENSOR_HOST_FASTPATH_MAX_ELEMS");
+    if (v != nullptr) {
+        char *end = nullptr;
+        const unsigned long long n = std::strtoull(v, &end, 10);
+        if (end != v && *end == '\0') {
+            return static_cast<size_t>(n);
+        }
+    }
+    // disabled unless requested, until the cross-over point with kernel
+    // submission is measured
+    return 0;
+}
+
+inline std::atomic<size_t> &host_fastpath_max_elems_setting()
+{
+    static std::atomic<size_t> n{host_fastpath_max_elems_from_env()};
+    return n;
+}
+
+} // namespace detail
+
+/*! @brief Get the largest number of elements of arrays in USM-host or
+ * USM-shared memory which operations evaluate on the calling thread.
+ *
+ * Default value is read from environment variable
+ * `DPCTL_TENSOR_HOST_FASTPATH_MAX_ELEMS`, zero, which is the default,
+ * disables host evaluation.
+ */
+inline size_t get_host_fastpath_max_elems()
+{
+    return detail::host_fastpath_max_elems_setting().load(
+        std::memory_order_relaxed);
+}
+
+/*! @brief Whether operations may be evaluated on the calling thread, in
+ * which case entry points check if events they return have completed */
+inline bool host_fastpath_enabled()
+{
+    return get_host_fastpath_max_elems() > 0;
+}
+
+/*! @brief Set the largest number of elements of arrays operations evaluate
+ * on the calling thread, e.g. to compare both paths in benchmarks */
+inline void set_host_fastpath_max_elems(size_t n)
+{
+    detail::host_fastpath_max_elems_setting().store(n,
+                                                    std::memory_order_relaxed);
+}
+
+/*! @brief Whether an operation on `nelems` elements of USM allocations
+ * `ptrs` is to be evaluated on the calling thread instead of submitted to
+ * `q`.
+ *
+ * This is the case for few elements in USM-host or USM-shared memory, when
+ * no commands submitted to an in-order queue `q` are pending. Submission of
+ * a kernel then costs far more than evaluation itself. If so, waits for
+ * `depends` before returning.
+ */
+inline bool use_host_fastpath(const sycl::queue &q,
+                              size_t nelems,
+                              const void *const *ptrs,
+                              size_t n_ptrs,
+                              const std::vector<sycl::event> &depends)
+{
+    if (nelems > get_host_fastpath_max_elems()) {
+        return false;
+    }
+    const sycl::context &ctx = q.get_context();
+    for (size_t i = 0; i < n_ptrs; ++i) {
+        const sycl::usm::alloc t = sycl::get_pointer_type(ptrs[i], ctx);
+        if (t != sycl::usm::alloc::host && t != sycl::usm::alloc::shared) {
+            return false;
+        }
+    }
+    // commands submitted to in-order queue are implicit dependencies
+    if (q.is_in_order() && !q.ext_oneapi_empty()) {
+        return false;
+    }
+    sycl::event::wait(depends);
+    return true;
+}
+
+inline bool use_host_fastpath(const sycl::queue &q,
+                              size_t nelems,
+                              std::initializer_list<const void *> ptrs,
+                              const std::vector<sycl::event> &depends)
+{
+    return use_host_fastpath(q, nelems, ptrs.begin(), ptrs.size(), depends);
+}
+
 } // namespace sycl_utils
 } // namespace tensor
 } // namespace dpctl
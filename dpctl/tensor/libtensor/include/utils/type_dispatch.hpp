@@ -27,6 +27,7 @@
 #include "dpctl4pybind11.hpp"
 #include <CL/sycl.hpp>
 #include <complex>
+#include <mutex>
 
 namespace dpctl
 {
@@ -380,6 +381,16 @@ struct NotDefinedEntry : std::true_type
     static constexpr bool is_defined = false;
 };
 
+/*! @brief Calls `populate_fn`, which populates dispatch tables or vectors of
+ * a function family, exactly once. Called on each use of the function
+ * family, so that tables are populated on first use rather than on import
+ * of the extension. Thread-safe. */
+template <void (*populate_fn)(void)> void populate_once(void)
+{
+    static std::once_flag populated;
+    std::call_once(populated, populate_fn);
+}
+
 } // namespace type_dispatch
 
 } // namespace tensor
@@ -35,6 +35,7 @@
 #include "simplify_iteration_space.hpp"
 #include "utils/memory_overlap.hpp"
 #include "utils/offset_utils.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 
 namespace dpctl
@@ -44,6 +45,8 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+
 // Computation of positions of masked elements
 
 namespace td_ns = dpctl::tensor::type_dispatch;
@@ -102,6 +105,8 @@ size_t py_mask_positions(dpctl::tensor::usm_ndarray mask,
                          sycl::queue exec_q,
                          std::vector<sycl::event> const &depends)
 {
+    td_ns::populate_once<populate_mask_positions_dispatch_vectors>();
+
     // cumsum is 1D
     if (cumsum.get_ndim() != 1) {
         throw py::value_error("Result array must be one-dimensional.");
@@ -190,7 +195,7 @@ size_t py_mask_positions(dpctl::tensor::usm_ndarray mask,
     if (2 * static_cast<size_t>(nd) != std::get<1>(ptr_size_event_tuple)) {
         copy_shape_ev.wait();
         sycl::event::wait(host_task_events);
-        sycl::free(shape_strides, exec_q);
+        sycl_free_noexcept(shape_strides, exec_q);
         throw std::runtime_error("Unexpected error");
     }
 
@@ -204,7 +209,7 @@ size_t py_mask_positions(dpctl::tensor::usm_ndarray mask,
                                   shape_strides, cumsum_data, dependent_events);
 
     sycl::event::wait(host_task_events);
-    sycl::free(shape_strides, exec_q);
+    sycl_free_noexcept(shape_strides, exec_q);
 
     return total_set;
 }
@@ -238,6 +243,8 @@ size_t py_cumsum_1d(dpctl::tensor::usm_ndarray src,
                     sycl::queue exec_q,
                     std::vector<sycl::event> const &depends)
 {
+    td_ns::populate_once<populate_cumsum_1d_dispatch_vectors>();
+
     // cumsum is 1D
     if (cumsum.get_ndim() != 1) {
         throw py::value_error("cumsum array must be one-dimensional.");
@@ -328,7 +335,7 @@ size_t py_cumsum_1d(dpctl::tensor::usm_ndarray src,
     if (2 * static_cast<size_t>(nd) != std::get<1>(ptr_size_event_tuple)) {
         copy_shape_ev.wait();
         sycl::event::wait(host_task_events);
-        sycl::free(shape_strides, exec_q);
+        sycl_free_noexcept(shape_strides, exec_q);
         throw std::runtime_error("Unexpected error");
     }
 
@@ -342,7 +349,7 @@ size_t py_cumsum_1d(dpctl::tensor::usm_ndarray src,
                               cumsum_data, dependent_events);
 
     sycl::event::wait(host_task_events);
-    sycl::free(shape_strides, exec_q);
+    sycl_free_noexcept(shape_strides, exec_q);
 
     return total;
 }
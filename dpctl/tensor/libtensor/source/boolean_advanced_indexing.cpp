@@ -20,13 +20,16 @@
 ///
 /// \file
 /// This file defines implementation functions of dpctl.tensor.place and
-/// dpctl.tensor.extract, dpctl.tensor.nonzero
+/// dpctl.tensor.extract, dpctl.tensor.nonzero, and of masked assignment
+/// used by usm_ndarray.__setitem__ with a boolean key
 //===----------------------------------------------------------------------===//
 
 #include "dpctl4pybind11.hpp"
 #include <CL/sycl.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <limits>
+#include <pybind11/complex.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <utility>
@@ -37,6 +40,7 @@
 #include "simplify_iteration_space.hpp"
 #include "utils/memory_overlap.hpp"
 #include "utils/offset_utils.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 
 namespace dpctl
@@ -46,6 +50,8 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+
 // Masked extraction
 
 namespace td_ns = dpctl::tensor::type_dispatch;
@@ -118,6 +124,8 @@ py_extract(dpctl::tensor::usm_ndarray src,
            sycl::queue exec_q,
            std::vector<sycl::event> const &depends)
 {
+    td_ns::populate_once<populate_masked_extract_dispatch_vectors>();
+
     int src_nd = src.get_ndim();
     if ((axis_start < 0 || axis_end > src_nd || axis_start >= axis_end)) {
         throw py::value_error("Specified axes_start and axes_end are invalid.");
@@ -238,6 +246,8 @@ py_extract(dpctl::tensor::usm_ndarray src,
         assert(dst_shape_vec.size() == 1);
         assert(dst_strides_vec.size() == 1);
 
+        py::gil_scoped_release release;
+
         using dpctl::tensor::offset_utils::device_allocate_and_pack;
         const auto &ptr_size_event_tuple1 =
             device_allocate_and_pack<py::ssize_t>(
@@ -266,7 +276,7 @@ py_extract(dpctl::tensor::usm_ndarray src,
                 cgh.depends_on(extract_ev);
                 auto ctx = exec_q.get_context();
                 cgh.host_task([ctx, packed_src_shape_strides] {
-                    sycl::free(packed_src_shape_strides, ctx);
+                    sycl_free_noexcept(packed_src_shape_strides, ctx);
                 });
             });
         host_task_events.push_back(cleanup_tmp_allocations_ev);
@@ -328,6 +338,8 @@ py_extract(dpctl::tensor::usm_ndarray src,
         assert(masked_dst_shape.size() == 1);
         assert(masked_dst_strides.size() == 1);
 
+        py::gil_scoped_release release;
+
         using dpctl::tensor::offset_utils::device_allocate_and_pack;
         const auto &ptr_size_event_tuple1 =
             device_allocate_and_pack<py::ssize_t>(
@@ -368,7 +380,7 @@ py_extract(dpctl::tensor::usm_ndarray src,
                 cgh.depends_on(extract_ev);
                 auto ctx = exec_q.get_context();
                 cgh.host_task([ctx, packed_shapes_strides] {
-                    sycl::free(packed_shapes_strides, ctx);
+                    sycl_free_noexcept(packed_shapes_strides, ctx);
                 });
             });
         host_task_events.push_back(cleanup_tmp_allocations_ev);
@@ -452,6 +464,8 @@ py_place(dpctl::tensor::usm_ndarray dst,
          sycl::queue exec_q,
          std::vector<sycl::event> const &depends)
 {
+    td_ns::populate_once<populate_masked_place_dispatch_vectors>();
+
     int dst_nd = dst.get_ndim();
     if ((axis_start < 0 || axis_end > dst_nd || axis_start >= axis_end)) {
         throw py::value_error("Specified axes_start and axes_end are invalid.");
@@ -568,6 +582,8 @@ py_place(dpctl::tensor::usm_ndarray dst,
         assert(rhs_shape_vec.size() == 1);
         assert(rhs_strides_vec.size() == 1);
 
+        py::gil_scoped_release release;
+
         using dpctl::tensor::offset_utils::device_allocate_and_pack;
         const auto &ptr_size_event_tuple1 =
             device_allocate_and_pack<py::ssize_t>(
@@ -596,7 +612,7 @@ py_place(dpctl::tensor::usm_ndarray dst,
                 cgh.depends_on(place_ev);
                 auto ctx = exec_q.get_context();
                 cgh.host_task([ctx, packed_dst_shape_strides] {
-                    sycl::free(packed_dst_shape_strides, ctx);
+                    sycl_free_noexcept(packed_dst_shape_strides, ctx);
                 });
             });
         host_task_events.push_back(cleanup_tmp_allocations_ev);
@@ -657,6 +673,8 @@ py_place(dpctl::tensor::usm_ndarray dst,
         assert(masked_rhs_shape.size() == 1);
         assert(masked_rhs_strides.size() == 1);
 
+        py::gil_scoped_release release;
+
         using dpctl::tensor::offset_utils::device_allocate_and_pack;
         const auto &ptr_size_event_tuple1 =
             device_allocate_and_pack<py::ssize_t>(
@@ -695,7 +713,7 @@ py_place(dpctl::tensor::usm_ndarray dst,
                 cgh.depends_on(place_ev);
                 auto ctx = exec_q.get_context();
                 cgh.host_task([ctx, packed_shapes_strides] {
-                    sycl::free(packed_shapes_strides, ctx);
+                    sycl_free_noexcept(packed_shapes_strides, ctx);
                 });
             });
         host_task_events.push_back(cleanup_tmp_allocations_ev);
@@ -709,6 +727,348 @@ py_place(dpctl::tensor::usm_ndarray dst,
     return std::make_pair(py_obj_management_host_task_ev, place_ev);
 }
 
+// Masked assignment
+
+using dpctl::tensor::kernels::indexing::masked_assign_contig_impl_fn_ptr_t;
+using dpctl::tensor::kernels::indexing::masked_assign_strided_impl_fn_ptr_t;
+using dpctl::tensor::kernels::indexing::masked_fill_contig_impl_fn_ptr_t;
+using dpctl::tensor::kernels::indexing::masked_fill_strided_impl_fn_ptr_t;
+
+static masked_assign_contig_impl_fn_ptr_t
+    masked_assign_contig_dispatch_vector[td_ns::num_types];
+static masked_assign_strided_impl_fn_ptr_t
+    masked_assign_strided_dispatch_vector[td_ns::num_types];
+static masked_fill_contig_impl_fn_ptr_t
+    masked_fill_contig_dispatch_vector[td_ns::num_types];
+static masked_fill_strided_impl_fn_ptr_t
+    masked_fill_strided_dispatch_vector[td_ns::num_types];
+
+void populate_masked_assign_dispatch_vectors(void)
+{
+    using dpctl::tensor::kernels::indexing::MaskAssignContigFactory;
+    td_ns::DispatchVectorBuilder<masked_assign_contig_impl_fn_ptr_t,
+                                 MaskAssignContigFactory, td_ns::num_types>
+        dvb1;
+    dvb1.populate_dispatch_vector(masked_assign_contig_dispatch_vector);
+
+    using dpctl::tensor::kernels::indexing::MaskAssignStridedFactory;
+    td_ns::DispatchVectorBuilder<masked_assign_strided_impl_fn_ptr_t,
+                                 MaskAssignStridedFactory, td_ns::num_types>
+        dvb2;
+    dvb2.populate_dispatch_vector(masked_assign_strided_dispatch_vector);
+
+    using dpctl::tensor::kernels::indexing::MaskFillContigFactory;
+    td_ns::DispatchVectorBuilder<masked_fill_contig_impl_fn_ptr_t,
+                                 MaskFillContigFactory, td_ns::num_types>
+        dvb3;
+    dvb3.populate_dispatch_vector(masked_fill_contig_dispatch_vector);
+
+    using dpctl::tensor::kernels::indexing::MaskFillStridedFactory;
+    td_ns::DispatchVectorBuilder<masked_fill_strided_impl_fn_ptr_t,
+                                 MaskFillStridedFactory, td_ns::num_types>
+        dvb4;
+    dvb4.populate_dispatch_vector(masked_fill_strided_dispatch_vector);
+}
+
+/*
+ * @brief Validates arguments of masked assignment, returns number of elements
+ * of the destination. Mask must have the shape of the destination.
+ */
+static size_t
+validate_masked_assign_args(dpctl::tensor::usm_ndarray dst,
+                            dpctl::tensor::usm_ndarray mask,
+                            sycl::queue exec_q)
+{
+    if (!dpctl::utils::queues_are_compatible(exec_q, {dst, mask})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    int nd = dst.get_ndim();
+    if (mask.get_ndim() != nd) {
+        throw py::value_error("Mask array must have the same number of "
+                              "dimensions as the destination array");
+    }
+
+    const py::ssize_t *dst_shape = dst.get_shape_raw();
+    const py::ssize_t *mask_shape = mask.get_shape_raw();
+
+    bool shapes_equal(true);
+    size_t nelems(1);
+    for (int i = 0; i < nd; ++i) {
+        const auto &sh_i = dst_shape[i];
+        nelems *= static_cast<size_t>(sh_i);
+        shapes_equal = shapes_equal && (mask_shape[i] == sh_i);
+    }
+
+    if (!shapes_equal) {
+        throw py::value_error("Inconsistent array dimensions");
+    }
+
+    constexpr int bool_typeid = static_cast<int>(td_ns::typenum_t::BOOL);
+    auto const &array_types = td_ns::usm_ndarray_types();
+    if (array_types.typenum_to_lookup_id(mask.get_typenum()) != bool_typeid) {
+        throw py::value_error("Mask array must have boolean data type");
+    }
+
+    if (nelems == 0) {
+        return nelems;
+    }
+
+    // ensure that dst is sufficiently ample
+    auto dst_offsets = dst.get_minmax_offsets();
+    // destination must be ample enough to accommodate all elements
+    {
+        size_t range =
+            static_cast<size_t>(dst_offsets.second - dst_offsets.first);
+        if (range + 1 < nelems) {
+            throw py::value_error(
+                "Memory addressed by the destination array can not "
+                "accommodate all the "
+                "array elements.");
+        }
+    }
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(dst, mask)) {
+        throw py::value_error("Destination array overlaps with inputs");
+    }
+
+    return nelems;
+}
+
+/*
+ * @brief Copy dst[i] = rhs[i] if mask[i], where mask and rhs have the shape
+ * of dst. No prefix sum of the mask is needed.
+ */
+std::pair<sycl::event, sycl::event>
+py_masked_assign(dpctl::tensor::usm_ndarray dst,
+                 dpctl::tensor::usm_ndarray mask,
+                 dpctl::tensor::usm_ndarray rhs,
+                 sycl::queue exec_q,
+                 std::vector<sycl::event> const &depends)
+{
+    td_ns::populate_once<populate_masked_assign_dispatch_vectors>();
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {rhs})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    int nd = dst.get_ndim();
+    if (rhs.get_ndim() != nd ||
+        !std::equal(dst.get_shape_raw(), dst.get_shape_raw() + nd,
+                    rhs.get_shape_raw()))
+    {
+        throw py::value_error("Inconsistent array dimensions");
+    }
+
+    size_t nelems = validate_masked_assign_args(dst, mask, exec_q);
+    if (nelems == 0) {
+        return std::make_pair(sycl::event{}, sycl::event{});
+    }
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(dst, rhs)) {
+        throw py::value_error("Destination array overlaps with inputs");
+    }
+
+    auto const &array_types = td_ns::usm_ndarray_types();
+    int dst_typeid = array_types.typenum_to_lookup_id(dst.get_typenum());
+    int rhs_typeid = array_types.typenum_to_lookup_id(rhs.get_typenum());
+
+    if (dst_typeid != rhs_typeid) {
+        throw py::value_error(
+            "Destination array must have the same elemental data types");
+    }
+
+    const char *mask_data = mask.get_data();
+    const char *rhs_data = rhs.get_data();
+    char *dst_data = dst.get_data();
+
+    bool all_c_contig = (dst.is_c_contiguous() && mask.is_c_contiguous() &&
+                         rhs.is_c_contiguous());
+    bool all_f_contig = (dst.is_f_contiguous() && mask.is_f_contiguous() &&
+                         rhs.is_f_contiguous());
+
+    if (all_c_contig || all_f_contig) {
+        auto contig_fn = masked_assign_contig_dispatch_vector[dst_typeid];
+
+        sycl::event assign_ev;
+        {
+            py::gil_scoped_release release;
+            assign_ev = contig_fn(exec_q, nelems, mask_data, rhs_data,
+                                  dst_data, depends);
+        }
+        sycl::event ht_ev = dpctl::utils::keep_args_alive(
+            exec_q, {dst, mask, rhs}, {assign_ev});
+
+        return std::make_pair(ht_ev, assign_ev);
+    }
+
+    auto const &mask_strides = mask.get_strides_vector();
+    auto const &rhs_strides = rhs.get_strides_vector();
+    auto const &dst_strides = dst.get_strides_vector();
+
+    using shT = std::vector<py::ssize_t>;
+    shT simplified_shape;
+    shT simplified_mask_strides;
+    shT simplified_rhs_strides;
+    shT simplified_dst_strides;
+    py::ssize_t mask_offset(0);
+    py::ssize_t rhs_offset(0);
+    py::ssize_t dst_offset(0);
+
+    const py::ssize_t *shape = dst.get_shape_raw();
+    dpctl::tensor::py_internal::simplify_iteration_space_3(
+        nd, shape, mask_strides, rhs_strides, dst_strides,
+        // outputs
+        simplified_shape, simplified_mask_strides, simplified_rhs_strides,
+        simplified_dst_strides, mask_offset, rhs_offset, dst_offset);
+
+    std::vector<sycl::event> host_task_events;
+    host_task_events.reserve(2);
+
+    sycl::event assign_ev;
+    {
+        py::gil_scoped_release release;
+
+        using dpctl::tensor::offset_utils::device_allocate_and_pack;
+        const auto &ptr_size_event_tuple =
+            device_allocate_and_pack<py::ssize_t>(
+                exec_q, host_task_events, simplified_shape,
+                simplified_mask_strides, simplified_rhs_strides,
+                simplified_dst_strides);
+        py::ssize_t *packed_shape_strides = std::get<0>(ptr_size_event_tuple);
+        if (packed_shape_strides == nullptr) {
+            throw std::runtime_error("Unable to allocate device memory");
+        }
+        sycl::event copy_shape_strides_ev = std::get<2>(ptr_size_event_tuple);
+
+        std::vector<sycl::event> all_deps;
+        all_deps.reserve(depends.size() + 1);
+        all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+        all_deps.push_back(copy_shape_strides_ev);
+
+        auto strided_fn = masked_assign_strided_dispatch_vector[dst_typeid];
+
+        assign_ev = strided_fn(
+            exec_q, nelems, nd, packed_shape_strides, mask_data, mask_offset,
+            rhs_data, rhs_offset, dst_data, dst_offset, all_deps);
+
+        sycl::event cleanup_tmp_allocations_ev =
+            exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(assign_ev);
+                auto ctx = exec_q.get_context();
+                cgh.host_task([ctx, packed_shape_strides] {
+                    sycl_free_noexcept(packed_shape_strides, ctx);
+                });
+            });
+        host_task_events.push_back(cleanup_tmp_allocations_ev);
+    }
+
+    sycl::event ht_ev = dpctl::utils::keep_args_alive(
+        exec_q, {dst, mask, rhs}, host_task_events);
+
+    return std::make_pair(ht_ev, assign_ev);
+}
+
+/*
+ * @brief Set dst[i] = value if mask[i], where mask has the shape of dst.
+ * Python scalar `value` is converted to the data type of dst on the host.
+ */
+std::pair<sycl::event, sycl::event>
+py_masked_fill(dpctl::tensor::usm_ndarray dst,
+               dpctl::tensor::usm_ndarray mask,
+               py::object value,
+               sycl::queue exec_q,
+               std::vector<sycl::event> const &depends)
+{
+    td_ns::populate_once<populate_masked_assign_dispatch_vectors>();
+
+    size_t nelems = validate_masked_assign_args(dst, mask, exec_q);
+    if (nelems == 0) {
+        return std::make_pair(sycl::event{}, sycl::event{});
+    }
+
+    auto const &array_types = td_ns::usm_ndarray_types();
+    int dst_typeid = array_types.typenum_to_lookup_id(dst.get_typenum());
+
+    const char *mask_data = mask.get_data();
+    char *dst_data = dst.get_data();
+
+    bool both_c_contig = (dst.is_c_contiguous() && mask.is_c_contiguous());
+    bool both_f_contig = (dst.is_f_contiguous() && mask.is_f_contiguous());
+
+    if (both_c_contig || both_f_contig) {
+        auto contig_fn = masked_fill_contig_dispatch_vector[dst_typeid];
+
+        sycl::event fill_ev =
+            contig_fn(exec_q, nelems, mask_data, value, dst_data, depends);
+        sycl::event ht_ev =
+            dpctl::utils::keep_args_alive(exec_q, {dst, mask}, {fill_ev});
+
+        return std::make_pair(ht_ev, fill_ev);
+    }
+
+    int nd = dst.get_ndim();
+    auto const &mask_strides = mask.get_strides_vector();
+    auto const &dst_strides = dst.get_strides_vector();
+
+    using shT = std::vector<py::ssize_t>;
+    shT simplified_shape;
+    shT simplified_mask_strides;
+    shT simplified_dst_strides;
+    py::ssize_t mask_offset(0);
+    py::ssize_t dst_offset(0);
+
+    const py::ssize_t *shape = dst.get_shape_raw();
+    dpctl::tensor::py_internal::simplify_iteration_space(
+        nd, shape, mask_strides, dst_strides,
+        // outputs
+        simplified_shape, simplified_mask_strides, simplified_dst_strides,
+        mask_offset, dst_offset);
+
+    std::vector<sycl::event> host_task_events;
+    host_task_events.reserve(2);
+
+    using dpctl::tensor::offset_utils::device_allocate_and_pack;
+    const auto &ptr_size_event_tuple = device_allocate_and_pack<py::ssize_t>(
+        exec_q, host_task_events, simplified_shape, simplified_mask_strides,
+        simplified_dst_strides);
+    py::ssize_t *packed_shape_strides = std::get<0>(ptr_size_event_tuple);
+    if (packed_shape_strides == nullptr) {
+        throw std::runtime_error("Unable to allocate device memory");
+    }
+    sycl::event copy_shape_strides_ev = std::get<2>(ptr_size_event_tuple);
+
+    std::vector<sycl::event> all_deps;
+    all_deps.reserve(depends.size() + 1);
+    all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+    all_deps.push_back(copy_shape_strides_ev);
+
+    auto strided_fn = masked_fill_strided_dispatch_vector[dst_typeid];
+
+    sycl::event fill_ev =
+        strided_fn(exec_q, nelems, nd, packed_shape_strides, mask_data,
+                   mask_offset, value, dst_data, dst_offset, all_deps);
+
+    sycl::event cleanup_tmp_allocations_ev =
+        exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(fill_ev);
+            auto ctx = exec_q.get_context();
+            cgh.host_task([ctx, packed_shape_strides] {
+                sycl_free_noexcept(packed_shape_strides, ctx);
+            });
+        });
+    host_task_events.push_back(cleanup_tmp_allocations_ev);
+
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, {dst, mask}, host_task_events);
+
+    return std::make_pair(ht_ev, fill_ev);
+}
+
 // Non-zero
 
 std::pair<sycl::event, sycl::event>
@@ -800,50 +1160,60 @@ py_nonzero(dpctl::tensor::usm_ndarray
         }
     }
 
+    const char *cumsum_data = cumsum.get_data();
+    char *indexes_data = indexes.get_data();
+
     std::vector<sycl::event> host_task_events;
     host_task_events.reserve(2);
 
-    using dpctl::tensor::offset_utils::device_allocate_and_pack;
-    const auto &mask_shape_copying_tuple =
-        device_allocate_and_pack<py::ssize_t>(exec_q, host_task_events,
-                                              mask_shape);
-    py::ssize_t *src_shape_device_ptr = std::get<0>(mask_shape_copying_tuple);
-    if (src_shape_device_ptr == nullptr) {
-        sycl::event::wait(host_task_events);
-        throw std::runtime_error("Device allocation failed");
-    }
-    sycl::event copy_ev = std::get<2>(mask_shape_copying_tuple);
+    sycl::event non_zero_indexes_ev;
+    {
+        py::gil_scoped_release release;
 
-    std::vector<sycl::event> all_deps;
-    all_deps.reserve(depends.size() + 1);
+        using dpctl::tensor::offset_utils::device_allocate_and_pack;
+        const auto &mask_shape_copying_tuple =
+            device_allocate_and_pack<py::ssize_t>(exec_q, host_task_events,
+                                                  mask_shape);
+        py::ssize_t *src_shape_device_ptr =
+            std::get<0>(mask_shape_copying_tuple);
+        if (src_shape_device_ptr == nullptr) {
+            sycl::event::wait(host_task_events);
+            throw std::runtime_error("Device allocation failed");
+        }
+        sycl::event copy_ev = std::get<2>(mask_shape_copying_tuple);
 
-    all_deps.insert(all_deps.end(), depends.begin(), depends.end());
-    all_deps.push_back(copy_ev);
-
-    using dpctl::tensor::kernels::indexing::non_zero_indexes_fn_ptr_t;
-    using dpctl::tensor::kernels::indexing::non_zero_indexes_impl;
-
-    int fn_index = ((cumsum_typeid == int64_typeid) ? 1 : 0) +
-                   ((indexes_typeid == int64_typeid) ? 2 : 0);
-    std::array<non_zero_indexes_fn_ptr_t, 4> fn_impls = {
-        non_zero_indexes_impl<std::int32_t, std::int32_t>,
-        non_zero_indexes_impl<std::int64_t, std::int32_t>,
-        non_zero_indexes_impl<std::int32_t, std::int64_t>,
-        non_zero_indexes_impl<std::int64_t, std::int64_t>};
-    auto fn = fn_impls[fn_index];
-
-    sycl::event non_zero_indexes_ev =
-        fn(exec_q, cumsum_sz, nz_elems, ndim, cumsum.get_data(),
-           indexes.get_data(), src_shape_device_ptr, all_deps);
-
-    sycl::event temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(non_zero_indexes_ev);
-        auto ctx = exec_q.get_context();
-        cgh.host_task([ctx, src_shape_device_ptr] {
-            sycl::free(src_shape_device_ptr, ctx);
-        });
-    });
-    host_task_events.push_back(temporaries_cleanup_ev);
+        std::vector<sycl::event> all_deps;
+        all_deps.reserve(depends.size() + 1);
+
+        all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+        all_deps.push_back(copy_ev);
+
+        using dpctl::tensor::kernels::indexing::non_zero_indexes_fn_ptr_t;
+        using dpctl::tensor::kernels::indexing::non_zero_indexes_impl;
+
+        int fn_index = ((cumsum_typeid == int64_typeid) ? 1 : 0) +
+                       ((indexes_typeid == int64_typeid) ? 2 : 0);
+        std::array<non_zero_indexes_fn_ptr_t, 4> fn_impls = {
+            non_zero_indexes_impl<std::int32_t, std::int32_t>,
+            non_zero_indexes_impl<std::int64_t, std::int32_t>,
+            non_zero_indexes_impl<std::int32_t, std::int64_t>,
+            non_zero_indexes_impl<std::int64_t, std::int64_t>};
+        auto fn = fn_impls[fn_index];
+
+        non_zero_indexes_ev =
+            fn(exec_q, cumsum_sz, nz_elems, ndim, cumsum_data, indexes_data,
+               src_shape_device_ptr, all_deps);
+
+        sycl::event temporaries_cleanup_ev =
+            exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(non_zero_indexes_ev);
+                auto ctx = exec_q.get_context();
+                cgh.host_task([ctx, src_shape_device_ptr] {
+                    sycl_free_noexcept(src_shape_device_ptr, ctx);
+                });
+            });
+        host_task_events.push_back(temporaries_cleanup_ev);
+    }
 
     sycl::event py_obj_management_host_task_ev = dpctl::utils::keep_args_alive(
         exec_q, {cumsum, indexes}, host_task_events);
@@ -60,6 +60,22 @@ py_place(dpctl::tensor::usm_ndarray dst,
 
 extern void populate_masked_place_dispatch_vectors(void);
 
+extern std::pair<sycl::event, sycl::event>
+py_masked_assign(dpctl::tensor::usm_ndarray dst,
+                 dpctl::tensor::usm_ndarray mask,
+                 dpctl::tensor::usm_ndarray rhs,
+                 sycl::queue exec_q,
+                 std::vector<sycl::event> const &depends = {});
+
+extern std::pair<sycl::event, sycl::event>
+py_masked_fill(dpctl::tensor::usm_ndarray dst,
+               dpctl::tensor::usm_ndarray mask,
+               py::object value,
+               sycl::queue exec_q,
+               std::vector<sycl::event> const &depends = {});
+
+extern void populate_masked_assign_dispatch_vectors(void);
+
 extern std::pair<sycl::event, sycl::event> py_nonzero(
     dpctl::tensor::usm_ndarray cumsum,  // int32 input array, 1D, C-contiguous
     dpctl::tensor::usm_ndarray indexes, // int32 2D output array, C-contiguous
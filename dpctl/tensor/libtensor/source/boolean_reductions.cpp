@@ -123,13 +123,13 @@ void init_boolean_reduction_functions(py::module_ m)
 
     // ALL
     {
-        impl::populate_all_dispatch_vectors();
         using impl::all_reduction_contig_dispatch_vector;
         using impl::all_reduction_strided_dispatch_vector;
 
         auto all_pyapi = [&](arrayT src, int trailing_dims_to_reduce,
                              arrayT dst, sycl::queue exec_q,
                              const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_all_dispatch_vectors>();
             return py_boolean_reduction(src, trailing_dims_to_reduce, dst,
                                         exec_q, depends,
                                         all_reduction_contig_dispatch_vector,
@@ -142,13 +142,13 @@ void init_boolean_reduction_functions(py::module_ m)
 
     // ANY
     {
-        impl::populate_any_dispatch_vectors();
         using impl::any_reduction_contig_dispatch_vector;
         using impl::any_reduction_strided_dispatch_vector;
 
         auto any_pyapi = [&](arrayT src, int trailing_dims_to_reduce,
                              arrayT dst, sycl::queue exec_q,
                              const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_any_dispatch_vectors>();
             return py_boolean_reduction(src, trailing_dims_to_reduce, dst,
                                         exec_q, depends,
                                         any_reduction_contig_dispatch_vector,
@@ -36,6 +36,7 @@
 #include "simplify_iteration_space.hpp"
 #include "utils/memory_overlap.hpp"
 #include "utils/offset_utils.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 
 namespace dpctl
@@ -45,6 +46,8 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+
 namespace td_ns = dpctl::tensor::type_dispatch;
 
 template <typename contig_dispatchT, typename strided_dispatchT>
@@ -139,8 +142,12 @@ py_boolean_reduction(dpctl::tensor::usm_ndarray src,
         auto fn = contig_dispatch_vector[src_typeid];
         constexpr py::ssize_t zero_offset = 0;
 
-        auto red_ev = fn(exec_q, dst_nelems, red_nelems, src_data, dst_data,
-                         zero_offset, zero_offset, zero_offset, depends);
+        sycl::event red_ev;
+        {
+            py::gil_scoped_release release;
+            red_ev = fn(exec_q, dst_nelems, red_nelems, src_data, dst_data,
+                        zero_offset, zero_offset, zero_offset, depends);
+        }
 
         sycl::event keep_args_event =
             dpctl::utils::keep_args_alive(exec_q, {src, dst}, {red_ev});
@@ -206,9 +213,13 @@ py_boolean_reduction(dpctl::tensor::usm_ndarray src,
         auto fn = contig_dispatch_vector[src_typeid];
         size_t iter_nelems = dst_nelems;
 
-        sycl::event red_ev =
-            fn(exec_q, iter_nelems, red_nelems, src.get_data(), dst.get_data(),
-               iter_src_offset, iter_dst_offset, red_src_offset, depends);
+        sycl::event red_ev;
+        {
+            py::gil_scoped_release release;
+            red_ev = fn(exec_q, iter_nelems, red_nelems, src_data, dst_data,
+                        iter_src_offset, iter_dst_offset, red_src_offset,
+                        depends);
+        }
 
         sycl::event keep_args_event =
             dpctl::utils::keep_args_alive(exec_q, {src, dst}, {red_ev});
@@ -221,42 +232,47 @@ py_boolean_reduction(dpctl::tensor::usm_ndarray src,
     // using a single host_task for packing here
     // prevents crashes on CPU
     std::vector<sycl::event> host_task_events{};
-    const auto &iter_red_metadata_packing_triple_ =
-        dpctl::tensor::offset_utils::device_allocate_and_pack<py::ssize_t>(
-            exec_q, host_task_events, simplified_iter_shape,
-            simplified_iter_src_strides, simplified_iter_dst_strides,
-            simplified_red_shape, simplified_red_src_strides);
-    py::ssize_t *packed_shapes_and_strides =
-        std::get<0>(iter_red_metadata_packing_triple_);
-    if (packed_shapes_and_strides == nullptr) {
-        throw std::runtime_error("Unable to allocate memory on device");
-    }
-    const auto &copy_metadata_ev =
-        std::get<2>(iter_red_metadata_packing_triple_);
-
-    py::ssize_t *iter_shape_and_strides = packed_shapes_and_strides;
-    py::ssize_t *red_shape_stride =
-        packed_shapes_and_strides + 3 * simplified_iter_shape.size();
-
-    std::vector<sycl::event> all_deps;
-    all_deps.reserve(depends.size() + 1);
-    all_deps.resize(depends.size());
-    std::copy(depends.begin(), depends.end(), all_deps.begin());
-    all_deps.push_back(copy_metadata_ev);
-
-    auto red_ev =
-        fn(exec_q, dst_nelems, red_nelems, src_data, dst_data, iter_nd,
-           iter_shape_and_strides, iter_src_offset, iter_dst_offset,
-           simplified_red_nd, red_shape_stride, red_src_offset, all_deps);
-
-    sycl::event temp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(red_ev);
-        auto ctx = exec_q.get_context();
-        cgh.host_task([ctx, packed_shapes_and_strides] {
-            sycl::free(packed_shapes_and_strides, ctx);
+    sycl::event red_ev;
+    {
+        py::gil_scoped_release release;
+
+        const auto &iter_red_metadata_packing_triple_ =
+            dpctl::tensor::offset_utils::device_allocate_and_pack<py::ssize_t>(
+                exec_q, host_task_events, simplified_iter_shape,
+                simplified_iter_src_strides, simplified_iter_dst_strides,
+                simplified_red_shape, simplified_red_src_strides);
+        py::ssize_t *packed_shapes_and_strides =
+            std::get<0>(iter_red_metadata_packing_triple_);
+        if (packed_shapes_and_strides == nullptr) {
+            throw std::runtime_error("Unable to allocate memory on device");
+        }
+        const auto &copy_metadata_ev =
+            std::get<2>(iter_red_metadata_packing_triple_);
+
+        py::ssize_t *iter_shape_and_strides = packed_shapes_and_strides;
+        py::ssize_t *red_shape_stride =
+            packed_shapes_and_strides + 3 * simplified_iter_shape.size();
+
+        std::vector<sycl::event> all_deps;
+        all_deps.reserve(depends.size() + 1);
+        all_deps.resize(depends.size());
+        std::copy(depends.begin(), depends.end(), all_deps.begin());
+        all_deps.push_back(copy_metadata_ev);
+
+        red_ev =
+            fn(exec_q, dst_nelems, red_nelems, src_data, dst_data, iter_nd,
+               iter_shape_and_strides, iter_src_offset, iter_dst_offset,
+               simplified_red_nd, red_shape_stride, red_src_offset, all_deps);
+
+        sycl::event temp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(red_ev);
+            auto ctx = exec_q.get_context();
+            cgh.host_task([ctx, packed_shapes_and_strides] {
+                sycl_free_noexcept(packed_shapes_and_strides, ctx);
+            });
         });
-    });
-    host_task_events.push_back(temp_cleanup_ev);
+        host_task_events.push_back(temp_cleanup_ev);
+    }
 
     sycl::event keep_args_event =
         dpctl::utils::keep_args_alive(exec_q, {src, dst}, host_task_events);
@@ -37,6 +37,7 @@
 #include "dpctl4pybind11.hpp"
 #include "kernels/copy_and_cast.hpp"
 #include "utils/memory_overlap.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 #include "utils/type_utils.hpp"
 
@@ -49,6 +50,8 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+
 namespace td_ns = dpctl::tensor::type_dispatch;
 
 using dpctl::tensor::kernels::copy_and_cast::copy_and_cast_1d_fn_ptr_t;
@@ -66,12 +69,16 @@ namespace py = pybind11;
 
 using dpctl::utils::keep_args_alive;
 
+void init_copy_and_cast_usm_to_usm_dispatch_tables(void);
+
 std::pair<sycl::event, sycl::event>
 copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
                                   dpctl::tensor::usm_ndarray dst,
                                   sycl::queue exec_q,
                                   const std::vector<sycl::event> &depends = {})
 {
+    td_ns::populate_once<init_copy_and_cast_usm_to_usm_dispatch_tables>();
+
     // array dimensions must be the same
     int src_nd = src.get_ndim();
     int dst_nd = dst.get_ndim();
@@ -152,6 +159,7 @@ copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
 
             int src_elem_size = src.get_elemsize();
 
+            py::gil_scoped_release release;
             copy_ev = exec_q.memcpy(static_cast<void *>(dst_data),
                                     static_cast<const void *>(src_data),
                                     src_nelems * src_elem_size, depends);
@@ -159,6 +167,8 @@ copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
         else {
             auto contig_fn =
                 copy_and_cast_contig_dispatch_table[dst_type_id][src_type_id];
+
+            py::gil_scoped_release release;
             copy_ev =
                 contig_fn(exec_q, src_nelems, src_data, dst_data, depends);
         }
@@ -202,12 +212,16 @@ copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
                 auto contig_fn =
                     copy_and_cast_contig_dispatch_table[dst_type_id]
                                                        [src_type_id];
-                sycl::event copy_and_cast_1d_event =
+
+                py::gil_scoped_release release;
+                copy_and_cast_1d_event =
                     contig_fn(exec_q, src_nelems, src_data, dst_data, depends);
             }
             else {
                 auto fn =
                     copy_and_cast_1d_dispatch_table[dst_type_id][src_type_id];
+
+                py::gil_scoped_release release;
                 copy_and_cast_1d_event =
                     fn(exec_q, src_nelems, shape_arr, src_strides_arr,
                        dst_strides_arr, src_data, src_offset, dst_data,
@@ -225,9 +239,14 @@ copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
 
             auto fn = copy_and_cast_1d_dispatch_table[dst_type_id][src_type_id];
 
-            sycl::event copy_and_cast_0d_event = fn(
-                exec_q, src_nelems, shape_arr, src_strides_arr, dst_strides_arr,
-                src_data, src_offset, dst_data, dst_offset, depends);
+            sycl::event copy_and_cast_0d_event;
+            {
+                py::gil_scoped_release release;
+                copy_and_cast_0d_event =
+                    fn(exec_q, src_nelems, shape_arr, src_strides_arr,
+                       dst_strides_arr, src_data, src_offset, dst_data,
+                       dst_offset, depends);
+            }
 
             return std::make_pair(
                 keep_args_alive(exec_q, {src, dst}, {copy_and_cast_0d_event}),
@@ -243,28 +262,36 @@ copy_usm_ndarray_into_usm_ndarray(dpctl::tensor::usm_ndarray src,
     host_task_events.reserve(2);
 
     using dpctl::tensor::offset_utils::device_allocate_and_pack;
-    const auto &ptr_size_event_tuple = device_allocate_and_pack<py::ssize_t>(
-        exec_q, host_task_events, simplified_shape, simplified_src_strides,
-        simplified_dst_strides);
-    py::ssize_t *shape_strides = std::get<0>(ptr_size_event_tuple);
-    if (shape_strides == nullptr) {
-        throw std::runtime_error("Unable to allocate device memory");
-    }
-    sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
-
-    sycl::event copy_and_cast_generic_ev = copy_and_cast_fn(
-        exec_q, src_nelems, nd, shape_strides, src_data, src_offset, dst_data,
-        dst_offset, depends, {copy_shape_ev});
 
-    // async free of shape_strides temporary
-    auto ctx = exec_q.get_context();
-    auto temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(copy_and_cast_generic_ev);
-        cgh.host_task(
-            [ctx, shape_strides]() { sycl::free(shape_strides, ctx); });
-    });
-
-    host_task_events.push_back(temporaries_cleanup_ev);
+    sycl::event copy_and_cast_generic_ev;
+    {
+        py::gil_scoped_release release;
+
+        const auto &ptr_size_event_tuple =
+            device_allocate_and_pack<py::ssize_t>(
+                exec_q, host_task_events, simplified_shape,
+                simplified_src_strides, simplified_dst_strides);
+        py::ssize_t *shape_strides = std::get<0>(ptr_size_event_tuple);
+        if (shape_strides == nullptr) {
+            throw std::runtime_error("Unable to allocate device memory");
+        }
+        sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
+
+        copy_and_cast_generic_ev = copy_and_cast_fn(
+            exec_q, src_nelems, nd, shape_strides, src_data, src_offset,
+            dst_data, dst_offset, depends, {copy_shape_ev});
+
+        // async free of shape_strides temporary
+        auto ctx = exec_q.get_context();
+        auto temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(copy_and_cast_generic_ev);
+            cgh.host_task([ctx, shape_strides]() {
+                sycl_free_noexcept(shape_strides, ctx);
+            });
+        });
+
+        host_task_events.push_back(temporaries_cleanup_ev);
+    }
 
     return std::make_pair(keep_args_alive(exec_q, {src, dst}, host_task_events),
                           copy_and_cast_generic_ev);
@@ -29,6 +29,7 @@
 #include "copy_for_reshape.hpp"
 #include "dpctl4pybind11.hpp"
 #include "kernels/copy_and_cast.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 #include <pybind11/pybind11.h>
 
@@ -39,6 +40,8 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+
 namespace td_ns = dpctl::tensor::type_dispatch;
 
 using dpctl::tensor::kernels::copy_and_cast::copy_for_reshape_fn_ptr_t;
@@ -63,6 +66,8 @@ copy_usm_ndarray_for_reshape(dpctl::tensor::usm_ndarray src,
                              sycl::queue exec_q,
                              const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<init_copy_for_reshape_dispatch_vectors>();
+
     py::ssize_t src_nelems = src.get_size();
     py::ssize_t dst_nelems = dst.get_size();
 
@@ -110,8 +115,11 @@ copy_usm_ndarray_for_reshape(dpctl::tensor::usm_ndarray src,
         int src_elemsize = src.get_elemsize();
         const char *src_data = src.get_data();
         char *dst_data = dst.get_data();
-        sycl::event copy_ev =
-            exec_q.copy<char>(src_data, dst_data, src_elemsize);
+        sycl::event copy_ev;
+        {
+            py::gil_scoped_release release;
+            copy_ev = exec_q.copy<char>(src_data, dst_data, src_elemsize);
+        }
         return std::make_pair(keep_args_alive(exec_q, {src, dst}, {copy_ev}),
                               copy_ev);
     }
@@ -131,39 +139,47 @@ copy_usm_ndarray_for_reshape(dpctl::tensor::usm_ndarray src,
     auto dst_shape = dst.get_shape_vector();
     auto dst_strides = dst.get_strides_vector();
 
-    std::vector<sycl::event> host_task_events;
-    host_task_events.reserve(2);
-
-    // shape_strides = [src_shape, src_strides, dst_shape, dst_strides]
-    using dpctl::tensor::offset_utils::device_allocate_and_pack;
-    const auto &ptr_size_event_tuple = device_allocate_and_pack<py::ssize_t>(
-        exec_q, host_task_events, src_shape, src_strides, dst_shape,
-        dst_strides);
-    py::ssize_t *shape_strides = std::get<0>(ptr_size_event_tuple);
-    if (shape_strides == nullptr) {
-        throw std::runtime_error("Unable to allocate device memory");
-    }
-    sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
-
     const char *src_data = src.get_data();
     char *dst_data = dst.get_data();
 
-    std::vector<sycl::event> all_deps(depends.size() + 1);
-    all_deps.push_back(copy_shape_ev);
-    all_deps.insert(std::end(all_deps), std::begin(depends), std::end(depends));
-
-    sycl::event copy_for_reshape_event =
-        fn(exec_q, src_nelems, src_nd, dst_nd, shape_strides, src_data,
-           dst_data, all_deps);
-
-    auto temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(copy_for_reshape_event);
-        auto ctx = exec_q.get_context();
-        cgh.host_task(
-            [shape_strides, ctx]() { sycl::free(shape_strides, ctx); });
-    });
+    std::vector<sycl::event> host_task_events;
+    host_task_events.reserve(2);
 
-    host_task_events.push_back(temporaries_cleanup_ev);
+    sycl::event copy_for_reshape_event;
+    {
+        py::gil_scoped_release release;
+
+        // shape_strides = [src_shape, src_strides, dst_shape, dst_strides]
+        using dpctl::tensor::offset_utils::device_allocate_and_pack;
+        const auto &ptr_size_event_tuple =
+            device_allocate_and_pack<py::ssize_t>(exec_q, host_task_events,
+                                                  src_shape, src_strides,
+                                                  dst_shape, dst_strides);
+        py::ssize_t *shape_strides = std::get<0>(ptr_size_event_tuple);
+        if (shape_strides == nullptr) {
+            throw std::runtime_error("Unable to allocate device memory");
+        }
+        sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
+
+        std::vector<sycl::event> all_deps(depends.size() + 1);
+        all_deps.push_back(copy_shape_ev);
+        all_deps.insert(std::end(all_deps), std::begin(depends),
+                        std::end(depends));
+
+        copy_for_reshape_event =
+            fn(exec_q, src_nelems, src_nd, dst_nd, shape_strides, src_data,
+               dst_data, all_deps);
+
+        auto temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(copy_for_reshape_event);
+            auto ctx = exec_q.get_context();
+            cgh.host_task([shape_strides, ctx]() {
+                sycl_free_noexcept(shape_strides, ctx);
+            });
+        });
+
+        host_task_events.push_back(temporaries_cleanup_ev);
+    }
 
     return std::make_pair(keep_args_alive(exec_q, {src, dst}, host_task_events),
                           copy_for_reshape_event);
@@ -29,6 +29,7 @@
 #include "copy_for_roll.hpp"
 #include "dpctl4pybind11.hpp"
 #include "kernels/copy_and_cast.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 #include <pybind11/pybind11.h>
 
@@ -41,6 +42,8 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+
 namespace td_ns = dpctl::tensor::type_dispatch;
 
 using dpctl::tensor::kernels::copy_and_cast::copy_for_roll_contig_fn_ptr_t;
@@ -75,6 +78,8 @@ copy_usm_ndarray_for_roll_1d(dpctl::tensor::usm_ndarray src,
                              sycl::queue exec_q,
                              const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<init_copy_for_roll_dispatch_vectors>();
+
     int src_nd = src.get_ndim();
     int dst_nd = dst.get_ndim();
 
@@ -133,8 +138,11 @@ copy_usm_ndarray_for_roll_1d(dpctl::tensor::usm_ndarray src,
         int src_elemsize = src.get_elemsize();
         const char *src_data = src.get_data();
         char *dst_data = dst.get_data();
-        sycl::event copy_ev =
-            exec_q.copy<char>(src_data, dst_data, src_elemsize);
+        sycl::event copy_ev;
+        {
+            py::gil_scoped_release release;
+            copy_ev = exec_q.copy<char>(src_data, dst_data, src_elemsize);
+        }
         return std::make_pair(keep_args_alive(exec_q, {src, dst}, {copy_ev}),
                               copy_ev);
     }
@@ -164,9 +172,13 @@ copy_usm_ndarray_for_roll_1d(dpctl::tensor::usm_ndarray src,
         if (fn != nullptr) {
             constexpr py::ssize_t zero_offset = 0;
 
-            sycl::event copy_for_roll_ev =
-                fn(exec_q, offset, src_nelems, src_data, zero_offset, dst_data,
-                   zero_offset, depends);
+            sycl::event copy_for_roll_ev;
+            {
+                py::gil_scoped_release release;
+                copy_for_roll_ev = fn(exec_q, offset, src_nelems, src_data,
+                                      zero_offset, dst_data, zero_offset,
+                                      depends);
+            }
 
             sycl::event ht_ev =
                 keep_args_alive(exec_q, {src, dst}, {copy_for_roll_ev});
@@ -201,9 +213,13 @@ copy_usm_ndarray_for_roll_1d(dpctl::tensor::usm_ndarray src,
 
         if (fn != nullptr) {
 
-            sycl::event copy_for_roll_ev =
-                fn(exec_q, offset, src_nelems, src_data, src_offset, dst_data,
-                   dst_offset, depends);
+            sycl::event copy_for_roll_ev;
+            {
+                py::gil_scoped_release release;
+                copy_for_roll_ev = fn(exec_q, offset, src_nelems, src_data,
+                                      src_offset, dst_data, dst_offset,
+                                      depends);
+            }
 
             sycl::event ht_ev =
                 keep_args_alive(exec_q, {src, dst}, {copy_for_roll_ev});
@@ -217,34 +233,42 @@ copy_usm_ndarray_for_roll_1d(dpctl::tensor::usm_ndarray src,
     std::vector<sycl::event> host_task_events;
     host_task_events.reserve(2);
 
-    // shape_strides = [src_shape, src_strides, dst_strides]
-    using dpctl::tensor::offset_utils::device_allocate_and_pack;
-    const auto &ptr_size_event_tuple = device_allocate_and_pack<py::ssize_t>(
-        exec_q, host_task_events, simplified_shape, simplified_src_strides,
-        simplified_dst_strides);
+    sycl::event copy_for_roll_event;
+    {
+        py::gil_scoped_release release;
+
+        // shape_strides = [src_shape, src_strides, dst_strides]
+        using dpctl::tensor::offset_utils::device_allocate_and_pack;
+        const auto &ptr_size_event_tuple =
+            device_allocate_and_pack<py::ssize_t>(
+                exec_q, host_task_events, simplified_shape,
+                simplified_src_strides, simplified_dst_strides);
+
+        py::ssize_t *shape_strides = std::get<0>(ptr_size_event_tuple);
+        if (shape_strides == nullptr) {
+            throw std::runtime_error("Unable to allocate device memory");
+        }
+        sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
+
+        std::vector<sycl::event> all_deps(depends.size() + 1);
+        all_deps.push_back(copy_shape_ev);
+        all_deps.insert(std::end(all_deps), std::begin(depends),
+                        std::end(depends));
+
+        copy_for_roll_event =
+            fn(exec_q, offset, src_nelems, src_nd, shape_strides, src_data,
+               src_offset, dst_data, dst_offset, all_deps);
+
+        auto temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(copy_for_roll_event);
+            auto ctx = exec_q.get_context();
+            cgh.host_task([shape_strides, ctx]() {
+                sycl_free_noexcept(shape_strides, ctx);
+            });
+        });
 
-    py::ssize_t *shape_strides = std::get<0>(ptr_size_event_tuple);
-    if (shape_strides == nullptr) {
-        throw std::runtime_error("Unable to allocate device memory");
+        host_task_events.push_back(temporaries_cleanup_ev);
     }
-    sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
-
-    std::vector<sycl::event> all_deps(depends.size() + 1);
-    all_deps.push_back(copy_shape_ev);
-    all_deps.insert(std::end(all_deps), std::begin(depends), std::end(depends));
-
-    sycl::event copy_for_roll_event =
-        fn(exec_q, offset, src_nelems, src_nd, shape_strides, src_data,
-           src_offset, dst_data, dst_offset, all_deps);
-
-    auto temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(copy_for_roll_event);
-        auto ctx = exec_q.get_context();
-        cgh.host_task(
-            [shape_strides, ctx]() { sycl::free(shape_strides, ctx); });
-    });
-
-    host_task_events.push_back(temporaries_cleanup_ev);
 
     return std::make_pair(keep_args_alive(exec_q, {src, dst}, host_task_events),
                           copy_for_roll_event);
@@ -257,6 +281,8 @@ copy_usm_ndarray_for_roll_nd(dpctl::tensor::usm_ndarray src,
                              sycl::queue exec_q,
                              const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<init_copy_for_roll_dispatch_vectors>();
+
     int src_nd = src.get_ndim();
     int dst_nd = dst.get_ndim();
 
@@ -321,8 +347,11 @@ copy_usm_ndarray_for_roll_nd(dpctl::tensor::usm_ndarray src,
         int src_elemsize = src.get_elemsize();
         const char *src_data = src.get_data();
         char *dst_data = dst.get_data();
-        sycl::event copy_ev =
-            exec_q.copy<char>(src_data, dst_data, src_elemsize);
+        sycl::event copy_ev;
+        {
+            py::gil_scoped_release release;
+            copy_ev = exec_q.copy<char>(src_data, dst_data, src_elemsize);
+        }
         return std::make_pair(keep_args_alive(exec_q, {src, dst}, {copy_ev}),
                               copy_ev);
     }
@@ -357,35 +386,42 @@ copy_usm_ndarray_for_roll_nd(dpctl::tensor::usm_ndarray src,
     std::vector<sycl::event> host_task_events;
     host_task_events.reserve(2);
 
-    // shape_strides = [src_shape, src_strides, dst_strides]
-    using dpctl::tensor::offset_utils::device_allocate_and_pack;
-    const auto &ptr_size_event_tuple = device_allocate_and_pack<py::ssize_t>(
-        exec_q, host_task_events, common_shape, src_strides, dst_strides,
-        normalized_shifts);
-
-    py::ssize_t *shape_strides_shifts = std::get<0>(ptr_size_event_tuple);
-    if (shape_strides_shifts == nullptr) {
-        throw std::runtime_error("Unable to allocate device memory");
-    }
-    sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
-
-    std::vector<sycl::event> all_deps(depends.size() + 1);
-    all_deps.push_back(copy_shape_ev);
-    all_deps.insert(std::end(all_deps), std::begin(depends), std::end(depends));
-
-    sycl::event copy_for_roll_event =
-        fn(exec_q, src_nelems, src_nd, shape_strides_shifts, src_data,
-           src_offset, dst_data, dst_offset, all_deps);
-
-    auto temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(copy_for_roll_event);
-        auto ctx = exec_q.get_context();
-        cgh.host_task([shape_strides_shifts, ctx]() {
-            sycl::free(shape_strides_shifts, ctx);
+    sycl::event copy_for_roll_event;
+    {
+        py::gil_scoped_release release;
+
+        // shape_strides = [src_shape, src_strides, dst_strides]
+        using dpctl::tensor::offset_utils::device_allocate_and_pack;
+        const auto &ptr_size_event_tuple =
+            device_allocate_and_pack<py::ssize_t>(
+                exec_q, host_task_events, common_shape, src_strides,
+                dst_strides, normalized_shifts);
+
+        py::ssize_t *shape_strides_shifts = std::get<0>(ptr_size_event_tuple);
+        if (shape_strides_shifts == nullptr) {
+            throw std::runtime_error("Unable to allocate device memory");
+        }
+        sycl::event copy_shape_ev = std::get<2>(ptr_size_event_tuple);
+
+        std::vector<sycl::event> all_deps(depends.size() + 1);
+        all_deps.push_back(copy_shape_ev);
+        all_deps.insert(std::end(all_deps), std::begin(depends),
+                        std::end(depends));
+
+        copy_for_roll_event =
+            fn(exec_q, src_nelems, src_nd, shape_strides_shifts, src_data,
+               src_offset, dst_data, dst_offset, all_deps);
+
+        auto temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(copy_for_roll_event);
+            auto ctx = exec_q.get_context();
+            cgh.host_task([shape_strides_shifts, ctx]() {
+                sycl_free_noexcept(shape_strides_shifts, ctx);
+            });
         });
-    });
 
-    host_task_events.push_back(temporaries_cleanup_ev);
+        host_task_events.push_back(temporaries_cleanup_ev);
+    }
 
     return std::make_pair(keep_args_alive(exec_q, {src, dst}, host_task_events),
                           copy_for_roll_event);
@@ -31,6 +31,7 @@
 #include <pybind11/pybind11.h>
 
 #include "kernels/copy_and_cast.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 
 #include "copy_numpy_ndarray_into_usm_ndarray.hpp"
@@ -46,6 +47,8 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+
 using dpctl::tensor::kernels::copy_and_cast::
     copy_and_cast_from_host_blocking_fn_ptr_t;
 
@@ -59,6 +62,9 @@ void copy_numpy_ndarray_into_usm_ndarray(
     sycl::queue exec_q,
     const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<
+        init_copy_numpy_ndarray_into_usm_ndarray_dispatch_tables>();
+
     int src_ndim = npy_src.ndim();
     int dst_ndim = dst.get_ndim();
 
@@ -248,7 +254,7 @@ void copy_numpy_ndarray_into_usm_ndarray(
         npy_src_min_nelem_offset, npy_src_max_nelem_offset, dst_data,
         dst_offset, depends, {copy_shape_ev});
 
-    sycl::free(shape_strides, exec_q);
+    sycl_free_noexcept(shape_strides, exec_q);
 
     return;
 }
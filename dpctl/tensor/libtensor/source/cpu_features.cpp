@@ -0,0 +1,74 @@
+//===-- cpu_features.cpp - _cpu_features module             --*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._cpu_features extension:
+/// queries of instruction sets supported by the host CPU, used to select
+/// variant of dpctl.tensor extensions with ahead-of-time compiled CPU device
+/// code.
+//===----------------------------------------------------------------------===//
+
+#include <pybind11/pybind11.h>
+#include <string>
+
+namespace py = pybind11;
+
+namespace
+{
+
+/*! @brief Returns true if the host CPU supports instruction set `isa`,
+ * named as in `-march` option of `opencl-aot` tool.
+ */
+bool host_cpu_supports(const std::string &isa)
+{
+    if (isa != "sse4.2" && isa != "avx" && isa != "avx2" && isa != "avx512") {
+        throw py::value_error("Unrecognized instruction set " + isa);
+    }
+#if defined(__x86_64__) || defined(_M_X64)
+    __builtin_cpu_init();
+    if (isa == "sse4.2") {
+        return __builtin_cpu_supports("sse4.2");
+    }
+    else if (isa == "avx") {
+        return __builtin_cpu_supports("avx");
+    }
+    else if (isa == "avx2") {
+        return __builtin_cpu_supports("avx2");
+    }
+    // AVX-512 subsets of Skylake server CPUs, targeted by -march=avx512
+    return __builtin_cpu_supports("avx512f") &&
+           __builtin_cpu_supports("avx512cd") &&
+           __builtin_cpu_supports("avx512bw") &&
+           __builtin_cpu_supports("avx512dq") &&
+           __builtin_cpu_supports("avx512vl");
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+PYBIND11_MODULE(_cpu_features, m)
+{
+    m.def("host_cpu_supports", &host_cpu_supports,
+          "Returns True if the host CPU supports the given instruction set, "
+          "one of \"sse4.2\", \"avx\", \"avx2\" and \"avx512\".",
+          py::arg("isa"));
+}
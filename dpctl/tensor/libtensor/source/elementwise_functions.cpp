@@ -48,6 +48,7 @@
 #include "kernels/elementwise_functions/bitwise_right_shift.hpp"
 #include "kernels/elementwise_functions/bitwise_xor.hpp"
 #include "kernels/elementwise_functions/ceil.hpp"
+#include "kernels/elementwise_functions/clip.hpp"
 #include "kernels/elementwise_functions/conj.hpp"
 #include "kernels/elementwise_functions/cos.hpp"
 #include "kernels/elementwise_functions/cosh.hpp"
@@ -56,6 +57,7 @@
 #include "kernels/elementwise_functions/expm1.hpp"
 #include "kernels/elementwise_functions/floor.hpp"
 #include "kernels/elementwise_functions/floor_divide.hpp"
+#include "kernels/elementwise_functions/fma.hpp"
 #include "kernels/elementwise_functions/greater.hpp"
 #include "kernels/elementwise_functions/greater_equal.hpp"
 #include "kernels/elementwise_functions/hypot.hpp"
@@ -65,6 +67,7 @@
 #include "kernels/elementwise_functions/isnan.hpp"
 #include "kernels/elementwise_functions/less.hpp"
 #include "kernels/elementwise_functions/less_equal.hpp"
+#include "kernels/elementwise_functions/lerp.hpp"
 #include "kernels/elementwise_functions/log.hpp"
 #include "kernels/elementwise_functions/log10.hpp"
 #include "kernels/elementwise_functions/log1p.hpp"
@@ -164,6 +167,9 @@ using ew_cmn_ns::binary_inplace_contig_impl_fn_ptr_t;
 using ew_cmn_ns::binary_inplace_row_matrix_broadcast_impl_fn_ptr_t;
 using ew_cmn_ns::binary_inplace_strided_impl_fn_ptr_t;
 
+using ternary_contig_impl_fn_ptr_t = ew_cmn_ns::nary_contig_impl_fn_ptr_t<3>;
+using ternary_strided_impl_fn_ptr_t = ew_cmn_ns::nary_strided_impl_fn_ptr_t<3>;
+
 // U01: ==== ABS   (x)
 namespace impl
 {
@@ -2727,6 +2733,114 @@ void populate_hypot_dispatch_tables(void)
 
 } // namespace impl
 
+// T01:  ==== CLIP    (x, lo, hi)
+
+namespace impl
+{
+namespace clip_fn_ns = dpctl::tensor::kernels::clip;
+
+static ternary_contig_impl_fn_ptr_t
+    clip_contig_dispatch_vector[td_ns::num_types];
+static int clip_output_typeid_vector[td_ns::num_types];
+static ternary_strided_impl_fn_ptr_t
+    clip_strided_dispatch_vector[td_ns::num_types];
+
+void populate_clip_dispatch_vectors(void)
+{
+    using namespace td_ns;
+    namespace fn_ns = clip_fn_ns;
+
+    using fn_ns::ClipContigFactory;
+    DispatchVectorBuilder<ternary_contig_impl_fn_ptr_t, ClipContigFactory,
+                          num_types>
+        dvb1;
+    dvb1.populate_dispatch_vector(clip_contig_dispatch_vector);
+
+    using fn_ns::ClipStridedFactory;
+    DispatchVectorBuilder<ternary_strided_impl_fn_ptr_t, ClipStridedFactory,
+                          num_types>
+        dvb2;
+    dvb2.populate_dispatch_vector(clip_strided_dispatch_vector);
+
+    using fn_ns::ClipTypeMapFactory;
+    DispatchVectorBuilder<int, ClipTypeMapFactory, num_types> dvb3;
+    dvb3.populate_dispatch_vector(clip_output_typeid_vector);
+}
+
+} // namespace impl
+
+// T02:  ==== FMA    (x1, x2, x3)
+
+namespace impl
+{
+namespace fma_fn_ns = dpctl::tensor::kernels::fma;
+
+static ternary_contig_impl_fn_ptr_t
+    fma_contig_dispatch_vector[td_ns::num_types];
+static int fma_output_typeid_vector[td_ns::num_types];
+static ternary_strided_impl_fn_ptr_t
+    fma_strided_dispatch_vector[td_ns::num_types];
+
+void populate_fma_dispatch_vectors(void)
+{
+    using namespace td_ns;
+    namespace fn_ns = fma_fn_ns;
+
+    using fn_ns::FmaContigFactory;
+    DispatchVectorBuilder<ternary_contig_impl_fn_ptr_t, FmaContigFactory,
+                          num_types>
+        dvb1;
+    dvb1.populate_dispatch_vector(fma_contig_dispatch_vector);
+
+    using fn_ns::FmaStridedFactory;
+    DispatchVectorBuilder<ternary_strided_impl_fn_ptr_t, FmaStridedFactory,
+                          num_types>
+        dvb2;
+    dvb2.populate_dispatch_vector(fma_strided_dispatch_vector);
+
+    using fn_ns::FmaTypeMapFactory;
+    DispatchVectorBuilder<int, FmaTypeMapFactory, num_types> dvb3;
+    dvb3.populate_dispatch_vector(fma_output_typeid_vector);
+}
+
+} // namespace impl
+
+// T03:  ==== LERP    (start, end, w)
+
+namespace impl
+{
+namespace lerp_fn_ns = dpctl::tensor::kernels::lerp;
+
+static ternary_contig_impl_fn_ptr_t
+    lerp_contig_dispatch_vector[td_ns::num_types];
+static int lerp_output_typeid_vector[td_ns::num_types];
+static ternary_strided_impl_fn_ptr_t
+    lerp_strided_dispatch_vector[td_ns::num_types];
+
+void populate_lerp_dispatch_vectors(void)
+{
+    using namespace td_ns;
+    namespace fn_ns = lerp_fn_ns;
+
+    using fn_ns::LerpContigFactory;
+    DispatchVectorBuilder<ternary_contig_impl_fn_ptr_t, LerpContigFactory,
+                          num_types>
+        dvb1;
+    dvb1.populate_dispatch_vector(lerp_contig_dispatch_vector);
+
+    using fn_ns::LerpStridedFactory;
+    DispatchVectorBuilder<ternary_strided_impl_fn_ptr_t, LerpStridedFactory,
+                          num_types>
+        dvb2;
+    dvb2.populate_dispatch_vector(lerp_strided_dispatch_vector);
+
+    using fn_ns::LerpTypeMapFactory;
+    DispatchVectorBuilder<int, LerpTypeMapFactory, num_types> dvb3;
+    dvb3.populate_dispatch_vector(lerp_output_typeid_vector);
+}
+
+} // namespace impl
+
 // ==========================================================================================
 // //
 
@@ -2739,13 +2853,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U01: ==== ABS   (x)
     {
-        impl::populate_abs_dispatch_vectors();
         using impl::abs_contig_dispatch_vector;
         using impl::abs_output_typeid_vector;
         using impl::abs_strided_dispatch_vector;
 
         auto abs_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                              const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_abs_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, abs_output_typeid_vector,
                 abs_contig_dispatch_vector, abs_strided_dispatch_vector);
@@ -2754,6 +2868,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto abs_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_abs_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, abs_output_typeid_vector);
         };
         m.def("_abs_result_type", abs_result_type_pyapi);
@@ -2761,13 +2876,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U02: ==== ACOS   (x)
     {
-        impl::populate_acos_dispatch_vectors();
         using impl::acos_contig_dispatch_vector;
         using impl::acos_output_typeid_vector;
         using impl::acos_strided_dispatch_vector;
 
         auto acos_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_acos_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, acos_output_typeid_vector,
                 acos_contig_dispatch_vector, acos_strided_dispatch_vector);
@@ -2776,6 +2891,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto acos_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_acos_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, acos_output_typeid_vector);
         };
         m.def("_acos_result_type", acos_result_type_pyapi);
@@ -2783,13 +2899,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U03: ===== ACOSH (x)
     {
-        impl::populate_acosh_dispatch_vectors();
         using impl::acosh_contig_dispatch_vector;
         using impl::acosh_output_typeid_vector;
         using impl::acosh_strided_dispatch_vector;
 
         auto acosh_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_acosh_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, acosh_output_typeid_vector,
                 acosh_contig_dispatch_vector, acosh_strided_dispatch_vector);
@@ -2798,6 +2914,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto acosh_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_acosh_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               acosh_output_typeid_vector);
         };
@@ -2806,7 +2923,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B01: ===== ADD   (x1, x2)
     {
-        impl::populate_add_dispatch_tables();
         using impl::add_contig_dispatch_table;
         using impl::add_contig_matrix_contig_row_broadcast_dispatch_table;
         using impl::add_contig_row_contig_matrix_broadcast_dispatch_table;
@@ -2817,6 +2933,7 @@ void init_elementwise_functions(py::module_ m)
                              dpctl::tensor::usm_ndarray src2,
                              dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
                              const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_add_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, add_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -2833,6 +2950,7 @@ void init_elementwise_functions(py::module_ m)
                 add_contig_row_contig_matrix_broadcast_dispatch_table);
         };
         auto add_result_type_pyapi = [&](py::dtype dtype1, py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_add_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                add_output_id_table);
         };
@@ -2849,6 +2967,7 @@ void init_elementwise_functions(py::module_ m)
             [&](dpctl::tensor::usm_ndarray src, dpctl::tensor::usm_ndarray dst,
                 sycl::queue exec_q,
                 const std::vector<sycl::event> &depends = {}) {
+                td_ns::populate_once<impl::populate_add_dispatch_tables>();
                 return py_binary_inplace_ufunc(
                     src, dst, exec_q, depends, add_output_id_table,
                     // function pointers to handle inplace operation on
@@ -2869,13 +2988,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U04: ===== ASIN  (x)
     {
-        impl::populate_asin_dispatch_vectors();
         using impl::asin_contig_dispatch_vector;
         using impl::asin_output_typeid_vector;
         using impl::asin_strided_dispatch_vector;
 
         auto asin_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_asin_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, asin_output_typeid_vector,
                 asin_contig_dispatch_vector, asin_strided_dispatch_vector);
@@ -2884,6 +3003,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto asin_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_asin_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, asin_output_typeid_vector);
         };
         m.def("_asin_result_type", asin_result_type_pyapi);
@@ -2891,13 +3011,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U05: ===== ASINH (x)
     {
-        impl::populate_asinh_dispatch_vectors();
         using impl::asinh_contig_dispatch_vector;
         using impl::asinh_output_typeid_vector;
         using impl::asinh_strided_dispatch_vector;
 
         auto asinh_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_asinh_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, asinh_output_typeid_vector,
                 asinh_contig_dispatch_vector, asinh_strided_dispatch_vector);
@@ -2906,6 +3026,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto asinh_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_asinh_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               asinh_output_typeid_vector);
         };
@@ -2914,13 +3035,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U06: ===== ATAN  (x)
     {
-        impl::populate_atan_dispatch_vectors();
         using impl::atan_contig_dispatch_vector;
         using impl::atan_output_typeid_vector;
         using impl::atan_strided_dispatch_vector;
 
         auto atan_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_atan_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, atan_output_typeid_vector,
                 atan_contig_dispatch_vector, atan_strided_dispatch_vector);
@@ -2929,6 +3050,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto atan_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_atan_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, atan_output_typeid_vector);
         };
         m.def("_atan_result_type", atan_result_type_pyapi);
@@ -2936,7 +3058,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B02: ===== ATAN2 (x1, x2)
     {
-        impl::populate_atan2_dispatch_tables();
         using impl::atan2_contig_dispatch_table;
         using impl::atan2_output_id_table;
         using impl::atan2_strided_dispatch_table;
@@ -2946,6 +3067,7 @@ void init_elementwise_functions(py::module_ m)
                                dpctl::tensor::usm_ndarray dst,
                                sycl::queue exec_q,
                                const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_atan2_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, atan2_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -2964,6 +3086,7 @@ void init_elementwise_functions(py::module_ m)
                     binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
         };
         auto atan2_result_type_pyapi = [&](py::dtype dtype1, py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_atan2_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                atan2_output_id_table);
         };
@@ -2975,13 +3098,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U07: ===== ATANH (x)
     {
-        impl::populate_atanh_dispatch_vectors();
         using impl::atanh_contig_dispatch_vector;
         using impl::atanh_output_typeid_vector;
         using impl::atanh_strided_dispatch_vector;
 
         auto atanh_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_atanh_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, atanh_output_typeid_vector,
                 atanh_contig_dispatch_vector, atanh_strided_dispatch_vector);
@@ -2990,6 +3113,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto atanh_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_atanh_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               atanh_output_typeid_vector);
         };
@@ -2998,7 +3122,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B03: ===== BITWISE_AND           (x1, x2)
     {
-        impl::populate_bitwise_and_dispatch_tables();
         using impl::bitwise_and_contig_dispatch_table;
         using impl::bitwise_and_output_id_table;
         using impl::bitwise_and_strided_dispatch_table;
@@ -3009,6 +3132,7 @@ void init_elementwise_functions(py::module_ m)
                                      sycl::queue exec_q,
                                      const std::vector<sycl::event> &depends =
                                          {}) {
+            td_ns::populate_once<impl::populate_bitwise_and_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, bitwise_and_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3028,6 +3152,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto bitwise_and_result_type_pyapi = [&](py::dtype dtype1,
                                                  py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_bitwise_and_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                bitwise_and_output_id_table);
         };
@@ -3039,7 +3164,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B04: ===== BITWISE_LEFT_SHIFT    (x1, x2)
     {
-        impl::populate_bitwise_left_shift_dispatch_tables();
         using impl::bitwise_left_shift_contig_dispatch_table;
         using impl::bitwise_left_shift_output_id_table;
         using impl::bitwise_left_shift_strided_dispatch_table;
@@ -3050,6 +3174,8 @@ void init_elementwise_functions(py::module_ m)
                                             sycl::queue exec_q,
                                             const std::vector<sycl::event>
                                                 &depends = {}) {
+            td_ns::populate_once<
+                impl::populate_bitwise_left_shift_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends,
                 bitwise_left_shift_output_id_table,
@@ -3070,6 +3196,8 @@ void init_elementwise_functions(py::module_ m)
         };
         auto bitwise_left_shift_result_type_pyapi = [&](py::dtype dtype1,
                                                         py::dtype dtype2) {
+            td_ns::populate_once<
+                impl::populate_bitwise_left_shift_dispatch_tables>();
             return py_binary_ufunc_result_type(
                 dtype1, dtype2, bitwise_left_shift_output_id_table);
         };
@@ -3082,7 +3210,6 @@ void init_elementwise_functions(py::module_ m)
 
     // U08: ===== BITWISE_INVERT        (x)
     {
-        impl::populate_bitwise_invert_dispatch_vectors();
         using impl::bitwise_invert_contig_dispatch_vector;
         using impl::bitwise_invert_output_typeid_vector;
         using impl::bitwise_invert_strided_dispatch_vector;
@@ -3090,6 +3217,8 @@ void init_elementwise_functions(py::module_ m)
         auto bitwise_invert_pyapi = [&](arrayT src, arrayT dst,
                                         sycl::queue exec_q,
                                         const event_vecT &depends = {}) {
+            td_ns::populate_once<
+                impl::populate_bitwise_invert_dispatch_vectors>();
             return py_unary_ufunc(src, dst, exec_q, depends,
                                   bitwise_invert_output_typeid_vector,
                                   bitwise_invert_contig_dispatch_vector,
@@ -3100,6 +3229,8 @@ void init_elementwise_functions(py::module_ m)
               py::arg("depends") = py::list());
 
         auto bitwise_invert_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<
+                impl::populate_bitwise_invert_dispatch_vectors>();
             return py_unary_ufunc_result_type(
                 dtype, bitwise_invert_output_typeid_vector);
         };
@@ -3108,7 +3239,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B05: ===== BITWISE_OR            (x1, x2)
     {
-        impl::populate_bitwise_or_dispatch_tables();
         using impl::bitwise_or_contig_dispatch_table;
         using impl::bitwise_or_output_id_table;
         using impl::bitwise_or_strided_dispatch_table;
@@ -3119,6 +3249,7 @@ void init_elementwise_functions(py::module_ m)
                                     sycl::queue exec_q,
                                     const std::vector<sycl::event> &depends =
                                         {}) {
+            td_ns::populate_once<impl::populate_bitwise_or_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, bitwise_or_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3138,6 +3269,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto bitwise_or_result_type_pyapi = [&](py::dtype dtype1,
                                                 py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_bitwise_or_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                bitwise_or_output_id_table);
         };
@@ -3149,7 +3281,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B06: ===== BITWISE_RIGHT_SHIFT   (x1, x2)
     {
-        impl::populate_bitwise_right_shift_dispatch_tables();
         using impl::bitwise_right_shift_contig_dispatch_table;
         using impl::bitwise_right_shift_output_id_table;
         using impl::bitwise_right_shift_strided_dispatch_table;
@@ -3160,6 +3291,8 @@ void init_elementwise_functions(py::module_ m)
                                              sycl::queue exec_q,
                                              const std::vector<sycl::event>
                                                  &depends = {}) {
+            td_ns::populate_once<
+                impl::populate_bitwise_right_shift_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends,
                 bitwise_right_shift_output_id_table,
@@ -3180,6 +3313,8 @@ void init_elementwise_functions(py::module_ m)
         };
         auto bitwise_right_shift_result_type_pyapi = [&](py::dtype dtype1,
                                                          py::dtype dtype2) {
+            td_ns::populate_once<
+                impl::populate_bitwise_right_shift_dispatch_tables>();
             return py_binary_ufunc_result_type(
                 dtype1, dtype2, bitwise_right_shift_output_id_table);
         };
@@ -3192,7 +3327,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B07: ===== BITWISE_XOR           (x1, x2)
     {
-        impl::populate_bitwise_xor_dispatch_tables();
         using impl::bitwise_xor_contig_dispatch_table;
         using impl::bitwise_xor_output_id_table;
         using impl::bitwise_xor_strided_dispatch_table;
@@ -3203,6 +3337,7 @@ void init_elementwise_functions(py::module_ m)
                                      sycl::queue exec_q,
                                      const std::vector<sycl::event> &depends =
                                          {}) {
+            td_ns::populate_once<impl::populate_bitwise_xor_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, bitwise_xor_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3222,6 +3357,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto bitwise_xor_result_type_pyapi = [&](py::dtype dtype1,
                                                  py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_bitwise_xor_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                bitwise_xor_output_id_table);
         };
@@ -3233,13 +3369,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U09: ==== CEIL          (x)
     {
-        impl::populate_ceil_dispatch_vectors();
         using impl::ceil_contig_dispatch_vector;
         using impl::ceil_output_typeid_vector;
         using impl::ceil_strided_dispatch_vector;
 
         auto ceil_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_ceil_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, ceil_output_typeid_vector,
                 ceil_contig_dispatch_vector, ceil_strided_dispatch_vector);
@@ -3248,6 +3384,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto ceil_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_ceil_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, ceil_output_typeid_vector);
         };
         m.def("_ceil_result_type", ceil_result_type_pyapi);
@@ -3255,13 +3392,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U10: ==== CONJ          (x)
     {
-        impl::populate_conj_dispatch_vectors();
         using impl::conj_contig_dispatch_vector;
         using impl::conj_output_typeid_vector;
         using impl::conj_strided_dispatch_vector;
 
         auto conj_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_conj_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, conj_output_typeid_vector,
                 conj_contig_dispatch_vector, conj_strided_dispatch_vector);
@@ -3270,6 +3407,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto conj_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_conj_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, conj_output_typeid_vector);
         };
         m.def("_conj_result_type", conj_result_type_pyapi);
@@ -3277,13 +3415,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U11: ==== COS           (x)
     {
-        impl::populate_cos_dispatch_vectors();
         using impl::cos_contig_dispatch_vector;
         using impl::cos_output_typeid_vector;
         using impl::cos_strided_dispatch_vector;
 
         auto cos_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                              const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_cos_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, cos_output_typeid_vector,
                 cos_contig_dispatch_vector, cos_strided_dispatch_vector);
@@ -3292,6 +3430,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto cos_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_cos_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, cos_output_typeid_vector);
         };
         m.def("_cos_result_type", cos_result_type_pyapi);
@@ -3299,13 +3438,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U12: ==== COSH          (x)
     {
-        impl::populate_cosh_dispatch_vectors();
         using impl::cosh_contig_dispatch_vector;
         using impl::cosh_output_typeid_vector;
         using impl::cosh_strided_dispatch_vector;
 
         auto cosh_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_cosh_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, cosh_output_typeid_vector,
                 cosh_contig_dispatch_vector, cosh_strided_dispatch_vector);
@@ -3314,6 +3453,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto cosh_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_cosh_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, cosh_output_typeid_vector);
         };
         m.def("_cosh_result_type", cosh_result_type_pyapi);
@@ -3321,7 +3461,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B08: ==== DIVIDE        (x1, x2)
     {
-        impl::populate_true_divide_dispatch_tables();
         using impl::true_divide_contig_dispatch_table;
         using impl::
             true_divide_contig_matrix_contig_row_broadcast_dispatch_table;
@@ -3335,6 +3474,7 @@ void init_elementwise_functions(py::module_ m)
                                 dpctl::tensor::usm_ndarray dst,
                                 sycl::queue exec_q,
                                 const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_true_divide_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, true_divide_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3352,6 +3492,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto divide_result_type_pyapi = [&](py::dtype dtype1,
                                             py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_true_divide_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                true_divide_output_id_table);
         };
@@ -3363,7 +3504,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B09: ==== EQUAL         (x1, x2)
     {
-        impl::populate_equal_dispatch_tables();
         using impl::equal_contig_dispatch_table;
         using impl::equal_output_id_table;
         using impl::equal_strided_dispatch_table;
@@ -3373,6 +3513,7 @@ void init_elementwise_functions(py::module_ m)
                                dpctl::tensor::usm_ndarray dst,
                                sycl::queue exec_q,
                                const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_equal_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, equal_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3391,6 +3532,7 @@ void init_elementwise_functions(py::module_ m)
                     binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
         };
         auto equal_result_type_pyapi = [&](py::dtype dtype1, py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_equal_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                equal_output_id_table);
         };
@@ -3402,13 +3544,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U13: ==== EXP           (x)
     {
-        impl::populate_exp_dispatch_vectors();
         using impl::exp_contig_dispatch_vector;
         using impl::exp_output_typeid_vector;
         using impl::exp_strided_dispatch_vector;
 
         auto exp_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                              const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_exp_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, exp_output_typeid_vector,
                 exp_contig_dispatch_vector, exp_strided_dispatch_vector);
@@ -3417,6 +3559,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto exp_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_exp_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, exp_output_typeid_vector);
         };
         m.def("_exp_result_type", exp_result_type_pyapi);
@@ -3424,13 +3567,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U14: ==== EXPM1         (x)
     {
-        impl::populate_expm1_dispatch_vectors();
         using impl::expm1_contig_dispatch_vector;
         using impl::expm1_output_typeid_vector;
         using impl::expm1_strided_dispatch_vector;
 
         auto expm1_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_expm1_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, expm1_output_typeid_vector,
                 expm1_contig_dispatch_vector, expm1_strided_dispatch_vector);
@@ -3439,6 +3582,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto expm1_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_expm1_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               expm1_output_typeid_vector);
         };
@@ -3447,13 +3591,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U15: ==== FLOOR         (x)
     {
-        impl::populate_floor_dispatch_vectors();
         using impl::floor_contig_dispatch_vector;
         using impl::floor_output_typeid_vector;
         using impl::floor_strided_dispatch_vector;
 
         auto floor_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_floor_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, floor_output_typeid_vector,
                 floor_contig_dispatch_vector, floor_strided_dispatch_vector);
@@ -3462,6 +3606,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto floor_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_floor_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               floor_output_typeid_vector);
         };
@@ -3470,7 +3615,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B10: ==== FLOOR_DIVIDE  (x1, x2)
     {
-        impl::populate_floor_divide_dispatch_tables();
         using impl::floor_divide_contig_dispatch_table;
         using impl::floor_divide_output_id_table;
         using impl::floor_divide_strided_dispatch_table;
@@ -3481,6 +3625,7 @@ void init_elementwise_functions(py::module_ m)
                                       sycl::queue exec_q,
                                       const std::vector<sycl::event> &depends =
                                           {}) {
+            td_ns::populate_once<impl::populate_floor_divide_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, floor_divide_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3500,6 +3645,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto floor_divide_result_type_pyapi = [&](py::dtype dtype1,
                                                   py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_floor_divide_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                floor_divide_output_id_table);
         };
@@ -3511,7 +3657,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B11: ==== GREATER       (x1, x2)
     {
-        impl::populate_greater_dispatch_tables();
         using impl::greater_contig_dispatch_table;
         using impl::greater_output_id_table;
         using impl::greater_strided_dispatch_table;
@@ -3521,6 +3666,7 @@ void init_elementwise_functions(py::module_ m)
                                  dpctl::tensor::usm_ndarray dst,
                                  sycl::queue exec_q,
                                  const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_greater_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, greater_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3540,6 +3686,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto greater_result_type_pyapi = [&](py::dtype dtype1,
                                              py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_greater_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                greater_output_id_table);
         };
@@ -3551,7 +3698,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B12: ==== GREATER_EQUAL (x1, x2)
     {
-        impl::populate_greater_equal_dispatch_tables();
         using impl::greater_equal_contig_dispatch_table;
         using impl::greater_equal_output_id_table;
         using impl::greater_equal_strided_dispatch_table;
@@ -3562,6 +3708,8 @@ void init_elementwise_functions(py::module_ m)
                                        sycl::queue exec_q,
                                        const std::vector<sycl::event> &depends =
                                            {}) {
+            td_ns::populate_once<
+                impl::populate_greater_equal_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, greater_equal_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3581,6 +3729,8 @@ void init_elementwise_functions(py::module_ m)
         };
         auto greater_equal_result_type_pyapi = [&](py::dtype dtype1,
                                                    py::dtype dtype2) {
+            td_ns::populate_once<
+                impl::populate_greater_equal_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                greater_equal_output_id_table);
         };
@@ -3593,13 +3743,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U16: ==== IMAG        (x)
     {
-        impl::populate_imag_dispatch_vectors();
         using impl::imag_contig_dispatch_vector;
         using impl::imag_output_typeid_vector;
         using impl::imag_strided_dispatch_vector;
 
         auto imag_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_imag_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, imag_output_typeid_vector,
                 imag_contig_dispatch_vector, imag_strided_dispatch_vector);
@@ -3608,6 +3758,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto imag_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_imag_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, imag_output_typeid_vector);
         };
         m.def("_imag_result_type", imag_result_type_pyapi);
@@ -3615,8 +3766,6 @@ void init_elementwise_functions(py::module_ m)
 
     // U17: ==== ISFINITE    (x)
     {
-        impl::populate_isfinite_dispatch_vectors();
-
         using impl::isfinite_contig_dispatch_vector;
         using impl::isfinite_output_typeid_vector;
         using impl::isfinite_strided_dispatch_vector;
@@ -3624,12 +3773,15 @@ void init_elementwise_functions(py::module_ m)
             [&](dpctl::tensor::usm_ndarray src, dpctl::tensor::usm_ndarray dst,
                 sycl::queue exec_q,
                 const std::vector<sycl::event> &depends = {}) {
+                td_ns::populate_once<
+                    impl::populate_isfinite_dispatch_vectors>();
                 return py_unary_ufunc(src, dst, exec_q, depends,
                                       isfinite_output_typeid_vector,
                                       isfinite_contig_dispatch_vector,
                                       isfinite_strided_dispatch_vector);
             };
         auto isfinite_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_isfinite_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               isfinite_output_typeid_vector);
         };
@@ -3640,8 +3792,6 @@ void init_elementwise_functions(py::module_ m)
 
     // U18: ==== ISINF       (x)
     {
-        impl::populate_isinf_dispatch_vectors();
-
         using impl::isinf_contig_dispatch_vector;
         using impl::isinf_output_typeid_vector;
         using impl::isinf_strided_dispatch_vector;
@@ -3649,11 +3799,13 @@ void init_elementwise_functions(py::module_ m)
                                dpctl::tensor::usm_ndarray dst,
                                sycl::queue exec_q,
                                const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_isinf_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, isinf_output_typeid_vector,
                 isinf_contig_dispatch_vector, isinf_strided_dispatch_vector);
         };
         auto isinf_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_isinf_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               isinf_output_typeid_vector);
         };
@@ -3664,8 +3816,6 @@ void init_elementwise_functions(py::module_ m)
 
     // U19: ==== ISNAN       (x)
     {
-        impl::populate_isnan_dispatch_vectors();
-
         using impl::isnan_contig_dispatch_vector;
         using impl::isnan_output_typeid_vector;
         using impl::isnan_strided_dispatch_vector;
@@ -3673,11 +3823,13 @@ void init_elementwise_functions(py::module_ m)
                                dpctl::tensor::usm_ndarray dst,
                                sycl::queue exec_q,
                                const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_isnan_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, isnan_output_typeid_vector,
                 isnan_contig_dispatch_vector, isnan_strided_dispatch_vector);
         };
         auto isnan_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_isnan_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               isnan_output_typeid_vector);
         };
@@ -3688,7 +3840,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B13: ==== LESS        (x1, x2)
     {
-        impl::populate_less_dispatch_tables();
         using impl::less_contig_dispatch_table;
         using impl::less_output_id_table;
         using impl::less_strided_dispatch_table;
@@ -3698,6 +3849,7 @@ void init_elementwise_functions(py::module_ m)
                               dpctl::tensor::usm_ndarray dst,
                               sycl::queue exec_q,
                               const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_less_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, less_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3716,6 +3868,7 @@ void init_elementwise_functions(py::module_ m)
                     binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
         };
         auto less_result_type_pyapi = [&](py::dtype dtype1, py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_less_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                less_output_id_table);
         };
@@ -3727,7 +3880,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B14: ==== LESS_EQUAL  (x1, x2)
     {
-        impl::populate_less_equal_dispatch_tables();
         using impl::less_equal_contig_dispatch_table;
         using impl::less_equal_output_id_table;
         using impl::less_equal_strided_dispatch_table;
@@ -3738,6 +3890,7 @@ void init_elementwise_functions(py::module_ m)
                                     sycl::queue exec_q,
                                     const std::vector<sycl::event> &depends =
                                         {}) {
+            td_ns::populate_once<impl::populate_less_equal_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, less_equal_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3757,6 +3910,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto less_equal_result_type_pyapi = [&](py::dtype dtype1,
                                                 py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_less_equal_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                less_equal_output_id_table);
         };
@@ -3768,13 +3922,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U20: ==== LOG         (x)
     {
-        impl::populate_log_dispatch_vectors();
         using impl::log_contig_dispatch_vector;
         using impl::log_output_typeid_vector;
         using impl::log_strided_dispatch_vector;
 
         auto log_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                              const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_log_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, log_output_typeid_vector,
                 log_contig_dispatch_vector, log_strided_dispatch_vector);
@@ -3783,6 +3937,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto log_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_log_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, log_output_typeid_vector);
         };
         m.def("_log_result_type", log_result_type_pyapi);
@@ -3790,13 +3945,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U21: ==== LOG1P       (x)
     {
-        impl::populate_log1p_dispatch_vectors();
         using impl::log1p_contig_dispatch_vector;
         using impl::log1p_output_typeid_vector;
         using impl::log1p_strided_dispatch_vector;
 
         auto log1p_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_log1p_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, log1p_output_typeid_vector,
                 log1p_contig_dispatch_vector, log1p_strided_dispatch_vector);
@@ -3805,6 +3960,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto log1p_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_log1p_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               log1p_output_typeid_vector);
         };
@@ -3813,8 +3969,6 @@ void init_elementwise_functions(py::module_ m)
 
     // U22: ==== LOG2        (x)
     {
-        impl::populate_log2_dispatch_vectors();
-
         using impl::log2_contig_dispatch_vector;
         using impl::log2_output_typeid_vector;
         using impl::log2_strided_dispatch_vector;
@@ -3822,11 +3976,13 @@ void init_elementwise_functions(py::module_ m)
                               dpctl::tensor::usm_ndarray dst,
                               sycl::queue exec_q,
                               const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_log2_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, log2_output_typeid_vector,
                 log2_contig_dispatch_vector, log2_strided_dispatch_vector);
         };
         auto log2_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_log2_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, log2_output_typeid_vector);
         };
         m.def("_log2", log2_pyapi, "", py::arg("src"), py::arg("dst"),
@@ -3836,8 +3992,6 @@ void init_elementwise_functions(py::module_ m)
 
     // U23: ==== LOG10       (x)
     {
-        impl::populate_log10_dispatch_vectors();
-
         using impl::log10_contig_dispatch_vector;
         using impl::log10_output_typeid_vector;
         using impl::log10_strided_dispatch_vector;
@@ -3845,11 +3999,13 @@ void init_elementwise_functions(py::module_ m)
                                dpctl::tensor::usm_ndarray dst,
                                sycl::queue exec_q,
                                const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_log10_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, log10_output_typeid_vector,
                 log10_contig_dispatch_vector, log10_strided_dispatch_vector);
         };
         auto log10_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_log10_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               log10_output_typeid_vector);
         };
@@ -3860,7 +4016,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B15: ==== LOGADDEXP   (x1, x2)
     {
-        impl::populate_logaddexp_dispatch_tables();
         using impl::logaddexp_contig_dispatch_table;
         using impl::logaddexp_output_id_table;
         using impl::logaddexp_strided_dispatch_table;
@@ -3871,6 +4026,7 @@ void init_elementwise_functions(py::module_ m)
                                    sycl::queue exec_q,
                                    const std::vector<sycl::event> &depends =
                                        {}) {
+            td_ns::populate_once<impl::populate_logaddexp_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, logaddexp_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3890,6 +4046,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto logaddexp_result_type_pyapi = [&](py::dtype dtype1,
                                                py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_logaddexp_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                logaddexp_output_id_table);
         };
@@ -3901,7 +4058,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B16: ==== LOGICAL_AND (x1, x2)
     {
-        impl::populate_logical_and_dispatch_tables();
         using impl::logical_and_contig_dispatch_table;
         using impl::logical_and_output_id_table;
         using impl::logical_and_strided_dispatch_table;
@@ -3912,6 +4068,7 @@ void init_elementwise_functions(py::module_ m)
                                      sycl::queue exec_q,
                                      const std::vector<sycl::event> &depends =
                                          {}) {
+            td_ns::populate_once<impl::populate_logical_and_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, logical_and_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3931,6 +4088,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto logical_and_result_type_pyapi = [&](py::dtype dtype1,
                                                  py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_logical_and_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                logical_and_output_id_table);
         };
@@ -3942,13 +4100,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U24: ==== LOGICAL_NOT (x)
     {
-        impl::populate_logical_not_dispatch_vectors();
         using impl::logical_not_contig_dispatch_vector;
         using impl::logical_not_output_typeid_vector;
         using impl::logical_not_strided_dispatch_vector;
 
         auto logical_not_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                      const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_logical_not_dispatch_vectors>();
             return py_unary_ufunc(src, dst, exec_q, depends,
                                   logical_not_output_typeid_vector,
                                   logical_not_contig_dispatch_vector,
@@ -3959,6 +4117,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("depends") = py::list());
 
         auto logical_not_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_logical_not_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               logical_not_output_typeid_vector);
         };
@@ -3967,7 +4126,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B17: ==== LOGICAL_OR  (x1, x2)
     {
-        impl::populate_logical_or_dispatch_tables();
         using impl::logical_or_contig_dispatch_table;
         using impl::logical_or_output_id_table;
         using impl::logical_or_strided_dispatch_table;
@@ -3978,6 +4136,7 @@ void init_elementwise_functions(py::module_ m)
                                     sycl::queue exec_q,
                                     const std::vector<sycl::event> &depends =
                                         {}) {
+            td_ns::populate_once<impl::populate_logical_or_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, logical_or_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -3997,6 +4156,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto logical_or_result_type_pyapi = [&](py::dtype dtype1,
                                                 py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_logical_or_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                logical_or_output_id_table);
         };
@@ -4008,7 +4168,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B18: ==== LOGICAL_XOR (x1, x2)
     {
-        impl::populate_logical_xor_dispatch_tables();
         using impl::logical_xor_contig_dispatch_table;
         using impl::logical_xor_output_id_table;
         using impl::logical_xor_strided_dispatch_table;
@@ -4019,6 +4178,7 @@ void init_elementwise_functions(py::module_ m)
                                      sycl::queue exec_q,
                                      const std::vector<sycl::event> &depends =
                                          {}) {
+            td_ns::populate_once<impl::populate_logical_xor_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, logical_xor_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -4038,6 +4198,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto logical_xor_result_type_pyapi = [&](py::dtype dtype1,
                                                  py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_logical_xor_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                logical_xor_output_id_table);
         };
@@ -4049,7 +4210,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B??: ==== MAXIMUM    (x1, x2)
     {
-        impl::populate_maximum_dispatch_tables();
         using impl::maximum_contig_dispatch_table;
         using impl::maximum_output_id_table;
         using impl::maximum_strided_dispatch_table;
@@ -4059,6 +4219,7 @@ void init_elementwise_functions(py::module_ m)
                                  dpctl::tensor::usm_ndarray dst,
                                  sycl::queue exec_q,
                                  const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_maximum_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, maximum_output_id_table,
                 // function pointers to handle operation on contiguous
@@ -4078,6 +4239,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto maximum_result_type_pyapi = [&](py::dtype dtype1,
                                              py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_maximum_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                maximum_output_id_table);
         };
@@ -4089,7 +4251,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B??: ==== MINIMUM    (x1, x2)
     {
-        impl::populate_minimum_dispatch_tables();
         using impl::minimum_contig_dispatch_table;
         using impl::minimum_output_id_table;
         using impl::minimum_strided_dispatch_table;
@@ -4099,6 +4260,7 @@ void init_elementwise_functions(py::module_ m)
                                  dpctl::tensor::usm_ndarray dst,
                                  sycl::queue exec_q,
                                  const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_minimum_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, minimum_output_id_table,
                 // function pointers to handle operation on contiguous
@@ -4118,6 +4280,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto minimum_result_type_pyapi = [&](py::dtype dtype1,
                                              py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_minimum_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                minimum_output_id_table);
         };
@@ -4129,7 +4292,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B19: ==== MULTIPLY    (x1, x2)
     {
-        impl::populate_multiply_dispatch_tables();
         using impl::multiply_contig_dispatch_table;
         using impl::multiply_contig_matrix_contig_row_broadcast_dispatch_table;
         using impl::multiply_contig_row_contig_matrix_broadcast_dispatch_table;
@@ -4141,6 +4303,7 @@ void init_elementwise_functions(py::module_ m)
                 dpctl::tensor::usm_ndarray src2, dpctl::tensor::usm_ndarray dst,
                 sycl::queue exec_q,
                 const std::vector<sycl::event> &depends = {}) {
+                td_ns::populate_once<impl::populate_multiply_dispatch_tables>();
                 return py_binary_ufunc(
                     src1, src2, dst, exec_q, depends, multiply_output_id_table,
                     // function pointers to handle operation on contiguous
@@ -4158,6 +4321,7 @@ void init_elementwise_functions(py::module_ m)
             };
         auto multiply_result_type_pyapi = [&](py::dtype dtype1,
                                               py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_multiply_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                multiply_output_id_table);
         };
@@ -4174,6 +4338,7 @@ void init_elementwise_functions(py::module_ m)
             [&](dpctl::tensor::usm_ndarray src, dpctl::tensor::usm_ndarray dst,
                 sycl::queue exec_q,
                 const std::vector<sycl::event> &depends = {}) {
+                td_ns::populate_once<impl::populate_multiply_dispatch_tables>();
                 return py_binary_inplace_ufunc(
                     src, dst, exec_q, depends, multiply_output_id_table,
                     // function pointers to handle inplace operation on
@@ -4194,13 +4359,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U25: ==== NEGATIVE    (x)
     {
-        impl::populate_negative_dispatch_vectors();
         using impl::negative_contig_dispatch_vector;
         using impl::negative_output_typeid_vector;
         using impl::negative_strided_dispatch_vector;
 
         auto negative_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                   const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_negative_dispatch_vectors>();
             return py_unary_ufunc(src, dst, exec_q, depends,
                                   negative_output_typeid_vector,
                                   negative_contig_dispatch_vector,
@@ -4210,6 +4375,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto negative_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_negative_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               negative_output_typeid_vector);
         };
@@ -4218,7 +4384,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B20: ==== NOT_EQUAL   (x1, x2)
     {
-        impl::populate_not_equal_dispatch_tables();
         using impl::not_equal_contig_dispatch_table;
         using impl::not_equal_output_id_table;
         using impl::not_equal_strided_dispatch_table;
@@ -4229,6 +4394,7 @@ void init_elementwise_functions(py::module_ m)
                                    sycl::queue exec_q,
                                    const std::vector<sycl::event> &depends =
                                        {}) {
+            td_ns::populate_once<impl::populate_not_equal_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, not_equal_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -4248,6 +4414,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto not_equal_result_type_pyapi = [&](py::dtype dtype1,
                                                py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_not_equal_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                not_equal_output_id_table);
         };
@@ -4259,13 +4426,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U26: ==== POSITIVE    (x)
     {
-        impl::populate_positive_dispatch_vectors();
         using impl::positive_contig_dispatch_vector;
         using impl::positive_output_typeid_vector;
         using impl::positive_strided_dispatch_vector;
 
         auto positive_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                   const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_positive_dispatch_vectors>();
             return py_unary_ufunc(src, dst, exec_q, depends,
                                   positive_output_typeid_vector,
                                   positive_contig_dispatch_vector,
@@ -4275,6 +4442,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto positive_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_positive_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               positive_output_typeid_vector);
         };
@@ -4283,7 +4451,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B21: ==== POW         (x1, x2)
     {
-        impl::populate_pow_dispatch_tables();
         using impl::pow_contig_dispatch_table;
         using impl::pow_output_id_table;
         using impl::pow_strided_dispatch_table;
@@ -4292,6 +4459,7 @@ void init_elementwise_functions(py::module_ m)
                              dpctl::tensor::usm_ndarray src2,
                              dpctl::tensor::usm_ndarray dst, sycl::queue exec_q,
                              const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_pow_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, pow_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -4310,6 +4478,7 @@ void init_elementwise_functions(py::module_ m)
                     binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
         };
         auto pow_result_type_pyapi = [&](py::dtype dtype1, py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_pow_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                pow_output_id_table);
         };
@@ -4321,13 +4490,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U??: ==== PROJ        (x)
     {
-        impl::populate_proj_dispatch_vectors();
         using impl::proj_contig_dispatch_vector;
         using impl::proj_output_typeid_vector;
         using impl::proj_strided_dispatch_vector;
 
         auto proj_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_proj_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, proj_output_typeid_vector,
                 proj_contig_dispatch_vector, proj_strided_dispatch_vector);
@@ -4336,6 +4505,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto proj_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_proj_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, proj_output_typeid_vector);
         };
         m.def("_proj_result_type", proj_result_type_pyapi);
@@ -4343,13 +4513,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U27: ==== REAL        (x)
     {
-        impl::populate_real_dispatch_vectors();
         using impl::real_contig_dispatch_vector;
         using impl::real_output_typeid_vector;
         using impl::real_strided_dispatch_vector;
 
         auto real_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_real_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, real_output_typeid_vector,
                 real_contig_dispatch_vector, real_strided_dispatch_vector);
@@ -4358,6 +4528,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto real_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_real_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, real_output_typeid_vector);
         };
         m.def("_real_result_type", real_result_type_pyapi);
@@ -4365,7 +4536,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B22: ==== REMAINDER   (x1, x2)
     {
-        impl::populate_remainder_dispatch_tables();
         using impl::remainder_contig_dispatch_table;
         using impl::remainder_output_id_table;
         using impl::remainder_strided_dispatch_table;
@@ -4376,6 +4546,7 @@ void init_elementwise_functions(py::module_ m)
                                    sycl::queue exec_q,
                                    const std::vector<sycl::event> &depends =
                                        {}) {
+            td_ns::populate_once<impl::populate_remainder_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, remainder_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -4395,6 +4566,7 @@ void init_elementwise_functions(py::module_ m)
         };
         auto remainder_result_type_pyapi = [&](py::dtype dtype1,
                                                py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_remainder_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                remainder_output_id_table);
         };
@@ -4406,13 +4578,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U28: ==== ROUND       (x)
     {
-        impl::populate_round_dispatch_vectors();
         using impl::round_contig_dispatch_vector;
         using impl::round_output_typeid_vector;
         using impl::round_strided_dispatch_vector;
 
         auto round_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_round_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, round_output_typeid_vector,
                 round_contig_dispatch_vector, round_strided_dispatch_vector);
@@ -4421,6 +4593,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto round_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_round_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               round_output_typeid_vector);
         };
@@ -4429,13 +4602,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U29: ==== SIGN        (x)
     {
-        impl::populate_sign_dispatch_vectors();
         using impl::sign_contig_dispatch_vector;
         using impl::sign_output_typeid_vector;
         using impl::sign_strided_dispatch_vector;
 
         auto sign_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_sign_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, sign_output_typeid_vector,
                 sign_contig_dispatch_vector, sign_strided_dispatch_vector);
@@ -4444,6 +4617,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto sign_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_sign_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, sign_output_typeid_vector);
         };
         m.def("_sign_result_type", sign_result_type_pyapi);
@@ -4451,13 +4625,13 @@ void init_elementwise_functions(py::module_ m)
 
     // ==== SIGNBIT        (x)
     {
-        impl::populate_signbit_dispatch_vectors();
         using impl::signbit_contig_dispatch_vector;
         using impl::signbit_output_typeid_vector;
         using impl::signbit_strided_dispatch_vector;
 
         auto signbit_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                  const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_signbit_dispatch_vectors>();
             return py_unary_ufunc(src, dst, exec_q, depends,
                                   signbit_output_typeid_vector,
                                   signbit_contig_dispatch_vector,
@@ -4467,6 +4641,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto signbit_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_signbit_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               signbit_output_typeid_vector);
         };
@@ -4475,13 +4650,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U30: ==== SIN         (x)
     {
-        impl::populate_sin_dispatch_vectors();
         using impl::sin_contig_dispatch_vector;
         using impl::sin_output_typeid_vector;
         using impl::sin_strided_dispatch_vector;
 
         auto sin_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                              const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_sin_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, sin_output_typeid_vector,
                 sin_contig_dispatch_vector, sin_strided_dispatch_vector);
@@ -4490,19 +4665,20 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto sin_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_sin_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, sin_output_typeid_vector);
         };
         m.def("_sin_result_type", sin_result_type_pyapi);
     }
     // U31: ==== SINH        (x)
     {
-        impl::populate_sinh_dispatch_vectors();
         using impl::sinh_contig_dispatch_vector;
         using impl::sinh_output_typeid_vector;
         using impl::sinh_strided_dispatch_vector;
 
         auto sinh_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_sinh_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, sinh_output_typeid_vector,
                 sinh_contig_dispatch_vector, sinh_strided_dispatch_vector);
@@ -4511,6 +4687,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto sinh_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_sinh_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, sinh_output_typeid_vector);
         };
         m.def("_sinh_result_type", sinh_result_type_pyapi);
@@ -4518,13 +4695,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U32: ==== SQUARE      (x)
     {
-        impl::populate_square_dispatch_vectors();
         using impl::square_contig_dispatch_vector;
         using impl::square_output_typeid_vector;
         using impl::square_strided_dispatch_vector;
 
         auto square_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                 const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_square_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, square_output_typeid_vector,
                 square_contig_dispatch_vector, square_strided_dispatch_vector);
@@ -4533,6 +4710,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto square_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_square_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               square_output_typeid_vector);
         };
@@ -4541,13 +4719,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U33: ==== SQRT        (x)
     {
-        impl::populate_sqrt_dispatch_vectors();
         using impl::sqrt_contig_dispatch_vector;
         using impl::sqrt_output_typeid_vector;
         using impl::sqrt_strided_dispatch_vector;
 
         auto sqrt_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_sqrt_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, sqrt_output_typeid_vector,
                 sqrt_contig_dispatch_vector, sqrt_strided_dispatch_vector);
@@ -4556,6 +4734,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto sqrt_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_sqrt_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, sqrt_output_typeid_vector);
         };
         m.def("_sqrt_result_type", sqrt_result_type_pyapi);
@@ -4563,7 +4742,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B23: ==== SUBTRACT    (x1, x2)
     {
-        impl::populate_subtract_dispatch_tables();
         using impl::subtract_contig_dispatch_table;
         using impl::subtract_contig_matrix_contig_row_broadcast_dispatch_table;
         using impl::subtract_contig_row_contig_matrix_broadcast_dispatch_table;
@@ -4575,6 +4753,7 @@ void init_elementwise_functions(py::module_ m)
                 dpctl::tensor::usm_ndarray src2, dpctl::tensor::usm_ndarray dst,
                 sycl::queue exec_q,
                 const std::vector<sycl::event> &depends = {}) {
+                td_ns::populate_once<impl::populate_subtract_dispatch_tables>();
                 return py_binary_ufunc(
                     src1, src2, dst, exec_q, depends, subtract_output_id_table,
                     // function pointers to handle operation on contiguous
@@ -4592,6 +4771,7 @@ void init_elementwise_functions(py::module_ m)
             };
         auto subtract_result_type_pyapi = [&](py::dtype dtype1,
                                               py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_subtract_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                subtract_output_id_table);
         };
@@ -4608,6 +4788,7 @@ void init_elementwise_functions(py::module_ m)
             [&](dpctl::tensor::usm_ndarray src, dpctl::tensor::usm_ndarray dst,
                 sycl::queue exec_q,
                 const std::vector<sycl::event> &depends = {}) {
+                td_ns::populate_once<impl::populate_subtract_dispatch_tables>();
                 return py_binary_inplace_ufunc(
                     src, dst, exec_q, depends, subtract_output_id_table,
                     // function pointers to handle inplace operation on
@@ -4628,13 +4809,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U34: ==== TAN         (x)
     {
-        impl::populate_tan_dispatch_vectors();
         using impl::tan_contig_dispatch_vector;
         using impl::tan_output_typeid_vector;
         using impl::tan_strided_dispatch_vector;
 
         auto tan_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                              const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_tan_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, tan_output_typeid_vector,
                 tan_contig_dispatch_vector, tan_strided_dispatch_vector);
@@ -4643,6 +4824,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto tan_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_tan_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, tan_output_typeid_vector);
         };
         m.def("_tan_result_type", tan_result_type_pyapi);
@@ -4650,13 +4832,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U35: ==== TANH        (x)
     {
-        impl::populate_tanh_dispatch_vectors();
         using impl::tanh_contig_dispatch_vector;
         using impl::tanh_output_typeid_vector;
         using impl::tanh_strided_dispatch_vector;
 
         auto tanh_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                               const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_tanh_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, tanh_output_typeid_vector,
                 tanh_contig_dispatch_vector, tanh_strided_dispatch_vector);
@@ -4665,6 +4847,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto tanh_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_tanh_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype, tanh_output_typeid_vector);
         };
         m.def("_tanh_result_type", tanh_result_type_pyapi);
@@ -4672,13 +4855,13 @@ void init_elementwise_functions(py::module_ m)
 
     // U36: ==== TRUNC       (x)
     {
-        impl::populate_trunc_dispatch_vectors();
         using impl::trunc_contig_dispatch_vector;
         using impl::trunc_output_typeid_vector;
         using impl::trunc_strided_dispatch_vector;
 
         auto trunc_pyapi = [&](arrayT src, arrayT dst, sycl::queue exec_q,
                                const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_trunc_dispatch_vectors>();
             return py_unary_ufunc(
                 src, dst, exec_q, depends, trunc_output_typeid_vector,
                 trunc_contig_dispatch_vector, trunc_strided_dispatch_vector);
@@ -4687,6 +4870,7 @@ void init_elementwise_functions(py::module_ m)
               py::arg("sycl_queue"), py::arg("depends") = py::list());
 
         auto trunc_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_trunc_dispatch_vectors>();
             return py_unary_ufunc_result_type(dtype,
                                               trunc_output_typeid_vector);
         };
@@ -4695,7 +4879,6 @@ void init_elementwise_functions(py::module_ m)
 
     // B24: ==== HYPOT       (x1, x2)
     {
-        impl::populate_hypot_dispatch_tables();
         using impl::hypot_contig_dispatch_table;
         using impl::hypot_output_id_table;
         using impl::hypot_strided_dispatch_table;
@@ -4705,6 +4888,7 @@ void init_elementwise_functions(py::module_ m)
                                dpctl::tensor::usm_ndarray dst,
                                sycl::queue exec_q,
                                const std::vector<sycl::event> &depends = {}) {
+            td_ns::populate_once<impl::populate_hypot_dispatch_tables>();
             return py_binary_ufunc(
                 src1, src2, dst, exec_q, depends, hypot_output_id_table,
                 // function pointers to handle operation on contiguous arrays
@@ -4723,6 +4907,7 @@ void init_elementwise_functions(py::module_ m)
                     binary_contig_row_contig_matrix_broadcast_impl_fn_ptr_t>{});
         };
         auto hypot_result_type_pyapi = [&](py::dtype dtype1, py::dtype dtype2) {
+            td_ns::populate_once<impl::populate_hypot_dispatch_tables>();
             return py_binary_ufunc_result_type(dtype1, dtype2,
                                                hypot_output_id_table);
         };
@@ -4731,6 +4916,84 @@ void init_elementwise_functions(py::module_ m)
               py::arg("depends") = py::list());
         m.def("_hypot_result_type", hypot_result_type_pyapi, "");
     }
+
+    // T01: ==== CLIP        (x, lo, hi)
+    {
+        using impl::clip_contig_dispatch_vector;
+        using impl::clip_output_typeid_vector;
+        using impl::clip_strided_dispatch_vector;
+
+        auto clip_pyapi = [&](arrayT src1, arrayT src2, arrayT src3, arrayT dst,
+                              sycl::queue exec_q,
+                              const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_clip_dispatch_vectors>();
+            return py_ternary_ufunc(
+                src1, src2, src3, dst, exec_q, depends,
+                clip_output_typeid_vector, clip_contig_dispatch_vector,
+                clip_strided_dispatch_vector);
+        };
+        m.def("_clip", clip_pyapi, "", py::arg("src1"), py::arg("src2"),
+              py::arg("src3"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
+        auto clip_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_clip_dispatch_vectors>();
+            return py_unary_ufunc_result_type(dtype, clip_output_typeid_vector);
+        };
+        m.def("_clip_result_type", clip_result_type_pyapi);
+    }
+
+    // T02: ==== FMA         (x1, x2, x3)
+    {
+        using impl::fma_contig_dispatch_vector;
+        using impl::fma_output_typeid_vector;
+        using impl::fma_strided_dispatch_vector;
+
+        auto fma_pyapi = [&](arrayT src1, arrayT src2, arrayT src3, arrayT dst,
+                             sycl::queue exec_q,
+                             const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_fma_dispatch_vectors>();
+            return py_ternary_ufunc(
+                src1, src2, src3, dst, exec_q, depends,
+                fma_output_typeid_vector, fma_contig_dispatch_vector,
+                fma_strided_dispatch_vector);
+        };
+        m.def("_fma", fma_pyapi, "", py::arg("src1"), py::arg("src2"),
+              py::arg("src3"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
+        auto fma_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_fma_dispatch_vectors>();
+            return py_unary_ufunc_result_type(dtype, fma_output_typeid_vector);
+        };
+        m.def("_fma_result_type", fma_result_type_pyapi);
+    }
+
+    // T03: ==== LERP        (start, end, w)
+    {
+        using impl::lerp_contig_dispatch_vector;
+        using impl::lerp_output_typeid_vector;
+        using impl::lerp_strided_dispatch_vector;
+
+        auto lerp_pyapi = [&](arrayT src1, arrayT src2, arrayT src3, arrayT dst,
+                              sycl::queue exec_q,
+                              const event_vecT &depends = {}) {
+            td_ns::populate_once<impl::populate_lerp_dispatch_vectors>();
+            return py_ternary_ufunc(
+                src1, src2, src3, dst, exec_q, depends,
+                lerp_output_typeid_vector, lerp_contig_dispatch_vector,
+                lerp_strided_dispatch_vector);
+        };
+        m.def("_lerp", lerp_pyapi, "", py::arg("src1"), py::arg("src2"),
+              py::arg("src3"), py::arg("dst"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
+        auto lerp_result_type_pyapi = [&](py::dtype dtype) {
+            td_ns::populate_once<impl::populate_lerp_dispatch_vectors>();
+            return py_unary_ufunc_result_type(dtype, lerp_output_typeid_vector);
+        };
+        m.def("_lerp_result_type", lerp_result_type_pyapi);
+    }
 }
 
 } // namespace py_internal
@@ -27,6 +27,7 @@
 
 #include "dpctl4pybind11.hpp"
 #include <CL/sycl.hpp>
+#include <array>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -36,6 +37,8 @@
 #include "simplify_iteration_space.hpp"
 #include "utils/memory_overlap.hpp"
 #include "utils/offset_utils.hpp"
+#include "utils/sycl_alloc_utils.hpp"
+#include "utils/sycl_utils.hpp"
 #include "utils/type_dispatch.hpp"
 
 namespace dpctl
@@ -45,6 +48,9 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+using dpctl::tensor::sycl_utils::host_fastpath_enabled;
+
 namespace td_ns = dpctl::tensor::type_dispatch;
 
 extern py::dtype _dtype_from_typenum(td_ns::typenum_t dst_typenum_t);
@@ -156,9 +162,13 @@ py_unary_ufunc(dpctl::tensor::usm_ndarray src,
                 std::to_string(src_typeid));
         }
 
-        auto comp_ev = contig_fn(q, src_nelems, src_data, dst_data, depends);
-        sycl::event ht_ev =
-            dpctl::utils::keep_args_alive(q, {src, dst}, {comp_ev});
+        sycl::event comp_ev;
+        {
+            py::gil_scoped_release release;
+            comp_ev = contig_fn(q, src_nelems, src_data, dst_data, depends);
+        }
+        sycl::event ht_ev = dpctl::utils::keep_args_alive(
+            q, {src, dst}, {comp_ev}, host_fastpath_enabled());
 
         return std::make_pair(ht_ev, comp_ev);
     }
@@ -199,12 +209,16 @@ py_unary_ufunc(dpctl::tensor::usm_ndarray src,
 
         int src_elem_size = src.get_elemsize();
         int dst_elem_size = dst.get_elemsize();
-        auto comp_ev =
-            contig_fn(q, src_nelems, src_data + src_elem_size * src_offset,
-                      dst_data + dst_elem_size * dst_offset, depends);
+        sycl::event comp_ev;
+        {
+            py::gil_scoped_release release;
+            comp_ev =
+                contig_fn(q, src_nelems, src_data + src_elem_size * src_offset,
+                          dst_data + dst_elem_size * dst_offset, depends);
+        }
 
-        sycl::event ht_ev =
-            dpctl::utils::keep_args_alive(q, {src, dst}, {comp_ev});
+        sycl::event ht_ev = dpctl::utils::keep_args_alive(
+            q, {src, dst}, {comp_ev}, host_fastpath_enabled());
 
         return std::make_pair(ht_ev, comp_ev);
     }
@@ -223,29 +237,37 @@ py_unary_ufunc(dpctl::tensor::usm_ndarray src,
     std::vector<sycl::event> host_tasks{};
     host_tasks.reserve(2);
 
-    const auto &ptr_size_event_triple_ = device_allocate_and_pack<py::ssize_t>(
-        q, host_tasks, simplified_shape, simplified_src_strides,
-        simplified_dst_strides);
-    py::ssize_t *shape_strides = std::get<0>(ptr_size_event_triple_);
-    sycl::event copy_shape_ev = std::get<2>(ptr_size_event_triple_);
+    sycl::event strided_fn_ev;
+    {
+        py::gil_scoped_release release;
+
+        const auto &ptr_size_event_triple_ =
+            device_allocate_and_pack<py::ssize_t>(q, host_tasks,
+                                                  simplified_shape,
+                                                  simplified_src_strides,
+                                                  simplified_dst_strides);
+        py::ssize_t *shape_strides = std::get<0>(ptr_size_event_triple_);
+        sycl::event copy_shape_ev = std::get<2>(ptr_size_event_triple_);
+
+        if (shape_strides == nullptr) {
+            throw std::runtime_error("Device memory allocation failed");
+        }
 
-    if (shape_strides == nullptr) {
-        throw std::runtime_error("Device memory allocation failed");
+        strided_fn_ev =
+            strided_fn(q, src_nelems, nd, shape_strides, src_data, src_offset,
+                       dst_data, dst_offset, depends, {copy_shape_ev});
+
+        // async free of shape_strides temporary
+        auto ctx = q.get_context();
+        sycl::event tmp_cleanup_ev = q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(strided_fn_ev);
+            cgh.host_task([ctx, shape_strides]() {
+                sycl_free_noexcept(shape_strides, ctx);
+            });
+        });
+        host_tasks.push_back(tmp_cleanup_ev);
     }
 
-    sycl::event strided_fn_ev =
-        strided_fn(q, src_nelems, nd, shape_strides, src_data, src_offset,
-                   dst_data, dst_offset, depends, {copy_shape_ev});
-
-    // async free of shape_strides temporary
-    auto ctx = q.get_context();
-    sycl::event tmp_cleanup_ev = q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(strided_fn_ev);
-        cgh.host_task(
-            [ctx, shape_strides]() { sycl::free(shape_strides, ctx); });
-    });
-    host_tasks.push_back(tmp_cleanup_ev);
-
     return std::make_pair(
         dpctl::utils::keep_args_alive(q, {src, dst}, host_tasks),
         strided_fn_ev);
@@ -412,10 +434,14 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
         auto contig_fn = contig_dispatch_table[src1_typeid][src2_typeid];
 
         if (contig_fn != nullptr) {
-            auto comp_ev = contig_fn(exec_q, src_nelems, src1_data, 0,
-                                     src2_data, 0, dst_data, 0, depends);
+            sycl::event comp_ev;
+            {
+                py::gil_scoped_release release;
+                comp_ev = contig_fn(exec_q, src_nelems, src1_data, 0,
+                                    src2_data, 0, dst_data, 0, depends);
+            }
             sycl::event ht_ev = dpctl::utils::keep_args_alive(
-                exec_q, {src1, src2, dst}, {comp_ev});
+                exec_q, {src1, src2, dst}, {comp_ev}, host_fastpath_enabled());
 
             return std::make_pair(ht_ev, comp_ev);
         }
@@ -458,11 +484,17 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
             auto contig_fn = contig_dispatch_table[src1_typeid][src2_typeid];
 
             if (contig_fn != nullptr) {
-                auto comp_ev = contig_fn(exec_q, src_nelems, src1_data,
-                                         src1_offset, src2_data, src2_offset,
-                                         dst_data, dst_offset, depends);
-                sycl::event ht_ev = dpctl::utils::keep_args_alive(
-                    exec_q, {src1, src2, dst}, {comp_ev});
+                sycl::event comp_ev;
+                {
+                    py::gil_scoped_release release;
+                    comp_ev = contig_fn(exec_q, src_nelems, src1_data,
+                                        src1_offset, src2_data, src2_offset,
+                                        dst_data, dst_offset, depends);
+                }
+                sycl::event ht_ev =
+                    dpctl::utils::keep_args_alive(exec_q, {src1, src2, dst},
+                                                  {comp_ev},
+                                                  host_fastpath_enabled());
 
                 return std::make_pair(ht_ev, comp_ev);
             }
@@ -484,9 +516,14 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
                 if (matrix_row_broadcast_fn != nullptr) {
                     size_t n0 = simplified_shape[0];
                     size_t n1 = simplified_shape[1];
-                    sycl::event comp_ev = matrix_row_broadcast_fn(
-                        exec_q, host_tasks, n0, n1, src1_data, src1_offset,
-                        src2_data, src2_offset, dst_data, dst_offset, depends);
+                    sycl::event comp_ev;
+                    {
+                        py::gil_scoped_release release;
+                        comp_ev = matrix_row_broadcast_fn(
+                            exec_q, host_tasks, n0, n1, src1_data, src1_offset,
+                            src2_data, src2_offset, dst_data, dst_offset,
+                            depends);
+                    }
 
                     return std::make_pair(
                         dpctl::utils::keep_args_alive(exec_q, {src1, src2, dst},
@@ -504,9 +541,14 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
                 if (row_matrix_broadcast_fn != nullptr) {
                     size_t n0 = simplified_shape[1];
                     size_t n1 = simplified_shape[0];
-                    sycl::event comp_ev = row_matrix_broadcast_fn(
-                        exec_q, host_tasks, n0, n1, src1_data, src1_offset,
-                        src2_data, src2_offset, dst_data, dst_offset, depends);
+                    sycl::event comp_ev;
+                    {
+                        py::gil_scoped_release release;
+                        comp_ev = row_matrix_broadcast_fn(
+                            exec_q, host_tasks, n0, n1, src1_data, src1_offset,
+                            src2_data, src2_offset, dst_data, dst_offset,
+                            depends);
+                    }
 
                     return std::make_pair(
                         dpctl::utils::keep_args_alive(exec_q, {src1, src2, dst},
@@ -528,31 +570,40 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
     }
 
     using dpctl::tensor::offset_utils::device_allocate_and_pack;
-    const auto &ptr_sz_event_triple_ = device_allocate_and_pack<py::ssize_t>(
-        exec_q, host_tasks, simplified_shape, simplified_src1_strides,
-        simplified_src2_strides, simplified_dst_strides);
 
-    py::ssize_t *shape_strides = std::get<0>(ptr_sz_event_triple_);
-    sycl::event copy_shape_ev = std::get<2>(ptr_sz_event_triple_);
+    sycl::event strided_fn_ev;
+    {
+        py::gil_scoped_release release;
+
+        const auto &ptr_sz_event_triple_ =
+            device_allocate_and_pack<py::ssize_t>(
+                exec_q, host_tasks, simplified_shape, simplified_src1_strides,
+                simplified_src2_strides, simplified_dst_strides);
 
-    if (shape_strides == nullptr) {
-        throw std::runtime_error("Unabled to allocate device memory");
-    }
+        py::ssize_t *shape_strides = std::get<0>(ptr_sz_event_triple_);
+        sycl::event copy_shape_ev = std::get<2>(ptr_sz_event_triple_);
 
-    sycl::event strided_fn_ev = strided_fn(
-        exec_q, src_nelems, nd, shape_strides, src1_data, src1_offset,
-        src2_data, src2_offset, dst_data, dst_offset, depends, {copy_shape_ev});
+        if (shape_strides == nullptr) {
+            throw std::runtime_error("Unabled to allocate device memory");
+        }
 
-    // async free of shape_strides temporary
-    auto ctx = exec_q.get_context();
+        strided_fn_ev = strided_fn(exec_q, src_nelems, nd, shape_strides,
+                                   src1_data, src1_offset, src2_data,
+                                   src2_offset, dst_data, dst_offset, depends,
+                                   {copy_shape_ev});
 
-    sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(strided_fn_ev);
-        cgh.host_task(
-            [ctx, shape_strides]() { sycl::free(shape_strides, ctx); });
-    });
+        // async free of shape_strides temporary
+        auto ctx = exec_q.get_context();
 
-    host_tasks.push_back(tmp_cleanup_ev);
+        sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(strided_fn_ev);
+            cgh.host_task([ctx, shape_strides]() {
+                sycl_free_noexcept(shape_strides, ctx);
+            });
+        });
+
+        host_tasks.push_back(tmp_cleanup_ev);
+    }
 
     return std::make_pair(
         dpctl::utils::keep_args_alive(exec_q, {src1, src2, dst}, host_tasks),
@@ -706,10 +757,14 @@ py_binary_inplace_ufunc(dpctl::tensor::usm_ndarray lhs,
         auto contig_fn = contig_dispatch_table[rhs_typeid][lhs_typeid];
 
         if (contig_fn != nullptr) {
-            auto comp_ev = contig_fn(exec_q, rhs_nelems, rhs_data, 0, lhs_data,
-                                     0, depends);
-            sycl::event ht_ev =
-                dpctl::utils::keep_args_alive(exec_q, {rhs, lhs}, {comp_ev});
+            sycl::event comp_ev;
+            {
+                py::gil_scoped_release release;
+                comp_ev = contig_fn(exec_q, rhs_nelems, rhs_data, 0, lhs_data,
+                                    0, depends);
+            }
+            sycl::event ht_ev = dpctl::utils::keep_args_alive(
+                exec_q, {rhs, lhs}, {comp_ev}, host_fastpath_enabled());
 
             return std::make_pair(ht_ev, comp_ev);
         }
@@ -748,11 +803,15 @@ py_binary_inplace_ufunc(dpctl::tensor::usm_ndarray lhs,
             auto contig_fn = contig_dispatch_table[rhs_typeid][lhs_typeid];
 
             if (contig_fn != nullptr) {
-                auto comp_ev =
-                    contig_fn(exec_q, rhs_nelems, rhs_data, rhs_offset,
-                              lhs_data, lhs_offset, depends);
+                sycl::event comp_ev;
+                {
+                    py::gil_scoped_release release;
+                    comp_ev = contig_fn(exec_q, rhs_nelems, rhs_data,
+                                        rhs_offset, lhs_data, lhs_offset,
+                                        depends);
+                }
                 sycl::event ht_ev = dpctl::utils::keep_args_alive(
-                    exec_q, {rhs, lhs}, {comp_ev});
+                    exec_q, {rhs, lhs}, {comp_ev}, host_fastpath_enabled());
 
                 return std::make_pair(ht_ev, comp_ev);
             }
@@ -771,9 +830,13 @@ py_binary_inplace_ufunc(dpctl::tensor::usm_ndarray lhs,
                 if (row_matrix_broadcast_fn != nullptr) {
                     size_t n0 = simplified_shape[1];
                     size_t n1 = simplified_shape[0];
-                    sycl::event comp_ev = row_matrix_broadcast_fn(
-                        exec_q, host_tasks, n0, n1, rhs_data, rhs_offset,
-                        lhs_data, lhs_offset, depends);
+                    sycl::event comp_ev;
+                    {
+                        py::gil_scoped_release release;
+                        comp_ev = row_matrix_broadcast_fn(
+                            exec_q, host_tasks, n0, n1, rhs_data, rhs_offset,
+                            lhs_data, lhs_offset, depends);
+                    }
 
                     return std::make_pair(dpctl::utils::keep_args_alive(
                                               exec_q, {lhs, rhs}, host_tasks),
@@ -794,37 +857,271 @@ py_binary_inplace_ufunc(dpctl::tensor::usm_ndarray lhs,
     }
 
     using dpctl::tensor::offset_utils::device_allocate_and_pack;
-    const auto &ptr_sz_event_triple_ = device_allocate_and_pack<py::ssize_t>(
-        exec_q, host_tasks, simplified_shape, simplified_rhs_strides,
-        simplified_lhs_strides);
 
-    py::ssize_t *shape_strides = std::get<0>(ptr_sz_event_triple_);
-    sycl::event copy_shape_ev = std::get<2>(ptr_sz_event_triple_);
+    sycl::event strided_fn_ev;
+    {
+        py::gil_scoped_release release;
+
+        const auto &ptr_sz_event_triple_ =
+            device_allocate_and_pack<py::ssize_t>(
+                exec_q, host_tasks, simplified_shape, simplified_rhs_strides,
+                simplified_lhs_strides);
 
-    if (shape_strides == nullptr) {
-        throw std::runtime_error("Unabled to allocate device memory");
-    }
+        py::ssize_t *shape_strides = std::get<0>(ptr_sz_event_triple_);
+        sycl::event copy_shape_ev = std::get<2>(ptr_sz_event_triple_);
 
-    sycl::event strided_fn_ev =
-        strided_fn(exec_q, rhs_nelems, nd, shape_strides, rhs_data, rhs_offset,
-                   lhs_data, lhs_offset, depends, {copy_shape_ev});
+        if (shape_strides == nullptr) {
+            throw std::runtime_error("Unabled to allocate device memory");
+        }
 
-    // async free of shape_strides temporary
-    auto ctx = exec_q.get_context();
+        strided_fn_ev = strided_fn(exec_q, rhs_nelems, nd, shape_strides,
+                                   rhs_data, rhs_offset, lhs_data, lhs_offset,
+                                   depends, {copy_shape_ev});
 
-    sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(strided_fn_ev);
-        cgh.host_task(
-            [ctx, shape_strides]() { sycl::free(shape_strides, ctx); });
-    });
+        // async free of shape_strides temporary
+        auto ctx = exec_q.get_context();
 
-    host_tasks.push_back(tmp_cleanup_ev);
+        sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(strided_fn_ev);
+            cgh.host_task([ctx, shape_strides]() {
+                sycl_free_noexcept(shape_strides, ctx);
+            });
+        });
+
+        host_tasks.push_back(tmp_cleanup_ev);
+    }
 
     return std::make_pair(
         dpctl::utils::keep_args_alive(exec_q, {rhs, lhs}, host_tasks),
         strided_fn_ev);
 }
 
+// ======================== Ternary functions ==========================
+
+/*! @brief Evaluates dst = op(src1, src2, src3) elementwise in a single pass.
+ *
+ * Inputs must have the same data type and the shape of the output,
+ * broadcasting and type promotion are assumed done by the caller. Dispatch
+ * vectors are indexed by the type id of inputs.
+ */
+template <typename output_typesT,
+          typename contig_dispatchT,
+          typename strided_dispatchT>
+std::pair<sycl::event, sycl::event>
+py_ternary_ufunc(dpctl::tensor::usm_ndarray src1,
+                 dpctl::tensor::usm_ndarray src2,
+                 dpctl::tensor::usm_ndarray src3,
+                 dpctl::tensor::usm_ndarray dst, // dst = op(src1, src2, src3)
+                 sycl::queue exec_q,
+                 const std::vector<sycl::event> &depends,
+                 //
+                 const output_typesT &output_type_vec,
+                 const contig_dispatchT &contig_dispatch_vector,
+                 const strided_dispatchT &strided_dispatch_vector)
+{
+    if (!dst.is_writable()) {
+        throw py::value_error("Output array is read-only.");
+    }
+
+    // check type_nums
+    auto array_types = td_ns::usm_ndarray_types();
+    int src1_typeid = array_types.typenum_to_lookup_id(src1.get_typenum());
+    int src2_typeid = array_types.typenum_to_lookup_id(src2.get_typenum());
+    int src3_typeid = array_types.typenum_to_lookup_id(src3.get_typenum());
+    int dst_typeid = array_types.typenum_to_lookup_id(dst.get_typenum());
+
+    if (src1_typeid != src2_typeid || src1_typeid != src3_typeid) {
+        throw py::value_error("Input arrays must have the same data type.");
+    }
+
+    int output_typeid = output_type_vec[src1_typeid];
+
+    if (output_typeid != dst_typeid) {
+        throw py::value_error(
+            "Destination array has unexpected elemental data type.");
+    }
+
+    // check that queues are compatible
+    if (!dpctl::utils::queues_are_compatible(exec_q,
+                                             {src1, src2, src3, dst})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    // check shapes, broadcasting is assumed done by caller
+    int dst_nd = dst.get_ndim();
+    if (dst_nd != src1.get_ndim() || dst_nd != src2.get_ndim() ||
+        dst_nd != src3.get_ndim())
+    {
+        throw py::value_error("Array dimensions are not the same.");
+    }
+
+    const py::ssize_t *src1_shape = src1.get_shape_raw();
+    const py::ssize_t *src2_shape = src2.get_shape_raw();
+    const py::ssize_t *src3_shape = src3.get_shape_raw();
+    const py::ssize_t *dst_shape = dst.get_shape_raw();
+    bool shapes_equal(true);
+    size_t src_nelems(1);
+
+    for (int i = 0; i < dst_nd; ++i) {
+        src_nelems *= static_cast<size_t>(dst_shape[i]);
+        shapes_equal = shapes_equal && (src1_shape[i] == dst_shape[i] &&
+                                        src2_shape[i] == dst_shape[i] &&
+                                        src3_shape[i] == dst_shape[i]);
+    }
+    if (!shapes_equal) {
+        throw py::value_error("Array shapes are not the same.");
+    }
+
+    // if nelems is zero, return
+    if (src_nelems == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    // destination must be ample enough to accommodate all elements
+    auto dst_offsets = dst.get_minmax_offsets();
+    {
+        size_t range =
+            static_cast<size_t>(dst_offsets.second - dst_offsets.first);
+        if (range + 1 < src_nelems) {
+            throw py::value_error(
+                "Destination array can not accommodate all the "
+                "elements of source array.");
+        }
+    }
+
+    // check memory overlap
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    auto const &same_logical_tensors =
+        dpctl::tensor::overlap::SameLogicalTensors();
+    if ((overlap(src1, dst) && !same_logical_tensors(src1, dst)) ||
+        (overlap(src2, dst) && !same_logical_tensors(src2, dst)) ||
+        (overlap(src3, dst) && !same_logical_tensors(src3, dst)))
+    {
+        throw py::value_error("Arrays index overlapping segments of memory");
+    }
+
+    const std::array<const char *, 3> src_data = {
+        src1.get_data(), src2.get_data(), src3.get_data()};
+    char *dst_data = dst.get_data();
+
+    // dispatch for contiguous inputs
+    bool all_c_contig = (src1.is_c_contiguous() && src2.is_c_contiguous() &&
+                         src3.is_c_contiguous() && dst.is_c_contiguous());
+    bool all_f_contig = (src1.is_f_contiguous() && src2.is_f_contiguous() &&
+                         src3.is_f_contiguous() && dst.is_f_contiguous());
+
+    auto contig_fn = contig_dispatch_vector[src1_typeid];
+
+    if ((all_c_contig || all_f_contig) && contig_fn != nullptr) {
+        sycl::event comp_ev;
+        {
+            py::gil_scoped_release release;
+            comp_ev = contig_fn(exec_q, src_nelems, src_data, {0, 0, 0},
+                                dst_data, 0, depends);
+        }
+        sycl::event ht_ev =
+            dpctl::utils::keep_args_alive(exec_q, {src1, src2, src3, dst},
+                                          {comp_ev}, host_fastpath_enabled());
+
+        return std::make_pair(ht_ev, comp_ev);
+    }
+
+    // simplify strides
+    auto const &src1_strides = src1.get_strides_vector();
+    auto const &src2_strides = src2.get_strides_vector();
+    auto const &src3_strides = src3.get_strides_vector();
+    auto const &dst_strides = dst.get_strides_vector();
+
+    using shT = std::vector<py::ssize_t>;
+    shT simplified_shape;
+    shT simplified_src1_strides;
+    shT simplified_src2_strides;
+    shT simplified_src3_strides;
+    shT simplified_dst_strides;
+    std::array<py::ssize_t, 3> src_offsets = {0, 0, 0};
+    py::ssize_t dst_offset(0);
+
+    int nd = dst_nd;
+    const py::ssize_t *shape = dst_shape;
+
+    dpctl::tensor::py_internal::simplify_iteration_space_4(
+        nd, shape, src1_strides, src2_strides, src3_strides, dst_strides,
+        // outputs
+        simplified_shape, simplified_src1_strides, simplified_src2_strides,
+        simplified_src3_strides, simplified_dst_strides, src_offsets[0],
+        src_offsets[1], src_offsets[2], dst_offset);
+
+    if (nd == 1 && simplified_src1_strides[0] == 1 &&
+        simplified_src2_strides[0] == 1 && simplified_src3_strides[0] == 1 &&
+        simplified_dst_strides[0] == 1 && contig_fn != nullptr)
+    {
+        sycl::event comp_ev;
+        {
+            py::gil_scoped_release release;
+            comp_ev = contig_fn(exec_q, src_nelems, src_data, src_offsets,
+                                dst_data, dst_offset, depends);
+        }
+        sycl::event ht_ev =
+            dpctl::utils::keep_args_alive(exec_q, {src1, src2, src3, dst},
+                                          {comp_ev}, host_fastpath_enabled());
+
+        return std::make_pair(ht_ev, comp_ev);
+    }
+
+    // dispatch to strided code
+    auto strided_fn = strided_dispatch_vector[src1_typeid];
+
+    if (strided_fn == nullptr) {
+        throw std::runtime_error(
+            "Strided implementation is missing for src_typeid=" +
+            std::to_string(src1_typeid));
+    }
+
+    using dpctl::tensor::offset_utils::device_allocate_and_pack;
+
+    std::vector<sycl::event> host_tasks{};
+    host_tasks.reserve(2);
+
+    sycl::event strided_fn_ev;
+    {
+        py::gil_scoped_release release;
+
+        const auto &ptr_sz_event_triple_ =
+            device_allocate_and_pack<py::ssize_t>(
+                exec_q, host_tasks, simplified_shape, simplified_src1_strides,
+                simplified_src2_strides, simplified_src3_strides,
+                simplified_dst_strides);
+
+        py::ssize_t *shape_strides = std::get<0>(ptr_sz_event_triple_);
+        sycl::event copy_shape_ev = std::get<2>(ptr_sz_event_triple_);
+
+        if (shape_strides == nullptr) {
+            throw std::runtime_error("Unabled to allocate device memory");
+        }
+
+        strided_fn_ev = strided_fn(exec_q, src_nelems, nd, shape_strides,
+                                   src_data, src_offsets, dst_data, dst_offset,
+                                   depends, {copy_shape_ev});
+
+        // async free of shape_strides temporary
+        auto ctx = exec_q.get_context();
+
+        sycl::event tmp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(strided_fn_ev);
+            cgh.host_task([ctx, shape_strides]() {
+                sycl_free_noexcept(shape_strides, ctx);
+            });
+        });
+
+        host_tasks.push_back(tmp_cleanup_ev);
+    }
+
+    return std::make_pair(dpctl::utils::keep_args_alive(
+                              exec_q, {src1, src2, src3, dst}, host_tasks),
+                          strided_fn_ev);
+}
+
 extern void init_elementwise_functions(py::module_ m);
 
 } // namespace py_internal
@@ -54,6 +54,8 @@ usm_ndarray_eye(py::ssize_t k,
                 sycl::queue exec_q,
                 const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<init_eye_ctor_dispatch_vectors>();
+
     // dst must be 2D
 
     if (dst.get_ndim() != 2) {
@@ -109,8 +111,11 @@ usm_ndarray_eye(py::ssize_t k,
 
     auto fn = eye_dispatch_vector[dst_typeid];
 
-    eye_event = fn(exec_q, static_cast<size_t>(nelem), start, end, step,
-                   dst_data, depends);
+    {
+        py::gil_scoped_release release;
+        eye_event = fn(exec_q, static_cast<size_t>(nelem), start, end, step,
+                       dst_data, depends);
+    }
 
     return std::make_pair(keep_args_alive(exec_q, {dst}, {eye_event}),
                           eye_event);
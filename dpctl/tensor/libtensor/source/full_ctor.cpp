@@ -58,6 +58,8 @@ usm_ndarray_full(py::object py_value,
                  sycl::queue exec_q,
                  const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<init_full_ctor_dispatch_vectors>();
+
     // start, end should be coercible into data type of dst
 
     py::ssize_t dst_nelems = dst.get_size();
@@ -0,0 +1,317 @@
+//===-- histogram.cpp - Histogram and bin search functions  --*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_reductions_impl
+/// extension computing histograms, bin indices and ranges of values.
+//===----------------------------------------------------------------------===//
+
+#include "dpctl4pybind11.hpp"
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "histogram.hpp"
+#include "kernels/histogram.hpp"
+#include "utils/memory_overlap.hpp"
+#include "utils/type_dispatch.hpp"
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+using dpctl::tensor::kernels::histogram::histogram_fn_ptr_t;
+static histogram_fn_ptr_t histogram_dispatch_table[td_ns::num_types]
+                                                  [td_ns::num_types];
+
+using dpctl::tensor::kernels::histogram::digitize_fn_ptr_t;
+static digitize_fn_ptr_t digitize_dispatch_table[td_ns::num_types]
+                                                [td_ns::num_types];
+
+using dpctl::tensor::kernels::histogram::minmax_fn_ptr_t;
+static minmax_fn_ptr_t minmax_dispatch_table[td_ns::num_types]
+                                            [td_ns::num_types];
+
+void init_histogram_dispatch_tables(void)
+{
+    using dpctl::tensor::kernels::histogram::HistogramFactory;
+    td_ns::DispatchTableBuilder<histogram_fn_ptr_t, HistogramFactory,
+                                td_ns::num_types>
+        dtb1;
+    dtb1.populate_dispatch_table(histogram_dispatch_table);
+
+    using dpctl::tensor::kernels::histogram::DigitizeFactory;
+    td_ns::DispatchTableBuilder<digitize_fn_ptr_t, DigitizeFactory,
+                                td_ns::num_types>
+        dtb2;
+    dtb2.populate_dispatch_table(digitize_dispatch_table);
+
+    using dpctl::tensor::kernels::histogram::MinMaxFactory;
+    td_ns::DispatchTableBuilder<minmax_fn_ptr_t, MinMaxFactory,
+                                td_ns::num_types>
+        dtb3;
+    dtb3.populate_dispatch_table(minmax_dispatch_table);
+}
+
+namespace
+{
+
+void validate_1d_src(const dpctl::tensor::usm_ndarray &src)
+{
+    if (src.get_ndim() != 1) {
+        throw py::value_error("Source array must be one-dimensional");
+    }
+}
+
+void validate_c_contig_1d(const dpctl::tensor::usm_ndarray &arr,
+                          size_t expected_size,
+                          const char *name)
+{
+    if (arr.get_ndim() != 1 || !arr.is_c_contiguous() ||
+        static_cast<size_t>(arr.get_shape(0)) != expected_size)
+    {
+        throw py::value_error(std::string(name) +
+                              " array must be one-dimensional C-contiguous "
+                              "array of " +
+                              std::to_string(expected_size) + " elements");
+    }
+}
+
+int lookup_typeid(const dpctl::tensor::usm_ndarray &arr)
+{
+    auto const &array_types = td_ns::usm_ndarray_types();
+    return array_types.typenum_to_lookup_id(arr.get_typenum());
+}
+
+void validate_int64_result(const dpctl::tensor::usm_ndarray &res)
+{
+    constexpr int int64_typeid = static_cast<int>(td_ns::typenum_t::INT64);
+    if (lookup_typeid(res) != int64_typeid) {
+        throw py::value_error(
+            "Unexpected data type of result array, expecting 'int64'");
+    }
+}
+
+} // namespace
+
+std::pair<sycl::event, sycl::event>
+py_histogram(dpctl::tensor::usm_ndarray src,
+             dpctl::tensor::usm_ndarray edges,
+             bool uniform,
+             dpctl::tensor::usm_ndarray counts,
+             sycl::queue exec_q,
+             std::vector<sycl::event> const &depends)
+{
+    td_ns::populate_once<init_histogram_dispatch_tables>();
+
+    validate_1d_src(src);
+    if (edges.get_ndim() != 1 || edges.get_shape(0) < 2) {
+        throw py::value_error("Bin edges array must be one-dimensional "
+                              "array of at least two elements");
+    }
+    const size_t n_bins = static_cast<size_t>(edges.get_shape(0)) - 1;
+    validate_c_contig_1d(edges, n_bins + 1, "Bin edges");
+    validate_c_contig_1d(counts, n_bins, "Counts");
+    validate_int64_result(counts);
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {src, edges, counts})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(counts, src) || overlap(counts, edges)) {
+        throw py::value_error("Destination array overlaps with inputs");
+    }
+
+    auto fn = histogram_dispatch_table[lookup_typeid(src)]
+                                      [lookup_typeid(edges)];
+    if (fn == nullptr) {
+        throw py::value_error("Histogram is not supported for the given "
+                              "data types of source and bin edges");
+    }
+
+    const size_t n = static_cast<size_t>(src.get_size());
+    const char *src_data = src.get_data();
+    const py::ssize_t src_step = src.get_strides_vector()[0];
+    const char *edges_data = edges.get_data();
+    char *counts_data = counts.get_data();
+
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+        comp_ev = fn(exec_q, n, src_data, src_step, edges_data, n_bins,
+                     uniform, counts_data, depends);
+    }
+
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, {src, edges, counts}, {comp_ev});
+
+    return std::make_pair(ht_ev, comp_ev);
+}
+
+std::pair<sycl::event, sycl::event>
+py_digitize(dpctl::tensor::usm_ndarray src,
+            dpctl::tensor::usm_ndarray edges,
+            bool right,
+            dpctl::tensor::usm_ndarray dst,
+            sycl::queue exec_q,
+            std::vector<sycl::event> const &depends)
+{
+    td_ns::populate_once<init_histogram_dispatch_tables>();
+
+    validate_1d_src(src);
+    const size_t n = static_cast<size_t>(src.get_size());
+    if (edges.get_ndim() != 1) {
+        throw py::value_error("Bin edges array must be one-dimensional");
+    }
+    const size_t n_edges = static_cast<size_t>(edges.get_shape(0));
+    validate_c_contig_1d(edges, n_edges, "Bin edges");
+    validate_c_contig_1d(dst, n, "Destination");
+    validate_int64_result(dst);
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {src, edges, dst})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(dst, src) || overlap(dst, edges)) {
+        throw py::value_error("Destination array overlaps with inputs");
+    }
+
+    auto fn =
+        digitize_dispatch_table[lookup_typeid(src)][lookup_typeid(edges)];
+    if (fn == nullptr) {
+        throw py::value_error("Digitize is not supported for the given "
+                              "data types of source and bin edges");
+    }
+
+    if (n == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    const char *src_data = src.get_data();
+    const py::ssize_t src_step = src.get_strides_vector()[0];
+    const char *edges_data = edges.get_data();
+    char *dst_data = dst.get_data();
+
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+        comp_ev = fn(exec_q, n, src_data, src_step, edges_data, n_edges,
+                     right, dst_data, depends);
+    }
+
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, {src, edges, dst}, {comp_ev});
+
+    return std::make_pair(ht_ev, comp_ev);
+}
+
+std::pair<sycl::event, sycl::event>
+py_minmax(dpctl::tensor::usm_ndarray src,
+          double lo,
+          double hi,
+          dpctl::tensor::usm_ndarray dst,
+          sycl::queue exec_q,
+          std::vector<sycl::event> const &depends)
+{
+    td_ns::populate_once<init_histogram_dispatch_tables>();
+
+    validate_1d_src(src);
+    validate_c_contig_1d(dst, 2, "Destination");
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {src, dst})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(dst, src)) {
+        throw py::value_error("Destination array overlaps with inputs");
+    }
+
+    auto fn = minmax_dispatch_table[lookup_typeid(src)][lookup_typeid(dst)];
+    if (fn == nullptr) {
+        throw py::value_error("Range of values is not supported for the "
+                              "given data types of source and destination");
+    }
+
+    const size_t n = static_cast<size_t>(src.get_size());
+    const char *src_data = src.get_data();
+    const py::ssize_t src_step = src.get_strides_vector()[0];
+    char *dst_data = dst.get_data();
+
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+        comp_ev = fn(exec_q, n, src_data, src_step, lo, hi, dst_data,
+                     depends);
+    }
+
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, {src, dst}, {comp_ev});
+
+    return std::make_pair(ht_ev, comp_ev);
+}
+
+void init_histogram_functions(py::module_ m)
+{
+    m.def("_histogram", &py_histogram,
+          "Writes counts of elements of one-dimensional array `src` in bins "
+          "with sorted edges `edges` into int64 array `counts`. Flag "
+          "`uniform` indicates equally spaced edges. Returns a tuple of "
+          "events: (host_task_event, compute_task_event).",
+          py::arg("src"), py::arg("edges"), py::arg("uniform"),
+          py::arg("counts"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+
+    m.def("_digitize", &py_digitize,
+          "Writes indices of bins with sorted edges `edges` to which "
+          "elements of one-dimensional array `src` belong into int64 array "
+          "`dst`, as `numpy.digitize` does. Returns a tuple of events: "
+          "(host_task_event, compute_task_event).",
+          py::arg("src"), py::arg("edges"), py::arg("right"), py::arg("dst"),
+          py::arg("sycl_queue"), py::arg("depends") = py::list());
+
+    m.def("_minmax", &py_minmax,
+          "Writes the smallest and the largest of elements of "
+          "one-dimensional array `src` within `[lo, hi]`, ignoring NaNs, "
+          "into two-element floating-point array `dst`. Returns a tuple of "
+          "events: (host_task_event, compute_task_event).",
+          py::arg("src"), py::arg("lo"), py::arg("hi"), py::arg("dst"),
+          py::arg("sycl_queue"), py::arg("depends") = py::list());
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
@@ -35,6 +35,7 @@
 #include "dpctl4pybind11.hpp"
 #include "kernels/integer_advanced_indexing.hpp"
 #include "utils/memory_overlap.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 #include "utils/type_utils.hpp"
 
@@ -51,6 +52,9 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+using dpctl::tensor::alloc_utils::sycl_malloc_device;
+
 namespace td_ns = dpctl::tensor::type_dispatch;
 
 using dpctl::tensor::kernels::indexing::put_fn_ptr_t;
@@ -103,7 +107,7 @@ _populate_kernel_params(sycl::queue exec_q,
 
     usm_host_allocatorT sz_allocator(exec_q);
     std::shared_ptr<shT> host_ind_sh_st_shp =
-        std::make_shared<shT>(ind_sh_elems * (k + 1), sz_allocator);
+        std::make_shared<shT>(ind_sh_sts.size(), sz_allocator);
 
     std::shared_ptr<shT> host_ind_offsets_shp =
         std::make_shared<shT>(k, sz_allocator);
@@ -198,6 +202,57 @@ _populate_kernel_params(sycl::queue exec_q,
     return sh_st_pack_deps;
 }
 
+/*
+ * @brief If every index array varies along at most one axis of the common
+ * shape of indices, as in x[i[:, None], j], replaces packed shape and
+ * strides of indices `ind_sh_sts` with [divisors, extents, strides], which
+ * hold for each index array the product of extents of axes following its
+ * varying axis, the extent of that axis and the stride along it, and
+ * returns true. Otherwise leaves `ind_sh_sts` intact and returns false.
+ */
+bool pack_outer_ind_strides(int k,
+                            int ind_nd,
+                            std::vector<py::ssize_t> &ind_sh_sts)
+{
+    // with a single axis the general indexer does no more work
+    if (ind_nd < 2) {
+        return false;
+    }
+
+    const py::ssize_t *ind_shape = ind_sh_sts.data();
+    std::vector<py::ssize_t> divisors_extents_strides(3 * k);
+    for (int i = 0; i < k; ++i) {
+        const py::ssize_t *ind_strides = ind_shape + (i + 1) * ind_nd;
+
+        int axis = -1;
+        for (int dim = 0; dim < ind_nd; ++dim) {
+            if (ind_shape[dim] > 1 && ind_strides[dim] != 0) {
+                if (axis >= 0) {
+                    return false;
+                }
+                axis = dim;
+            }
+        }
+
+        py::ssize_t divisor(1);
+        py::ssize_t extent(1);
+        py::ssize_t stride(0);
+        if (axis >= 0) {
+            for (int dim = axis + 1; dim < ind_nd; ++dim) {
+                divisor *= ind_shape[dim];
+            }
+            extent = ind_shape[axis];
+            stride = ind_strides[axis];
+        }
+        divisors_extents_strides[i] = divisor;
+        divisors_extents_strides[k + i] = extent;
+        divisors_extents_strides[2 * k + i] = stride;
+    }
+
+    ind_sh_sts = std::move(divisors_extents_strides);
+    return true;
+}
+
 /* Utility to parse python object py_ind into vector of `usm_ndarray`s */
 std::vector<dpctl::tensor::usm_ndarray> parse_py_ind(const sycl::queue &q,
                                                      py::object py_ind)
@@ -241,6 +296,8 @@ usm_ndarray_take(dpctl::tensor::usm_ndarray src,
                  sycl::queue exec_q,
                  const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<init_advanced_indexing_dispatch_tables>();
+
     std::vector<dpctl::tensor::usm_ndarray> ind = parse_py_ind(exec_q, py_ind);
 
     int k = ind.size();
@@ -418,124 +475,140 @@ usm_ndarray_take(dpctl::tensor::usm_ndarray src,
         ind_offsets.push_back(py::ssize_t(0));
     }
 
-    char **packed_ind_ptrs = sycl::malloc_device<char *>(k, exec_q);
+    const bool outer_ind = pack_outer_ind_strides(k, ind_nd, ind_sh_sts);
 
-    if (packed_ind_ptrs == nullptr) {
-        throw std::runtime_error(
-            "Unable to allocate packed_ind_ptrs device memory");
-    }
-
-    // rearrange to past where indices shapes are checked
-    // packed_ind_shapes_strides = [ind_shape,
-    //                              ind[0] strides,
-    //                              ...,
-    //                              ind[k] strides]
-    py::ssize_t *packed_ind_shapes_strides =
-        sycl::malloc_device<py::ssize_t>((k + 1) * ind_sh_elems, exec_q);
-
-    if (packed_ind_shapes_strides == nullptr) {
-        sycl::free(packed_ind_ptrs, exec_q);
-        throw std::runtime_error(
-            "Unable to allocate packed_ind_shapes_strides device memory");
-    }
+    auto src_strides = src.get_strides_vector();
+    auto dst_strides = dst.get_strides_vector();
 
-    py::ssize_t *packed_ind_offsets =
-        sycl::malloc_device<py::ssize_t>(k, exec_q);
+    std::vector<sycl::event> host_task_events;
+    host_task_events.reserve(2);
 
-    if (packed_ind_offsets == nullptr) {
-        sycl::free(packed_ind_ptrs, exec_q);
-        sycl::free(packed_ind_shapes_strides, exec_q);
-        throw std::runtime_error(
-            "Unable to allocate packed_ind_offsets device memory");
-    }
+    sycl::event take_generic_ev;
+    {
+        py::gil_scoped_release release;
 
-    int orthog_sh_elems = std::max<int>(src_nd - k, 1);
+        char **packed_ind_ptrs =
+            sycl_malloc_device<char *>(k, exec_q, "usm_ndarray_take");
 
-    // packed_shapes_strides = [src_shape[:axis] + src_shape[axis+k:],
-    //                          src_strides[:axis] + src_strides[axis+k:],
-    //                          dst_strides[:axis] +
-    //                          dst_strides[axis+ind.ndim:]]
-    py::ssize_t *packed_shapes_strides =
-        sycl::malloc_device<py::ssize_t>(3 * orthog_sh_elems, exec_q);
+        if (packed_ind_ptrs == nullptr) {
+            throw std::runtime_error(
+                "Unable to allocate packed_ind_ptrs device memory");
+        }
 
-    if (packed_shapes_strides == nullptr) {
-        sycl::free(packed_ind_ptrs, exec_q);
-        sycl::free(packed_ind_shapes_strides, exec_q);
-        sycl::free(packed_ind_offsets, exec_q);
-        throw std::runtime_error(
-            "Unable to allocate packed_shapes_strides device memory");
-    }
+        // rearrange to past where indices shapes are checked
+        // packed_ind_shapes_strides = [ind_shape,
+        //                              ind[0] strides,
+        //                              ...,
+        //                              ind[k] strides]
+        // or, for outer indices, [divisors, extents, strides]
+        py::ssize_t *packed_ind_shapes_strides =
+            sycl_malloc_device<py::ssize_t>(ind_sh_sts.size(), exec_q,
+                                            "usm_ndarray_take");
+
+        if (packed_ind_shapes_strides == nullptr) {
+            sycl_free_noexcept(packed_ind_ptrs, exec_q);
+            throw std::runtime_error(
+                "Unable to allocate packed_ind_shapes_strides device memory");
+        }
 
-    // packed_axes_shapes_strides = [src_shape[axis:axis+k],
-    //                               src_strides[axis:axis+k],
-    //                               dst_shape[axis:axis+ind.ndim],
-    //                               dst_strides[axis:axis+ind.ndim]]
-    py::ssize_t *packed_axes_shapes_strides =
-        sycl::malloc_device<py::ssize_t>(2 * (k + ind_sh_elems), exec_q);
+        py::ssize_t *packed_ind_offsets =
+            sycl_malloc_device<py::ssize_t>(k, exec_q, "usm_ndarray_take");
 
-    if (packed_axes_shapes_strides == nullptr) {
-        sycl::free(packed_ind_ptrs, exec_q);
-        sycl::free(packed_ind_shapes_strides, exec_q);
-        sycl::free(packed_ind_offsets, exec_q);
-        sycl::free(packed_shapes_strides, exec_q);
-        throw std::runtime_error(
-            "Unable to allocate packed_axes_shapes_strides device memory");
-    }
+        if (packed_ind_offsets == nullptr) {
+            sycl_free_noexcept(packed_ind_ptrs, exec_q);
+            sycl_free_noexcept(packed_ind_shapes_strides, exec_q);
+            throw std::runtime_error(
+                "Unable to allocate packed_ind_offsets device memory");
+        }
 
-    auto src_strides = src.get_strides_vector();
-    auto dst_strides = dst.get_strides_vector();
+        int orthog_sh_elems = std::max<int>(src_nd - k, 1);
+
+        // packed_shapes_strides = [src_shape[:axis] + src_shape[axis+k:],
+        //                          src_strides[:axis] + src_strides[axis+k:],
+        //                          dst_strides[:axis] +
+        //                          dst_strides[axis+ind.ndim:]]
+        py::ssize_t *packed_shapes_strides = sycl_malloc_device<py::ssize_t>(
+            3 * orthog_sh_elems, exec_q, "usm_ndarray_take");
+
+        if (packed_shapes_strides == nullptr) {
+            sycl_free_noexcept(packed_ind_ptrs, exec_q);
+            sycl_free_noexcept(packed_ind_shapes_strides, exec_q);
+            sycl_free_noexcept(packed_ind_offsets, exec_q);
+            throw std::runtime_error(
+                "Unable to allocate packed_shapes_strides device memory");
+        }
 
-    std::vector<sycl::event> host_task_events;
-    host_task_events.reserve(2);
+        // packed_axes_shapes_strides = [src_shape[axis:axis+k],
+        //                               src_strides[axis:axis+k],
+        //                               dst_shape[axis:axis+ind.ndim],
+        //                               dst_strides[axis:axis+ind.ndim]]
+        py::ssize_t *packed_axes_shapes_strides =
+            sycl_malloc_device<py::ssize_t>(2 * (k + ind_sh_elems), exec_q,
+                                            "usm_ndarray_take");
+
+        if (packed_axes_shapes_strides == nullptr) {
+            sycl_free_noexcept(packed_ind_ptrs, exec_q);
+            sycl_free_noexcept(packed_ind_shapes_strides, exec_q);
+            sycl_free_noexcept(packed_ind_offsets, exec_q);
+            sycl_free_noexcept(packed_shapes_strides, exec_q);
+            throw std::runtime_error(
+                "Unable to allocate packed_axes_shapes_strides device memory");
+        }
 
-    std::vector<sycl::event> pack_deps = _populate_kernel_params(
-        exec_q, host_task_events, packed_ind_ptrs, packed_ind_shapes_strides,
-        packed_ind_offsets, packed_shapes_strides, packed_axes_shapes_strides,
-        src_shape, dst_shape, src_strides, dst_strides, ind_sh_sts, ind_ptrs,
-        ind_offsets, axis_start, k, ind_nd, src_nd, orthog_sh_elems,
-        ind_sh_elems);
-
-    std::vector<sycl::event> all_deps;
-    all_deps.reserve(depends.size() + pack_deps.size());
-    all_deps.insert(std::end(all_deps), std::begin(pack_deps),
-                    std::end(pack_deps));
-    all_deps.insert(std::end(all_deps), std::begin(depends), std::end(depends));
-
-    auto fn = take_dispatch_table[mode][src_type_id][ind_type_id];
-
-    if (fn == nullptr) {
-        sycl::event::wait(host_task_events);
-        sycl::free(packed_ind_ptrs, exec_q);
-        sycl::free(packed_ind_shapes_strides, exec_q);
-        sycl::free(packed_ind_offsets, exec_q);
-        sycl::free(packed_shapes_strides, exec_q);
-        sycl::free(packed_axes_shapes_strides, exec_q);
-        throw std::runtime_error("Indices must be integer type, got " +
-                                 std::to_string(ind_type_id));
-    }
-
-    sycl::event take_generic_ev =
-        fn(exec_q, orthog_nelems, ind_nelems, orthog_sh_elems, ind_sh_elems, k,
-           packed_shapes_strides, packed_axes_shapes_strides,
-           packed_ind_shapes_strides, src_data, dst_data, packed_ind_ptrs,
-           src_offset, dst_offset, packed_ind_offsets, all_deps);
-
-    // free packed temporaries
-    sycl::event temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(take_generic_ev);
-        auto ctx = exec_q.get_context();
-        cgh.host_task([packed_shapes_strides, packed_axes_shapes_strides,
-                       packed_ind_shapes_strides, packed_ind_ptrs,
-                       packed_ind_offsets, ctx]() {
-            sycl::free(packed_shapes_strides, ctx);
-            sycl::free(packed_axes_shapes_strides, ctx);
-            sycl::free(packed_ind_shapes_strides, ctx);
-            sycl::free(packed_ind_ptrs, ctx);
-            sycl::free(packed_ind_offsets, ctx);
-        });
-    });
+        std::vector<sycl::event> pack_deps = _populate_kernel_params(
+            exec_q, host_task_events, packed_ind_ptrs,
+            packed_ind_shapes_strides, packed_ind_offsets,
+            packed_shapes_strides, packed_axes_shapes_strides, src_shape,
+            dst_shape, src_strides, dst_strides, ind_sh_sts, ind_ptrs,
+            ind_offsets, axis_start, k, ind_nd, src_nd, orthog_sh_elems,
+            ind_sh_elems);
+
+        std::vector<sycl::event> all_deps;
+        all_deps.reserve(depends.size() + pack_deps.size());
+        all_deps.insert(std::end(all_deps), std::begin(pack_deps),
+                        std::end(pack_deps));
+        all_deps.insert(std::end(all_deps), std::begin(depends),
+                        std::end(depends));
+
+        auto fn = take_dispatch_table[mode][src_type_id][ind_type_id];
+
+        if (fn == nullptr) {
+            sycl::event::wait(host_task_events);
+            sycl_free_noexcept(packed_ind_ptrs, exec_q);
+            sycl_free_noexcept(packed_ind_shapes_strides, exec_q);
+            sycl_free_noexcept(packed_ind_offsets, exec_q);
+            sycl_free_noexcept(packed_shapes_strides, exec_q);
+            sycl_free_noexcept(packed_axes_shapes_strides, exec_q);
+            throw std::runtime_error("Indices must be integer type, got " +
+                                     std::to_string(ind_type_id));
+        }
 
-    host_task_events.push_back(temporaries_cleanup_ev);
+        take_generic_ev =
+            fn(exec_q, orthog_nelems, ind_nelems, orthog_sh_elems,
+               ind_sh_elems, k, packed_shapes_strides,
+               packed_axes_shapes_strides, packed_ind_shapes_strides,
+               src_data, dst_data, packed_ind_ptrs, src_offset, dst_offset,
+               packed_ind_offsets, outer_ind, all_deps);
+
+        // free packed temporaries
+        sycl::event temporaries_cleanup_ev =
+            exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(take_generic_ev);
+                auto ctx = exec_q.get_context();
+                cgh.host_task([packed_shapes_strides,
+                               packed_axes_shapes_strides,
+                               packed_ind_shapes_strides, packed_ind_ptrs,
+                               packed_ind_offsets, ctx]() {
+                    sycl_free_noexcept(packed_shapes_strides, ctx);
+                    sycl_free_noexcept(packed_axes_shapes_strides, ctx);
+                    sycl_free_noexcept(packed_ind_shapes_strides, ctx);
+                    sycl_free_noexcept(packed_ind_ptrs, ctx);
+                    sycl_free_noexcept(packed_ind_offsets, ctx);
+                });
+            });
+
+        host_task_events.push_back(temporaries_cleanup_ev);
+    }
 
     sycl::event arg_cleanup_ev =
         keep_args_alive(exec_q, {src, py_ind, dst}, host_task_events);
@@ -552,6 +625,8 @@ usm_ndarray_put(dpctl::tensor::usm_ndarray dst,
                 sycl::queue exec_q,
                 const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<init_advanced_indexing_dispatch_tables>();
+
     std::vector<dpctl::tensor::usm_ndarray> ind = parse_py_ind(exec_q, py_ind);
     int k = ind.size();
 
@@ -733,123 +808,139 @@ usm_ndarray_put(dpctl::tensor::usm_ndarray dst,
         ind_offsets.push_back(py::ssize_t(0));
     }
 
-    char **packed_ind_ptrs = sycl::malloc_device<char *>(k, exec_q);
+    const bool outer_ind = pack_outer_ind_strides(k, ind_nd, ind_sh_sts);
 
-    if (packed_ind_ptrs == nullptr) {
-        throw std::runtime_error(
-            "Unable to allocate packed_ind_ptrs device memory");
-    }
-
-    // packed_ind_shapes_strides = [ind_shape,
-    //                              ind[0] strides,
-    //                              ...,
-    //                              ind[k] strides]
-    py::ssize_t *packed_ind_shapes_strides =
-        sycl::malloc_device<py::ssize_t>((k + 1) * ind_sh_elems, exec_q);
-
-    if (packed_ind_shapes_strides == nullptr) {
-        sycl::free(packed_ind_ptrs, exec_q);
-        throw std::runtime_error(
-            "Unable to allocate packed_ind_shapes_strides device memory");
-    }
+    auto dst_strides = dst.get_strides_vector();
+    auto val_strides = val.get_strides_vector();
 
-    py::ssize_t *packed_ind_offsets =
-        sycl::malloc_device<py::ssize_t>(k, exec_q);
+    std::vector<sycl::event> host_task_events;
+    host_task_events.reserve(2);
 
-    if (packed_ind_offsets == nullptr) {
-        sycl::free(packed_ind_ptrs, exec_q);
-        sycl::free(packed_ind_shapes_strides, exec_q);
-        throw std::runtime_error(
-            "Unable to allocate packed_ind_offsets device memory");
-    }
+    sycl::event put_generic_ev;
+    {
+        py::gil_scoped_release release;
 
-    int orthog_sh_elems = std::max<int>(dst_nd - k, 1);
+        char **packed_ind_ptrs =
+            sycl_malloc_device<char *>(k, exec_q, "usm_ndarray_put");
 
-    // packed_shapes_strides = [dst_shape[:axis] + dst_shape[axis+k:],
-    //                          dst_strides[:axis] + dst_strides[axis+k:],
-    //                          val_strides[:axis] +
-    //                          val_strides[axis+ind.ndim:]]
-    py::ssize_t *packed_shapes_strides =
-        sycl::malloc_device<py::ssize_t>(3 * orthog_sh_elems, exec_q);
+        if (packed_ind_ptrs == nullptr) {
+            throw std::runtime_error(
+                "Unable to allocate packed_ind_ptrs device memory");
+        }
 
-    if (packed_shapes_strides == nullptr) {
-        sycl::free(packed_ind_ptrs, exec_q);
-        sycl::free(packed_ind_shapes_strides, exec_q);
-        sycl::free(packed_ind_offsets, exec_q);
-        throw std::runtime_error(
-            "Unable to allocate packed_shapes_strides device memory");
-    }
+        // packed_ind_shapes_strides = [ind_shape,
+        //                              ind[0] strides,
+        //                              ...,
+        //                              ind[k] strides]
+        // or, for outer indices, [divisors, extents, strides]
+        py::ssize_t *packed_ind_shapes_strides =
+            sycl_malloc_device<py::ssize_t>(ind_sh_sts.size(), exec_q,
+                                            "usm_ndarray_put");
+
+        if (packed_ind_shapes_strides == nullptr) {
+            sycl_free_noexcept(packed_ind_ptrs, exec_q);
+            throw std::runtime_error(
+                "Unable to allocate packed_ind_shapes_strides device memory");
+        }
 
-    // packed_axes_shapes_strides = [dst_shape[axis:axis+k],
-    //                               dst_strides[axis:axis+k],
-    //                               val_shape[axis:axis+ind.ndim],
-    //                               val_strides[axis:axis+ind.ndim]]
-    py::ssize_t *packed_axes_shapes_strides =
-        sycl::malloc_device<py::ssize_t>(2 * (k + ind_sh_elems), exec_q);
+        py::ssize_t *packed_ind_offsets =
+            sycl_malloc_device<py::ssize_t>(k, exec_q, "usm_ndarray_put");
 
-    if (packed_axes_shapes_strides == nullptr) {
-        sycl::free(packed_ind_ptrs, exec_q);
-        sycl::free(packed_ind_shapes_strides, exec_q);
-        sycl::free(packed_ind_offsets, exec_q);
-        sycl::free(packed_shapes_strides, exec_q);
-        throw std::runtime_error(
-            "Unable to allocate packed_axes_shapes_strides device memory");
-    }
+        if (packed_ind_offsets == nullptr) {
+            sycl_free_noexcept(packed_ind_ptrs, exec_q);
+            sycl_free_noexcept(packed_ind_shapes_strides, exec_q);
+            throw std::runtime_error(
+                "Unable to allocate packed_ind_offsets device memory");
+        }
 
-    auto dst_strides = dst.get_strides_vector();
-    auto val_strides = val.get_strides_vector();
+        int orthog_sh_elems = std::max<int>(dst_nd - k, 1);
+
+        // packed_shapes_strides = [dst_shape[:axis] + dst_shape[axis+k:],
+        //                          dst_strides[:axis] + dst_strides[axis+k:],
+        //                          val_strides[:axis] +
+        //                          val_strides[axis+ind.ndim:]]
+        py::ssize_t *packed_shapes_strides = sycl_malloc_device<py::ssize_t>(
+            3 * orthog_sh_elems, exec_q, "usm_ndarray_put");
+
+        if (packed_shapes_strides == nullptr) {
+            sycl_free_noexcept(packed_ind_ptrs, exec_q);
+            sycl_free_noexcept(packed_ind_shapes_strides, exec_q);
+            sycl_free_noexcept(packed_ind_offsets, exec_q);
+            throw std::runtime_error(
+                "Unable to allocate packed_shapes_strides device memory");
+        }
 
-    std::vector<sycl::event> host_task_events;
-    host_task_events.reserve(2);
+        // packed_axes_shapes_strides = [dst_shape[axis:axis+k],
+        //                               dst_strides[axis:axis+k],
+        //                               val_shape[axis:axis+ind.ndim],
+        //                               val_strides[axis:axis+ind.ndim]]
+        py::ssize_t *packed_axes_shapes_strides =
+            sycl_malloc_device<py::ssize_t>(2 * (k + ind_sh_elems), exec_q,
+                                            "usm_ndarray_put");
+
+        if (packed_axes_shapes_strides == nullptr) {
+            sycl_free_noexcept(packed_ind_ptrs, exec_q);
+            sycl_free_noexcept(packed_ind_shapes_strides, exec_q);
+            sycl_free_noexcept(packed_ind_offsets, exec_q);
+            sycl_free_noexcept(packed_shapes_strides, exec_q);
+            throw std::runtime_error(
+                "Unable to allocate packed_axes_shapes_strides device memory");
+        }
 
-    std::vector<sycl::event> pack_deps = _populate_kernel_params(
-        exec_q, host_task_events, packed_ind_ptrs, packed_ind_shapes_strides,
-        packed_ind_offsets, packed_shapes_strides, packed_axes_shapes_strides,
-        dst_shape, val_shape, dst_strides, val_strides, ind_sh_sts, ind_ptrs,
-        ind_offsets, axis_start, k, ind_nd, dst_nd, orthog_sh_elems,
-        ind_sh_elems);
-
-    std::vector<sycl::event> all_deps;
-    all_deps.reserve(depends.size() + pack_deps.size());
-    all_deps.insert(std::end(all_deps), std::begin(pack_deps),
-                    std::end(pack_deps));
-    all_deps.insert(std::end(all_deps), std::begin(depends), std::end(depends));
-
-    auto fn = put_dispatch_table[mode][dst_type_id][ind_type_id];
-
-    if (fn == nullptr) {
-        sycl::event::wait(host_task_events);
-        sycl::free(packed_ind_ptrs, exec_q);
-        sycl::free(packed_ind_shapes_strides, exec_q);
-        sycl::free(packed_ind_offsets, exec_q);
-        sycl::free(packed_shapes_strides, exec_q);
-        sycl::free(packed_axes_shapes_strides, exec_q);
-        throw std::runtime_error("Indices must be integer type, got " +
-                                 std::to_string(ind_type_id));
-    }
-
-    sycl::event put_generic_ev =
-        fn(exec_q, orthog_nelems, ind_nelems, orthog_sh_elems, ind_sh_elems, k,
-           packed_shapes_strides, packed_axes_shapes_strides,
-           packed_ind_shapes_strides, dst_data, val_data, packed_ind_ptrs,
-           dst_offset, val_offset, packed_ind_offsets, all_deps);
-
-    // free packed temporaries
-    sycl::event temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(put_generic_ev);
-        auto ctx = exec_q.get_context();
-        cgh.host_task([packed_shapes_strides, packed_axes_shapes_strides,
-                       packed_ind_shapes_strides, packed_ind_ptrs,
-                       packed_ind_offsets, ctx]() {
-            sycl::free(packed_shapes_strides, ctx);
-            sycl::free(packed_axes_shapes_strides, ctx);
-            sycl::free(packed_ind_shapes_strides, ctx);
-            sycl::free(packed_ind_ptrs, ctx);
-            sycl::free(packed_ind_offsets, ctx);
-        });
-    });
+        std::vector<sycl::event> pack_deps = _populate_kernel_params(
+            exec_q, host_task_events, packed_ind_ptrs,
+            packed_ind_shapes_strides, packed_ind_offsets,
+            packed_shapes_strides, packed_axes_shapes_strides, dst_shape,
+            val_shape, dst_strides, val_strides, ind_sh_sts, ind_ptrs,
+            ind_offsets, axis_start, k, ind_nd, dst_nd, orthog_sh_elems,
+            ind_sh_elems);
+
+        std::vector<sycl::event> all_deps;
+        all_deps.reserve(depends.size() + pack_deps.size());
+        all_deps.insert(std::end(all_deps), std::begin(pack_deps),
+                        std::end(pack_deps));
+        all_deps.insert(std::end(all_deps), std::begin(depends),
+                        std::end(depends));
+
+        auto fn = put_dispatch_table[mode][dst_type_id][ind_type_id];
+
+        if (fn == nullptr) {
+            sycl::event::wait(host_task_events);
+            sycl_free_noexcept(packed_ind_ptrs, exec_q);
+            sycl_free_noexcept(packed_ind_shapes_strides, exec_q);
+            sycl_free_noexcept(packed_ind_offsets, exec_q);
+            sycl_free_noexcept(packed_shapes_strides, exec_q);
+            sycl_free_noexcept(packed_axes_shapes_strides, exec_q);
+            throw std::runtime_error("Indices must be integer type, got " +
+                                     std::to_string(ind_type_id));
+        }
 
-    host_task_events.push_back(temporaries_cleanup_ev);
+        put_generic_ev =
+            fn(exec_q, orthog_nelems, ind_nelems, orthog_sh_elems,
+               ind_sh_elems, k, packed_shapes_strides,
+               packed_axes_shapes_strides, packed_ind_shapes_strides,
+               dst_data, val_data, packed_ind_ptrs, dst_offset, val_offset,
+               packed_ind_offsets, outer_ind, all_deps);
+
+        // free packed temporaries
+        sycl::event temporaries_cleanup_ev =
+            exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(put_generic_ev);
+                auto ctx = exec_q.get_context();
+                cgh.host_task([packed_shapes_strides,
+                               packed_axes_shapes_strides,
+                               packed_ind_shapes_strides, packed_ind_ptrs,
+                               packed_ind_offsets, ctx]() {
+                    sycl_free_noexcept(packed_shapes_strides, ctx);
+                    sycl_free_noexcept(packed_axes_shapes_strides, ctx);
+                    sycl_free_noexcept(packed_ind_shapes_strides, ctx);
+                    sycl_free_noexcept(packed_ind_ptrs, ctx);
+                    sycl_free_noexcept(packed_ind_offsets, ctx);
+                });
+            });
+
+        host_task_events.push_back(temporaries_cleanup_ev);
+    }
 
     sycl::event arg_cleanup_ev =
         keep_args_alive(exec_q, {dst, py_ind, val}, host_task_events);
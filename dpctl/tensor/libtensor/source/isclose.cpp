@@ -0,0 +1,421 @@
+//===-- isclose.cpp - Implementation of isclose and allclose --*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines Python API for implementation functions of
+/// dpctl.tensor.isclose and dpctl.tensor.allclose
+//===----------------------------------------------------------------------===//
+
+#include "dpctl4pybind11.hpp"
+#include <CL/sycl.hpp>
+#include <complex>
+#include <cstdint>
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <stdexcept>
+#include <utility>
+
+#include "isclose.hpp"
+#include "kernels/isclose.hpp"
+#include "simplify_iteration_space.hpp"
+#include "utils/memory_overlap.hpp"
+#include "utils/offset_utils.hpp"
+#include "utils/sycl_alloc_utils.hpp"
+#include "utils/type_dispatch.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+using dpctl::tensor::kernels::isclose::allclose_contig_impl_fn_ptr_t;
+using dpctl::tensor::kernels::isclose::allclose_strided_impl_fn_ptr_t;
+using dpctl::tensor::kernels::isclose::isclose_contig_impl_fn_ptr_t;
+using dpctl::tensor::kernels::isclose::isclose_strided_impl_fn_ptr_t;
+
+static isclose_contig_impl_fn_ptr_t
+    isclose_contig_dispatch_vector[td_ns::num_types];
+static isclose_strided_impl_fn_ptr_t
+    isclose_strided_dispatch_vector[td_ns::num_types];
+static allclose_contig_impl_fn_ptr_t
+    allclose_contig_dispatch_vector[td_ns::num_types];
+static allclose_strided_impl_fn_ptr_t
+    allclose_strided_dispatch_vector[td_ns::num_types];
+
+using dpctl::utils::keep_args_alive;
+
+namespace
+{
+
+/*! @brief Validates arguments common to isclose and allclose, and returns
+ * type id of elements of inputs and number of elements */
+std::pair<int, size_t>
+validate_closeness_args(const dpctl::tensor::usm_ndarray &a,
+                        const dpctl::tensor::usm_ndarray &b,
+                        const dpctl::tensor::usm_ndarray &dst,
+                        sycl::queue &exec_q)
+{
+    if (!dst.is_writable()) {
+        throw py::value_error("Output array is read-only.");
+    }
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {a, b, dst})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    auto const &array_types = td_ns::usm_ndarray_types();
+    int a_typeid = array_types.typenum_to_lookup_id(a.get_typenum());
+    int b_typeid = array_types.typenum_to_lookup_id(b.get_typenum());
+    int dst_typeid = array_types.typenum_to_lookup_id(dst.get_typenum());
+
+    if (a_typeid != b_typeid) {
+        throw py::value_error("Input arrays must have the same data type");
+    }
+    if (dst_typeid != static_cast<int>(td_ns::typenum_t::BOOL)) {
+        throw py::value_error("Destination array must have boolean data type");
+    }
+
+    int nd = a.get_ndim();
+    if (nd != b.get_ndim()) {
+        throw py::value_error("Array dimensions are not the same.");
+    }
+
+    const py::ssize_t *a_shape = a.get_shape_raw();
+    const py::ssize_t *b_shape = b.get_shape_raw();
+    bool shapes_equal(true);
+    size_t nelems(1);
+    for (int i = 0; i < nd; ++i) {
+        nelems *= static_cast<size_t>(a_shape[i]);
+        shapes_equal = shapes_equal && (a_shape[i] == b_shape[i]);
+    }
+    if (!shapes_equal) {
+        throw py::value_error("Array shapes are not the same.");
+    }
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(dst, a) || overlap(dst, b)) {
+        throw py::value_error("Destination array overlaps with input.");
+    }
+
+    return std::make_pair(a_typeid, nelems);
+}
+
+} // namespace
+
+std::pair<sycl::event, sycl::event>
+py_isclose(dpctl::tensor::usm_ndarray a,
+           dpctl::tensor::usm_ndarray b,
+           dpctl::tensor::usm_ndarray dst,
+           double atol,
+           double rtol,
+           bool equal_nan,
+           sycl::queue exec_q,
+           const std::vector<sycl::event> &depends)
+{
+    td_ns::populate_once<init_isclose_dispatch_vectors>();
+
+    const auto &typeid_nelems = validate_closeness_args(a, b, dst, exec_q);
+    int type_id = typeid_nelems.first;
+    size_t nelems = typeid_nelems.second;
+
+    int nd = dst.get_ndim();
+    if (nd != a.get_ndim()) {
+        throw py::value_error("Array dimensions are not the same.");
+    }
+    const py::ssize_t *shape = a.get_shape_raw();
+    const py::ssize_t *dst_shape = dst.get_shape_raw();
+    for (int i = 0; i < nd; ++i) {
+        if (shape[i] != dst_shape[i]) {
+            throw py::value_error("Array shapes are not the same.");
+        }
+    }
+
+    if (nelems == 0) {
+        return std::make_pair(sycl::event{}, sycl::event{});
+    }
+
+    // destination must be ample enough to accommodate all elements
+    auto dst_offsets = dst.get_minmax_offsets();
+    {
+        size_t range =
+            static_cast<size_t>(dst_offsets.second - dst_offsets.first);
+        if (range + 1 < nelems) {
+            throw py::value_error(
+                "Destination array can not accommodate all the "
+                "elements of source array.");
+        }
+    }
+
+    const char *a_data = a.get_data();
+    const char *b_data = b.get_data();
+    char *dst_data = dst.get_data();
+
+    bool all_c_contig =
+        (a.is_c_contiguous() && b.is_c_contiguous() && dst.is_c_contiguous());
+    bool all_f_contig =
+        (a.is_f_contiguous() && b.is_f_contiguous() && dst.is_f_contiguous());
+
+    if (all_c_contig || all_f_contig) {
+        auto contig_fn = isclose_contig_dispatch_vector[type_id];
+
+        sycl::event comp_ev;
+        {
+            py::gil_scoped_release release;
+            comp_ev = contig_fn(exec_q, nelems, a_data, b_data, dst_data,
+                                atol, rtol, equal_nan, depends);
+        }
+        sycl::event ht_ev = keep_args_alive(exec_q, {a, b, dst}, {comp_ev});
+
+        return std::make_pair(ht_ev, comp_ev);
+    }
+
+    auto const &a_strides = a.get_strides_vector();
+    auto const &b_strides = b.get_strides_vector();
+    auto const &dst_strides = dst.get_strides_vector();
+
+    using shT = std::vector<py::ssize_t>;
+    shT simplified_shape;
+    shT simplified_a_strides;
+    shT simplified_b_strides;
+    shT simplified_dst_strides;
+    py::ssize_t a_offset(0);
+    py::ssize_t b_offset(0);
+    py::ssize_t dst_offset(0);
+
+    dpctl::tensor::py_internal::simplify_iteration_space_3(
+        nd, shape, a_strides, b_strides, dst_strides,
+        // outputs
+        simplified_shape, simplified_a_strides, simplified_b_strides,
+        simplified_dst_strides, a_offset, b_offset, dst_offset);
+
+    std::vector<sycl::event> host_task_events;
+    host_task_events.reserve(2);
+
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+
+        using dpctl::tensor::offset_utils::device_allocate_and_pack;
+        const auto &ptr_size_event_tuple =
+            device_allocate_and_pack<py::ssize_t>(
+                exec_q, host_task_events, simplified_shape,
+                simplified_a_strides, simplified_b_strides,
+                simplified_dst_strides);
+        py::ssize_t *packed_shape_strides = std::get<0>(ptr_size_event_tuple);
+        sycl::event copy_shape_strides_ev = std::get<2>(ptr_size_event_tuple);
+
+        if (packed_shape_strides == nullptr) {
+            throw std::runtime_error("Unable to allocate device memory");
+        }
+
+        std::vector<sycl::event> all_deps;
+        all_deps.reserve(depends.size() + 1);
+        all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+        all_deps.push_back(copy_shape_strides_ev);
+
+        auto strided_fn = isclose_strided_dispatch_vector[type_id];
+        comp_ev = strided_fn(exec_q, nelems, nd, packed_shape_strides, a_data,
+                             a_offset, b_data, b_offset, dst_data, dst_offset,
+                             atol, rtol, equal_nan, all_deps);
+
+        // free packed temporaries
+        sycl::event temporaries_cleanup_ev =
+            exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(comp_ev);
+                auto ctx = exec_q.get_context();
+                cgh.host_task([packed_shape_strides, ctx]() {
+                    sycl_free_noexcept(packed_shape_strides, ctx);
+                });
+            });
+        host_task_events.push_back(temporaries_cleanup_ev);
+    }
+
+    sycl::event arg_cleanup_ev =
+        keep_args_alive(exec_q, {a, b, dst}, host_task_events);
+
+    return std::make_pair(arg_cleanup_ev, comp_ev);
+}
+
+std::pair<sycl::event, sycl::event>
+py_allclose(dpctl::tensor::usm_ndarray a,
+            dpctl::tensor::usm_ndarray b,
+            dpctl::tensor::usm_ndarray dst,
+            double atol,
+            double rtol,
+            bool equal_nan,
+            sycl::queue exec_q,
+            const std::vector<sycl::event> &depends)
+{
+    td_ns::populate_once<init_isclose_dispatch_vectors>();
+
+    const auto &typeid_nelems = validate_closeness_args(a, b, dst, exec_q);
+    int type_id = typeid_nelems.first;
+    size_t nelems = typeid_nelems.second;
+
+    if (dst.get_ndim() != 0) {
+        throw py::value_error("Destination array must be zero-dimensional");
+    }
+
+    char *dst_data = dst.get_data();
+
+    if (nelems == 0) {
+        // empty arrays are close
+        sycl::event fill_ev;
+        {
+            py::gil_scoped_release release;
+            fill_ev = exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(depends);
+                bool *dst_p = reinterpret_cast<bool *>(dst_data);
+                cgh.single_task([=]() { *dst_p = true; });
+            });
+        }
+        sycl::event ht_ev = keep_args_alive(exec_q, {a, b, dst}, {fill_ev});
+
+        return std::make_pair(ht_ev, fill_ev);
+    }
+
+    const char *a_data = a.get_data();
+    const char *b_data = b.get_data();
+
+    std::vector<sycl::event> host_task_events;
+    host_task_events.reserve(3);
+
+    bool both_c_contig = (a.is_c_contiguous() && b.is_c_contiguous());
+    bool both_f_contig = (a.is_f_contiguous() && b.is_f_contiguous());
+
+    if (both_c_contig || both_f_contig) {
+        auto contig_fn = allclose_contig_dispatch_vector[type_id];
+
+        sycl::event comp_ev;
+        {
+            py::gil_scoped_release release;
+            comp_ev = contig_fn(exec_q, host_task_events, nelems, a_data,
+                                b_data, dst_data, atol, rtol, equal_nan,
+                                depends);
+        }
+        sycl::event ht_ev =
+            keep_args_alive(exec_q, {a, b, dst}, host_task_events);
+
+        return std::make_pair(ht_ev, comp_ev);
+    }
+
+    int nd = a.get_ndim();
+    const py::ssize_t *shape = a.get_shape_raw();
+    auto const &a_strides = a.get_strides_vector();
+    auto const &b_strides = b.get_strides_vector();
+
+    using shT = std::vector<py::ssize_t>;
+    shT simplified_shape;
+    shT simplified_a_strides;
+    shT simplified_b_strides;
+    py::ssize_t a_offset(0);
+    py::ssize_t b_offset(0);
+
+    dpctl::tensor::py_internal::simplify_iteration_space(
+        nd, shape, a_strides, b_strides,
+        // outputs
+        simplified_shape, simplified_a_strides, simplified_b_strides, a_offset,
+        b_offset);
+
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+
+        using dpctl::tensor::offset_utils::device_allocate_and_pack;
+        const auto &ptr_size_event_tuple =
+            device_allocate_and_pack<py::ssize_t>(
+                exec_q, host_task_events, simplified_shape,
+                simplified_a_strides, simplified_b_strides);
+        py::ssize_t *packed_shape_strides = std::get<0>(ptr_size_event_tuple);
+        sycl::event copy_shape_strides_ev = std::get<2>(ptr_size_event_tuple);
+
+        if (packed_shape_strides == nullptr) {
+            throw std::runtime_error("Unable to allocate device memory");
+        }
+
+        std::vector<sycl::event> all_deps;
+        all_deps.reserve(depends.size() + 1);
+        all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+        all_deps.push_back(copy_shape_strides_ev);
+
+        auto strided_fn = allclose_strided_dispatch_vector[type_id];
+        comp_ev = strided_fn(exec_q, host_task_events, nelems, nd,
+                             packed_shape_strides, a_data, a_offset, b_data,
+                             b_offset, dst_data, atol, rtol, equal_nan,
+                             all_deps);
+
+        // free packed temporaries
+        sycl::event temporaries_cleanup_ev =
+            exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(comp_ev);
+                auto ctx = exec_q.get_context();
+                cgh.host_task([packed_shape_strides, ctx]() {
+                    sycl_free_noexcept(packed_shape_strides, ctx);
+                });
+            });
+        host_task_events.push_back(temporaries_cleanup_ev);
+    }
+
+    sycl::event arg_cleanup_ev =
+        keep_args_alive(exec_q, {a, b, dst}, host_task_events);
+
+    return std::make_pair(arg_cleanup_ev, comp_ev);
+}
+
+void init_isclose_dispatch_vectors(void)
+{
+    using namespace td_ns;
+    using dpctl::tensor::kernels::isclose::AllCloseContigFactory;
+    using dpctl::tensor::kernels::isclose::AllCloseStridedFactory;
+    using dpctl::tensor::kernels::isclose::IsCloseContigFactory;
+    using dpctl::tensor::kernels::isclose::IsCloseStridedFactory;
+
+    DispatchVectorBuilder<isclose_contig_impl_fn_ptr_t, IsCloseContigFactory,
+                          num_types>
+        dvb1;
+    dvb1.populate_dispatch_vector(isclose_contig_dispatch_vector);
+
+    DispatchVectorBuilder<isclose_strided_impl_fn_ptr_t, IsCloseStridedFactory,
+                          num_types>
+        dvb2;
+    dvb2.populate_dispatch_vector(isclose_strided_dispatch_vector);
+
+    DispatchVectorBuilder<allclose_contig_impl_fn_ptr_t, AllCloseContigFactory,
+                          num_types>
+        dvb3;
+    dvb3.populate_dispatch_vector(allclose_contig_dispatch_vector);
+
+    DispatchVectorBuilder<allclose_strided_impl_fn_ptr_t,
+                          AllCloseStridedFactory, num_types>
+        dvb4;
+    dvb4.populate_dispatch_vector(allclose_strided_dispatch_vector);
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
@@ -64,6 +64,8 @@ usm_ndarray_linear_sequence_step(py::object start,
                                  sycl::queue exec_q,
                                  const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<init_linear_sequences_dispatch_vectors>();
+
     // dst must be 1D and C-contiguous
     // start, end should be coercible into data type of dst
 
@@ -112,6 +114,8 @@ usm_ndarray_linear_sequence_affine(py::object start,
                                    sycl::queue exec_q,
                                    const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<init_linear_sequences_dispatch_vectors>();
+
     // dst must be 1D and C-contiguous
     // start, end should be coercible into data type of dst
 
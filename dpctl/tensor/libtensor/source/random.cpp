@@ -0,0 +1,319 @@
+//===-- random.cpp - Random number generation              --*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_random_impl
+/// extension filling arrays with random numbers.
+//===----------------------------------------------------------------------===//
+
+#include "dpctl4pybind11.hpp"
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "kernels/random.hpp"
+#include "random.hpp"
+#include "utils/type_dispatch.hpp"
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+namespace rng_ns = dpctl::tensor::kernels::random;
+
+using rng_ns::random_integers_fn_ptr_t;
+using rng_ns::random_real_fn_ptr_t;
+
+static random_real_fn_ptr_t random_uniform_dispatch_vector[td_ns::num_types];
+static random_real_fn_ptr_t random_normal_dispatch_vector[td_ns::num_types];
+static random_integers_fn_ptr_t
+    random_integers_dispatch_vector[td_ns::num_types];
+
+void init_random_dispatch_vectors(void)
+{
+    td_ns::DispatchVectorBuilder<random_real_fn_ptr_t,
+                                 rng_ns::RandomUniformFactory, td_ns::num_types>
+        dvb1;
+    dvb1.populate_dispatch_vector(random_uniform_dispatch_vector);
+
+    td_ns::DispatchVectorBuilder<random_real_fn_ptr_t,
+                                 rng_ns::RandomNormalFactory, td_ns::num_types>
+        dvb2;
+    dvb2.populate_dispatch_vector(random_normal_dispatch_vector);
+
+    td_ns::DispatchVectorBuilder<random_integers_fn_ptr_t,
+                                 rng_ns::RandomIntegersFactory,
+                                 td_ns::num_types>
+        dvb3;
+    dvb3.populate_dispatch_vector(random_integers_dispatch_vector);
+}
+
+namespace
+{
+
+rng_ns::rng_engine engine_from_name(const std::string &engine)
+{
+    if (engine == "philox") {
+        return rng_ns::rng_engine::philox4x32x10;
+    }
+    if (engine == "threefry") {
+        return rng_ns::rng_engine::threefry4x32x20;
+    }
+    throw py::value_error("Unknown random number engine '" + engine +
+                          "', expecting 'philox' or 'threefry'");
+}
+
+/*! @brief Validates destination array and returns its type lookup id */
+int validate_random_dst(const dpctl::tensor::usm_ndarray &dst,
+                        sycl::queue &exec_q)
+{
+    if (!dst.is_c_contiguous()) {
+        throw py::value_error("Destination array must be C-contiguous");
+    }
+    if (!dst.is_writable()) {
+        throw py::value_error("Output array is read-only.");
+    }
+    if (!dpctl::utils::queues_are_compatible(exec_q, {dst})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queue");
+    }
+
+    auto const &array_types = td_ns::usm_ndarray_types();
+    return array_types.typenum_to_lookup_id(dst.get_typenum());
+}
+
+std::pair<sycl::event, sycl::event>
+keep_dst_alive(sycl::queue &exec_q,
+               const dpctl::tensor::usm_ndarray &dst,
+               const sycl::event &comp_ev)
+{
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, {dst}, {comp_ev});
+    return std::make_pair(ht_ev, comp_ev);
+}
+
+} // namespace
+
+std::pair<sycl::event, sycl::event>
+py_random_bits(dpctl::tensor::usm_ndarray dst,
+               const std::string &engine,
+               std::uint64_t seed,
+               std::uint64_t stream_id,
+               std::uint64_t offset,
+               sycl::queue exec_q,
+               std::vector<sycl::event> const &depends)
+{
+    const rng_ns::rng_engine engine_id = engine_from_name(engine);
+    int dst_typeid = validate_random_dst(dst, exec_q);
+
+    constexpr int uint32_typeid = static_cast<int>(td_ns::typenum_t::UINT32);
+    if (dst_typeid != uint32_typeid) {
+        throw py::value_error(
+            "Unexpected data type of destination array, expecting 'uint32'");
+    }
+
+    const size_t nelems = static_cast<size_t>(dst.get_size());
+    if (nelems == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    char *dst_data = dst.get_data();
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+        comp_ev = rng_ns::random_bits_impl(exec_q, nelems, dst_data, engine_id,
+                                           seed, stream_id, offset, depends);
+    }
+
+    return keep_dst_alive(exec_q, dst, comp_ev);
+}
+
+std::pair<sycl::event, sycl::event>
+py_random_uniform(dpctl::tensor::usm_ndarray dst,
+                  const std::string &engine,
+                  std::uint64_t seed,
+                  std::uint64_t stream_id,
+                  std::uint64_t offset,
+                  double low,
+                  double high,
+                  sycl::queue exec_q,
+                  std::vector<sycl::event> const &depends)
+{
+    td_ns::populate_once<init_random_dispatch_vectors>();
+
+    const rng_ns::rng_engine engine_id = engine_from_name(engine);
+    int dst_typeid = validate_random_dst(dst, exec_q);
+
+    auto fn = random_uniform_dispatch_vector[dst_typeid];
+    if (fn == nullptr) {
+        throw py::value_error("Uniform distribution requires destination "
+                              "array of real floating-point data type");
+    }
+
+    const size_t nelems = static_cast<size_t>(dst.get_size());
+    if (nelems == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    char *dst_data = dst.get_data();
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+        comp_ev = fn(exec_q, nelems, dst_data, engine_id, seed, stream_id,
+                     offset, low, high, depends);
+    }
+
+    return keep_dst_alive(exec_q, dst, comp_ev);
+}
+
+std::pair<sycl::event, sycl::event>
+py_random_normal(dpctl::tensor::usm_ndarray dst,
+                 const std::string &engine,
+                 std::uint64_t seed,
+                 std::uint64_t stream_id,
+                 std::uint64_t offset,
+                 double loc,
+                 double scale,
+                 sycl::queue exec_q,
+                 std::vector<sycl::event> const &depends)
+{
+    td_ns::populate_once<init_random_dispatch_vectors>();
+
+    const rng_ns::rng_engine engine_id = engine_from_name(engine);
+    int dst_typeid = validate_random_dst(dst, exec_q);
+
+    auto fn = random_normal_dispatch_vector[dst_typeid];
+    if (fn == nullptr) {
+        throw py::value_error("Normal distribution requires destination "
+                              "array of real floating-point data type");
+    }
+
+    const size_t nelems = static_cast<size_t>(dst.get_size());
+    if (nelems == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    char *dst_data = dst.get_data();
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+        comp_ev = fn(exec_q, nelems, dst_data, engine_id, seed, stream_id,
+                     offset, loc, scale, depends);
+    }
+
+    return keep_dst_alive(exec_q, dst, comp_ev);
+}
+
+std::pair<sycl::event, sycl::event>
+py_random_integers(dpctl::tensor::usm_ndarray dst,
+                   const std::string &engine,
+                   std::uint64_t seed,
+                   std::uint64_t stream_id,
+                   std::uint64_t offset,
+                   std::uint64_t low,
+                   std::uint64_t range,
+                   sycl::queue exec_q,
+                   std::vector<sycl::event> const &depends)
+{
+    td_ns::populate_once<init_random_dispatch_vectors>();
+
+    const rng_ns::rng_engine engine_id = engine_from_name(engine);
+    int dst_typeid = validate_random_dst(dst, exec_q);
+
+    auto fn = random_integers_dispatch_vector[dst_typeid];
+    if (fn == nullptr) {
+        throw py::value_error("Random integers require destination array "
+                              "of integral data type");
+    }
+
+    const size_t nelems = static_cast<size_t>(dst.get_size());
+    if (nelems == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    char *dst_data = dst.get_data();
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+        comp_ev = fn(exec_q, nelems, dst_data, engine_id, seed, stream_id,
+                     offset, low, range, depends);
+    }
+
+    return keep_dst_alive(exec_q, dst, comp_ev);
+}
+
+void init_random_functions(py::module_ m)
+{
+    m.def("_random_bits", &py_random_bits,
+          "Fills C-contiguous array `dst` of data type `uint32` with words "
+          "generated by counter-based `engine`, 'philox' or 'threefry', "
+          "keyed by `seed`. Words of block `offset + i` of stream `stream` "
+          "are written to elements `4*i` to `4*i + 3`. Returns a tuple of "
+          "events: (host_task_event, compute_task_event).",
+          py::arg("dst"), py::arg("engine"), py::arg("seed"),
+          py::arg("stream"), py::arg("offset"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+    m.def("_random_uniform", &py_random_uniform,
+          "Fills C-contiguous array `dst` of real floating-point data type "
+          "with numbers uniformly distributed in `[low, high)`, generated "
+          "from blocks starting from block `offset` of stream `stream`. "
+          "Each block gives 4 numbers, or 2 numbers for 'float64'. Returns "
+          "a tuple of events: (host_task_event, compute_task_event).",
+          py::arg("dst"), py::arg("engine"), py::arg("seed"),
+          py::arg("stream"), py::arg("offset"), py::arg("low"),
+          py::arg("high"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+    m.def("_random_normal", &py_random_normal,
+          "Fills C-contiguous array `dst` of real floating-point data type "
+          "with normally distributed numbers with mean `loc` and standard "
+          "deviation `scale`, generated from blocks starting from block "
+          "`offset` of stream `stream`. Each block gives 4 numbers, or 2 "
+          "numbers for 'float64'. Returns a tuple of events: "
+          "(host_task_event, compute_task_event).",
+          py::arg("dst"), py::arg("engine"), py::arg("seed"),
+          py::arg("stream"), py::arg("offset"), py::arg("loc"),
+          py::arg("scale"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+    m.def("_random_integers", &py_random_integers,
+          "Fills C-contiguous array `dst` of integral data type with "
+          "integers uniformly distributed in `[low, low + range)`, with "
+          "`low` given modulo 2**64 and `range == 0` standing for 2**64, "
+          "generated from blocks starting from block `offset` of stream "
+          "`stream`. Each block gives 2 numbers. Returns a tuple of "
+          "events: (host_task_event, compute_task_event).",
+          py::arg("dst"), py::arg("engine"), py::arg("seed"),
+          py::arg("stream"), py::arg("offset"), py::arg("low"),
+          py::arg("range"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
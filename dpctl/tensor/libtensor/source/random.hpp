@@ -0,0 +1,91 @@
+//===-- random.hpp - Random number generation              --*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file declares functions of dpctl.tensor._tensor_random_impl
+/// extension filling arrays with random numbers.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dpctl4pybind11.hpp"
+#include <pybind11/pybind11.h>
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+extern void init_random_dispatch_vectors(void);
+
+extern std::pair<sycl::event, sycl::event>
+py_random_bits(dpctl::tensor::usm_ndarray dst,
+               const std::string &engine,
+               std::uint64_t seed,
+               std::uint64_t stream_id,
+               std::uint64_t offset,
+               sycl::queue exec_q,
+               std::vector<sycl::event> const &depends);
+
+extern std::pair<sycl::event, sycl::event>
+py_random_uniform(dpctl::tensor::usm_ndarray dst,
+                  const std::string &engine,
+                  std::uint64_t seed,
+                  std::uint64_t stream_id,
+                  std::uint64_t offset,
+                  double low,
+                  double high,
+                  sycl::queue exec_q,
+                  std::vector<sycl::event> const &depends);
+
+extern std::pair<sycl::event, sycl::event>
+py_random_normal(dpctl::tensor::usm_ndarray dst,
+                 const std::string &engine,
+                 std::uint64_t seed,
+                 std::uint64_t stream_id,
+                 std::uint64_t offset,
+                 double loc,
+                 double scale,
+                 sycl::queue exec_q,
+                 std::vector<sycl::event> const &depends);
+
+extern std::pair<sycl::event, sycl::event>
+py_random_integers(dpctl::tensor::usm_ndarray dst,
+                   const std::string &engine,
+                   std::uint64_t seed,
+                   std::uint64_t stream_id,
+                   std::uint64_t offset,
+                   std::uint64_t low,
+                   std::uint64_t range,
+                   sycl::queue exec_q,
+                   std::vector<sycl::event> const &depends);
+
+extern void init_random_functions(py::module_ m);
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
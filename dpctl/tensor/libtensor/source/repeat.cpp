@@ -35,6 +35,7 @@
 #include "simplify_iteration_space.hpp"
 #include "utils/memory_overlap.hpp"
 #include "utils/offset_utils.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 
 namespace dpctl
@@ -44,6 +45,8 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+
 namespace td_ns = dpctl::tensor::type_dispatch;
 
 using dpctl::tensor::kernels::repeat::repeat_by_sequence_fn_ptr_t;
@@ -98,6 +101,8 @@ py_repeat_by_sequence(dpctl::tensor::usm_ndarray src,
                       sycl::queue exec_q,
                       std::vector<sycl::event> const &depends)
 {
+    td_ns::populate_once<init_repeat_dispatch_vectors>();
+
     int src_nd = src.get_ndim();
     if (axis < 0 || (axis + 1 > src_nd && src_nd > 0) ||
         (axis > 0 && src_nd == 0)) {
@@ -244,7 +249,8 @@ py_repeat_by_sequence(dpctl::tensor::usm_ndarray src,
             src_stride = src_strides_vec[0];
         }
 
-        sycl::event repeat_ev =
+        py::gil_scoped_release release;
+        repeat_ev =
             fn(exec_q, src_axis_nelems, src_data_p, dst_data_p, reps_data_p,
                cumsum_data_p, src_shape, src_stride, dst_shape_vec[0],
                dst_strides_vec[0], reps_shape_vec[0], reps_strides_vec[0],
@@ -294,6 +300,8 @@ py_repeat_by_sequence(dpctl::tensor::usm_ndarray src,
             simplified_orthog_dst_strides, orthog_src_offset,
             orthog_dst_offset);
 
+        py::gil_scoped_release release;
+
         using dpctl::tensor::offset_utils::device_allocate_and_pack;
         const auto &ptr_size_event_tuple1 =
             device_allocate_and_pack<py::ssize_t>(
@@ -329,7 +337,7 @@ py_repeat_by_sequence(dpctl::tensor::usm_ndarray src,
                 cgh.depends_on(repeat_ev);
                 auto ctx = exec_q.get_context();
                 cgh.host_task([ctx, packed_shapes_strides] {
-                    sycl::free(packed_shapes_strides, ctx);
+                    sycl_free_noexcept(packed_shapes_strides, ctx);
                 });
             });
         host_task_events.push_back(cleanup_tmp_allocations_ev);
@@ -351,6 +359,8 @@ py_repeat_by_scalar(dpctl::tensor::usm_ndarray src,
                     sycl::queue exec_q,
                     std::vector<sycl::event> const &depends)
 {
+    td_ns::populate_once<init_repeat_dispatch_vectors>();
+
     int src_nd = src.get_ndim();
     if (axis < 0 || (axis + 1 > src_nd && src_nd > 0) ||
         (axis > 0 && src_nd == 0)) {
@@ -458,7 +468,9 @@ py_repeat_by_scalar(dpctl::tensor::usm_ndarray src,
             src_shape = src_shape_vec[0];
             src_stride = src_strides_vec[0];
         }
-        sycl::event repeat_ev =
+
+        py::gil_scoped_release release;
+        repeat_ev =
             fn(exec_q, dst_axis_nelems, src_data_p, dst_data_p, reps, src_shape,
                src_stride, dst_shape_vec[0], dst_strides_vec[0], depends);
     }
@@ -507,6 +519,8 @@ py_repeat_by_scalar(dpctl::tensor::usm_ndarray src,
             simplified_orthog_dst_strides, orthog_src_offset,
             orthog_dst_offset);
 
+        py::gil_scoped_release release;
+
         using dpctl::tensor::offset_utils::device_allocate_and_pack;
         const auto &ptr_size_event_tuple1 =
             device_allocate_and_pack<py::ssize_t>(
@@ -540,7 +554,7 @@ py_repeat_by_scalar(dpctl::tensor::usm_ndarray src,
                 cgh.depends_on(repeat_ev);
                 auto ctx = exec_q.get_context();
                 cgh.host_task([ctx, packed_shapes_strides] {
-                    sycl::free(packed_shapes_strides, ctx);
+                    sycl_free_noexcept(packed_shapes_strides, ctx);
                 });
             });
         host_task_events.push_back(cleanup_tmp_allocations_ev);
@@ -40,6 +40,8 @@
 #include "simplify_iteration_space.hpp"
 #include "utils/memory_overlap.hpp"
 #include "utils/offset_utils.hpp"
+#include "utils/sycl_alloc_utils.hpp"
+#include "utils/sycl_utils.hpp"
 #include "utils/type_dispatch.hpp"
 
 namespace dpctl
@@ -49,6 +51,9 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+using dpctl::tensor::sycl_utils::host_fastpath_enabled;
+
 bool check_atomic_support(const sycl::queue &exec_q,
                           sycl::usm::alloc usm_alloc_type,
                           bool require_atomic64 = false)
@@ -94,6 +99,8 @@ static sum_reduction_contig_impl_fn_ptr
     sum_over_axis0_contig_atomic_dispatch_table[td_ns::num_types]
                                                [td_ns::num_types];
 
+void populate_sum_over_axis_dispatch_table(void);
+
 std::pair<sycl::event, sycl::event> py_sum_over_axis(
     dpctl::tensor::usm_ndarray src,
     int trailing_dims_to_reduce, // sum over this many trailing indexes
@@ -101,6 +108,8 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
     sycl::queue exec_q,
     const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<populate_sum_over_axis_dispatch_table>();
+
     int src_nd = src.get_ndim();
     int iteration_nd = src_nd - trailing_dims_to_reduce;
     if (trailing_dims_to_reduce <= 0 || iteration_nd < 0) {
@@ -187,6 +196,9 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
     } break;
     }
 
+    const char *src_data = src.get_data();
+    char *dst_data = dst.get_data();
+
     // handle special case when both reduction and iteration are 1D contiguous
     // and can be done with atomics
     if (supports_atomics) {
@@ -204,16 +216,21 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
 
                 constexpr py::ssize_t zero_offset = 0;
 
-                sycl::event sum_over_axis_contig_ev =
-                    fn(exec_q, iter_nelems, reduction_nelems, src.get_data(),
-                       dst.get_data(),
-                       zero_offset, // iteration_src_offset
-                       zero_offset, // iteration_dst_offset
-                       zero_offset, // reduction_src_offset
-                       depends);
+                sycl::event sum_over_axis_contig_ev;
+                {
+                    py::gil_scoped_release release;
+                    sum_over_axis_contig_ev =
+                        fn(exec_q, iter_nelems, reduction_nelems, src_data,
+                           dst_data,
+                           zero_offset, // iteration_src_offset
+                           zero_offset, // iteration_dst_offset
+                           zero_offset, // reduction_src_offset
+                           depends);
+                }
 
                 sycl::event keep_args_event = dpctl::utils::keep_args_alive(
-                    exec_q, {src, dst}, {sum_over_axis_contig_ev});
+                    exec_q, {src, dst}, {sum_over_axis_contig_ev},
+                    host_fastpath_enabled());
 
                 return std::make_pair(keep_args_event, sum_over_axis_contig_ev);
             }
@@ -228,16 +245,21 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
 
                 constexpr py::ssize_t zero_offset = 0;
 
-                sycl::event sum_over_axis_contig_ev =
-                    fn(exec_q, iter_nelems, reduction_nelems, src.get_data(),
-                       dst.get_data(),
-                       zero_offset, // iteration_src_offset
-                       zero_offset, // iteration_dst_offset
-                       zero_offset, // reduction_src_offset
-                       depends);
+                sycl::event sum_over_axis_contig_ev;
+                {
+                    py::gil_scoped_release release;
+                    sum_over_axis_contig_ev =
+                        fn(exec_q, iter_nelems, reduction_nelems, src_data,
+                           dst_data,
+                           zero_offset, // iteration_src_offset
+                           zero_offset, // iteration_dst_offset
+                           zero_offset, // reduction_src_offset
+                           depends);
+                }
 
                 sycl::event keep_args_event = dpctl::utils::keep_args_alive(
-                    exec_q, {src, dst}, {sum_over_axis_contig_ev});
+                    exec_q, {src, dst}, {sum_over_axis_contig_ev},
+                    host_fastpath_enabled());
 
                 return std::make_pair(keep_args_event, sum_over_axis_contig_ev);
             }
@@ -323,13 +345,18 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
             auto fn = sum_over_axis1_contig_atomic_dispatch_table[src_typeid]
                                                                  [dst_typeid];
             if (fn != nullptr) {
-                sycl::event sum_over_axis1_contig_ev =
-                    fn(exec_q, iter_nelems, reduction_nelems, src.get_data(),
-                       dst.get_data(), iteration_src_offset,
-                       iteration_dst_offset, reduction_src_offset, depends);
+                sycl::event sum_over_axis1_contig_ev;
+                {
+                    py::gil_scoped_release release;
+                    sum_over_axis1_contig_ev =
+                        fn(exec_q, iter_nelems, reduction_nelems, src_data,
+                           dst_data, iteration_src_offset,
+                           iteration_dst_offset, reduction_src_offset, depends);
+                }
 
                 sycl::event keep_args_event = dpctl::utils::keep_args_alive(
-                    exec_q, {src, dst}, {sum_over_axis1_contig_ev});
+                    exec_q, {src, dst}, {sum_over_axis1_contig_ev},
+                    host_fastpath_enabled());
 
                 return std::make_pair(keep_args_event,
                                       sum_over_axis1_contig_ev);
@@ -339,13 +366,18 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
             auto fn = sum_over_axis0_contig_atomic_dispatch_table[src_typeid]
                                                                  [dst_typeid];
             if (fn != nullptr) {
-                sycl::event sum_over_axis0_contig_ev =
-                    fn(exec_q, iter_nelems, reduction_nelems, src.get_data(),
-                       dst.get_data(), iteration_src_offset,
-                       iteration_dst_offset, reduction_src_offset, depends);
+                sycl::event sum_over_axis0_contig_ev;
+                {
+                    py::gil_scoped_release release;
+                    sum_over_axis0_contig_ev =
+                        fn(exec_q, iter_nelems, reduction_nelems, src_data,
+                           dst_data, iteration_src_offset,
+                           iteration_dst_offset, reduction_src_offset, depends);
+                }
 
                 sycl::event keep_args_event = dpctl::utils::keep_args_alive(
-                    exec_q, {src, dst}, {sum_over_axis0_contig_ev});
+                    exec_q, {src, dst}, {sum_over_axis0_contig_ev},
+                    host_fastpath_enabled());
 
                 return std::make_pair(keep_args_event,
                                       sum_over_axis0_contig_ev);
@@ -373,45 +405,51 @@ std::pair<sycl::event, sycl::event> py_sum_over_axis(
 
     using dpctl::tensor::offset_utils::device_allocate_and_pack;
 
-    const auto &arrays_metainfo_packing_triple_ =
-        device_allocate_and_pack<py::ssize_t>(
-            exec_q, host_task_events,
-            // iteration metadata
-            simplified_iteration_shape, simplified_iteration_src_strides,
-            simplified_iteration_dst_strides,
-            // reduction metadata
-            simplified_reduction_shape, simplified_reduction_src_strides);
-    py::ssize_t *temp_allocation_ptr =
-        std::get<0>(arrays_metainfo_packing_triple_);
-    if (temp_allocation_ptr == nullptr) {
-        throw std::runtime_error("Unable to allocate memory on device");
-    }
-    const auto &copy_metadata_ev = std::get<2>(arrays_metainfo_packing_triple_);
-
-    py::ssize_t *iter_shape_and_strides = temp_allocation_ptr;
-    py::ssize_t *reduction_shape_stride =
-        temp_allocation_ptr + 3 * simplified_iteration_shape.size();
-
-    std::vector<sycl::event> all_deps;
-    all_deps.reserve(depends.size() + 1);
-    all_deps.resize(depends.size());
-    std::copy(depends.begin(), depends.end(), all_deps.begin());
-    all_deps.push_back(copy_metadata_ev);
-
-    auto comp_ev = fn(exec_q, dst_nelems, reduction_nelems, src.get_data(),
-                      dst.get_data(), iteration_nd, iter_shape_and_strides,
-                      iteration_src_offset, iteration_dst_offset,
-                      reduction_nd, // number dimensions being reduced
-                      reduction_shape_stride, reduction_src_offset, all_deps);
-
-    sycl::event temp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(comp_ev);
-        auto ctx = exec_q.get_context();
-        cgh.host_task([ctx, temp_allocation_ptr] {
-            sycl::free(temp_allocation_ptr, ctx);
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+
+        const auto &arrays_metainfo_packing_triple_ =
+            device_allocate_and_pack<py::ssize_t>(
+                exec_q, host_task_events,
+                // iteration metadata
+                simplified_iteration_shape, simplified_iteration_src_strides,
+                simplified_iteration_dst_strides,
+                // reduction metadata
+                simplified_reduction_shape, simplified_reduction_src_strides);
+        py::ssize_t *temp_allocation_ptr =
+            std::get<0>(arrays_metainfo_packing_triple_);
+        if (temp_allocation_ptr == nullptr) {
+            throw std::runtime_error("Unable to allocate memory on device");
+        }
+        const auto &copy_metadata_ev =
+            std::get<2>(arrays_metainfo_packing_triple_);
+
+        py::ssize_t *iter_shape_and_strides = temp_allocation_ptr;
+        py::ssize_t *reduction_shape_stride =
+            temp_allocation_ptr + 3 * simplified_iteration_shape.size();
+
+        std::vector<sycl::event> all_deps;
+        all_deps.reserve(depends.size() + 1);
+        all_deps.resize(depends.size());
+        std::copy(depends.begin(), depends.end(), all_deps.begin());
+        all_deps.push_back(copy_metadata_ev);
+
+        comp_ev = fn(exec_q, dst_nelems, reduction_nelems, src_data, dst_data,
+                     iteration_nd, iter_shape_and_strides,
+                     iteration_src_offset, iteration_dst_offset,
+                     reduction_nd, // number dimensions being reduced
+                     reduction_shape_stride, reduction_src_offset, all_deps);
+
+        sycl::event temp_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(comp_ev);
+            auto ctx = exec_q.get_context();
+            cgh.host_task([ctx, temp_allocation_ptr] {
+                sycl_free_noexcept(temp_allocation_ptr, ctx);
+            });
         });
-    });
-    host_task_events.push_back(temp_cleanup_ev);
+        host_task_events.push_back(temp_cleanup_ev);
+    }
 
     sycl::event keep_args_event =
         dpctl::utils::keep_args_alive(exec_q, {src, dst}, host_task_events);
@@ -424,6 +462,8 @@ bool py_sum_over_axis_dtype_supported(py::dtype input_dtype,
                                       const std::string &dst_usm_type,
                                       sycl::queue q)
 {
+    td_ns::populate_once<populate_sum_over_axis_dispatch_table>();
+
     int arg_tn =
         input_dtype.num(); // NumPy type numbers are the same as in dpctl
     int out_tn =
@@ -526,8 +566,6 @@ namespace py = pybind11;
 
 void init_reduction_functions(py::module_ m)
 {
-    populate_sum_over_axis_dispatch_table();
-
     m.def("_sum_over_axis", &py_sum_over_axis, "", py::arg("src"),
           py::arg("trailing_dims_to_reduce"), py::arg("dst"),
           py::arg("sycl_queue"), py::arg("depends") = py::list());
@@ -0,0 +1,55 @@
+//===-- tensor_elementwise.cpp - _tensor_elementwise_impl module -*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_elementwise_impl
+/// extension: elementwise functions and closeness tests of arrays.
+//===----------------------------------------------------------------------===//
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "elementwise_functions.hpp"
+#include "isclose.hpp"
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(_tensor_elementwise_impl, m)
+{
+    dpctl::tensor::py_internal::init_elementwise_functions(m);
+
+    using dpctl::tensor::py_internal::py_allclose;
+    using dpctl::tensor::py_internal::py_isclose;
+
+    m.def("_isclose", &py_isclose,
+          "Tests whether elements of arrays `src1` and `src2` are close "
+          "within tolerances `atol` and `rtol`, and writes results into "
+          "boolean array `dst`",
+          py::arg("src1"), py::arg("src2"), py::arg("dst"), py::arg("atol"),
+          py::arg("rtol"), py::arg("equal_nan"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+    m.def("_allclose", &py_allclose,
+          "Tests whether all elements of arrays `src1` and `src2` are close "
+          "within tolerances `atol` and `rtol`, and writes the result into "
+          "zero-dimensional boolean array `dst`",
+          py::arg("src1"), py::arg("src2"), py::arg("dst"), py::arg("atol"),
+          py::arg("rtol"), py::arg("equal_nan"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+}
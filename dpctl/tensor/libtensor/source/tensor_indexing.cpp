@@ -0,0 +1,121 @@
+//===-- tensor_indexing.cpp - _tensor_indexing_impl module  --*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_indexing_impl extension:
+/// integer and boolean advanced indexing, and repeat.
+//===----------------------------------------------------------------------===//
+
+#include <CL/sycl.hpp>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "dpctl4pybind11.hpp"
+
+#include "accumulators.hpp"
+#include "boolean_advanced_indexing.hpp"
+#include "integer_advanced_indexing.hpp"
+#include "repeat.hpp"
+
+namespace py = pybind11;
+
+namespace
+{
+
+/* ============== Advanced Indexing ============= */
+using dpctl::tensor::py_internal::usm_ndarray_put;
+using dpctl::tensor::py_internal::usm_ndarray_take;
+
+using dpctl::tensor::py_internal::py_extract;
+using dpctl::tensor::py_internal::py_mask_positions;
+using dpctl::tensor::py_internal::py_masked_assign;
+using dpctl::tensor::py_internal::py_masked_fill;
+using dpctl::tensor::py_internal::py_nonzero;
+using dpctl::tensor::py_internal::py_place;
+
+/* ================= Repeat ====================*/
+using dpctl::tensor::py_internal::py_cumsum_1d;
+using dpctl::tensor::py_internal::py_repeat_by_scalar;
+using dpctl::tensor::py_internal::py_repeat_by_sequence;
+
+} // namespace
+
+PYBIND11_MODULE(_tensor_indexing_impl, m)
+{
+    m.def("_take", &usm_ndarray_take,
+          "Takes elements at usm_ndarray indices `ind` and axes starting "
+          "at axis `axis_start` from array `src` and copies them "
+          "into usm_ndarray `dst` synchronously."
+          "Returns a tuple of events: (hev, ev)",
+          py::arg("src"), py::arg("ind"), py::arg("dst"), py::arg("axis_start"),
+          py::arg("mode"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+
+    m.def("_put", &usm_ndarray_put,
+          "Puts elements at usm_ndarray indices `ind` and axes starting "
+          "at axis `axis_start` into array `dst` from "
+          "usm_ndarray `val` synchronously."
+          "Returns a tuple of events: (hev, ev)",
+          py::arg("dst"), py::arg("ind"), py::arg("val"), py::arg("axis_start"),
+          py::arg("mode"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+
+    m.def("mask_positions", &py_mask_positions, "", py::arg("mask"),
+          py::arg("cumsum"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+
+    m.def("_cumsum_1d", &py_cumsum_1d, "", py::arg("src"), py::arg("cumsum"),
+          py::arg("sycl_queue"), py::arg("depends") = py::list());
+
+    m.def("_extract", &py_extract, "", py::arg("src"), py::arg("cumsum"),
+          py::arg("axis_start"), py::arg("axis_end"), py::arg("dst"),
+          py::arg("sycl_queue"), py::arg("depends") = py::list());
+
+    m.def("_place", &py_place, "", py::arg("dst"), py::arg("cumsum"),
+          py::arg("axis_start"), py::arg("axis_end"), py::arg("rhs"),
+          py::arg("sycl_queue"), py::arg("depends") = py::list());
+
+    m.def("_masked_assign", &py_masked_assign,
+          "Sets elements of usm_ndarray `dst` to elements of usm_ndarray "
+          "`rhs` where boolean usm_ndarray `mask` is set. Mask and `rhs` "
+          "must have the shape of `dst`. "
+          "Returns a tuple of events: (hev, ev)",
+          py::arg("dst"), py::arg("mask"), py::arg("rhs"),
+          py::arg("sycl_queue"), py::arg("depends") = py::list());
+
+    m.def("_masked_fill", &py_masked_fill,
+          "Sets elements of usm_ndarray `dst` to Python scalar `value` "
+          "where boolean usm_ndarray `mask` of the same shape is set. "
+          "Returns a tuple of events: (hev, ev)",
+          py::arg("dst"), py::arg("mask"), py::arg("value"),
+          py::arg("sycl_queue"), py::arg("depends") = py::list());
+
+    m.def("_nonzero", &py_nonzero, "", py::arg("cumsum"), py::arg("indexes"),
+          py::arg("mask_shape"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+
+    m.def("_repeat_by_sequence", &py_repeat_by_sequence, "", py::arg("src"),
+          py::arg("dst"), py::arg("reps"), py::arg("cumsum"), py::arg("axis"),
+          py::arg("sycl_queue"), py::arg("depends") = py::list());
+
+    m.def("_repeat_by_scalar", &py_repeat_by_scalar, "", py::arg("src"),
+          py::arg("dst"), py::arg("reps"), py::arg("axis"),
+          py::arg("sycl_queue"), py::arg("depends") = py::list());
+}
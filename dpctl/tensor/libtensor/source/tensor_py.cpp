@@ -19,7 +19,10 @@
 //===----------------------------------------------------------------------===//
 ///
 /// \file
-/// This file defines functions of dpctl.tensor._tensor_impl extensions
+/// This file defines functions of dpctl.tensor._tensor_impl extension:
+/// copying, constructors and utilities used by all of dpctl.tensor.
+/// Elementwise functions, reductions and indexing functions are defined in
+/// separate extensions, which are loaded on first use.
 //===----------------------------------------------------------------------===//
 
 #include <CL/sycl.hpp>
@@ -33,22 +36,15 @@
 
 #include "dpctl4pybind11.hpp"
 
-#include "accumulators.hpp"
-#include "boolean_advanced_indexing.hpp"
-#include "boolean_reductions.hpp"
 #include "copy_and_cast_usm_to_usm.hpp"
 #include "copy_for_reshape.hpp"
 #include "copy_for_roll.hpp"
 #include "copy_numpy_ndarray_into_usm_ndarray.hpp"
 #include "device_support_queries.hpp"
-#include "elementwise_functions.hpp"
 #include "eye_ctor.hpp"
 #include "full_ctor.hpp"
-#include "integer_advanced_indexing.hpp"
 #include "linear_sequences.hpp"
-#include "repeat.hpp"
 #include "simplify_iteration_space.hpp"
-#include "sum_reductions.hpp"
 #include "triul_ctor.hpp"
 #include "utils/memory_overlap.hpp"
 #include "utils/strided_iters.hpp"
@@ -89,20 +85,6 @@ using dpctl::tensor::py_internal::usm_ndarray_linear_sequence_step;
 
 using dpctl::tensor::py_internal::usm_ndarray_full;
 
-/* ============== Advanced Indexing ============= */
-using dpctl::tensor::py_internal::usm_ndarray_put;
-using dpctl::tensor::py_internal::usm_ndarray_take;
-
-using dpctl::tensor::py_internal::py_extract;
-using dpctl::tensor::py_internal::py_mask_positions;
-using dpctl::tensor::py_internal::py_nonzero;
-using dpctl::tensor::py_internal::py_place;
-
-/* ================= Repeat ====================*/
-using dpctl::tensor::py_internal::py_cumsum_1d;
-using dpctl::tensor::py_internal::py_repeat_by_scalar;
-using dpctl::tensor::py_internal::py_repeat_by_sequence;
-
 /* ================ Eye ================== */
 
 using dpctl::tensor::py_internal::usm_ndarray_eye;
@@ -115,47 +97,12 @@ using dpctl::tensor::py_internal::usm_ndarray_triul;
 
 using dpctl::tensor::py_internal::py_where;
 
-// populate dispatch tables
-void init_dispatch_tables(void)
-{
-    using namespace dpctl::tensor::py_internal;
-
-    init_copy_and_cast_usm_to_usm_dispatch_tables();
-    init_copy_numpy_ndarray_into_usm_ndarray_dispatch_tables();
-    init_advanced_indexing_dispatch_tables();
-    init_where_dispatch_tables();
-    return;
-}
-
-// populate dispatch vectors
-void init_dispatch_vectors(void)
-{
-    using namespace dpctl::tensor::py_internal;
-
-    init_copy_for_reshape_dispatch_vectors();
-    init_copy_for_roll_dispatch_vectors();
-    init_linear_sequences_dispatch_vectors();
-    init_full_ctor_dispatch_vectors();
-    init_eye_ctor_dispatch_vectors();
-    init_triul_ctor_dispatch_vectors();
-
-    populate_masked_extract_dispatch_vectors();
-    populate_masked_place_dispatch_vectors();
-
-    populate_mask_positions_dispatch_vectors();
-
-    populate_cumsum_1d_dispatch_vectors();
-    init_repeat_dispatch_vectors();
-
-    return;
-}
-
 } // namespace
 
 PYBIND11_MODULE(_tensor_impl, m)
 {
-    init_dispatch_tables();
-    init_dispatch_vectors();
+    // dispatch tables and vectors are populated on first use of each
+    // function family, see type_dispatch::populate_once
 
     using dpctl::tensor::strides::contract_iter;
     m.def(
@@ -288,24 +235,6 @@ PYBIND11_MODULE(_tensor_impl, m)
           py::arg("fill_value"), py::arg("dst"), py::arg("sycl_queue"),
           py::arg("depends") = py::list());
 
-    m.def("_take", &usm_ndarray_take,
-          "Takes elements at usm_ndarray indices `ind` and axes starting "
-          "at axis `axis_start` from array `src` and copies them "
-          "into usm_ndarray `dst` synchronously."
-          "Returns a tuple of events: (hev, ev)",
-          py::arg("src"), py::arg("ind"), py::arg("dst"), py::arg("axis_start"),
-          py::arg("mode"), py::arg("sycl_queue"),
-          py::arg("depends") = py::list());
-
-    m.def("_put", &usm_ndarray_put,
-          "Puts elements at usm_ndarray indices `ind` and axes starting "
-          "at axis `axis_start` into array `dst` from "
-          "usm_ndarray `val` synchronously."
-          "Returns a tuple of events: (hev, ev)",
-          py::arg("dst"), py::arg("ind"), py::arg("val"), py::arg("axis_start"),
-          py::arg("mode"), py::arg("sycl_queue"),
-          py::arg("depends") = py::list());
-
     m.def("_eye", &usm_ndarray_eye,
           "Fills input 2D contiguous usm_ndarray `dst` with "
           "zeros outside of the diagonal "
@@ -360,17 +289,6 @@ PYBIND11_MODULE(_tensor_impl, m)
           py::arg("dst"), py::arg("k") = 0, py::arg("sycl_queue"),
           py::arg("depends") = py::list());
 
-    m.def("mask_positions", &py_mask_positions, "", py::arg("mask"),
-          py::arg("cumsum"), py::arg("sycl_queue"),
-          py::arg("depends") = py::list());
-
-    m.def("_cumsum_1d", &py_cumsum_1d, "", py::arg("src"), py::arg("cumsum"),
-          py::arg("sycl_queue"), py::arg("depends") = py::list());
-
-    m.def("_extract", &py_extract, "", py::arg("src"), py::arg("cumsum"),
-          py::arg("axis_start"), py::arg("axis_end"), py::arg("dst"),
-          py::arg("sycl_queue"), py::arg("depends") = py::list());
-
     auto overlap = [](dpctl::tensor::usm_ndarray x1,
                       dpctl::tensor::usm_ndarray x2) -> bool {
         auto const &overlap = MemoryOverlap();
@@ -389,27 +307,7 @@ PYBIND11_MODULE(_tensor_impl, m)
           "Determines if the memory regions indexed by each array are the same",
           py::arg("array1"), py::arg("array2"));
 
-    m.def("_place", &py_place, "", py::arg("dst"), py::arg("cumsum"),
-          py::arg("axis_start"), py::arg("axis_end"), py::arg("rhs"),
-          py::arg("sycl_queue"), py::arg("depends") = py::list());
-
-    m.def("_nonzero", &py_nonzero, "", py::arg("cumsum"), py::arg("indexes"),
-          py::arg("mask_shape"), py::arg("sycl_queue"),
-          py::arg("depends") = py::list());
-
     m.def("_where", &py_where, "", py::arg("condition"), py::arg("x1"),
           py::arg("x2"), py::arg("dst"), py::arg("sycl_queue"),
           py::arg("depends") = py::list());
-
-    m.def("_repeat_by_sequence", &py_repeat_by_sequence, "", py::arg("src"),
-          py::arg("dst"), py::arg("reps"), py::arg("cumsum"), py::arg("axis"),
-          py::arg("sycl_queue"), py::arg("depends") = py::list());
-
-    m.def("_repeat_by_scalar", &py_repeat_by_scalar, "", py::arg("src"),
-          py::arg("dst"), py::arg("reps"), py::arg("axis"),
-          py::arg("sycl_queue"), py::arg("depends") = py::list());
-
-    dpctl::tensor::py_internal::init_elementwise_functions(m);
-    dpctl::tensor::py_internal::init_boolean_reduction_functions(m);
-    dpctl::tensor::py_internal::init_reduction_functions(m);
 }
@@ -0,0 +1,178 @@
+//===-- topk.cpp - Top-k selection along the last axis    --*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_sorting_impl
+/// extension selecting k largest, or smallest, elements.
+//===----------------------------------------------------------------------===//
+
+#include "dpctl4pybind11.hpp"
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <limits>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <utility>
+#include <vector>
+
+#include "kernels/topk.hpp"
+#include "topk.hpp"
+#include "utils/memory_overlap.hpp"
+#include "utils/type_dispatch.hpp"
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+using dpctl::tensor::kernels::sorting::topk_impl_fn_ptr_t;
+static topk_impl_fn_ptr_t topk_dispatch_vector[td_ns::num_types];
+
+void init_topk_dispatch_vector(void)
+{
+    using dpctl::tensor::kernels::sorting::TopKFactory;
+    td_ns::DispatchVectorBuilder<topk_impl_fn_ptr_t, TopKFactory,
+                                 td_ns::num_types>
+        dvb;
+    dvb.populate_dispatch_vector(topk_dispatch_vector);
+}
+
+std::pair<sycl::event, sycl::event>
+py_topk(dpctl::tensor::usm_ndarray src,
+        size_t k,
+        bool largest,
+        dpctl::tensor::usm_ndarray vals,
+        dpctl::tensor::usm_ndarray inds,
+        sycl::queue exec_q,
+        std::vector<sycl::event> const &depends)
+{
+    td_ns::populate_once<init_topk_dispatch_vector>();
+
+    if (src.get_ndim() != 2 || vals.get_ndim() != 2 || inds.get_ndim() != 2) {
+        throw py::value_error("Source, values and indices arrays must be "
+                              "two-dimensional");
+    }
+
+    const py::ssize_t *src_shape = src.get_shape_raw();
+    const size_t n_rows = static_cast<size_t>(src_shape[0]);
+    const size_t n = static_cast<size_t>(src_shape[1]);
+
+    if (k == 0 || k > n) {
+        throw py::value_error("Number of selected elements must be positive "
+                              "and not exceed the size of the last axis");
+    }
+    if (n > static_cast<size_t>(std::numeric_limits<std::uint32_t>::max())) {
+        throw py::value_error("Size of the last axis is too large");
+    }
+
+    const py::ssize_t *vals_shape = vals.get_shape_raw();
+    const py::ssize_t *inds_shape = inds.get_shape_raw();
+    if (static_cast<size_t>(vals_shape[0]) != n_rows ||
+        static_cast<size_t>(vals_shape[1]) != k ||
+        static_cast<size_t>(inds_shape[0]) != n_rows ||
+        static_cast<size_t>(inds_shape[1]) != k)
+    {
+        throw py::value_error("Values and indices arrays must have shape "
+                              "(n_rows, k)");
+    }
+
+    if (!vals.is_c_contiguous() || !inds.is_c_contiguous()) {
+        throw py::value_error(
+            "Values and indices arrays must be C-contiguous");
+    }
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {src, vals, inds})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(src, vals) || overlap(src, inds) || overlap(vals, inds)) {
+        throw py::value_error("Arrays index overlapping segments of memory");
+    }
+
+    auto const &array_types = td_ns::usm_ndarray_types();
+    int src_typeid = array_types.typenum_to_lookup_id(src.get_typenum());
+    int vals_typeid = array_types.typenum_to_lookup_id(vals.get_typenum());
+    int inds_typeid = array_types.typenum_to_lookup_id(inds.get_typenum());
+
+    if (src_typeid != vals_typeid) {
+        throw py::value_error(
+            "Values array must have the same elemental data type as source");
+    }
+
+    constexpr int int64_typeid = static_cast<int>(td_ns::typenum_t::INT64);
+    if (inds_typeid != int64_typeid) {
+        throw py::value_error(
+            "Unexpected data type of indices array, expecting 'int64'");
+    }
+
+    auto fn = topk_dispatch_vector[src_typeid];
+    if (fn == nullptr) {
+        throw py::value_error("Top-k selection is not supported for "
+                              "the data type of source array");
+    }
+
+    if (n_rows == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    // strides are not stored for contiguous arrays
+    const auto &src_strides = src.get_strides_vector();
+    const char *src_data = src.get_data();
+    char *vals_data = vals.get_data();
+    char *inds_data = inds.get_data();
+
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+        comp_ev = fn(exec_q, n_rows, n, k, largest, src_data, src_strides[0],
+                     src_strides[1], vals_data, inds_data, depends);
+    }
+
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, {src, vals, inds}, {comp_ev});
+
+    return std::make_pair(ht_ev, comp_ev);
+}
+
+void init_topk_functions(py::module_ m)
+{
+    m.def("_topk", &py_topk,
+          "Writes values and indices of `k` largest, or smallest, elements "
+          "of each row of two-dimensional array `src` into C-contiguous "
+          "arrays `vals` and `inds` of shape `(src.shape[0], k)`, in the "
+          "order of selection. Of equal elements, one with the smaller "
+          "index is selected first. Returns a tuple of events: "
+          "(host_task_event, compute_task_event).",
+          py::arg("src"), py::arg("k"), py::arg("largest"), py::arg("vals"),
+          py::arg("inds"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
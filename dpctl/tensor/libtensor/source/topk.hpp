@@ -0,0 +1,56 @@
+//===-- topk.hpp - Top-k selection along the last axis    --*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file declares functions of dpctl.tensor._tensor_sorting_impl
+/// extension selecting k largest, or smallest, elements.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <CL/sycl.hpp>
+#include <utility>
+#include <vector>
+
+#include "dpctl4pybind11.hpp"
+#include <pybind11/pybind11.h>
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+extern void init_topk_dispatch_vector(void);
+
+extern std::pair<sycl::event, sycl::event>
+py_topk(dpctl::tensor::usm_ndarray src,
+        size_t k,
+        bool largest,
+        dpctl::tensor::usm_ndarray vals,
+        dpctl::tensor::usm_ndarray inds,
+        sycl::queue exec_q,
+        std::vector<sycl::event> const &depends);
+
+extern void init_topk_functions(py::module_ m);
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
@@ -32,6 +32,7 @@
 #include "kernels/constructors.hpp"
 #include "simplify_iteration_space.hpp"
 #include "utils/memory_overlap.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 
 namespace py = pybind11;
@@ -44,6 +45,9 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+using dpctl::tensor::alloc_utils::sycl_malloc_device;
+
 using dpctl::utils::keep_args_alive;
 
 using dpctl::tensor::kernels::constructors::tri_fn_ptr_t;
@@ -51,6 +55,8 @@ using dpctl::tensor::kernels::constructors::tri_fn_ptr_t;
 static tri_fn_ptr_t tril_generic_dispatch_vector[td_ns::num_types];
 static tri_fn_ptr_t triu_generic_dispatch_vector[td_ns::num_types];
 
+void init_triul_ctor_dispatch_vectors(void);
+
 std::pair<sycl::event, sycl::event>
 usm_ndarray_triul(sycl::queue exec_q,
                   dpctl::tensor::usm_ndarray src,
@@ -59,6 +65,8 @@ usm_ndarray_triul(sycl::queue exec_q,
                   py::ssize_t k = 0,
                   const std::vector<sycl::event> &depends = {})
 {
+    td_ns::populate_once<init_triul_ctor_dispatch_vectors>();
+
     // array dimensions must be the same
     int src_nd = src.get_ndim();
     int dst_nd = dst.get_ndim();
@@ -146,64 +154,71 @@ usm_ndarray_triul(sycl::queue exec_q,
 
     nd += 2;
 
-    using usm_host_allocatorT =
-        sycl::usm_allocator<py::ssize_t, sycl::usm::alloc::host>;
-    using usmshT = std::vector<py::ssize_t, usm_host_allocatorT>;
-
-    usm_host_allocatorT allocator(exec_q);
-    auto shp_host_shape_and_strides =
-        std::make_shared<usmshT>(3 * nd, allocator);
-
-    std::copy(simplified_shape.begin(), simplified_shape.end(),
-              shp_host_shape_and_strides->begin());
-    (*shp_host_shape_and_strides)[nd - 2] = src_shape[src_nd - 2];
-    (*shp_host_shape_and_strides)[nd - 1] = src_shape[src_nd - 1];
-
-    std::copy(simplified_src_strides.begin(), simplified_src_strides.end(),
-              shp_host_shape_and_strides->begin() + nd);
-    (*shp_host_shape_and_strides)[2 * nd - 2] = src_strides[src_nd - 2];
-    (*shp_host_shape_and_strides)[2 * nd - 1] = src_strides[src_nd - 1];
-
-    std::copy(simplified_dst_strides.begin(), simplified_dst_strides.end(),
-              shp_host_shape_and_strides->begin() + 2 * nd);
-    (*shp_host_shape_and_strides)[3 * nd - 2] = dst_strides[src_nd - 2];
-    (*shp_host_shape_and_strides)[3 * nd - 1] = dst_strides[src_nd - 1];
-
-    py::ssize_t *dev_shape_and_strides =
-        sycl::malloc_device<py::ssize_t>(3 * nd, exec_q);
-    if (dev_shape_and_strides == nullptr) {
-        throw std::runtime_error("Unabled to allocate device memory");
-    }
-    sycl::event copy_shape_and_strides = exec_q.copy<py::ssize_t>(
-        shp_host_shape_and_strides->data(), dev_shape_and_strides, 3 * nd);
-
-    py::ssize_t inner_range = src_shape[src_nd - 1] * src_shape[src_nd - 2];
-    py::ssize_t outer_range = src_nelems / inner_range;
-
     sycl::event tri_ev;
-    if (part == 'l') {
-        auto fn = tril_generic_dispatch_vector[src_typeid];
-        tri_ev =
-            fn(exec_q, inner_range, outer_range, src_data, dst_data, nd,
-               dev_shape_and_strides, k, depends, {copy_shape_and_strides});
+    sycl::event temporaries_cleanup_ev;
+    {
+        py::gil_scoped_release release;
+
+        using usm_host_allocatorT =
+            sycl::usm_allocator<py::ssize_t, sycl::usm::alloc::host>;
+        using usmshT = std::vector<py::ssize_t, usm_host_allocatorT>;
+
+        usm_host_allocatorT allocator(exec_q);
+        auto shp_host_shape_and_strides =
+            std::make_shared<usmshT>(3 * nd, allocator);
+
+        std::copy(simplified_shape.begin(), simplified_shape.end(),
+                  shp_host_shape_and_strides->begin());
+        (*shp_host_shape_and_strides)[nd - 2] = src_shape[src_nd - 2];
+        (*shp_host_shape_and_strides)[nd - 1] = src_shape[src_nd - 1];
+
+        std::copy(simplified_src_strides.begin(), simplified_src_strides.end(),
+                  shp_host_shape_and_strides->begin() + nd);
+        (*shp_host_shape_and_strides)[2 * nd - 2] = src_strides[src_nd - 2];
+        (*shp_host_shape_and_strides)[2 * nd - 1] = src_strides[src_nd - 1];
+
+        std::copy(simplified_dst_strides.begin(), simplified_dst_strides.end(),
+                  shp_host_shape_and_strides->begin() + 2 * nd);
+        (*shp_host_shape_and_strides)[3 * nd - 2] = dst_strides[src_nd - 2];
+        (*shp_host_shape_and_strides)[3 * nd - 1] = dst_strides[src_nd - 1];
+
+        py::ssize_t *dev_shape_and_strides = sycl_malloc_device<py::ssize_t>(
+            3 * nd, exec_q, "usm_ndarray_triul");
+        if (dev_shape_and_strides == nullptr) {
+            throw std::runtime_error("Unabled to allocate device memory");
+        }
+        sycl::event copy_shape_and_strides = exec_q.copy<py::ssize_t>(
+            shp_host_shape_and_strides->data(), dev_shape_and_strides, 3 * nd);
+
+        py::ssize_t inner_range =
+            src_shape[src_nd - 1] * src_shape[src_nd - 2];
+        py::ssize_t outer_range = src_nelems / inner_range;
+
+        if (part == 'l') {
+            auto fn = tril_generic_dispatch_vector[src_typeid];
+            tri_ev = fn(exec_q, inner_range, outer_range, src_data, dst_data,
+                        nd, dev_shape_and_strides, k, depends,
+                        {copy_shape_and_strides});
+        }
+        else {
+            auto fn = triu_generic_dispatch_vector[src_typeid];
+            tri_ev = fn(exec_q, inner_range, outer_range, src_data, dst_data,
+                        nd, dev_shape_and_strides, k, depends,
+                        {copy_shape_and_strides});
+        }
+
+        temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(tri_ev);
+            auto ctx = exec_q.get_context();
+            cgh.host_task(
+                [shp_host_shape_and_strides, dev_shape_and_strides, ctx]() {
+                    // capture of shp_host_shape_and_strides ensure the
+                    // underlying vector exists for the entire execution of
+                    // copying kernel
+                    sycl_free_noexcept(dev_shape_and_strides, ctx);
+                });
+        });
     }
-    else {
-        auto fn = triu_generic_dispatch_vector[src_typeid];
-        tri_ev =
-            fn(exec_q, inner_range, outer_range, src_data, dst_data, nd,
-               dev_shape_and_strides, k, depends, {copy_shape_and_strides});
-    }
-
-    auto temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(tri_ev);
-        auto ctx = exec_q.get_context();
-        cgh.host_task(
-            [shp_host_shape_and_strides, dev_shape_and_strides, ctx]() {
-                // capture of shp_host_shape_and_strides ensure the underlying
-                // vector exists for the entire execution of copying kernel
-                sycl::free(dev_shape_and_strides, ctx);
-            });
-    });
 
     return std::make_pair(
         keep_args_alive(exec_q, {src, dst}, {temporaries_cleanup_ev}), tri_ev);
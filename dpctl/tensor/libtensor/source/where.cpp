@@ -36,6 +36,7 @@
 #include "simplify_iteration_space.hpp"
 #include "utils/memory_overlap.hpp"
 #include "utils/offset_utils.hpp"
+#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 #include "where.hpp"
 
@@ -46,6 +47,8 @@ namespace tensor
 namespace py_internal
 {
 
+using dpctl::tensor::alloc_utils::sycl_free_noexcept;
+
 namespace td_ns = dpctl::tensor::type_dispatch;
 
 using dpctl::tensor::kernels::search::where_contig_impl_fn_ptr_t;
@@ -66,6 +69,7 @@ py_where(dpctl::tensor::usm_ndarray condition,
          sycl::queue exec_q,
          const std::vector<sycl::event> &depends)
 {
+    td_ns::populate_once<init_where_dispatch_tables>();
 
     if (!dpctl::utils::queues_are_compatible(exec_q, {x1, x2, condition, dst}))
     {
@@ -169,8 +173,12 @@ py_where(dpctl::tensor::usm_ndarray condition,
     if (all_c_contig || all_f_contig) {
         auto contig_fn = where_contig_dispatch_table[x1_typeid][cond_typeid];
 
-        auto where_ev = contig_fn(exec_q, nelems, cond_data, x1_data, x2_data,
-                                  dst_data, depends);
+        sycl::event where_ev;
+        {
+            py::gil_scoped_release release;
+            where_ev = contig_fn(exec_q, nelems, cond_data, x1_data, x2_data,
+                                 dst_data, depends);
+        }
         sycl::event ht_ev =
             keep_args_alive(exec_q, {x1, x2, dst, condition}, {where_ev});
 
@@ -206,35 +214,42 @@ py_where(dpctl::tensor::usm_ndarray condition,
     host_task_events.reserve(2);
 
     using dpctl::tensor::offset_utils::device_allocate_and_pack;
-    auto ptr_size_event_tuple = device_allocate_and_pack<py::ssize_t>(
-        exec_q, host_task_events,
-        // common shape and strides
-        simplified_shape, simplified_cond_strides, simplified_x1_strides,
-        simplified_x2_strides, simplified_dst_strides);
-    py::ssize_t *packed_shape_strides = std::get<0>(ptr_size_event_tuple);
-    sycl::event copy_shape_strides_ev = std::get<2>(ptr_size_event_tuple);
-
-    std::vector<sycl::event> all_deps;
-    all_deps.reserve(depends.size() + 1);
-    all_deps.insert(all_deps.end(), depends.begin(), depends.end());
-    all_deps.push_back(copy_shape_strides_ev);
-
-    assert(all_deps.size() == depends.size() + 1);
-
-    sycl::event where_ev = fn(exec_q, nelems, nd, cond_data, x1_data, x2_data,
-                              dst_data, packed_shape_strides, cond_offset,
-                              x1_offset, x2_offset, dst_offset, all_deps);
-
-    // free packed temporaries
-    sycl::event temporaries_cleanup_ev = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(where_ev);
-        auto ctx = exec_q.get_context();
-        cgh.host_task([packed_shape_strides, ctx]() {
-            sycl::free(packed_shape_strides, ctx);
-        });
-    });
-
-    host_task_events.push_back(temporaries_cleanup_ev);
+
+    sycl::event where_ev;
+    {
+        py::gil_scoped_release release;
+
+        auto ptr_size_event_tuple = device_allocate_and_pack<py::ssize_t>(
+            exec_q, host_task_events,
+            // common shape and strides
+            simplified_shape, simplified_cond_strides, simplified_x1_strides,
+            simplified_x2_strides, simplified_dst_strides);
+        py::ssize_t *packed_shape_strides = std::get<0>(ptr_size_event_tuple);
+        sycl::event copy_shape_strides_ev = std::get<2>(ptr_size_event_tuple);
+
+        std::vector<sycl::event> all_deps;
+        all_deps.reserve(depends.size() + 1);
+        all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+        all_deps.push_back(copy_shape_strides_ev);
+
+        assert(all_deps.size() == depends.size() + 1);
+
+        where_ev = fn(exec_q, nelems, nd, cond_data, x1_data, x2_data,
+                      dst_data, packed_shape_strides, cond_offset, x1_offset,
+                      x2_offset, dst_offset, all_deps);
+
+        // free packed temporaries
+        sycl::event temporaries_cleanup_ev =
+            exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(where_ev);
+                auto ctx = exec_q.get_context();
+                cgh.host_task([packed_shape_strides, ctx]() {
+                    sycl_free_noexcept(packed_shape_strides, ctx);
+                });
+            });
+
+        host_task_events.push_back(temporaries_cleanup_ev);
+    }
 
     sycl::event arg_cleanup_ev =
         keep_args_alive(exec_q, {x1, x2, condition, dst}, host_task_events);
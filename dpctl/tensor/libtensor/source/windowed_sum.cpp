@@ -0,0 +1,156 @@
+//===-- windowed_sum.cpp - Sums over overlapping windows   --*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_reductions_impl
+/// extension summing elements of overlapping windows.
+//===----------------------------------------------------------------------===//
+
+#include "dpctl4pybind11.hpp"
+#include <CL/sycl.hpp>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <utility>
+#include <vector>
+
+#include "kernels/windowed_sum.hpp"
+#include "utils/memory_overlap.hpp"
+#include "utils/type_dispatch.hpp"
+#include "windowed_sum.hpp"
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+using dpctl::tensor::kernels::windowed_sum_impl_fn_ptr_t;
+static windowed_sum_impl_fn_ptr_t
+    windowed_sum_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+void init_windowed_sum_dispatch_table(void)
+{
+    using dpctl::tensor::kernels::WindowedSumFactory;
+    td_ns::DispatchTableBuilder<windowed_sum_impl_fn_ptr_t,
+                                WindowedSumFactory, td_ns::num_types>
+        dtb;
+    dtb.populate_dispatch_table(windowed_sum_dispatch_table);
+}
+
+std::pair<sycl::event, sycl::event>
+py_windowed_sum(dpctl::tensor::usm_ndarray src,
+                dpctl::tensor::usm_ndarray dst,
+                sycl::queue exec_q,
+                const std::vector<sycl::event> &depends)
+{
+    td_ns::populate_once<init_windowed_sum_dispatch_table>();
+
+    if (src.get_ndim() != 3 || dst.get_ndim() != 2) {
+        throw py::value_error("Source array must be three-dimensional, and "
+                              "destination array two-dimensional");
+    }
+
+    const py::ssize_t *src_shape = src.get_shape_raw();
+    const py::ssize_t *dst_shape = dst.get_shape_raw();
+    if (src_shape[0] != dst_shape[0] || src_shape[1] != dst_shape[1]) {
+        throw py::value_error("Destination shape does not match leading "
+                              "dimensions of the source shape");
+    }
+
+    // strides are not stored for contiguous arrays
+    const auto &src_strides = src.get_strides_vector();
+    const auto &dst_strides = dst.get_strides_vector();
+    if (src_strides[1] != src_strides[2]) {
+        throw py::value_error("Windows along the last axis of the source "
+                              "must start at consecutive elements of rows");
+    }
+
+    if (!dst.is_writable()) {
+        throw py::value_error("Output array is read-only.");
+    }
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {src, dst})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(src, dst)) {
+        throw py::value_error("Arrays index overlapping segments of memory");
+    }
+
+    auto const &array_types = td_ns::usm_ndarray_types();
+    int src_typeid = array_types.typenum_to_lookup_id(src.get_typenum());
+    int dst_typeid = array_types.typenum_to_lookup_id(dst.get_typenum());
+
+    auto fn = windowed_sum_dispatch_table[src_typeid][dst_typeid];
+    if (fn == nullptr) {
+        throw py::value_error("Sums over windows are not implemented for "
+                              "data types of source and destination arrays");
+    }
+
+    const size_t n_rows = static_cast<size_t>(src_shape[0]);
+    const size_t n_windows = static_cast<size_t>(src_shape[1]);
+    const size_t window_size = static_cast<size_t>(src_shape[2]);
+    if (n_rows == 0 || n_windows == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+    if (window_size == 0) {
+        throw py::value_error("Windows must not be empty");
+    }
+
+    const char *src_data = src.get_data();
+    char *dst_data = dst.get_data();
+
+    sycl::event comp_ev;
+    {
+        py::gil_scoped_release release;
+        comp_ev = fn(exec_q, n_rows, n_windows, window_size, src_data,
+                     src_strides[0], src_strides[1], dst_data,
+                     dst_strides[0], dst_strides[1], depends);
+    }
+
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, {src, dst}, {comp_ev});
+
+    return std::make_pair(ht_ev, comp_ev);
+}
+
+void init_windowed_sum_functions(py::module_ m)
+{
+    m.def("_windowed_sum", &py_windowed_sum,
+          "Writes sums of windows `src[i, j, :]` into `dst[i, j]`, where "
+          "`src` is a three-dimensional view with equal strides along its "
+          "last two axes, so that windows of a row start at consecutive "
+          "elements. Elements of rows are read from global memory once per "
+          "work-group, not once per window. Returns a tuple of events: "
+          "(host_task_event, compute_task_event).",
+          py::arg("src"), py::arg("dst"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
@@ -15,6 +15,10 @@
 #  limitations under the License.
 
 import ctypes
+import os
+import subprocess
+import sys
+import threading
 
 import numpy as np
 import pytest
@@ -28,6 +32,8 @@ from dpctl.utils import ExecutionPlacementError
 
 from .utils import _all_dtypes, _compare_dtypes, _usm_types
 
+_FASTPATH_ENV = "DPCTL_TENSOR_HOST_FASTPATH_MAX_ELEMS"
+
 
 @pytest.mark.parametrize("op1_dtype", _all_dtypes)
 @pytest.mark.parametrize("op2_dtype", _all_dtypes)
@@ -526,3 +532,76 @@ def test_add_out_need_temporary():
     dpt.add(x[:6], 1, out=x[-6:])
 
     assert dpt.all(x[:-6] == 1) and dpt.all(x[-6:] == 2)
+
+
+def test_add_concurrent_submission():
+    q = get_queue_or_skip()
+
+    # entry points release the GIL during submission
+    def work(i, errors):
+        try:
+            x1 = dpt.arange(2 * 1000, dtype="i4", sycl_queue=q)[::2]
+            x2 = dpt.full(1000, i, dtype="i4", sycl_queue=q)
+            for _ in range(20):
+                r = dpt.add(x1, x2)
+                r_np = dpt.asnumpy(r)
+                assert np.array_equal(r_np, np.arange(0, 2000, 2) + i)
+        except Exception as e:
+            errors.append(e)
+
+    errors = []
+    threads = [
+        threading.Thread(target=work, args=(i, errors)) for i in range(8)
+    ]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    if errors:
+        raise errors[0]
+
+
+@pytest.mark.parametrize("usm_type", _usm_types)
+def test_add_small_arrays(usm_type):
+    q = get_queue_or_skip()
+
+    # few elements in USM-host or USM-shared memory may be added on the
+    # host, after commands the operation depends on, see
+    # test_add_small_arrays_host_fastpath
+    for n in [1, 7, 16, 17, 100]:
+        x = dpt.zeros(n, dtype="i4", usm_type=usm_type, sycl_queue=q)
+        y = dpt.arange(n, dtype="i4", usm_type=usm_type, sycl_queue=q)
+        for _ in range(5):
+            x = dpt.add(x, y)
+        x += y
+        x = dpt.negative(x)
+        assert x.usm_type == usm_type
+        assert np.array_equal(dpt.asnumpy(x), -6 * np.arange(n))
+
+
+@pytest.mark.skipif(
+    os.environ.get(_FASTPATH_ENV) is not None,
+    reason="Threshold of evaluation on the host already set",
+)
+def test_add_small_arrays_host_fastpath():
+    get_queue_or_skip()
+    # threshold is read once per process, so the test is run in a fresh
+    # interpreter
+    env = dict(os.environ)
+    env[_FASTPATH_ENV] = "16"
+    res = subprocess.run(
+        [
+            sys.executable,
+            "-m",
+            "pytest",
+            "-q",
+            "-p",
+            "no:cacheprovider",
+            "-k",
+            "test_add_small_arrays and not host_fastpath",
+            os.path.abspath(__file__),
+        ],
+        env=env,
+        capture_output=True,
+    )
+    assert res.returncode == 0, res.stdout.decode("utf-8")
@@ -0,0 +1,162 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+import pytest
+
+import dpctl.tensor as dpt
+from dpctl.tests.helper import get_queue_or_skip, skip_if_dtype_not_supported
+
+from .utils import _real_fp_dtypes, _real_value_dtypes
+
+
+@pytest.mark.parametrize("dtype", _real_value_dtypes)
+def test_clip_dtypes(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    sz = 127
+    x = dpt.arange(sz, dtype=dtype, sycl_queue=q)
+    lo = dpt.full_like(x, 10)
+    hi = dpt.full_like(x, 100)
+
+    r = dpt.clip(x, lo, hi)
+    assert r.dtype == x.dtype
+    expected = np.clip(dpt.asnumpy(x), 10, 100)
+    assert (dpt.asnumpy(r) == expected).all()
+
+    # scalar bounds, strided input
+    r = dpt.clip(x[::-2], 10, 100)
+    assert (dpt.asnumpy(r) == expected[::-2]).all()
+
+
+def test_clip_one_sided():
+    q = get_queue_or_skip()
+
+    x = dpt.arange(10, dtype="i4", sycl_queue=q)
+    xnp = dpt.asnumpy(x)
+    assert (dpt.asnumpy(dpt.clip(x, min=3)) == np.clip(xnp, 3, None)).all()
+    assert (dpt.asnumpy(dpt.clip(x, max=3)) == np.clip(xnp, None, 3)).all()
+    r = dpt.clip(x)
+    assert r is not x
+    assert (dpt.asnumpy(r) == xnp).all()
+
+    # bounds are cast to the data type of `x`
+    for r in (
+        dpt.clip(x, min=2.5),
+        dpt.clip(x, max=2.5),
+        dpt.clip(x, min=dpt.asarray(3, dtype="i8", sycl_queue=q)),
+        dpt.clip(x, max=dpt.ones(10, dtype="f4", sycl_queue=q)),
+    ):
+        assert r.dtype == x.dtype
+    assert (dpt.asnumpy(dpt.clip(x, min=2.5)) == np.clip(xnp, 2, None)).all()
+
+
+def test_clip_broadcasting_and_out():
+    q = get_queue_or_skip()
+
+    x = dpt.reshape(dpt.arange(20, dtype="f4", sycl_queue=q), (4, 5))
+    lo = dpt.asarray([0, 2, 4, 6, 8], dtype="f4", sycl_queue=q)
+    hi = dpt.asarray([[5], [10], [15], [20]], dtype="f4", sycl_queue=q)
+    expected = np.clip(dpt.asnumpy(x), dpt.asnumpy(lo), dpt.asnumpy(hi))
+
+    out = dpt.empty_like(x)
+    r = dpt.clip(x, lo, hi, out=out)
+    assert r is out
+    assert (dpt.asnumpy(out) == expected).all()
+
+    # out overlapping the input
+    r = dpt.clip(x, lo, hi, out=x)
+    assert (dpt.asnumpy(x) == expected).all()
+
+
+@pytest.mark.parametrize("dtype", _real_fp_dtypes)
+def test_clip_nan(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    x = dpt.asarray([np.nan, 0, 1, 2], dtype=dtype, sycl_queue=q)
+    lo = dpt.asarray([0, np.nan, 0, 0], dtype=dtype, sycl_queue=q)
+    r = dpt.asnumpy(dpt.clip(x, lo, 1))
+    assert np.isnan(r[:2]).all()
+    assert (r[2:] == 1).all()
+
+
+def test_clip_bool_raises():
+    q = get_queue_or_skip()
+
+    x = dpt.ones(10, dtype="?", sycl_queue=q)
+    with pytest.raises(TypeError):
+        dpt.clip(x, False, True)
+
+
+@pytest.mark.parametrize("dtype", _real_fp_dtypes + ["c8", "c16"])
+def test_fma(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    sz = 1025
+    x1 = dpt.astype(dpt.linspace(-1, 1, num=sz, sycl_queue=q), dtype)
+    x2 = dpt.full(2 * sz, 3, dtype=dtype, sycl_queue=q)
+    r = dpt.fma(x1, x2[:sz], 2)
+    assert r.dtype == x1.dtype
+    x1np = dpt.asnumpy(x1)
+    expected = x1np * 3 + 2
+    tol = 8 * dpt.finfo(r.dtype).resolution
+    assert np.allclose(dpt.asnumpy(r), expected, atol=tol, rtol=tol)
+
+    # strided inputs, 0d array broadcast to the shape of the result
+    r = dpt.fma(x1[::-1], x2[::2], x1[0])
+    expected = x1np[::-1] * 3 + x1np[0]
+    assert np.allclose(dpt.asnumpy(r), expected, atol=tol, rtol=tol)
+
+
+def test_fma_type_promotion():
+    q = get_queue_or_skip()
+
+    x1 = dpt.ones(10, dtype="f4", sycl_queue=q)
+    x2 = dpt.ones(10, dtype="i4", sycl_queue=q)
+    r = dpt.fma(x1, x2, 1.5)
+    assert r.dtype.kind == "f"
+    assert (dpt.asnumpy(r) == 2.5).all()
+
+
+@pytest.mark.parametrize("dtype", _real_fp_dtypes)
+def test_lerp(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    start = dpt.asarray([1, 2, 3, -7], dtype=dtype, sycl_queue=q)
+    end = dpt.asarray([3, 5, 7, 11], dtype=dtype, sycl_queue=q)
+    w = dpt.asarray([0, 1, 0.5, 0.25], dtype=dtype, sycl_queue=q)
+    r = dpt.lerp(start, end, w)
+    assert r.dtype == start.dtype
+    # exact at the end points
+    assert (dpt.asnumpy(r) == np.asarray([1, 5, 5, -2.5])).all()
+
+    r = dpt.lerp(start, end, 1)
+    assert (dpt.asnumpy(r) == dpt.asnumpy(end)).all()
+
+
+def test_ternary_shape_mismatch():
+    q = get_queue_or_skip()
+
+    x1 = dpt.ones(10, dtype="f4", sycl_queue=q)
+    x2 = dpt.ones(7, dtype="f4", sycl_queue=q)
+    with pytest.raises(ValueError):
+        dpt.fma(x1, x2, x1)
+    with pytest.raises(ValueError):
+        dpt.clip(x1, x2, 1)
@@ -0,0 +1,54 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import os
+import subprocess
+import sys
+
+import pytest
+
+import dpctl
+
+_LAUNCH_ENV = "DPCTL_TENSOR_ELEMENTWISE_LAUNCH"
+
+
+@pytest.mark.skipif(
+    os.environ.get(_LAUNCH_ENV) == "persistent",
+    reason="Suite already runs with persistent launch",
+)
+def test_elementwise_suite_persistent_launch():
+    try:
+        dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Default queue could not be created")
+    # launch mode is read once per process, so the suite is run in
+    # a fresh interpreter
+    env = dict(os.environ)
+    env[_LAUNCH_ENV] = "persistent"
+    res = subprocess.run(
+        [
+            sys.executable,
+            "-m",
+            "pytest",
+            "-q",
+            "-p",
+            "no:cacheprovider",
+            os.path.dirname(os.path.abspath(__file__)),
+        ],
+        env=env,
+        capture_output=True,
+    )
+    assert res.returncode == 0, res.stdout.decode("utf-8")
@@ -179,6 +179,17 @@ def test_get_wait_list():
     assert len(wait_list) >= 0
 
 
+def test_event_equality_and_hash():
+    e1 = dpctl.SyclEvent()
+    e2 = dpctl.SyclEvent(e1._get_capsule())
+    e3 = dpctl.SyclEvent()
+    assert e1 == e2
+    assert hash(e1) == hash(e2)
+    assert e1 != e3
+    assert e1 != e1._get_capsule()
+    assert len({e1, e2}) == 1
+
+
 def test_profiling_info():
     try:
         event = produce_event(profiling=True)
@@ -212,6 +223,54 @@ def test_sycl_timer():
         timer(queue=None)
 
 
+def test_sycl_timer_kernel_events():
+    try:
+        q1 = dpctl.SyclQueue(property="enable_profiling")
+        q2 = dpctl.SyclQueue(q1.sycl_device, property="enable_profiling")
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Queue creation of default device failed")
+    timer = dpctl.SyclTimer(device_timer="kernel_events")
+    m1 = dpctl_mem.MemoryUSMDevice(1024 * 1024, queue=q1)
+    m2 = dpctl_mem.MemoryUSMDevice(1024 * 1024, queue=q2)
+    n_iters = 4
+    for _ in range(n_iters):
+        with timer(name="outer"):
+            with timer(name="inner"):
+                m1.copy_from_device(m2)
+            m2.copy_from_device(m1)
+    host_dt, device_dt = timer.dt
+    assert host_dt > 0 and device_dt > 0
+    stats = timer.statistics()
+    assert set(stats.keys()) == {"inner", "outer"}
+    for name in ("inner", "outer"):
+        for clock in ("host", "device"):
+            st = stats[name][clock]
+            assert st["count"] == n_iters
+            assert 0 <= st["min"] <= st["median"] <= st["p99"]
+            assert st["min"] <= st["mean"]
+    assert (
+        stats["outer"]["device"]["median"]
+        >= stats["inner"]["device"]["median"]
+    )
+    timer.reset()
+    assert timer.statistics() == dict()
+    # no commands submitted, only host time is sampled
+    with timer():
+        pass
+    stats = timer.statistics()
+    assert stats["region"]["host"]["count"] == 1
+    assert stats["region"]["device"]["count"] == 0
+    assert stats["region"]["device"]["median"] is None
+    with pytest.raises(TypeError):
+        timer(queue=1)
+    with pytest.raises(TypeError):
+        timer(q1)
+    with pytest.raises(ValueError):
+        dpctl.SyclTimer(device_timer="unknown")
+    with pytest.raises(TypeError):
+        dpctl.SyclTimer().statistics()
+
+
 def test_event_capsule():
     ev = dpctl.SyclEvent()
     cap1 = ev._get_capsule()
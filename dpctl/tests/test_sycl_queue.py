@@ -355,6 +355,9 @@ def test_queue_memops():
     m2 = MemoryUSMDevice(512, queue=q)
     q.memcpy(m1, m2, 512)
     q.prefetch(m1, 512)
+    ev = q.prefetch_async(m1)
+    assert isinstance(ev, dpctl.SyclEvent)
+    ev.wait()
     q.mem_advise(m1, 512, 0)
     with pytest.raises(TypeError):
         q.memcpy(m1, list(), 512)
@@ -362,6 +365,8 @@ def test_queue_memops():
         q.memcpy(list(), m2, 512)
     with pytest.raises(TypeError):
         q.prefetch(list(), 512)
+    with pytest.raises(TypeError):
+        q.prefetch_async(list(), 512)
     with pytest.raises(TypeError):
         q.mem_advise(list(), 512, 0)
 
@@ -61,3 +61,26 @@ def test_memcpy_type_error():
     with pytest.raises(TypeError) as cm:
         q.memcpy(mobj, None, 3)
     assert "`src`" in str(cm.value)
+
+
+def test_memcpy_async():
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Default constructor for SyclQueue failed")
+    mobj1 = _create_memory(q)
+    mobj2 = _create_memory(q)
+
+    mv1 = memoryview(mobj1)
+    mv2 = memoryview(mobj2)
+
+    mv1[:3] = b"123"
+
+    ev = q.memcpy_async(mobj2, mobj1, 3)
+    assert isinstance(ev, dpctl.SyclEvent)
+    ev.wait()
+
+    assert mv2[:3] == b"123"
+
+    with pytest.raises(TypeError):
+        q.memcpy_async(None, mobj1, 3)
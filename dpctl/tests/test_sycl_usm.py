@@ -17,6 +17,8 @@
 """Defines unit test cases for the Memory classes in _memory.pyx.
 """
 
+import inspect
+
 import numpy as np
 import pytest
 
@@ -195,6 +197,33 @@ def test_pickling_reconstructor_invalid_type(memory_ctor):
         pickle.loads(bad_pickle_bytes)
 
 
+def test_pickling_out_of_band(memory_ctor):
+    import pickle
+
+    try:
+        mobj = memory_ctor(1024, alignment=64)
+    except dpctl.SyclDeviceCreationError:
+        pytest.skip("No SYCL devices available")
+    host_src_obj = _create_host_buf(mobj.nbytes)
+    mobj.copy_from_host(host_src_obj)
+
+    buffers = []
+    data = pickle.dumps(mobj, protocol=5, buffer_callback=buffers.append)
+    assert len(buffers) == 1
+    # content is not serialized in-band
+    assert len(data) < mobj.nbytes
+    assert buffers[0].raw().nbytes == mobj.nbytes
+
+    mobj_reconstructed = pickle.loads(data, buffers=buffers)
+    assert type(mobj) is type(mobj_reconstructed)
+    assert mobj.tobytes() == mobj_reconstructed.tobytes()
+    assert mobj._pointer != mobj_reconstructed._pointer
+
+    # in-band pickling with protocol 5
+    mobj_reconstructed = pickle.loads(pickle.dumps(mobj, protocol=5))
+    assert mobj.tobytes() == mobj_reconstructed.tobytes()
+
+
 @pytest.fixture(params=[MemoryUSMShared, MemoryUSMDevice, MemoryUSMHost])
 def memory_ctor(request):
     return request.param
@@ -671,3 +700,113 @@ def test_memset():
     m_ho.memset(ord("7"))
     m_ho.copy_to_host(host_buf)
     assert host_buf == b"7" * n
+
+
+def _site_stats(usm_type, site_prefix):
+    from dpctl.memory import usm_memory_stats
+
+    return [
+        st
+        for st in usm_memory_stats()
+        if st.usm_type == usm_type
+        and st.call_site is not None
+        and st.call_site.startswith(site_prefix)
+    ]
+
+
+def test_usm_accounting():
+    from dpctl.memory import (
+        disable_usm_accounting,
+        enable_usm_accounting,
+        is_usm_accounting_enabled,
+        reset_usm_memory_peaks,
+        usm_memory_report,
+    )
+
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("SyclQueue() failed, skip further testing...")
+    was_enabled = is_usm_accounting_enabled()
+    enable_usm_accounting()
+    try:
+        reset_usm_memory_peaks()
+        m1 = MemoryUSMDevice(1024, queue=q)
+        m2 = MemoryUSMDevice(2048, queue=q)
+        site = __name__ + ".test_usm_accounting"
+        stats = _site_stats("device", site)
+        assert sum(st.live_bytes for st in stats) == 3072
+        assert sum(st.live_allocations for st in stats) == 2
+        assert all(st.device == q.sycl_device for st in stats)
+        assert site in usm_memory_report()
+        del m2
+        stats = _site_stats("device", site)
+        assert sum(st.live_bytes for st in stats) == 1024
+        assert sum(st.peak_bytes for st in stats) >= 3072
+        totals = [
+            st
+            for st in dpctl.memory.usm_memory_stats()
+            if st.call_site is None and st.device == q.sycl_device
+        ]
+        assert any(st.usm_type == "device" for st in totals)
+        del m1
+        reset_usm_memory_peaks()
+        assert not _site_stats("device", site)
+    finally:
+        if not was_enabled:
+            disable_usm_accounting()
+
+
+def test_usm_accounting_call_site():
+    from dpctl.memory import (
+        disable_usm_accounting,
+        enable_usm_accounting,
+        is_usm_accounting_enabled,
+        usm_memory_stats,
+    )
+
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("SyclQueue() failed, skip further testing...")
+    was_enabled = is_usm_accounting_enabled()
+    enable_usm_accounting()
+    try:
+        # allocation is attributed to the line of this function making it
+        line = inspect.currentframe().f_lineno + 1
+        m = MemoryUSMShared(512, queue=q)
+        site = f"{__name__}.test_usm_accounting_call_site:{line}"
+        stats = [
+            st
+            for st in usm_memory_stats()
+            if st.usm_type == "shared" and st.call_site == site
+        ]
+        assert len(stats) == 1
+        assert stats[0].live_bytes == 512
+        del m
+    finally:
+        if not was_enabled:
+            disable_usm_accounting()
+
+
+def test_usm_accounting_disabled():
+    from dpctl.memory import (
+        disable_usm_accounting,
+        enable_usm_accounting,
+        is_usm_accounting_enabled,
+    )
+
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("SyclQueue() failed, skip further testing...")
+    was_enabled = is_usm_accounting_enabled()
+    disable_usm_accounting()
+    try:
+        m = MemoryUSMShared(256, queue=q)
+        site = __name__ + ".test_usm_accounting_disabled"
+        assert not _site_stats("shared", site)
+        del m
+    finally:
+        if was_enabled:
+            enable_usm_accounting()
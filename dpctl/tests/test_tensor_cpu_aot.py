@@ -0,0 +1,54 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import importlib.machinery
+import os
+
+import pytest
+
+import dpctl.tensor._cpu_aot_finder as caf
+
+
+def test_cpu_aot_finder_resolves_variants(tmp_path):
+    suffix = importlib.machinery.EXTENSION_SUFFIXES[0]
+    (tmp_path / ("_tensor_impl" + suffix)).write_bytes(b"")
+    finder = caf.CpuAotFinder(str(tmp_path))
+
+    spec = finder.find_spec("dpctl.tensor._tensor_impl")
+    assert spec is not None
+    assert spec.name == "dpctl.tensor._tensor_impl"
+    assert os.path.dirname(spec.origin) == str(tmp_path)
+    # extensions without variants are imported as usual
+    assert finder.find_spec("dpctl.tensor._tensor_sorting_impl") is None
+    assert finder.find_spec("dpctl.tensor._usmarray") is None
+    assert finder.find_spec("dpctl._tensor_impl") is None
+
+
+def test_cpu_aot_disabled_by_env(monkeypatch):
+    monkeypatch.setenv("DPCTL_TENSOR_CPU_AOT", "0")
+    assert caf._select_cpu_aot_dir() is None
+
+
+def test_cpu_features_host_cpu_supports():
+    try:
+        from dpctl.tensor._cpu_features import host_cpu_supports
+    except ImportError:
+        pytest.skip("dpctl is built without DPCTL_TARGET_CPU_AOT")
+    res = [host_cpu_supports(isa) for isa in reversed(caf._CPU_AOT_ISAS)]
+    # each instruction set implies preceding ones
+    assert res == sorted(res, reverse=True)
+    with pytest.raises(ValueError):
+        host_cpu_supports("mmx")
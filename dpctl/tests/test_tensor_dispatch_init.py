@@ -0,0 +1,123 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import subprocess
+import sys
+import textwrap
+
+import pytest
+
+import dpctl
+
+# Dispatch tables of `_tensor_impl` are populated on first use of each
+# function family, so the check is run in a fresh interpreter where
+# first uses from several threads race
+_concurrent_first_use = textwrap.dedent(
+    """
+    import threading
+
+    import numpy as np
+
+    import dpctl.tensor as dpt
+
+    def work(errors):
+        try:
+            x = dpt.arange(100, dtype="f4")
+            y = dpt.sin(dpt.add(x, x))
+            s = dpt.sum(y)
+            b = dpt.any(x > 50)
+            x_np = np.arange(100, dtype="f4")
+            assert np.allclose(dpt.asnumpy(y), np.sin(x_np + x_np), atol=1e-5)
+            assert np.allclose(
+                dpt.asnumpy(s), np.sin(x_np + x_np).sum(), atol=1e-3
+            )
+            assert bool(b)
+        except Exception as e:
+            errors.append(e)
+
+    errors = []
+    threads = [threading.Thread(target=work, args=(errors,)) for _ in range(8)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    if errors:
+        raise errors[0]
+    """
+)
+
+
+def test_concurrent_first_use_of_functions():
+    try:
+        dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Default queue could not be created")
+    res = subprocess.run(
+        [sys.executable, "-c", _concurrent_first_use], capture_output=True
+    )
+    assert res.returncode == 0, res.stderr.decode("utf-8")
+
+
+# Kernels of elementwise functions, reductions and indexing functions are
+# in separate extensions, imported on first use of the function family
+_lazy_extensions_import = textwrap.dedent(
+    """
+    import sys
+
+    import dpctl.tensor as dpt
+
+    def loaded(name):
+        return "dpctl.tensor." + name in sys.modules
+
+    lazy_exts = [
+        "_tensor_elementwise_impl",
+        "_tensor_reductions_impl",
+        "_tensor_indexing_impl",
+        "_tensor_sorting_impl",
+        "_tensor_random_impl",
+    ]
+    assert not any(loaded(ext) for ext in lazy_exts)
+    x = dpt.arange(10, dtype="i4")
+    assert not any(loaded(ext) for ext in lazy_exts)
+
+    y = dpt.add(x, x)
+    assert loaded("_tensor_elementwise_impl")
+    assert not loaded("_tensor_reductions_impl")
+    assert int(dpt.sum(y)) == 90
+    assert loaded("_tensor_reductions_impl")
+    assert not loaded("_tensor_indexing_impl")
+    assert int(x[x > 6][0]) == 7
+    assert loaded("_tensor_indexing_impl")
+    assert not loaded("_tensor_sorting_impl")
+    assert int(dpt.top_k(x, 1).values[0]) == 9
+    assert loaded("_tensor_sorting_impl")
+    assert not loaded("_tensor_random_impl")
+    assert dpt.Generator(0).uniform(size=3).shape == (3,)
+    assert loaded("_tensor_random_impl")
+    assert "add" in dir(dpt)
+    """
+)
+
+
+def test_extensions_imported_on_first_use():
+    try:
+        dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Default queue could not be created")
+    res = subprocess.run(
+        [sys.executable, "-c", _lazy_extensions_import], capture_output=True
+    )
+    assert res.returncode == 0, res.stderr.decode("utf-8")
@@ -0,0 +1,97 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+import pytest
+
+import dpctl.tensor as dpt
+from dpctl.tests.helper import get_queue_or_skip
+
+
+def test_growable_append():
+    q = get_queue_or_skip()
+
+    acc = dpt.GrowableArray((3,), dtype="i4", sycl_queue=q)
+    assert len(acc) == 0
+    assert acc.capacity == 0
+    assert acc.view().shape == (0, 3)
+
+    expected = []
+    for i in range(20):
+        batch = np.arange(3 * i, dtype="i4").reshape(i, 3) + i
+        if i % 2:
+            acc.append(dpt.asarray(batch, sycl_queue=q))
+        else:
+            acc.append(batch)
+        expected.append(batch)
+    acc.append([7, 8, 9])
+    expected.append(np.array([[7, 8, 9]], dtype="i4"))
+    expected = np.concatenate(expected)
+
+    assert len(acc) == expected.shape[0]
+    assert acc.shape == expected.shape
+    assert acc.capacity >= len(acc)
+    v = acc.view()
+    assert v.sycl_queue == q
+    assert not v.flags.writable
+    assert np.array_equal(dpt.asnumpy(v), expected)
+
+
+def test_growable_amortized_growth():
+    q = get_queue_or_skip()
+
+    acc = dpt.GrowableArray(dtype="f4", sycl_queue=q, capacity=1)
+    capacities = set()
+    for i in range(1000):
+        acc.append(i)
+        capacities.add(acc.capacity)
+    # geometric growth reallocates a logarithmic number of times
+    assert len(capacities) <= 11
+    assert np.array_equal(dpt.asnumpy(acc.view()), np.arange(1000))
+
+    # earlier views keep records filled when they were taken
+    v = acc.view()
+    acc.append(np.ones(2000, dtype="f4"))
+    assert v.shape == (1000,)
+    assert np.array_equal(dpt.asnumpy(v), np.arange(1000))
+    assert float(dpt.sum(acc.view())) == 999 * 1000 / 2 + 2000
+
+    acc.shrink_to_fit()
+    assert acc.capacity == len(acc) == 3000
+    acc.clear()
+    assert len(acc) == 0 and acc.capacity == 3000
+    acc.reserve(5000)
+    assert acc.capacity == 5000
+
+
+def test_growable_validation():
+    q = get_queue_or_skip()
+
+    acc = dpt.GrowableArray((2,), dtype="i8", usm_type="host", sycl_queue=q)
+    assert acc.usm_type == "host"
+    assert acc.dtype == dpt.int64
+    with pytest.raises(ValueError):
+        acc.append(np.ones(3))
+    with pytest.raises(ValueError):
+        acc.append(np.ones((4, 3)))
+    acc.append(np.ones((0, 2)))
+    assert len(acc) == 0
+    with pytest.raises(ValueError):
+        dpt.GrowableArray(capacity=-1, sycl_queue=q)
+    with pytest.raises(ValueError):
+        dpt.GrowableArray(growth_factor=1, sycl_queue=q)
+    with pytest.raises(ValueError):
+        dpt.GrowableArray((-1,), sycl_queue=q)
@@ -0,0 +1,219 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+import pytest
+
+import dpctl.tensor as dpt
+from dpctl.tests.helper import get_queue_or_skip, skip_if_dtype_not_supported
+
+_real_dtypes = [
+    "?",
+    "i1",
+    "u1",
+    "i2",
+    "u2",
+    "i4",
+    "u4",
+    "i8",
+    "u8",
+    "f2",
+    "f4",
+    "f8",
+]
+
+
+@pytest.mark.parametrize("dt", _real_dtypes)
+def test_histogram_uniform_bins(dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    rng = np.random.default_rng(0)
+    x_np = rng.integers(0, 100, size=5000).astype(dt)
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    counts, edges = dpt.histogram(x, bins=13)
+    expected_counts, expected_edges = np.histogram(
+        x_np.astype(edges.dtype), bins=13
+    )
+    assert counts.dtype == dpt.int64
+    assert np.array_equal(dpt.asnumpy(counts), expected_counts)
+    assert np.allclose(dpt.asnumpy(edges), expected_edges)
+
+
+def test_histogram_range_and_edges():
+    q = get_queue_or_skip()
+
+    rng = np.random.default_rng(1)
+    x_np = rng.standard_normal(size=(100, 70)).astype("f4")
+    x_np[3, 4] = np.nan
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    counts, edges = dpt.histogram(x, bins=20, range=(-1, 2))
+    expected_counts, _ = np.histogram(
+        x_np[~np.isnan(x_np)], bins=20, range=(-1, 2)
+    )
+    assert np.array_equal(dpt.asnumpy(counts), expected_counts)
+
+    bins = [-3.0, -1.5, -0.2, 0.0, 0.1, 1.0, 4.0]
+    counts, edges = dpt.histogram(x, bins=bins)
+    expected_counts, _ = np.histogram(x_np[~np.isnan(x_np)], bins=bins)
+    assert np.array_equal(dpt.asnumpy(counts), expected_counts)
+    assert np.array_equal(dpt.asnumpy(edges), bins)
+
+    # strided input, edges in USM memory
+    counts, _ = dpt.histogram(x[::3, ::-2], bins=dpt.asarray(bins))
+    expected_counts, _ = np.histogram(x_np[::3, ::-2], bins=bins)
+    assert np.array_equal(dpt.asnumpy(counts), expected_counts)
+
+
+def test_histogram_many_bins():
+    # histogram which does not fit into local memory is counted with
+    # global atomics
+    q = get_queue_or_skip()
+
+    x_np = np.arange(300000, dtype="i4") % 70001
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    counts, _ = dpt.histogram(x, bins=70001)
+    expected_counts, _ = np.histogram(x_np, bins=70001)
+    assert np.array_equal(dpt.asnumpy(counts), expected_counts)
+
+
+def test_histogram_validation():
+    q = get_queue_or_skip()
+
+    x = dpt.asarray([1.0, 2.0, np.nan], sycl_queue=q)
+    with pytest.raises(ValueError):
+        dpt.histogram(x, bins=0)
+    with pytest.raises(ValueError):
+        dpt.histogram(x, bins=[1.0, 0.0, 2.0])
+    with pytest.raises(ValueError):
+        dpt.histogram(x, bins=[1.0])
+    with pytest.raises(ValueError):
+        dpt.histogram(x, range=(2, 1))
+    with pytest.raises(ValueError):
+        dpt.histogram(dpt.full(3, np.nan, sycl_queue=q))
+    with pytest.raises(TypeError):
+        dpt.histogram(dpt.ones(3, dtype="c8", sycl_queue=q))
+
+    counts, edges = dpt.histogram(dpt.empty(0, sycl_queue=q), bins=4)
+    assert np.array_equal(dpt.asnumpy(counts), np.zeros(4))
+    assert np.allclose(dpt.asnumpy(edges), np.linspace(0, 1, 5))
+
+
+@pytest.mark.parametrize("right", [False, True])
+def test_digitize(right):
+    q = get_queue_or_skip()
+
+    x_np = np.array(
+        [[-1.0, 0.0, 0.5, 1.0], [2.5, 3.0, 7.0, np.nan]], dtype="f4"
+    )
+    bins = np.array([0.0, 1.0, 2.5, 3.0, 3.0, 5.0])
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    res = dpt.digitize(x, bins, right=right)
+    assert res.shape == x.shape
+    assert res.dtype == dpt.int64
+    assert np.array_equal(
+        dpt.asnumpy(res), np.digitize(x_np, bins, right=right)
+    )
+
+    res = dpt.digitize(dpt.arange(5, dtype="i2", sycl_queue=q), [])
+    assert np.array_equal(dpt.asnumpy(res), np.zeros(5))
+
+
+@pytest.mark.parametrize("dt", ["i4", "u8", "f4", "f8"])
+def test_quantile_exact(dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    rng = np.random.default_rng(2)
+    # skewed, so that bins holding quantiles are refined
+    x_np = (rng.lognormal(0, 3, size=300000) * 10).astype(dt)
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    qs = [0.0, 0.1, 0.25, 0.5, 0.731, 0.99, 1.0]
+    res = dpt.quantile(x, qs)
+    assert res.shape == (len(qs),)
+    expected = np.quantile(x_np.astype(res.dtype), qs)
+    assert np.allclose(dpt.asnumpy(res), expected, rtol=1e-6)
+
+    res = dpt.quantile(x, 0.5)
+    assert res.shape == tuple()
+
+
+def test_quantile_duplicates_and_nans():
+    q = get_queue_or_skip()
+
+    x_np = np.repeat(np.array([3.0, 1.0, 2.0], dtype="f4"), 30000)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    res = dpt.quantile(x, [0.2, 0.5, 0.9])
+    assert np.array_equal(dpt.asnumpy(res), [1.0, 2.0, 3.0])
+
+    x_np[5] = np.nan
+    x = dpt.asarray(x_np, sycl_queue=q)
+    res = dpt.quantile(x, [0.2, 0.5])
+    assert np.all(np.isnan(dpt.asnumpy(res)))
+
+
+def test_quantile_narrow_range():
+    q = get_queue_or_skip()
+
+    dt = dpt.quantile(dpt.ones(1, sycl_queue=q), 0.5).dtype
+    one = np.ones(1, dtype=dt)[0]
+    # range spans fewer representable values than there are bins
+    eps = np.spacing(one)
+    for vals in [[one, one + eps], [one, one + 8 * eps]]:
+        vals_np = np.asarray(vals, dtype=dt)
+        for n in [1, 20000]:
+            x_np = np.repeat(vals_np, n)
+            x_np[::3] = vals_np[0]
+            x = dpt.asarray(x_np, sycl_queue=q)
+            qs = [0.0, 0.25, 0.5, 0.75, 1.0]
+            res = dpt.quantile(x, qs)
+            expected = np.quantile(x_np, qs)
+            assert np.allclose(dpt.asnumpy(res), expected, rtol=0, atol=eps)
+
+
+def test_quantile_approximate():
+    q = get_queue_or_skip()
+
+    rng = np.random.default_rng(3)
+    x_np = rng.uniform(-5, 5, size=100000).astype("f4")
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    qs = [0.05, 0.5, 0.95]
+    res = dpt.quantile(x, qs, exact=False)
+    # interpolated within one of 1024 bins spanning the range
+    bin_width = (x_np.max() - x_np.min()) / 1024
+    assert np.allclose(
+        dpt.asnumpy(res), np.quantile(x_np, qs), atol=2 * bin_width
+    )
+
+
+def test_quantile_validation():
+    q = get_queue_or_skip()
+
+    x = dpt.ones(10, dtype="f4", sycl_queue=q)
+    with pytest.raises(ValueError):
+        dpt.quantile(x, 1.5)
+    with pytest.raises(ValueError):
+        dpt.quantile(x, [0.5, -0.1])
+    with pytest.raises(ValueError):
+        dpt.quantile(dpt.empty(0, sycl_queue=q), 0.5)
+    with pytest.raises(TypeError):
+        dpt.quantile(dpt.ones(3, dtype="c8", sycl_queue=q), 0.5)
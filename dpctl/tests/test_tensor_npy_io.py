@@ -0,0 +1,147 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import io
+
+import numpy as np
+import pytest
+
+import dpctl.tensor as dpt
+import dpctl.tensor._npy_io as npy_io
+from dpctl.tests.helper import get_queue_or_skip, skip_if_dtype_not_supported
+
+
+@pytest.mark.parametrize("dtype", ["?", "i1", "u2", "i4", "i8", "f4", "c8"])
+def test_save_load_roundtrip(tmp_path, dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    x = dpt.astype(
+        dpt.reshape(dpt.arange(60, sycl_queue=q), (3, 4, 5)), dtype
+    )
+    fn = tmp_path / "x.npy"
+    dpt.save(fn, x)
+
+    # file is readable by NumPy
+    assert (np.load(fn) == dpt.asnumpy(x)).all()
+
+    y = dpt.load(fn, sycl_queue=q)
+    assert y.dtype == x.dtype
+    assert y.shape == x.shape
+    assert y.flags.c_contiguous
+    assert (dpt.asnumpy(y) == dpt.asnumpy(x)).all()
+
+
+def test_save_load_layouts(tmp_path):
+    q = get_queue_or_skip()
+
+    x = dpt.reshape(dpt.arange(24, dtype="i4", sycl_queue=q), (4, 6))
+    fn = tmp_path / "x.npy"
+    for v in [x.mT, x[::2, 1:], x[1:3], x[0, 0]]:
+        dpt.save(fn, v)
+        y = dpt.load(fn, sycl_queue=q)
+        assert y.shape == v.shape
+        assert (dpt.asnumpy(y) == dpt.asnumpy(v)).all()
+
+    # F-contiguous array is saved without a copy and loaded as such
+    dpt.save(fn, x.mT)
+    assert np.load(fn).flags.f_contiguous
+    assert dpt.load(fn, sycl_queue=q).flags.f_contiguous
+
+
+def test_load_chunked(tmp_path, monkeypatch):
+    q = get_queue_or_skip()
+
+    # several chunks with a partial last one, each chunk is whole elements
+    monkeypatch.setattr(npy_io, "_staging_nbytes", 40)
+    xnp = np.arange(1001, dtype="i4").reshape(7, 11, 13)
+    fn = tmp_path / "x.npy"
+    np.save(fn, xnp)
+    y = dpt.load(fn, usm_type="host", sycl_queue=q)
+    assert y.usm_type == "host"
+    assert (dpt.asnumpy(y) == xnp).all()
+
+    dpt.save(fn, y[::-1])
+    assert (np.load(fn) == xnp[::-1]).all()
+
+
+class _FailingWriter(io.BytesIO):
+    "Fails writes after `n_ok` writes succeed"
+
+    def __init__(self, n_ok):
+        super().__init__()
+        self.n_ok = n_ok
+
+    def write(self, b):
+        if self.n_ok == 0:
+            raise OSError("No space left")
+        self.n_ok -= 1
+        return super().write(b)
+
+
+def test_load_save_errors_chunked(monkeypatch):
+    q = get_queue_or_skip()
+
+    # error is raised while copies from or into staging buffers of
+    # earlier chunks may be in flight
+    monkeypatch.setattr(npy_io, "_staging_nbytes", 40)
+    xnp = np.arange(1001, dtype="i4")
+    f = io.BytesIO()
+    np.save(f, xnp)
+    data = f.getvalue()
+    for cut in [4, 400, 2000]:
+        truncated = io.BytesIO(data[:-cut])
+        with pytest.raises(ValueError):
+            dpt.load(truncated, sycl_queue=q)
+
+    x = dpt.asarray(xnp, sycl_queue=q)
+    for n_ok in [1, 5]:
+        with pytest.raises(OSError):
+            dpt.save(_FailingWriter(n_ok), x)
+
+
+def test_load_non_native_byte_order():
+    q = get_queue_or_skip()
+
+    xnp = np.arange(100, dtype=">i4")
+    f = io.BytesIO()
+    np.save(f, xnp)
+    f.seek(0)
+    y = dpt.load(f, sycl_queue=q)
+    assert y.dtype == dpt.int32
+    assert (dpt.asnumpy(y) == xnp).all()
+
+
+def test_load_empty_and_errors(tmp_path):
+    q = get_queue_or_skip()
+
+    fn = tmp_path / "x.npy"
+    np.save(fn, np.empty((0, 3), dtype="f4"))
+    y = dpt.load(fn, sycl_queue=q)
+    assert y.shape == (0, 3)
+
+    np.save(fn, np.asarray([None, 1], dtype=object), allow_pickle=True)
+    with pytest.raises(ValueError):
+        dpt.load(fn, sycl_queue=q)
+
+    f = io.BytesIO()
+    np.save(f, np.arange(10, dtype="i4"))
+    truncated = io.BytesIO(f.getvalue()[:-4])
+    with pytest.raises(ValueError):
+        dpt.load(truncated, sycl_queue=q)
+
+    with pytest.raises(TypeError):
+        dpt.save(fn, np.arange(3))
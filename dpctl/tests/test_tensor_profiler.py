@@ -0,0 +1,131 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import json
+
+import pytest
+
+import dpctl
+import dpctl.tensor as dpt
+import dpctl.tensor._tensor_impl as ti
+from dpctl.tests.helper import get_queue_or_skip
+from dpctl.utils import TensorProfiler
+
+
+def _get_profiling_queue_or_skip():
+    try:
+        q = dpctl.SyclQueue(property="enable_profiling")
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Queue with profiling could not be created")
+    return q
+
+
+def test_profiler_records_entry_points():
+    q = _get_profiling_queue_or_skip()
+
+    x = dpt.ones((16, 32), dtype="f4", sycl_queue=q)
+    with TensorProfiler() as prof:
+        y = dpt.sin(x.T)
+        s = dpt.sum(y, axis=0)
+        z = dpt.copy(x.T, order="C")
+    del s, z
+
+    names = [r["name"] for r in prof.records]
+    assert "_sin" in names
+    assert "_copy_usm_ndarray_into_usm_ndarray" in names
+
+    agg = prof.summary()
+    for name in names:
+        assert agg[name]["calls"] >= 1
+        assert agg[name]["submit_time"] >= 0
+        assert agg[name]["device_time"] >= 0
+
+    tbl = prof.table()
+    assert "_sin" in tbl
+
+
+def test_profiler_restores_entry_points():
+    get_queue_or_skip()
+
+    orig_fn = ti._copy_usm_ndarray_into_usm_ndarray
+    orig_sin = dpt.sin.unary_fn_
+    with TensorProfiler():
+        assert ti._copy_usm_ndarray_into_usm_ndarray is not orig_fn
+        assert dpt.sin.unary_fn_ is not orig_sin
+    assert ti._copy_usm_ndarray_into_usm_ndarray is orig_fn
+    assert dpt.sin.unary_fn_ is orig_sin
+
+
+def test_profiler_no_device_times_without_profiling_queue():
+    q = get_queue_or_skip()
+    if q.has_enable_profiling:
+        pytest.skip("Default queue has profiling enabled")
+
+    x = dpt.ones(10, sycl_queue=q)
+    with TensorProfiler() as prof:
+        dpt.abs(x)
+    recs = prof.records
+    assert len(recs) > 0
+    assert all(r["device_intervals"] == [] for r in recs)
+
+
+def test_profiler_depends_on_non_profiling_events():
+    q = _get_profiling_queue_or_skip()
+    # queue sharing context and device with q, but without profiling
+    q_np = dpctl.SyclQueue(q.sycl_context, q.sycl_device)
+
+    x = dpt.ones(64, dtype="i4", sycl_queue=q)
+    y = dpt.empty_like(x)
+    z = dpt.empty_like(x)
+    ht_ev, cpy_ev = ti._copy_usm_ndarray_into_usm_ndarray(
+        src=x, dst=y, sycl_queue=q_np
+    )
+    with TensorProfiler() as prof:
+        # depend on a kernel event from a non-profiling queue and on
+        # a host task event, neither of which has profiling information
+        ht_ev2, cpy_ev2 = ti._copy_usm_ndarray_into_usm_ndarray(
+            src=y, dst=z, sycl_queue=q, depends=[ht_ev, cpy_ev]
+        )
+    dpctl.SyclEvent.wait_for([ht_ev2, cpy_ev2])
+    recs = prof.records
+    assert len(recs) == 1
+    kinds = [kind for kind, _, _ in recs[0]["device_intervals"]]
+    assert kinds == ["kernel"]
+    assert recs[0]["device_time"] >= 0
+
+
+def test_profiler_chrome_trace(tmp_path):
+    q = _get_profiling_queue_or_skip()
+
+    x = dpt.ones(100, dtype="i4", sycl_queue=q)
+    with TensorProfiler() as prof:
+        dpt.add(x, x)
+    fn = tmp_path / "trace.json"
+    prof.export_chrome_trace(str(fn))
+    with open(fn, "r") as fh:
+        trace = json.load(fh)
+    assert "traceEvents" in trace
+    assert any(ev["name"] == "_add" for ev in trace["traceEvents"])
+
+
+def test_profiler_not_reentrant():
+    get_queue_or_skip()
+
+    prof = TensorProfiler()
+    with prof:
+        with pytest.raises(RuntimeError):
+            with prof:
+                pass
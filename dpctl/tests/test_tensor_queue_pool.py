@@ -0,0 +1,116 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+import pytest
+
+import dpctl
+import dpctl.tensor as dpt
+from dpctl.tests.helper import get_queue_or_skip
+
+
+def test_queue_pool():
+    q = get_queue_or_skip()
+
+    pool = dpt.QueuePool(q, size=3)
+    assert len(pool) == 3
+    assert pool.sycl_queue == q
+    assert all(pq.sycl_context == q.sycl_context for pq in pool)
+    assert all(pq.sycl_device == q.sycl_device for pq in pool)
+    assert len(set(pool)) == 3
+
+    assert [pool.next_queue() for _ in range(6)] == list(pool) * 2
+    pool.wait()
+
+    with pytest.raises(ValueError):
+        dpt.QueuePool(q, size=0)
+
+
+def test_device_queue_pool_cached():
+    get_queue_or_skip()
+
+    p1 = dpt.get_device_queue_pool()
+    p2 = dpt.get_device_queue_pool()
+    assert p1 is p2
+    assert p1.sycl_queue == dpt.empty(1).sycl_queue
+    assert dpt.get_device_queue_pool(size=2) is not p1
+
+
+def test_round_robin_policy():
+    q = get_queue_or_skip()
+
+    pool = dpt.QueuePool(q, size=2)
+    x = dpt.arange(100, dtype="i4", sycl_queue=q)
+    y = dpt.ones(100, dtype="i4", sycl_queue=q)
+    with dpt.RoundRobinPolicy(pool) as policy:
+        f1 = policy.submit(dpt.add, x, y)
+        f2 = policy.submit(dpt.multiply, x, x)
+        f3 = policy.submit(dpt.sum, x)
+        # operations run on different queues of the pool
+        assert f1.result().sycl_queue == pool[0]
+        assert f2.result().sycl_queue == pool[1]
+        assert f3.result().sycl_queue == pool[0]
+        r1, r2 = policy.join(f1, f2)
+        r3 = policy.join(f3)
+
+    x_np = np.arange(100, dtype="i4")
+    for r in (r1, r2, r3):
+        assert r.sycl_queue == q
+    assert np.array_equal(dpt.asnumpy(r1), x_np + 1)
+    assert np.array_equal(dpt.asnumpy(r2), x_np * x_np)
+    assert int(r3) == x_np.sum()
+
+    # results of join combine with arrays of the first queue
+    assert np.array_equal(dpt.asnumpy(r1 + r2 + x), x_np * x_np + 2 * x_np + 1)
+
+
+def test_round_robin_policy_nested_args():
+    q = get_queue_or_skip()
+
+    pool = dpt.QueuePool(q, size=2)
+    x = dpt.ones(10, dtype="f4", sycl_queue=q)
+    with dpt.RoundRobinPolicy(pool) as policy:
+        policy.submit(dpt.sum, x)
+        f = policy.submit(dpt.concat, [x, x], axis=0)
+        res = policy.join(f)
+        assert res.sycl_queue == q
+        assert res.shape == (20,)
+
+        f = policy.submit(dpt.ones, 3, sycl_queue=q)
+        assert f.result().sycl_queue == q
+
+
+def test_round_robin_policy_errors():
+    q = get_queue_or_skip()
+
+    with pytest.raises(TypeError):
+        dpt.RoundRobinPolicy(q)
+
+    pool = dpt.QueuePool(q, size=2)
+    policy = dpt.RoundRobinPolicy(pool)
+    policy.submit(dpt.reshape, dpt.ones(4, sycl_queue=q), (3,))
+    with pytest.raises(ValueError):
+        policy.join()
+    assert policy.join() is None
+
+    try:
+        other_ctx = dpctl.SyclContext(q.sycl_device)
+    except dpctl.SyclContextCreationError:
+        pytest.skip("Context could not be created")
+    x = dpt.ones(4, sycl_queue=dpctl.SyclQueue(other_ctx, q.sycl_device))
+    with pytest.raises(dpctl.utils.ExecutionPlacementError):
+        policy.submit(dpt.abs, x)
+    policy.__exit__(None, None, None)
@@ -0,0 +1,178 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+import pytest
+
+import dpctl.tensor as dpt
+from dpctl.tests.helper import get_queue_or_skip, skip_if_dtype_not_supported
+
+# known-answer vectors of Random123 library for zero counter and key
+_kat_zero = {
+    "philox": [0x6627E8D5, 0xE169C58D, 0xBC57AC4C, 0x9B00DBD8],
+    "threefry": [0x9C6CA96A, 0xE17EAE66, 0xFC10ECD4, 0x5256A7D8],
+}
+
+
+@pytest.mark.parametrize("engine", ["philox", "threefry"])
+def test_random_raw_known_answer(engine):
+    q = get_queue_or_skip()
+
+    g = dpt.Generator(0, engine=engine, sycl_queue=q)
+    r = g.random_raw(6)
+    assert r.dtype == dpt.uint32
+    assert g.offset == 2
+    assert np.array_equal(dpt.asnumpy(r)[:4], _kat_zero[engine])
+
+
+@pytest.mark.parametrize("engine", ["philox", "threefry"])
+def test_random_reproducible(engine):
+    q = get_queue_or_skip()
+
+    # four numbers per block for float32
+    g = dpt.Generator(7, engine=engine, sycl_queue=q)
+    x_np = dpt.asnumpy(g.uniform(size=1003, dtype="f4"))
+
+    # pieces starting at block boundaries continue the same stream
+    g = dpt.Generator(7, engine=engine, sycl_queue=q)
+    y1 = g.uniform(size=400, dtype="f4")
+    y2 = g.uniform(size=(3, 201), dtype="f4")
+    assert np.array_equal(dpt.asnumpy(y1), x_np[:400])
+    assert np.array_equal(dpt.asnumpy(y2).ravel(), x_np[400:])
+
+    g = dpt.Generator(7, engine=engine, sycl_queue=q).advance(25)
+    y = g.uniform(size=3, dtype="f4")
+    assert np.array_equal(dpt.asnumpy(y), x_np[100:103])
+
+    # different streams and seeds give different numbers
+    other_stream = dpt.Generator(7, engine=engine, stream=1, sycl_queue=q)
+    other_seed = dpt.Generator(8, engine=engine, sycl_queue=q)
+    for other in (other_stream, other_seed):
+        y = other.uniform(size=8, dtype="f4")
+        assert not np.array_equal(dpt.asnumpy(y), x_np[:8])
+
+
+@pytest.mark.parametrize("dt", ["f2", "f4", "f8"])
+def test_random_uniform(dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    g = dpt.Generator(123, sycl_queue=q)
+    x = g.uniform(-2, 3, size=(100, 100), dtype=dt)
+    assert x.dtype == dpt.dtype(dt)
+    assert x.shape == (100, 100)
+    x_np = dpt.asnumpy(x).astype("f8")
+    assert x_np.min() >= -2 and x_np.max() <= 3
+    assert abs(x_np.mean() - 0.5) < 0.05
+    assert abs(x_np.var() - 25 / 12) < 0.1
+
+
+def test_random_uniform_from_raw_words():
+    q = get_queue_or_skip()
+
+    raw = dpt.asnumpy(dpt.Generator(3, sycl_queue=q).random_raw(64))
+    x = dpt.asnumpy(
+        dpt.Generator(3, sycl_queue=q).uniform(size=64, dtype="f4")
+    )
+    assert np.array_equal(x, (raw >> 8).astype("f4") * np.float32(2**-24))
+
+
+@pytest.mark.parametrize("dt", ["f4", "f8"])
+def test_random_normal(dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    g = dpt.Generator(5, engine="threefry", sycl_queue=q)
+    x = g.normal(1.5, 2.0, size=200001, dtype=dt)
+    assert x.dtype == dpt.dtype(dt)
+    x_np = dpt.asnumpy(x)
+    assert np.all(np.isfinite(x_np))
+    assert abs(x_np.mean() - 1.5) < 0.02
+    assert abs(x_np.std() - 2.0) < 0.02
+
+
+_int_dtypes = ["i1", "u1", "i2", "u2", "i4", "u4", "i8", "u8"]
+
+
+@pytest.mark.parametrize("dt", _int_dtypes)
+def test_random_integers(dt):
+    q = get_queue_or_skip()
+
+    g = dpt.Generator(11, sycl_queue=q)
+    x = g.integers(3, 10, size=10000, dtype=dt)
+    assert x.dtype == dpt.dtype(dt)
+    x_np = dpt.asnumpy(x)
+    assert np.array_equal(np.unique(x_np), np.arange(3, 10))
+
+    info = np.iinfo(dt)
+    x = g.integers(int(info.min), int(info.max) + 1, size=1000, dtype=dt)
+    x_np = dpt.asnumpy(x)
+    assert np.unique(x_np).size > 100
+
+
+def test_random_integers_single_bound():
+    q = get_queue_or_skip()
+
+    x = dpt.Generator(0, sycl_queue=q).integers(5, size=(7, 9))
+    assert x.dtype == dpt.int64
+    x_np = dpt.asnumpy(x)
+    assert x_np.min() >= 0 and x_np.max() < 5
+
+
+def test_random_spawn():
+    q = get_queue_or_skip()
+
+    g = dpt.Generator(42, sycl_queue=q)
+    children = g.spawn([q, q])
+    assert len(children) == 2
+    assert children[0].stream != children[1].stream
+    assert all(c.seed == 42 for c in children)
+    a, b = (dpt.asnumpy(c.uniform(size=16)) for c in children)
+    assert not np.array_equal(a, b)
+
+    # same sequence of spawns gives same streams
+    again = dpt.Generator(42, sycl_queue=q).spawn([q, q])
+    assert [c.stream for c in again] == [c.stream for c in children]
+    assert g.spawn([q])[0].stream not in [c.stream for c in children]
+
+
+def test_random_validation():
+    q = get_queue_or_skip()
+
+    with pytest.raises(ValueError):
+        dpt.Generator(0, engine="mt19937", sycl_queue=q)
+    with pytest.raises(ValueError):
+        dpt.Generator(-1, sycl_queue=q)
+    g = dpt.Generator(0, sycl_queue=q)
+    with pytest.raises(ValueError):
+        g.uniform(size=3, dtype="i4")
+    with pytest.raises(ValueError):
+        g.uniform(0, np.inf, size=3)
+    with pytest.raises(ValueError):
+        g.normal(0, -1, size=3)
+    with pytest.raises(ValueError):
+        g.integers(5, 5, size=3)
+    with pytest.raises(ValueError):
+        g.integers(0, 300, size=3, dtype="u1")
+    with pytest.raises(ValueError):
+        g.integers(0, 3, size=3, dtype="f4")
+    with pytest.raises(ValueError):
+        g.advance(-1)
+
+    x = g.uniform(size=0)
+    assert x.shape == (0,)
+    assert g.offset == 0
+    assert g.uniform().shape == tuple()
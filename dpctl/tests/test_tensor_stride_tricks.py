@@ -0,0 +1,174 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+import pytest
+from numpy.lib.stride_tricks import sliding_window_view as np_swv
+
+import dpctl.tensor as dpt
+from dpctl.tests.helper import get_queue_or_skip, skip_if_dtype_not_supported
+
+
+def test_as_strided():
+    q = get_queue_or_skip()
+
+    x = dpt.arange(12, dtype="i4", sycl_queue=q)
+    v = dpt.as_strided(x, (3, 4), (4, 1))
+    assert np.array_equal(dpt.asnumpy(v), np.arange(12).reshape(3, 4))
+    assert v.flags.writable
+
+    v = dpt.as_strided(x[2:], (4, 3), (2, 1), writeable=False)
+    expected = np.lib.stride_tricks.as_strided(
+        np.arange(12, dtype="i4")[2:], (4, 3), (8, 4)
+    )
+    assert np.array_equal(dpt.asnumpy(v), expected)
+    assert not v.flags.writable
+
+    # broadcasting with zero stride, and reversed view of the allocation
+    v = dpt.as_strided(x, (2, 3), (0, 1))
+    assert np.array_equal(dpt.asnumpy(v), [[0, 1, 2], [0, 1, 2]])
+    v = dpt.as_strided(x[::-1], (12,), (-1,))
+    assert np.array_equal(dpt.asnumpy(v), np.arange(12)[::-1])
+
+    # views without elements need not be within bounds
+    assert dpt.as_strided(x, (0, 100), (100, 1)).size == 0
+
+
+def test_as_strided_validation():
+    q = get_queue_or_skip()
+
+    x = dpt.arange(12, dtype="i4", sycl_queue=q)
+    with pytest.raises(ValueError):
+        dpt.as_strided(x, (3, 5), (4, 1))
+    with pytest.raises(ValueError):
+        dpt.as_strided(x[1:], (3,), (-1,))
+    with pytest.raises(ValueError):
+        dpt.as_strided(x, (3, 4), (4,))
+    with pytest.raises(ValueError):
+        dpt.as_strided(x, (-1,), (1,))
+    with pytest.raises(TypeError):
+        dpt.as_strided(x, (2.5,), (1,))
+    with pytest.raises(TypeError):
+        dpt.as_strided(np.arange(4), (2,), (1,))
+
+
+@pytest.mark.parametrize(
+    "shape,window_shape,axis",
+    [
+        ((10,), 3, None),
+        ((6, 7), (2, 3), None),
+        ((6, 7), 4, 0),
+        ((4, 5, 6), (2, 2), (2, 0)),
+        ((8,), (2, 3), (0, 0)),
+    ],
+)
+def test_sliding_window_view(shape, window_shape, axis):
+    q = get_queue_or_skip()
+
+    x_np = np.arange(np.prod(shape), dtype="f4").reshape(shape)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    v = dpt.sliding_window_view(x, window_shape, axis=axis)
+    expected = np_swv(x_np, window_shape, axis=axis)
+    assert v.shape == expected.shape
+    assert np.array_equal(dpt.asnumpy(v), expected)
+    assert not v.flags.writable
+
+
+def test_sliding_window_view_validation():
+    q = get_queue_or_skip()
+
+    x = dpt.ones((4, 5), sycl_queue=q)
+    with pytest.raises(ValueError):
+        dpt.sliding_window_view(x, 3)
+    with pytest.raises(ValueError):
+        dpt.sliding_window_view(x, (2, 6))
+    with pytest.raises(ValueError):
+        dpt.sliding_window_view(x, (2, 2), axis=0)
+    with pytest.raises(ValueError):
+        dpt.sliding_window_view(x, -1, axis=1)
+
+    v = dpt.sliding_window_view(x, 2, axis=1, writeable=True)
+    assert v.flags.writable
+
+
+@pytest.mark.parametrize("dt", ["?", "i1", "u2", "i4", "i8", "f2", "f4", "f8"])
+@pytest.mark.parametrize("window", [1, 5, 300])
+def test_sum_sliding_windows(dt, window):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    x_np = (np.arange(1000) % 7).astype(dt)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    s = dpt.sum(dpt.sliding_window_view(x, window), axis=-1)
+    expected = np.sum(np_swv(x_np, window), axis=-1, dtype=s.dtype)
+    assert s.shape == expected.shape
+    assert np.allclose(dpt.asnumpy(s), expected)
+
+
+def test_sum_sliding_windows_batched():
+    q = get_queue_or_skip()
+
+    x_np = np.arange(4 * 3 * 50, dtype="f4").reshape(4, 3, 50) % 11
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    # windows along the last axis, rows over leading axes
+    v = dpt.sliding_window_view(x, 6, axis=-1)
+    res = dpt.sum(v, axis=-1, keepdims=True)
+    expected = np.sum(np_swv(x_np, 6, axis=-1), axis=-1, keepdims=True)
+    assert np.allclose(dpt.asnumpy(res), expected)
+
+    # windows along the middle axis of a strided array
+    y_np = x_np[:, ::-1, ::2]
+    y = x[:, ::-1, ::2]
+    v = dpt.sliding_window_view(y, 2, axis=1)
+    assert np.allclose(
+        dpt.asnumpy(dpt.sum(v, axis=3)), np.sum(np_swv(y_np, 2, axis=1), 3)
+    )
+
+    # windows longer than the number of windows
+    v = dpt.sliding_window_view(x, 40, axis=-1)
+    assert np.allclose(
+        dpt.asnumpy(dpt.sum(v, axis=-1)),
+        np.sum(np_swv(x_np, 40, axis=-1), axis=-1),
+    )
+
+    # sum over the sliding axis
+    v = dpt.sliding_window_view(x, 6, axis=-1)
+    assert np.allclose(
+        dpt.asnumpy(dpt.sum(v, axis=2)),
+        np.sum(np_swv(x_np, 6, axis=-1), axis=2),
+    )
+
+
+def test_unary_sliding_windows():
+    q = get_queue_or_skip()
+
+    x_np = np.linspace(-3, 3, num=200, dtype="f4").reshape(2, 100)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    v = dpt.sliding_window_view(x, 8, axis=1)
+    v_np = np_swv(x_np, 8, axis=1)
+
+    res = dpt.exp(v)
+    assert res.shape == v.shape
+    assert res.flags.c_contiguous
+    assert np.allclose(dpt.asnumpy(res), np.exp(v_np), rtol=1e-5)
+
+    res = dpt.abs(dpt.permute_dims(v, (2, 1, 0)))
+    assert np.array_equal(dpt.asnumpy(res), np.abs(v_np.transpose(2, 1, 0)))
+
+    res = dpt.isnan(v)
+    assert res.dtype == dpt.bool
+    assert not np.any(dpt.asnumpy(res))
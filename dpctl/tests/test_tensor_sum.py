@@ -14,12 +14,18 @@
 #  See the License for the specific language governing permissions and
 #  limitations under the License.
 
+import os
+import subprocess
+import sys
+
 import numpy as np
 import pytest
 
 import dpctl.tensor as dpt
 from dpctl.tests.helper import get_queue_or_skip, skip_if_dtype_not_supported
 
+_FASTPATH_ENV = "DPCTL_TENSOR_HOST_FASTPATH_MAX_ELEMS"
+
 _all_dtypes = [
     "?",
     "i1",
@@ -187,3 +193,48 @@ def test_axis0_bug():
     expected = dpt.asarray([[0, 3], [1, 4], [2, 5]])
 
     assert dpt.all(s == expected)
+
+
+@pytest.mark.parametrize("usm_type", _usm_types)
+def test_sum_small_arrays(usm_type):
+    q = get_queue_or_skip()
+
+    # few elements in USM-host or USM-shared memory may be summed on the
+    # host, see test_sum_small_arrays_host_fastpath
+    x_np = np.arange(12, dtype="i4").reshape(3, 4)
+    x = dpt.asarray(x_np, usm_type=usm_type, sycl_queue=q)
+    for axis in (None, 0, 1):
+        s = dpt.sum(x, axis=axis)
+        assert s.usm_type == usm_type
+        assert np.array_equal(dpt.asnumpy(s), np.sum(x_np, axis=axis))
+    # dependent on preceding computation
+    s = dpt.sum(x + 1, axis=1)
+    assert np.array_equal(dpt.asnumpy(s), np.sum(x_np + 1, axis=1))
+
+
+@pytest.mark.skipif(
+    os.environ.get(_FASTPATH_ENV) is not None,
+    reason="Threshold of evaluation on the host already set",
+)
+def test_sum_small_arrays_host_fastpath():
+    get_queue_or_skip()
+    # threshold is read once per process, so the test is run in a fresh
+    # interpreter
+    env = dict(os.environ)
+    env[_FASTPATH_ENV] = "16"
+    res = subprocess.run(
+        [
+            sys.executable,
+            "-m",
+            "pytest",
+            "-q",
+            "-p",
+            "no:cacheprovider",
+            "-k",
+            "test_sum_small_arrays and not host_fastpath",
+            os.path.abspath(__file__),
+        ],
+        env=env,
+        capture_output=True,
+    )
+    assert res.returncode == 0, res.stdout.decode("utf-8")
@@ -1,5 +1,6 @@
 import itertools
 
+import numpy as np
 import pytest
 
 import dpctl.tensor as dpt
@@ -147,3 +148,82 @@ def test_allclose_complex_fp_early_exists():
 
     x2 = dpt.asarray([0.0, -dpt.inf * 1j, dpt.inf * 1j], dtype="c8")
     assert not dpt.allclose(x1, x2)
+
+
+@pytest.mark.parametrize("dtype", ["f2", "f4", "f8", "c8", "c16"])
+def test_isclose_fp(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    v = [dpt.nan, dpt.inf, -dpt.inf, 0.0, 1.0, -1.0]
+    pairs = list(itertools.product(v, repeat=2))
+    x1 = dpt.asarray([p[0] for p in pairs], dtype=dtype, sycl_queue=q)
+    x2 = dpt.asarray([p[1] for p in pairs], dtype=dtype, sycl_queue=q)
+
+    for equal_nan in [False, True]:
+        r = dpt.isclose(x1, x2, atol=0, rtol=0, equal_nan=equal_nan)
+        assert r.dtype == dpt.bool
+        assert r.shape == x1.shape
+        expected = np.isclose(
+            dpt.asnumpy(x1),
+            dpt.asnumpy(x2),
+            atol=0,
+            rtol=0,
+            equal_nan=equal_nan,
+        )
+        assert (dpt.asnumpy(r) == expected).all()
+
+
+def test_isclose_strided_and_broadcast():
+    get_queue_or_skip()
+
+    x1 = dpt.reshape(dpt.arange(12, dtype="f4"), (3, 4))
+    x2 = dpt.asarray([0, 1.5, 2.0000001, 3], dtype="f4")
+    r = dpt.isclose(x1.mT, x2[:3], atol=0.25, rtol=0)
+    expected = np.isclose(
+        dpt.asnumpy(x1).T, dpt.asnumpy(x2)[:3], atol=0.25, rtol=0
+    )
+    assert r.shape == expected.shape
+    assert (dpt.asnumpy(r) == expected).all()
+
+
+def test_isclose_integral():
+    get_queue_or_skip()
+
+    x1 = dpt.arange(10, dtype="i4")
+    x2 = dpt.flip(dpt.arange(10, dtype="i8"))
+    r = dpt.isclose(x1, x2, atol=2, rtol=0)
+    # integral elements are close within tolerances
+    d = np.abs(dpt.asnumpy(x1) - dpt.asnumpy(x2))
+    assert (dpt.asnumpy(r) == (d <= 2)).all()
+
+    r = dpt.isclose(x1, x2, atol=0, rtol=0.5)
+    expected = d <= 0.5 * np.maximum(dpt.asnumpy(x1), dpt.asnumpy(x2))
+    assert (dpt.asnumpy(r) == expected).all()
+
+    # difference is computed without overflow
+    imax = np.iinfo("i1").max
+    x1 = dpt.asarray([-imax, imax, 5], dtype="i1")
+    x2 = dpt.asarray([imax, -imax, 6], dtype="i1")
+    r = dpt.isclose(x1, x2, atol=1, rtol=0)
+    assert (dpt.asnumpy(r) == [False, False, True]).all()
+    assert not dpt.allclose(x1, x2, atol=1, rtol=0)
+    assert dpt.allclose(x1[2:], x2[2:], atol=1, rtol=0)
+
+
+def test_allclose_strided_and_empty():
+    get_queue_or_skip()
+
+    x1 = dpt.reshape(dpt.arange(1024, dtype="f4"), (32, 32))
+    x2 = dpt.asarray(x1, order="F")
+    r = dpt.allclose(x1.mT, x2.mT)
+    assert r.shape == tuple()
+    assert r.dtype == dpt.bool
+    assert r
+
+    x2[31, 31] = -1
+    assert not dpt.allclose(x1[::-1], x2[::-1])
+    assert dpt.allclose(x1[:-1], x2[:-1])
+
+    e = dpt.empty((0, 3), dtype="f4")
+    assert dpt.allclose(e, e)
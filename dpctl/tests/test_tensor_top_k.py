@@ -0,0 +1,168 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+import pytest
+
+import dpctl.tensor as dpt
+import dpctl.tensor._tensor_impl as ti
+from dpctl.tests.helper import get_queue_or_skip, skip_if_dtype_not_supported
+
+_real_dtypes = [
+    "i1",
+    "u1",
+    "i2",
+    "u2",
+    "i4",
+    "u4",
+    "i8",
+    "u8",
+    "f2",
+    "f4",
+    "f8",
+]
+
+
+def _expected_top_k(x_np, k, largest):
+    "Indices of top-k of rows of `x_np` with distinct elements"
+    order = np.argsort(x_np, axis=-1, kind="stable")
+    if largest:
+        order = order[..., ::-1]
+    return order[..., :k]
+
+
+@pytest.mark.parametrize("dt", _real_dtypes)
+@pytest.mark.parametrize("k", [1, 7, 32, 33, 100])
+def test_top_k_dtypes(dt, k):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    # distinct values representable in all data types
+    rng = np.random.default_rng(1234)
+    x_np = np.stack([rng.permutation(120) for _ in range(5)]).astype(dt)
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    for mode in ["largest", "smallest"]:
+        res = dpt.top_k(x, k, mode=mode)
+        assert res.values.shape == (5, k)
+        assert res.indices.shape == (5, k)
+        assert res.values.dtype == x.dtype
+        assert res.indices.dtype == ti.default_device_index_type(
+            q.sycl_device
+        )
+        expected_ind = _expected_top_k(x_np, k, mode == "largest")
+        assert np.array_equal(dpt.asnumpy(res.indices), expected_ind)
+        assert np.array_equal(
+            dpt.asnumpy(res.values),
+            np.take_along_axis(x_np, expected_ind, axis=-1),
+        )
+
+
+@pytest.mark.parametrize("k", [5, 300])
+def test_top_k_long_rows(k):
+    # few long rows are split between work-groups for small k
+    q = get_queue_or_skip()
+
+    rng = np.random.default_rng(42)
+    x_np = rng.permutation(3 * 50000).astype("f4").reshape(3, 50000)
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    vals, inds = dpt.top_k(x, k)
+    expected_ind = _expected_top_k(x_np, k, True)
+    assert np.array_equal(dpt.asnumpy(inds), expected_ind)
+    assert np.array_equal(
+        dpt.asnumpy(vals), np.take_along_axis(x_np, expected_ind, axis=-1)
+    )
+
+
+@pytest.mark.parametrize("k", [3, 40])
+def test_top_k_ties_and_nans(k):
+    q = get_queue_or_skip()
+
+    x_np = np.zeros(64, dtype="f4")
+    x_np[[5, 17, 40]] = np.nan
+    x_np[[2, 9]] = 1
+    # negative zeros tie with positive zeros
+    x_np[[1, 30, 63]] = -0.0
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    res = dpt.top_k(x, k)
+    expected_ind = np.concatenate(
+        [[5, 17, 40, 2, 9], np.setdiff1d(np.arange(64), [2, 5, 9, 17, 40])]
+    )[:k]
+    assert np.array_equal(dpt.asnumpy(res.indices), expected_ind)
+
+    res = dpt.top_k(x, k, mode="smallest")
+    expected_ind = np.setdiff1d(np.arange(64), [2, 5, 9, 17, 40])[:k]
+    assert np.array_equal(dpt.asnumpy(res.indices), expected_ind)
+
+
+def test_top_k_axis():
+    q = get_queue_or_skip()
+
+    rng = np.random.default_rng(7)
+    x_np = rng.permutation(4 * 30 * 6).astype("i4").reshape(4, 30, 6)
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    res = dpt.top_k(x, 4, axis=1)
+    assert res.values.shape == (4, 4, 6)
+    expected_ind = np.moveaxis(
+        _expected_top_k(np.moveaxis(x_np, 1, -1), 4, True), -1, 1
+    )
+    assert np.array_equal(dpt.asnumpy(res.indices), expected_ind)
+    assert np.array_equal(
+        dpt.asnumpy(res.values), np.take_along_axis(x_np, expected_ind, 1)
+    )
+
+    # strided input
+    res = dpt.top_k(x[::2, ::-1], 3, axis=1)
+    expected_ind = np.moveaxis(
+        _expected_top_k(np.moveaxis(x_np[::2, ::-1], 1, -1), 3, True), -1, 1
+    )
+    assert np.array_equal(dpt.asnumpy(res.indices), expected_ind)
+
+
+def test_top_k_empty():
+    q = get_queue_or_skip()
+
+    x = dpt.ones((0, 10), dtype="f4", sycl_queue=q)
+    res = dpt.top_k(x, 3)
+    assert res.values.shape == (0, 3)
+
+    x = dpt.ones((4, 10), dtype="f4", sycl_queue=q)
+    res = dpt.top_k(x, 0)
+    assert res.values.shape == (4, 0)
+    assert res.indices.shape == (4, 0)
+
+
+def test_top_k_validation():
+    q = get_queue_or_skip()
+
+    x = dpt.ones((4, 10), dtype="f4", sycl_queue=q)
+    with pytest.raises(TypeError):
+        dpt.top_k(dpt.asnumpy(x), 2)
+    with pytest.raises(ValueError):
+        dpt.top_k(x, 11)
+    with pytest.raises(ValueError):
+        dpt.top_k(x, -1)
+    with pytest.raises(ValueError):
+        dpt.top_k(x, 2, mode="median")
+    with pytest.raises(ValueError):
+        dpt.top_k(x[0, 0], 1)
+    with pytest.raises(np.AxisError):
+        dpt.top_k(x, 2, axis=2)
+    with pytest.raises(TypeError):
+        dpt.top_k(dpt.ones(10, dtype="c8", sycl_queue=q), 2)
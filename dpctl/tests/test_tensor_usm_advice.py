@@ -0,0 +1,110 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2023 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import gc
+
+import numpy as np
+import pytest
+
+import dpctl.tensor as dpt
+import dpctl.tensor._usm_advice as usm_advice
+from dpctl.tensor._usm_advice import _last_access_side
+from dpctl.tests.helper import get_queue_or_skip
+
+
+def get_shared_queue_or_skip():
+    q = get_queue_or_skip()
+    if not q.sycl_device.has_aspect_usm_shared_allocations:
+        pytest.skip("Device does not support shared USM allocations")
+    return q
+
+
+def test_shared_array_last_access_side():
+    q = get_shared_queue_or_skip()
+
+    x_np = np.arange(64, dtype="i4")
+    x = dpt.asarray(x_np, usm_type="shared", sycl_queue=q)
+    assert _last_access_side(x) == "host"
+    # read on the host
+    assert np.array_equal(dpt.asnumpy(x), x_np)
+
+    y = dpt.add(x, 1)
+    assert _last_access_side(x) == "device"
+    # read by the device copy
+    assert np.array_equal(dpt.asnumpy(x), x_np)
+    assert np.array_equal(dpt.asnumpy(y), x_np + 1)
+
+    # views share the allocation
+    x[::-2] = np.zeros(32, dtype="i4")
+    assert _last_access_side(x[1:]) == "host"
+    x_np[::-2] = 0
+    assert np.array_equal(dpt.asnumpy(x), x_np)
+    assert int(dpt.sum(x)) == x_np.sum()
+    assert _last_access_side(x) == "device"
+
+    d = dpt.asarray(x_np, usm_type="device", sycl_queue=q)
+    assert _last_access_side(d) is None
+    assert np.array_equal(dpt.asnumpy(dpt.abs(d)), x_np)
+
+
+def test_set_usm_advice():
+    q = get_shared_queue_or_skip()
+
+    x = dpt.ones(100, dtype="f4", usm_type="shared", sycl_queue=q)
+    assert dpt.get_usm_advice(x) == {"read_mostly": False, "prefetch": True}
+    dpt.set_usm_advice(x, read_mostly=True)
+    assert dpt.get_usm_advice(x[10:]) == {
+        "read_mostly": True,
+        "prefetch": True,
+    }
+    dpt.set_usm_advice(x[10:], prefetch=False)
+    assert dpt.get_usm_advice(x) == {"read_mostly": True, "prefetch": False}
+
+    x[:] = np.arange(100, dtype="f4")
+    assert np.allclose(dpt.asnumpy(dpt.multiply(x, x)), np.arange(100) ** 2)
+    dpt.set_usm_advice(x, read_mostly=False, prefetch=True)
+    assert dpt.get_usm_advice(x) == {"read_mostly": False, "prefetch": True}
+
+    d = dpt.ones(10, usm_type="device", sycl_queue=q)
+    dpt.set_usm_advice(d, read_mostly=True)
+    assert dpt.get_usm_advice(d) is None
+
+    with pytest.raises(TypeError):
+        dpt.set_usm_advice(np.ones(10), read_mostly=True)
+    with pytest.raises(TypeError):
+        dpt.get_usm_advice(None)
+
+
+def test_usm_advice_dropped_with_arrays():
+    q = get_shared_queue_or_skip()
+
+    x = dpt.ones(100, dtype="f4", usm_type="shared", sycl_queue=q)
+    key = x.usm_data._pointer
+    dpt.set_usm_advice(x, prefetch=False)
+    y = x[10:]
+    assert np.array_equal(dpt.asnumpy(dpt.add(y, y)), np.full(90, 2))
+    del x
+    gc.collect()
+    # a view used by a function keeps the record
+    assert dpt.get_usm_advice(y) == {"read_mostly": False, "prefetch": False}
+    del y
+    gc.collect()
+    # so that an allocation reusing the address does not inherit settings
+    z = dpt.ones(100, dtype="f4", usm_type="shared", sycl_queue=q)
+    assert dpt.get_usm_advice(z) == {"read_mostly": False, "prefetch": True}
+    with usm_advice._lock:
+        usm_advice._purge()
+        assert key not in usm_advice._records
@@ -2211,3 +2211,34 @@ def test_gh_1201():
     c = dpt.flip(dpt.empty(a.shape, dtype=a.dtype))
     c[:] = a
     assert (dpt.asnumpy(c) == a).all()
+
+
+@pytest.mark.parametrize("usm_type", ["device", "shared", "host"])
+@pytest.mark.parametrize("protocol", [4, 5])
+def test_usm_ndarray_pickling(usm_type, protocol):
+    import pickle
+
+    get_queue_or_skip()
+    x = dpt.reshape(dpt.arange(120, dtype="i4", usm_type=usm_type), (4, 5, 6))
+    for ary in [x, x[::-2, 1:, ::3], x.mT, x[0, 0, 0]]:
+        r = pickle.loads(pickle.dumps(ary, protocol=protocol))
+        assert isinstance(r, dpt.usm_ndarray)
+        assert r.shape == ary.shape
+        assert r.dtype == ary.dtype
+        assert r.usm_type == usm_type
+        assert (dpt.asnumpy(r) == dpt.asnumpy(ary)).all()
+
+        if protocol >= 5:
+            buffers = []
+            data = pickle.dumps(
+                ary, protocol=protocol, buffer_callback=buffers.append
+            )
+            assert len(buffers) == 1
+            r = pickle.loads(data, buffers=buffers)
+            assert (dpt.asnumpy(r) == dpt.asnumpy(ary)).all()
+
+    y = dpt.empty((0, 3), dtype="f4", usm_type=usm_type)
+    y.flags.writable = False
+    r = pickle.loads(pickle.dumps(y, protocol=protocol))
+    assert r.shape == y.shape
+    assert not r.flags.writable
@@ -163,6 +163,54 @@ def test_basic_slice10():
     assert y.strides == (0, n1 * n2, n2, 1)
 
 
+@pytest.mark.parametrize(
+    "ind",
+    [
+        (1, slice(None, None, -2)),
+        (Ellipsis, -1),
+        (slice(2, 1), Ellipsis, 0),
+        (None, slice(1, None), None, Ellipsis, slice(None, None, 3)),
+        (-2, slice(5, 0, -2), 3),
+        (),
+    ],
+)
+def test_basic_slice_views_match_numpy(ind):
+    q = get_queue_or_skip()
+    xnp = np.arange(4 * 7 * 5, dtype="i4").reshape((4, 7, 5))
+    x = dpt.asarray(xnp, sycl_queue=q)
+    for base_x, base_xnp in [(x, xnp), (x.mT, xnp.swapaxes(-1, -2))]:
+        y = base_x[ind]
+        ynp = base_xnp[ind]
+        assert y.shape == ynp.shape
+        assert y.flags.c_contiguous == ynp.flags.c_contiguous
+        assert y.flags.f_contiguous == ynp.flags.f_contiguous
+        assert_array_equal(dpt.asnumpy(y), ynp)
+
+
+def test_basic_slice_high_rank():
+    q = get_queue_or_skip()
+    # views with more dimensions than stored inline in the array object
+    x = dpt.reshape(dpt.arange(2**10, dtype="i2", sycl_queue=q), (2,) * 10)
+    xnp = dpt.asnumpy(x)
+    for ind in [(1, Ellipsis, 0), (None,) * 3, (slice(None, None, -1),)]:
+        y = x[ind]
+        assert y.shape == xnp[ind].shape
+        assert_array_equal(dpt.asnumpy(y), xnp[ind])
+    y = x[(None,) * 3][0, 0, 0, ..., ::-1]
+    assert_array_equal(dpt.asnumpy(y), xnp[..., ::-1])
+    y = dpt.permute_dims(x, tuple(range(10))[::-1])
+    assert_array_equal(dpt.asnumpy(y), xnp.T)
+
+
+def test_basic_slice_view_flags():
+    q = get_queue_or_skip()
+    x = dpt.ones((3, 4), dtype="c8", sycl_queue=q)
+    x.flags["W"] = False
+    for v in [x[1:], x.T, x.mT, x.real, x.imag, x[0, ...]]:
+        assert not v.flags.writable
+        assert v.usm_data is x.usm_data
+
+
 def _all_equal(it1, it2):
     return all(dpt.asnumpy(x) == dpt.asnumpy(y) for x, y in zip(it1, it2))
 
@@ -435,6 +483,53 @@ def test_integer_indexing_2d():
     assert (dpt.asnumpy(y) == np.array([[5, 6], [12, 13]])).all()
 
 
+def test_integer_indexing_outer_product():
+    get_queue_or_skip()
+    x_np = np.arange(4 * 6 * 5, dtype="i4").reshape(4, 6, 5)
+    x = dpt.asarray(x_np)
+    i_np = np.array([3, 0, 2], dtype="i8")
+    j_np = np.array([5, 1, 4, 2], dtype="i8")
+    k_np = np.array([0, 4], dtype="i8")
+    i, j, k = dpt.asarray(i_np), dpt.asarray(j_np), dpt.asarray(k_np)
+
+    y = x[i[:, None, None], j[None, :, None], k]
+    expected = x_np[i_np[:, None, None], j_np[None, :, None], k_np]
+    assert (dpt.asnumpy(y) == expected).all()
+    # strided source, reversed index, trailing basic slice
+    y = x[::-1, j[:, None], i[::-1]]
+    expected = x_np[::-1, j_np[:, None], i_np[::-1]]
+    assert (dpt.asnumpy(y) == expected).all()
+
+    v_np = -np.arange(3 * 4, dtype="i4").reshape(3, 4, 1)
+    x[i[:, None], j] = dpt.asarray(v_np)
+    x_np[i_np[:, None], j_np] = v_np
+    assert (dpt.asnumpy(x) == x_np).all()
+
+
+def test_mixed_boolean_integer_indexing():
+    get_queue_or_skip()
+    x_np = np.arange(3 * 4 * 5 * 2, dtype="i4").reshape(3, 4, 5, 2)
+    x = dpt.asarray(x_np)
+    m_np = np.arange(4 * 5).reshape(4, 5) % 3 == 0
+    ind_np = np.array([1])
+    m = dpt.asarray(m_np)
+    # positions of set mask elements have default index data type
+    ind = dpt.asarray(ind_np, dtype=ti.default_device_index_type(x.sycl_queue))
+
+    y = x[:, m, ind]
+    expected = x_np[:, m_np, ind_np]
+    assert y.shape == expected.shape
+    assert (dpt.asnumpy(y) == expected).all()
+    # dimensions spanned by mask can not be merged
+    y = x[:, ::2][:, m[::2], ind]
+    expected = x_np[:, ::2][:, m_np[::2], ind_np]
+    assert (dpt.asnumpy(y) == expected).all()
+
+    x[1:, m, ind] = 0
+    x_np[1:, m_np, ind_np] = 0
+    assert (dpt.asnumpy(x) == x_np).all()
+
+
 def test_integer_strided_indexing():
     get_queue_or_skip()
     n0, n1 = 5, 7
@@ -1293,6 +1388,67 @@ def test_place_empty_vals_full_false_mask():
     assert (dpt.asnumpy(x) == expected).all()
 
 
+@pytest.mark.parametrize("dt", ["?", "i1", "u8", "f2", "f4", "c8"])
+def test_setitem_mask_scalar(dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+    x_np = np.zeros((4, 6), dtype=dt)
+    m_np = (np.arange(24) % 3 == 0).reshape(4, 6)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    m = dpt.asarray(m_np, sycl_queue=q)
+    x[m] = 1
+    x_np[m_np] = 1
+    assert (dpt.asnumpy(x) == x_np).all()
+    # strided destination and mask
+    x[::-1, 1::2][m[:, ::2]] = True
+    x_np[::-1, 1::2][m_np[:, ::2]] = True
+    assert (dpt.asnumpy(x) == x_np).all()
+
+
+def test_setitem_mask_broadcastable_rhs():
+    get_queue_or_skip()
+    x_np = np.arange(60, dtype="i4").reshape(3, 4, 5)
+    x = dpt.asarray(x_np)
+    m_np = np.array([True, False, True, True])
+    m = dpt.asarray(m_np)
+    # rhs of shape (3, 1, 5) and (5,) are the same for every selected row
+    v_np = np.arange(-15, 0, dtype="i4").reshape(3, 1, 5)
+    x[:, m] = dpt.asarray(v_np)
+    x_np[:, m_np] = v_np
+    assert (dpt.asnumpy(x) == x_np).all()
+    x[:, m, :] = dpt.asarray([7, 8, 9, 10, 11], dtype="i8")
+    x_np[:, m_np, :] = np.asarray([7, 8, 9, 10, 11])
+    assert (dpt.asnumpy(x) == x_np).all()
+    # 2D mask spanning the two leading dimensions
+    m2_np = np.arange(12).reshape(3, 4) % 2 == 1
+    x[dpt.asarray(m2_np)] = dpt.asarray([[-1, -2, -3, -4, -5]], dtype="i4")
+    x_np[m2_np] = np.asarray([[-1, -2, -3, -4, -5]])
+    assert (dpt.asnumpy(x) == x_np).all()
+
+
+def test_setitem_mask_rhs_overlaps_dst():
+    get_queue_or_skip()
+    x_np = np.arange(12, dtype="f4").reshape(3, 4)
+    x = dpt.asarray(x_np)
+    m_np = np.array([False, True, True])
+    x[dpt.asarray(m_np)] = x[0]
+    x_np[m_np] = x_np[0]
+    assert (dpt.asnumpy(x) == x_np).all()
+    # mask is the destination itself
+    b = dpt.asarray([True, False, True])
+    b[b] = False
+    assert not dpt.asnumpy(b).any()
+
+
+def test_setitem_mask_shape_mismatch():
+    get_queue_or_skip()
+    x = dpt.zeros((2, 3), dtype="i4")
+    with pytest.raises(ValueError):
+        x[dpt.ones((3, 2), dtype="?")] = 1
+    with pytest.raises(ValueError):
+        x[dpt.ones((2, 3), dtype="?")] = dpt.ones((2, 2, 3), dtype="i4")
+
+
 def test_nonzero():
     get_queue_or_skip()
     x = dpt.concat((dpt.zeros(3), dpt.ones(4), dpt.zeros(3)))
@@ -25,11 +25,13 @@ from ._compute_follows_data import (
     validate_usm_type,
 )
 from ._onetrace_context import onetrace_enabled
+from ._tensor_profiler import TensorProfiler
 
 __all__ = [
     "get_execution_queue",
     "get_coerced_usm_type",
     "validate_usm_type",
     "onetrace_enabled",
+    "TensorProfiler",
     "ExecutionPlacementError",
 ]
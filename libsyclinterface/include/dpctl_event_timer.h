@@ -0,0 +1,241 @@
+//===-- dpctl_event_timer.h - C API for event based region timer -*-C++-*- ===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This header declares a C API to a timer of named code regions. Regions
+/// may be nested and are tracked per thread. Events of commands submitted
+/// while a region is open on the calling thread, to any queue, are recorded
+/// with DPCTLEventTimer_RecordEvent. Device time of a region is the span
+/// between the earliest start and the latest end of its events, as given by
+/// their profiling information, so no barriers are submitted. Host and device
+/// times are accumulated per region name over many executions.
+///
+/// Queue submission functions of libsyclinterface record their events
+/// automatically.
+///
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "Support/DllExport.h"
+#include "Support/ExternC.h"
+#include "Support/MemOwnershipAttrs.h"
+#include "dpctl_data_types.h"
+#include "dpctl_sycl_types.h"
+
+DPCTL_C_EXTERN_C_BEGIN
+
+/**
+ * @defgroup EventTimer Event based region timer
+ */
+
+/*!
+ * @brief Opaque pointer to a region timer.
+ *
+ * @ingroup EventTimer
+ */
+typedef struct DPCTLOpaqueEventTimer *DPCTLEventTimerRef;
+
+/*!
+ * @brief Clock used to measure the duration of a region.
+ *
+ * @ingroup EventTimer
+ */
+typedef enum
+{
+    DPCTL_EVENT_TIMER_HOST,
+    DPCTL_EVENT_TIMER_DEVICE
+} DPCTLEventTimerClock;
+
+/*!
+ * @brief Creates a new timer without any recorded samples.
+ *
+ * @return An opaque pointer to the timer, which must be freed with
+ * DPCTLEventTimer_Delete.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+__dpctl_give DPCTLEventTimerRef DPCTLEventTimer_Create(void);
+
+/*!
+ * @brief Deletes the timer. Regions of the timer which are still open on
+ * any thread are discarded.
+ *
+ * @param    TRef           Timer to delete.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+void DPCTLEventTimer_Delete(__dpctl_take DPCTLEventTimerRef TRef);
+
+/*!
+ * @brief Opens a region on the calling thread and records its host start
+ * time.
+ *
+ * @param    TRef           Timer owning the region.
+ * @param    name           C string naming the region. The string is copied.
+ * @return True on success, false if either argument is nullptr.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+bool DPCTLEventTimer_BeginRegion(__dpctl_keep DPCTLEventTimerRef TRef,
+                                 __dpctl_keep const char *name);
+
+/*!
+ * @brief Closes the innermost region open on the calling thread, which must
+ * belong to the given timer.
+ *
+ * The host end time is recorded immediately. Device time is computed by
+ * DPCTLEventTimer_Synchronize.
+ *
+ * @param    TRef           Timer owning the region.
+ * @return True on success, false if the innermost region open on the calling
+ * thread does not belong to TRef.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+bool DPCTLEventTimer_EndRegion(__dpctl_keep DPCTLEventTimerRef TRef);
+
+/*!
+ * @brief Records an event of a command submitted by the calling thread with
+ * every region open on this thread.
+ *
+ * The call is a no-op if no region is open on the calling thread. A region
+ * holds at most 1024 events. Beyond that, profiling information of its
+ * completed events is folded into its device span, and if none has
+ * completed, the call waits for the oldest event of the region.
+ *
+ * @param    ERef           Event to record. The event is copied.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+void DPCTLEventTimer_RecordEvent(__dpctl_keep const DPCTLSyclEventRef ERef);
+
+/*!
+ * @brief Waits for events of closed regions and accumulates their host and
+ * device durations.
+ *
+ * Events without profiling information, e.g. submitted to queues created
+ * without "enable_profiling" property, do not contribute to the device time.
+ * Regions without any such events only contribute a host sample.
+ *
+ * @param    TRef           Timer to synchronize.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+void DPCTLEventTimer_Synchronize(__dpctl_keep DPCTLEventTimerRef TRef);
+
+/*!
+ * @brief Discards all samples and regions closed but not yet synchronized.
+ *
+ * @param    TRef           Timer to reset.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+void DPCTLEventTimer_Reset(__dpctl_keep DPCTLEventTimerRef TRef);
+
+/*!
+ * @brief Returns the duration of the region synchronized last.
+ *
+ * @param    TRef           Timer.
+ * @param    clock          Clock to query.
+ * @return Duration in nanoseconds, or zero if no region was synchronized or
+ * the region has no device sample.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+uint64_t DPCTLEventTimer_GetLastDuration(__dpctl_keep DPCTLEventTimerRef TRef,
+                                         DPCTLEventTimerClock clock);
+
+/*!
+ * @brief Returns the number of distinct region names with samples.
+ *
+ * @param    TRef           Timer.
+ * @return Number of region names.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+size_t DPCTLEventTimer_GetNumRegions(__dpctl_keep DPCTLEventTimerRef TRef);
+
+/*!
+ * @brief Returns the name of the region at the given position. Names are
+ * ordered lexicographically.
+ *
+ * @param    TRef           Timer.
+ * @param    pos            Position of the region.
+ * @return A C string which must be freed with DPCTLCString_Delete, or
+ * nullptr if pos is out of range.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+__dpctl_give const char *
+DPCTLEventTimer_GetRegionName(__dpctl_keep DPCTLEventTimerRef TRef,
+                              size_t pos);
+
+/*!
+ * @brief Returns the number of samples accumulated for the named region.
+ *
+ * @param    TRef           Timer.
+ * @param    name           Name of the region.
+ * @param    clock          Clock to query.
+ * @return Number of samples.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+size_t DPCTLEventTimer_GetCount(__dpctl_keep DPCTLEventTimerRef TRef,
+                                __dpctl_keep const char *name,
+                                DPCTLEventTimerClock clock);
+
+/*!
+ * @brief Returns the mean of the samples accumulated for the named region.
+ *
+ * @param    TRef           Timer.
+ * @param    name           Name of the region.
+ * @param    clock          Clock to query.
+ * @return Mean duration in nanoseconds, or a negative value if there are no
+ * samples.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+double DPCTLEventTimer_GetMean(__dpctl_keep DPCTLEventTimerRef TRef,
+                               __dpctl_keep const char *name,
+                               DPCTLEventTimerClock clock);
+
+/*!
+ * @brief Returns the quantile of the samples accumulated for the named
+ * region, using linear interpolation between closest ranks.
+ *
+ * Quantile 0 gives the minimum, 0.5 gives the median, 0.99 gives the 99-th
+ * percentile.
+ *
+ * @param    TRef           Timer.
+ * @param    name           Name of the region.
+ * @param    clock          Clock to query.
+ * @param    q              Quantile in the interval [0, 1].
+ * @return Quantile in nanoseconds, or a negative value if there are no
+ * samples or q is out of range.
+ * @ingroup EventTimer
+ */
+DPCTL_API
+double DPCTLEventTimer_GetQuantile(__dpctl_keep DPCTLEventTimerRef TRef,
+                                   __dpctl_keep const char *name,
+                                   DPCTLEventTimerClock clock,
+                                   double q);
+
+DPCTL_C_EXTERN_C_END
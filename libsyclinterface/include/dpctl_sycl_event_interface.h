@@ -93,6 +93,19 @@ DPCTL_API
 __dpctl_give DPCTLSyclEventRef
 DPCTLEvent_Copy(__dpctl_keep const DPCTLSyclEventRef ERef);
 
+/*!
+ * @brief Checks if two DPCTLSyclEventRef objects point to the same
+ * sycl::event, i.e. to the same command or host task.
+ *
+ * @param    ERef1          First opaque pointer to a ``sycl::event``.
+ * @param    ERef2          Second opaque pointer to a ``sycl::event``.
+ * @return   True if the underlying sycl::event are same, false otherwise.
+ * @ingroup EventInterface
+ */
+DPCTL_API
+bool DPCTLEvent_AreEq(__dpctl_keep const DPCTLSyclEventRef ERef1,
+                      __dpctl_keep const DPCTLSyclEventRef ERef2);
+
 /*!
  * @brief  Returns a DPCTLSyclBackendType enum value identifying the SYCL
  * backend associated with the event.
@@ -167,4 +180,14 @@ DPCTL_API
 __dpctl_give DPCTLEventVectorRef
 DPCTLEvent_GetWaitList(__dpctl_keep DPCTLSyclEventRef ERef);
 
+/*!
+ * @brief Wrapper over std::hash<sycl::event>'s operator()
+ *
+ * @param    ERef           Opaque pointer to a ``sycl::event``.
+ * @return   Hash value of the underlying ``sycl::event`` instance.
+ * @ingroup EventInterface
+ */
+DPCTL_API
+size_t DPCTLEvent_Hash(__dpctl_keep const DPCTLSyclEventRef ERef);
+
 DPCTL_C_EXTERN_C_END
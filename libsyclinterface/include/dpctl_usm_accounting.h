@@ -0,0 +1,259 @@
+//===-- dpctl_usm_accounting.h - C API for USM memory accounting -*-C++-*- ===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This header declares a C API to a process-wide registry of live USM
+/// allocations. The registry tracks the number of live bytes, the high-water
+/// mark of live bytes, and allocation counts per (device, USM kind, call site)
+/// triple as well as totals per (device, USM kind) pair.
+///
+/// Accounting is disabled by default, and can be enabled by setting
+/// environment variable DPCTL_USM_ACCOUNTING to a non-zero value, or by
+/// calling DPCTLUSMAccounting_SetEnabled.
+///
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "Support/DllExport.h"
+#include "Support/ExternC.h"
+#include "Support/MemOwnershipAttrs.h"
+#include "dpctl_data_types.h"
+#include "dpctl_sycl_enum_types.h"
+#include "dpctl_sycl_types.h"
+
+DPCTL_C_EXTERN_C_BEGIN
+
+/**
+ * @defgroup USMAccounting USM memory accounting
+ */
+
+/*!
+ * @brief Opaque pointer to a snapshot of the USM accounting registry.
+ *
+ * @ingroup USMAccounting
+ */
+typedef struct DPCTLOpaqueUSMAccountingSnapshot
+    *DPCTLUSMAccountingSnapshotRef;
+
+/*!
+ * @brief Enables or disables recording of USM allocations.
+ *
+ * Deallocations of pointers recorded while accounting was enabled continue
+ * to be accounted for after accounting is disabled.
+ *
+ * @param    enabled        Whether to record subsequent allocations.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+void DPCTLUSMAccounting_SetEnabled(bool enabled);
+
+/*!
+ * @brief Returns whether USM allocations are being recorded.
+ *
+ * @return True if accounting is enabled, false otherwise.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+bool DPCTLUSMAccounting_IsEnabled(void);
+
+/*!
+ * @brief Records allocation of USM memory.
+ *
+ * The call is a no-op if accounting is disabled or if MRef is nullptr.
+ *
+ * @param    MRef           USM pointer returned by the allocation function.
+ * @param    nbytes         Size of the allocation in bytes.
+ * @param    kind           USM kind of the allocation.
+ * @param    QRef           Queue used to perform the allocation.
+ * @param    call_site      C string identifying the call site, e.g.
+ *                          "device_allocate_and_pack". The string is copied.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+void DPCTLUSMAccounting_RecordAlloc(__dpctl_keep const DPCTLSyclUSMRef MRef,
+                                    size_t nbytes,
+                                    DPCTLSyclUSMType kind,
+                                    __dpctl_keep const DPCTLSyclQueueRef QRef,
+                                    __dpctl_keep const char *call_site);
+
+/*!
+ * @brief Records deallocation of USM memory.
+ *
+ * Must be called before the pointer is freed. The call is a no-op if the
+ * pointer was not recorded by DPCTLUSMAccounting_RecordAlloc.
+ *
+ * @param    MRef           USM pointer about to be freed.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+void DPCTLUSMAccounting_RecordFree(__dpctl_keep const DPCTLSyclUSMRef MRef);
+
+/*!
+ * @brief Resets high-water marks to the current number of live bytes, and
+ * allocation counts to zero. Live allocations continue to be tracked.
+ *
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+void DPCTLUSMAccounting_ResetPeaks(void);
+
+/*!
+ * @brief Returns human-readable report of the accounting registry.
+ *
+ * @return A C string with one line per (device, USM kind, call site)
+ * triple, grouped by (device, USM kind) totals. The string must be freed
+ * with DPCTLCString_Delete.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+__dpctl_give const char *DPCTLUSMAccounting_Report(void);
+
+/*!
+ * @brief Takes a consistent snapshot of the accounting registry.
+ *
+ * Entries with call site being an empty string hold totals for the
+ * (device, USM kind) pair.
+ *
+ * @return An opaque pointer to the snapshot, which must be freed with
+ * DPCTLUSMAccountingSnapshot_Delete.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+__dpctl_give DPCTLUSMAccountingSnapshotRef
+DPCTLUSMAccounting_CreateSnapshot(void);
+
+/*!
+ * @brief Deletes the snapshot.
+ *
+ * @param    SRef           Snapshot to delete.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+void DPCTLUSMAccountingSnapshot_Delete(
+    __dpctl_take DPCTLUSMAccountingSnapshotRef SRef);
+
+/*!
+ * @brief Returns the number of entries in the snapshot.
+ *
+ * @param    SRef           Snapshot.
+ * @return Number of entries, or zero if SRef is nullptr.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+size_t DPCTLUSMAccountingSnapshot_Size(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef);
+
+/*!
+ * @brief Returns the device of the entry at the given position.
+ *
+ * @param    SRef           Snapshot.
+ * @param    pos            Position of the entry.
+ * @return A copy of the device, or nullptr if pos is out of range.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+__dpctl_give DPCTLSyclDeviceRef DPCTLUSMAccountingSnapshot_GetDevice(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos);
+
+/*!
+ * @brief Returns the USM kind of the entry at the given position.
+ *
+ * @param    SRef           Snapshot.
+ * @param    pos            Position of the entry.
+ * @return USM kind, or DPCTL_USM_UNKNOWN if pos is out of range.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+DPCTLSyclUSMType DPCTLUSMAccountingSnapshot_GetUSMType(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos);
+
+/*!
+ * @brief Returns the call site of the entry at the given position.
+ *
+ * @param    SRef           Snapshot.
+ * @param    pos            Position of the entry.
+ * @return A C string which must be freed with DPCTLCString_Delete, or
+ * nullptr if pos is out of range.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+__dpctl_give const char *DPCTLUSMAccountingSnapshot_GetCallSite(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos);
+
+/*!
+ * @brief Returns the number of live bytes of the entry at the given position.
+ *
+ * @param    SRef           Snapshot.
+ * @param    pos            Position of the entry.
+ * @return Number of bytes allocated and not yet freed.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+size_t DPCTLUSMAccountingSnapshot_GetLiveBytes(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos);
+
+/*!
+ * @brief Returns the high-water mark of live bytes of the entry at the given
+ * position.
+ *
+ * @param    SRef           Snapshot.
+ * @param    pos            Position of the entry.
+ * @return Largest number of live bytes observed since the last reset.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+size_t DPCTLUSMAccountingSnapshot_GetPeakBytes(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos);
+
+/*!
+ * @brief Returns the number of live allocations of the entry at the given
+ * position.
+ *
+ * @param    SRef           Snapshot.
+ * @param    pos            Position of the entry.
+ * @return Number of allocations not yet freed.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+size_t DPCTLUSMAccountingSnapshot_GetLiveCount(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos);
+
+/*!
+ * @brief Returns the number of allocations recorded for the entry at the
+ * given position since the last reset.
+ *
+ * @param    SRef           Snapshot.
+ * @param    pos            Position of the entry.
+ * @return Number of allocations.
+ * @ingroup USMAccounting
+ */
+DPCTL_API
+size_t DPCTLUSMAccountingSnapshot_GetAllocCount(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos);
+
+DPCTL_C_EXTERN_C_END
@@ -0,0 +1,490 @@
+//===-- dpctl_event_timer.cpp - Implements C API for region timer         ===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file implements the functions declared in dpctl_event_timer.h.
+///
+//===----------------------------------------------------------------------===//
+
+#include "dpctl_event_timer.h"
+#include "dpctl_error_handlers.h"
+#include "dpctl_string_utils.hpp"
+#include "dpctl_sycl_type_casters.hpp"
+#include <CL/sycl.hpp> /* SYCL headers   */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace sycl;
+
+namespace
+{
+using namespace dpctl::syclinterface;
+
+using host_clock_t = std::chrono::steady_clock;
+
+struct region_samples
+{
+    std::vector<std::uint64_t> host;
+    std::vector<std::uint64_t> device;
+};
+
+/*! @brief Span between the earliest start and the latest end of events with
+ * profiling information folded into it.
+ */
+struct event_span
+{
+    std::uint64_t start = std::numeric_limits<std::uint64_t>::max();
+    std::uint64_t end = 0;
+    bool found = false;
+
+    /*! @brief Folds the event into the span. The event must have completed,
+     * otherwise querying profiling information blocks. */
+    void add(const event &e)
+    {
+        try {
+            auto e_start =
+                e.get_profiling_info<info::event_profiling::command_start>();
+            auto e_end =
+                e.get_profiling_info<info::event_profiling::command_end>();
+            start = std::min<std::uint64_t>(start, e_start);
+            end = std::max<std::uint64_t>(end, e_end);
+            found = true;
+        } catch (std::exception const &) {
+            // the queue was created without enable_profiling property
+        }
+    }
+
+    std::uint64_t duration() const
+    {
+        return (found && end > start) ? end - start : 0;
+    }
+};
+
+bool is_complete(const event &e)
+{
+    return e.get_info<info::event::command_execution_status>() ==
+           info::event_command_status::complete;
+}
+
+// Number of events a region keeps before folding completed ones into its
+// span, so that long regions do not accumulate events without bound.
+constexpr size_t max_region_events = 1024;
+
+struct closed_region
+{
+    std::string name;
+    std::uint64_t host_ns;
+    event_span span;
+    std::vector<event> events;
+};
+
+class event_timer;
+
+struct open_region
+{
+    event_timer *timer;
+    std::string name;
+    host_clock_t::time_point host_start;
+    event_span span;
+    std::vector<event> events;
+
+    void record(const event &e)
+    {
+        if (events.size() >= max_region_events) {
+            auto completed = std::stable_partition(
+                events.begin(), events.end(),
+                [](const event &ev) { return !is_complete(ev); });
+            for (auto it = completed; it != events.end(); ++it) {
+                span.add(*it);
+            }
+            events.erase(completed, events.end());
+            if (events.size() >= max_region_events) {
+                // all events are pending, wait for the oldest one
+                events.front().wait();
+                span.add(events.front());
+                events.erase(events.begin());
+            }
+        }
+        events.push_back(e);
+    }
+};
+
+struct thread_regions;
+
+struct regions_registry
+{
+    std::mutex mu;
+    std::set<thread_regions *> threads;
+};
+
+regions_registry &get_regions_registry()
+{
+    // never destroyed, as threads may exit and unregister their regions
+    // after destruction of static objects
+    static regions_registry *registry = new regions_registry();
+    return *registry;
+}
+
+/*! @brief Regions open on a thread, innermost last. Guarded by a mutex, so
+ * that deleting a timer can discard its regions open on every thread. */
+struct thread_regions
+{
+    std::mutex mu;
+    std::vector<open_region> regions;
+
+    thread_regions()
+    {
+        auto &registry = get_regions_registry();
+        std::lock_guard<std::mutex> lock(registry.mu);
+        registry.threads.insert(this);
+    }
+
+    ~thread_regions()
+    {
+        auto &registry = get_regions_registry();
+        std::lock_guard<std::mutex> lock(registry.mu);
+        registry.threads.erase(this);
+    }
+};
+
+thread_local thread_regions open_regions_;
+
+/*! @brief Removes regions of the timer open on any thread. */
+void discard_open_regions(const event_timer *T)
+{
+    auto &registry = get_regions_registry();
+    std::lock_guard<std::mutex> registry_lock(registry.mu);
+    for (auto *t : registry.threads) {
+        std::lock_guard<std::mutex> lock(t->mu);
+        auto &regions = t->regions;
+        regions.erase(std::remove_if(regions.begin(), regions.end(),
+                                     [T](const open_region &r) {
+                                         return r.timer == T;
+                                     }),
+                      regions.end());
+    }
+}
+
+/*! @brief Returns the span of the region, adding the events it still holds,
+ * and false if the region has no events with profiling information.
+ */
+bool device_span(const closed_region &r, std::uint64_t &span)
+{
+    event_span s = r.span;
+    for (const auto &e : r.events) {
+        s.add(e);
+    }
+    span = s.duration();
+    return s.found;
+}
+
+double quantile(std::vector<std::uint64_t> samples, double q)
+{
+    if (samples.empty() || !(q >= 0.0 && q <= 1.0)) {
+        return -1.0;
+    }
+    std::sort(samples.begin(), samples.end());
+    const double pos = q * static_cast<double>(samples.size() - 1);
+    const size_t lo = static_cast<size_t>(pos);
+    const size_t hi = std::min(lo + 1, samples.size() - 1);
+    const double frac = pos - static_cast<double>(lo);
+    return static_cast<double>(samples[lo]) * (1.0 - frac) +
+           static_cast<double>(samples[hi]) * frac;
+}
+
+class event_timer
+{
+    std::mutex mu_;
+    std::vector<closed_region> closed_;
+    std::map<std::string, region_samples> samples_;
+    std::uint64_t last_host_ = 0;
+    std::uint64_t last_device_ = 0;
+
+    const std::vector<std::uint64_t> *
+    get_samples(const std::string &name, DPCTLEventTimerClock clock) const
+    {
+        auto it = samples_.find(name);
+        if (it == samples_.end()) {
+            return nullptr;
+        }
+        return (clock == DPCTL_EVENT_TIMER_DEVICE) ? &it->second.device
+                                                   : &it->second.host;
+    }
+
+public:
+    void close(closed_region &&r)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        closed_.push_back(std::move(r));
+    }
+
+    void synchronize()
+    {
+        std::vector<closed_region> closed;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            closed.swap(closed_);
+        }
+        // wait outside of the lock, so that other threads may keep closing
+        // regions
+        for (auto &r : closed) {
+            event::wait(r.events);
+        }
+
+        std::lock_guard<std::mutex> lock(mu_);
+        for (auto &r : closed) {
+            auto &s = samples_[r.name];
+            s.host.push_back(r.host_ns);
+            last_host_ = r.host_ns;
+            std::uint64_t span = 0;
+            if (device_span(r, span)) {
+                s.device.push_back(span);
+            }
+            last_device_ = span;
+        }
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        closed_.clear();
+        samples_.clear();
+        last_host_ = 0;
+        last_device_ = 0;
+    }
+
+    std::uint64_t last_duration(DPCTLEventTimerClock clock)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        return (clock == DPCTL_EVENT_TIMER_DEVICE) ? last_device_ : last_host_;
+    }
+
+    size_t num_regions()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        return samples_.size();
+    }
+
+    bool region_name(size_t pos, std::string &name)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (pos >= samples_.size()) {
+            return false;
+        }
+        auto it = samples_.begin();
+        std::advance(it, pos);
+        name = it->first;
+        return true;
+    }
+
+    size_t count(const std::string &name, DPCTLEventTimerClock clock)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        const auto *s = get_samples(name, clock);
+        return (s) ? s->size() : 0;
+    }
+
+    double mean(const std::string &name, DPCTLEventTimerClock clock)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        const auto *s = get_samples(name, clock);
+        if (!s || s->empty()) {
+            return -1.0;
+        }
+        double sum = 0.0;
+        for (auto v : *s) {
+            sum += static_cast<double>(v);
+        }
+        return sum / static_cast<double>(s->size());
+    }
+
+    double
+    get_quantile(const std::string &name, DPCTLEventTimerClock clock, double q)
+    {
+        std::vector<std::uint64_t> s_copy;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            const auto *s = get_samples(name, clock);
+            if (!s) {
+                return -1.0;
+            }
+            s_copy = *s;
+        }
+        return quantile(std::move(s_copy), q);
+    }
+};
+
+DEFINE_SIMPLE_CONVERSION_FUNCTIONS(event_timer, DPCTLEventTimerRef)
+
+} // end of anonymous namespace
+
+__dpctl_give DPCTLEventTimerRef DPCTLEventTimer_Create(void)
+{
+    try {
+        return wrap<event_timer>(new event_timer());
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+        return nullptr;
+    }
+}
+
+void DPCTLEventTimer_Delete(__dpctl_take DPCTLEventTimerRef TRef)
+{
+    auto T = unwrap<event_timer>(TRef);
+    if (!T) {
+        return;
+    }
+    discard_open_regions(T);
+    delete T;
+}
+
+bool DPCTLEventTimer_BeginRegion(__dpctl_keep DPCTLEventTimerRef TRef,
+                                 __dpctl_keep const char *name)
+{
+    auto T = unwrap<event_timer>(TRef);
+    if (!T || !name) {
+        error_handler("Cannot begin region: timer or name is nullptr.",
+                      __FILE__, __func__, __LINE__);
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(open_regions_.mu);
+    open_regions_.regions.push_back(
+        open_region{T, std::string(name), host_clock_t::now(), {}, {}});
+    return true;
+}
+
+bool DPCTLEventTimer_EndRegion(__dpctl_keep DPCTLEventTimerRef TRef)
+{
+    auto host_end = host_clock_t::now();
+    auto T = unwrap<event_timer>(TRef);
+    // the lock is held while closing, so that the timer is not deleted
+    std::lock_guard<std::mutex> lock(open_regions_.mu);
+    auto &regions = open_regions_.regions;
+    if (!T || regions.empty() || regions.back().timer != T) {
+        error_handler("Innermost region open on this thread does not belong "
+                      "to the timer.",
+                      __FILE__, __func__, __LINE__);
+        return false;
+    }
+    open_region r = std::move(regions.back());
+    regions.pop_back();
+    auto host_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       host_end - r.host_start)
+                       .count();
+    T->close(closed_region{std::move(r.name),
+                           static_cast<std::uint64_t>(host_ns), r.span,
+                           std::move(r.events)});
+    return true;
+}
+
+void DPCTLEventTimer_RecordEvent(__dpctl_keep const DPCTLSyclEventRef ERef)
+{
+    auto E = unwrap<event>(ERef);
+    if (!E) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(open_regions_.mu);
+    // outer regions span the commands of inner regions
+    for (auto &r : open_regions_.regions) {
+        try {
+            r.record(*E);
+        } catch (std::exception const &e) {
+            error_handler(e, __FILE__, __func__, __LINE__);
+        }
+    }
+}
+
+void DPCTLEventTimer_Synchronize(__dpctl_keep DPCTLEventTimerRef TRef)
+{
+    auto T = unwrap<event_timer>(TRef);
+    if (!T) {
+        return;
+    }
+    try {
+        T->synchronize();
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+    }
+}
+
+void DPCTLEventTimer_Reset(__dpctl_keep DPCTLEventTimerRef TRef)
+{
+    auto T = unwrap<event_timer>(TRef);
+    if (T) {
+        T->reset();
+    }
+}
+
+uint64_t DPCTLEventTimer_GetLastDuration(__dpctl_keep DPCTLEventTimerRef TRef,
+                                         DPCTLEventTimerClock clock)
+{
+    auto T = unwrap<event_timer>(TRef);
+    return (T) ? T->last_duration(clock) : 0;
+}
+
+size_t DPCTLEventTimer_GetNumRegions(__dpctl_keep DPCTLEventTimerRef TRef)
+{
+    auto T = unwrap<event_timer>(TRef);
+    return (T) ? T->num_regions() : 0;
+}
+
+__dpctl_give const char *
+DPCTLEventTimer_GetRegionName(__dpctl_keep DPCTLEventTimerRef TRef, size_t pos)
+{
+    auto T = unwrap<event_timer>(TRef);
+    std::string name;
+    if (!T || !T->region_name(pos, name)) {
+        return nullptr;
+    }
+    return dpctl::helper::cstring_from_string(name);
+}
+
+size_t DPCTLEventTimer_GetCount(__dpctl_keep DPCTLEventTimerRef TRef,
+                                __dpctl_keep const char *name,
+                                DPCTLEventTimerClock clock)
+{
+    auto T = unwrap<event_timer>(TRef);
+    return (T && name) ? T->count(name, clock) : 0;
+}
+
+double DPCTLEventTimer_GetMean(__dpctl_keep DPCTLEventTimerRef TRef,
+                               __dpctl_keep const char *name,
+                               DPCTLEventTimerClock clock)
+{
+    auto T = unwrap<event_timer>(TRef);
+    return (T && name) ? T->mean(name, clock) : -1.0;
+}
+
+double DPCTLEventTimer_GetQuantile(__dpctl_keep DPCTLEventTimerRef TRef,
+                                   __dpctl_keep const char *name,
+                                   DPCTLEventTimerClock clock,
+                                   double q)
+{
+    auto T = unwrap<event_timer>(TRef);
+    return (T && name) ? T->get_quantile(name, clock, q) : -1.0;
+}
@@ -121,6 +121,17 @@ DPCTLEvent_Copy(__dpctl_keep DPCTLSyclEventRef ERef)
     }
 }
 
+bool DPCTLEvent_AreEq(__dpctl_keep const DPCTLSyclEventRef ERef1,
+                      __dpctl_keep const DPCTLSyclEventRef ERef2)
+{
+    if (!(ERef1 && ERef2)) {
+        error_handler("DPCTLSyclEventRefs are nullptr.", __FILE__, __func__,
+                      __LINE__);
+        return false;
+    }
+    return (*unwrap<event>(ERef1) == *unwrap<event>(ERef2));
+}
+
 DPCTLSyclBackendType DPCTLEvent_GetBackend(__dpctl_keep DPCTLSyclEventRef ERef)
 {
     DPCTLSyclBackendType BTy = DPCTLSyclBackendType::DPCTL_UNKNOWN_BACKEND;
@@ -231,3 +242,16 @@ DPCTLEvent_GetWaitList(__dpctl_keep DPCTLSyclEventRef ERef)
         return nullptr;
     }
 }
+
+size_t DPCTLEvent_Hash(__dpctl_keep const DPCTLSyclEventRef ERef)
+{
+    if (ERef) {
+        auto E = unwrap<event>(ERef);
+        std::hash<event> hash_fn;
+        return hash_fn(*E);
+    }
+    else {
+        error_handler("Argument ERef is null.", __FILE__, __func__, __LINE__);
+        return 0;
+    }
+}
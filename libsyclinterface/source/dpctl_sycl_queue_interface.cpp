@@ -27,6 +27,7 @@
 #include "dpctl_sycl_queue_interface.h"
 #include "Config/dpctl_config.h"
 #include "dpctl_error_handlers.h"
+#include "dpctl_event_timer.h"
 #include "dpctl_sycl_context_interface.h"
 #include "dpctl_sycl_device_interface.h"
 #include "dpctl_sycl_device_manager.h"
@@ -167,6 +168,17 @@ getQueueImpl(__dpctl_keep DPCTLSyclContextRef cRef,
     return qRef;
 }
 
+/*!
+ * @brief Wraps the event of a submitted command, and records it with regions
+ * of event timers open on the calling thread.
+ */
+DPCTLSyclEventRef wrap_submitted_event(const event &e)
+{
+    DPCTLSyclEventRef ERef = wrap<event>(new event(e));
+    DPCTLEventTimer_RecordEvent(ERef);
+    return ERef;
+}
+
 } /* end of anonymous namespace */
 
 DPCTL_API
@@ -387,7 +399,7 @@ DPCTLQueue_SubmitRange(__dpctl_keep const DPCTLSyclKernelRef KRef,
         return nullptr;
     }
 
-    return wrap<event>(new event(e));
+    return wrap_submitted_event(e);
 }
 
 __dpctl_give DPCTLSyclEventRef
@@ -443,7 +455,7 @@ DPCTLQueue_SubmitNDRange(__dpctl_keep const DPCTLSyclKernelRef KRef,
         return nullptr;
     }
 
-    return wrap<event>(new event(e));
+    return wrap_submitted_event(e);
 }
 
 void DPCTLQueue_Wait(__dpctl_keep DPCTLSyclQueueRef QRef)
@@ -475,7 +487,7 @@ DPCTLQueue_Memcpy(__dpctl_keep const DPCTLSyclQueueRef QRef,
             error_handler(e, __FILE__, __func__, __LINE__);
             return nullptr;
         }
-        return wrap<event>(new event(ev));
+        return wrap_submitted_event(ev);
     }
     else {
         error_handler("QRef passed to memcpy was NULL.", __FILE__, __func__,
@@ -499,7 +511,7 @@ DPCTLQueue_Prefetch(__dpctl_keep DPCTLSyclQueueRef QRef,
                 error_handler(e, __FILE__, __func__, __LINE__);
                 return nullptr;
             }
-            return wrap<event>(new event(ev));
+            return wrap_submitted_event(ev);
         }
         else {
             error_handler("Attempt to prefetch USM-allocation at nullptr.",
@@ -529,7 +541,7 @@ DPCTLQueue_MemAdvise(__dpctl_keep DPCTLSyclQueueRef QRef,
             error_handler(e, __FILE__, __func__, __LINE__);
             return nullptr;
         }
-        return wrap<event>(new event(ev));
+        return wrap_submitted_event(ev);
     }
     else {
         error_handler("QRef passed to prefetch was NULL.", __FILE__, __func__,
@@ -622,7 +634,7 @@ DPCTLQueue_Memset(__dpctl_keep const DPCTLSyclQueueRef QRef,
             error_handler(e, __FILE__, __func__, __LINE__);
             return nullptr;
         }
-        return wrap<event>(new event(ev));
+        return wrap_submitted_event(ev);
     }
     else {
         error_handler("QRef or USMRef passed to fill8 were NULL.", __FILE__,
@@ -646,7 +658,7 @@ DPCTLQueue_Fill8(__dpctl_keep const DPCTLSyclQueueRef QRef,
             error_handler(e, __FILE__, __func__, __LINE__);
             return nullptr;
         }
-        return wrap<event>(new event(ev));
+        return wrap_submitted_event(ev);
     }
     else {
         error_handler("QRef or USMRef passed to fill8 were NULL.", __FILE__,
@@ -670,7 +682,7 @@ DPCTLQueue_Fill16(__dpctl_keep const DPCTLSyclQueueRef QRef,
             error_handler(e, __FILE__, __func__, __LINE__);
             return nullptr;
         }
-        return wrap<event>(new event(ev));
+        return wrap_submitted_event(ev);
     }
     else {
         error_handler("QRef or USMRef passed to fill16 were NULL.", __FILE__,
@@ -694,7 +706,7 @@ DPCTLQueue_Fill32(__dpctl_keep const DPCTLSyclQueueRef QRef,
             error_handler(e, __FILE__, __func__, __LINE__);
             return nullptr;
         }
-        return wrap<event>(new event(ev));
+        return wrap_submitted_event(ev);
     }
     else {
         error_handler("QRef or USMRef passed to fill32 were NULL.", __FILE__,
@@ -718,7 +730,7 @@ DPCTLQueue_Fill64(__dpctl_keep const DPCTLSyclQueueRef QRef,
             error_handler(e, __FILE__, __func__, __LINE__);
             return nullptr;
         }
-        return wrap<event>(new event(ev));
+        return wrap_submitted_event(ev);
     }
     else {
         error_handler("QRef or USMRef passed to fill64 were NULL.", __FILE__,
@@ -745,7 +757,7 @@ DPCTLQueue_Fill128(__dpctl_keep const DPCTLSyclQueueRef QRef,
             error_handler(e, __FILE__, __func__, __LINE__);
             return nullptr;
         }
-        return wrap<event>(new event(ev));
+        return wrap_submitted_event(ev);
     }
     else {
         error_handler("QRef or USMRef passed to fill128 were NULL.", __FILE__,
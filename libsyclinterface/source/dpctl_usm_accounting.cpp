@@ -0,0 +1,461 @@
+//===-- dpctl_usm_accounting.cpp - Implements C API for USM accounting    ===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file implements the functions declared in dpctl_usm_accounting.h.
+///
+//===----------------------------------------------------------------------===//
+
+#include "dpctl_usm_accounting.h"
+#include "dpctl_error_handlers.h"
+#include "dpctl_string_utils.hpp"
+#include "dpctl_sycl_type_casters.hpp"
+#include <CL/sycl.hpp> /* SYCL headers   */
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace sycl;
+
+namespace
+{
+using namespace dpctl::syclinterface;
+
+struct usm_counters
+{
+    size_t live_bytes = 0;
+    size_t peak_bytes = 0;
+    size_t live_count = 0;
+    size_t alloc_count = 0;
+
+    void add(size_t nbytes)
+    {
+        live_bytes += nbytes;
+        peak_bytes = std::max(peak_bytes, live_bytes);
+        ++live_count;
+        ++alloc_count;
+    }
+
+    void remove(size_t nbytes)
+    {
+        live_bytes -= std::min(live_bytes, nbytes);
+        live_count -= (live_count > 0) ? 1 : 0;
+    }
+
+    void reset_peak()
+    {
+        peak_bytes = live_bytes;
+        alloc_count = 0;
+    }
+};
+
+struct usm_key
+{
+    device dev;
+    DPCTLSyclUSMType kind;
+    std::string call_site;
+
+    bool operator==(const usm_key &other) const
+    {
+        return kind == other.kind && dev == other.dev &&
+               call_site == other.call_site;
+    }
+};
+
+struct usm_key_hash
+{
+    size_t operator()(const usm_key &k) const
+    {
+        size_t h = std::hash<device>{}(k.dev);
+        h ^= std::hash<int>{}(static_cast<int>(k.kind)) + 0x9e3779b9 +
+             (h << 6) + (h >> 2);
+        h ^= std::hash<std::string>{}(k.call_site) + 0x9e3779b9 + (h << 6) +
+             (h >> 2);
+        return h;
+    }
+};
+
+struct usm_live_allocation
+{
+    size_t nbytes;
+    usm_counters *site;
+    usm_counters *total;
+};
+
+struct usm_snapshot_entry
+{
+    device dev;
+    DPCTLSyclUSMType kind;
+    std::string call_site;
+    usm_counters counters;
+};
+
+using usm_snapshot_t = std::vector<usm_snapshot_entry>;
+
+DEFINE_SIMPLE_CONVERSION_FUNCTIONS(usm_snapshot_t,
+                                   DPCTLUSMAccountingSnapshotRef)
+
+bool accounting_enabled_by_env()
+{
+    const char *val = std::getenv("DPCTL_USM_ACCOUNTING");
+    return (val != nullptr) && (std::strlen(val) > 0) &&
+           (std::strcmp(val, "0") != 0);
+}
+
+const char *usm_kind_name(DPCTLSyclUSMType kind)
+{
+    switch (kind) {
+    case DPCTL_USM_DEVICE:
+        return "device";
+    case DPCTL_USM_SHARED:
+        return "shared";
+    case DPCTL_USM_HOST:
+        return "host";
+    default:
+        return "unknown";
+    }
+}
+
+class usm_registry
+{
+    std::atomic<bool> enabled_;
+    // number of pointers being tracked, allows to skip locking on
+    // deallocation of untracked pointers
+    std::atomic<size_t> n_tracked_;
+    std::mutex mu_;
+    // nodes of unordered_map are stable, so live allocations keep pointers
+    // to counters of their call site and of their (device, kind) total
+    std::unordered_map<usm_key, usm_counters, usm_key_hash> counters_;
+    std::unordered_map<void *, usm_live_allocation> live_;
+
+public:
+    usm_registry()
+        : enabled_(accounting_enabled_by_env()), n_tracked_(0), mu_{},
+          counters_{}, live_{}
+    {
+    }
+
+    static usm_registry &get()
+    {
+        static usm_registry registry;
+        return registry;
+    }
+
+    bool is_enabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void set_enabled(bool enabled)
+    {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    void record_alloc(void *ptr,
+                      size_t nbytes,
+                      DPCTLSyclUSMType kind,
+                      const device &dev,
+                      const char *call_site)
+    {
+        std::string site = (call_site) ? std::string(call_site) : "unknown";
+        if (site.empty()) {
+            site = "unknown";
+        }
+
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = live_.find(ptr);
+        if (it != live_.end()) {
+            // the pointer was freed without being recorded, forget it
+            it->second.site->remove(it->second.nbytes);
+            it->second.total->remove(it->second.nbytes);
+            live_.erase(it);
+            --n_tracked_;
+        }
+        usm_counters &site_c = counters_[usm_key{dev, kind, std::move(site)}];
+        usm_counters &total_c = counters_[usm_key{dev, kind, std::string{}}];
+        site_c.add(nbytes);
+        total_c.add(nbytes);
+        live_.emplace(ptr, usm_live_allocation{nbytes, &site_c, &total_c});
+        ++n_tracked_;
+    }
+
+    void record_free(void *ptr)
+    {
+        if (n_tracked_.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = live_.find(ptr);
+        if (it != live_.end()) {
+            it->second.site->remove(it->second.nbytes);
+            it->second.total->remove(it->second.nbytes);
+            live_.erase(it);
+            --n_tracked_;
+        }
+    }
+
+    void reset_peaks()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        for (auto it = counters_.begin(); it != counters_.end();) {
+            if (it->second.live_count == 0) {
+                it = counters_.erase(it);
+            }
+            else {
+                it->second.reset_peak();
+                ++it;
+            }
+        }
+    }
+
+    usm_snapshot_t snapshot()
+    {
+        usm_snapshot_t res;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            res.reserve(counters_.size());
+            for (const auto &kv : counters_) {
+                res.push_back(usm_snapshot_entry{kv.first.dev, kv.first.kind,
+                                                 kv.first.call_site,
+                                                 kv.second});
+            }
+        }
+        // totals first, then call sites by descending high-water mark
+        std::stable_sort(res.begin(), res.end(),
+                         [](const usm_snapshot_entry &e1,
+                            const usm_snapshot_entry &e2) {
+                             bool t1 = e1.call_site.empty();
+                             bool t2 = e2.call_site.empty();
+                             if (t1 != t2) {
+                                 return t1;
+                             }
+                             return e1.counters.peak_bytes >
+                                    e2.counters.peak_bytes;
+                         });
+        return res;
+    }
+};
+
+void format_counters(std::ostringstream &os, const usm_counters &c)
+{
+    os << "live=" << c.live_bytes << " B, peak=" << c.peak_bytes
+       << " B, live_allocations=" << c.live_count
+       << ", allocations=" << c.alloc_count;
+}
+
+std::string usm_report()
+{
+    auto &registry = usm_registry::get();
+    const usm_snapshot_t snap = registry.snapshot();
+
+    std::ostringstream os;
+    os << "USM accounting report"
+       << (registry.is_enabled() ? "" : " (accounting disabled)") << "\n";
+    for (const auto &total : snap) {
+        if (!total.call_site.empty()) {
+            continue;
+        }
+        os << "  " << total.dev.get_info<info::device::name>() << " ["
+           << usm_kind_name(total.kind) << "]: ";
+        format_counters(os, total.counters);
+        os << "\n";
+        for (const auto &entry : snap) {
+            if (entry.call_site.empty() || entry.kind != total.kind ||
+                entry.dev != total.dev)
+            {
+                continue;
+            }
+            os << "    " << entry.call_site << ": ";
+            format_counters(os, entry.counters);
+            os << "\n";
+        }
+    }
+    return os.str();
+}
+
+const usm_snapshot_entry *
+get_snapshot_entry(const DPCTLUSMAccountingSnapshotRef SRef, size_t pos)
+{
+    const auto snap = unwrap<usm_snapshot_t>(SRef);
+    if (!snap || pos >= snap->size()) {
+        return nullptr;
+    }
+    return &((*snap)[pos]);
+}
+
+} // end of anonymous namespace
+
+void DPCTLUSMAccounting_SetEnabled(bool enabled)
+{
+    usm_registry::get().set_enabled(enabled);
+}
+
+bool DPCTLUSMAccounting_IsEnabled(void)
+{
+    return usm_registry::get().is_enabled();
+}
+
+void DPCTLUSMAccounting_RecordAlloc(__dpctl_keep const DPCTLSyclUSMRef MRef,
+                                    size_t nbytes,
+                                    DPCTLSyclUSMType kind,
+                                    __dpctl_keep const DPCTLSyclQueueRef QRef,
+                                    __dpctl_keep const char *call_site)
+{
+    auto &registry = usm_registry::get();
+    if (!MRef || !registry.is_enabled()) {
+        return;
+    }
+    if (!QRef) {
+        error_handler("Input QRef is nullptr.", __FILE__, __func__, __LINE__);
+        return;
+    }
+    try {
+        auto Q = unwrap<queue>(QRef);
+        registry.record_alloc(unwrap<void>(MRef), nbytes, kind,
+                              Q->get_device(), call_site);
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+    }
+}
+
+void DPCTLUSMAccounting_RecordFree(__dpctl_keep const DPCTLSyclUSMRef MRef)
+{
+    if (!MRef) {
+        return;
+    }
+    try {
+        usm_registry::get().record_free(unwrap<void>(MRef));
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+    }
+}
+
+void DPCTLUSMAccounting_ResetPeaks(void)
+{
+    usm_registry::get().reset_peaks();
+}
+
+__dpctl_give const char *DPCTLUSMAccounting_Report(void)
+{
+    try {
+        return dpctl::helper::cstring_from_string(usm_report());
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+        return nullptr;
+    }
+}
+
+__dpctl_give DPCTLUSMAccountingSnapshotRef
+DPCTLUSMAccounting_CreateSnapshot(void)
+{
+    try {
+        auto snap = new usm_snapshot_t(usm_registry::get().snapshot());
+        return wrap<usm_snapshot_t>(snap);
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+        return nullptr;
+    }
+}
+
+void DPCTLUSMAccountingSnapshot_Delete(
+    __dpctl_take DPCTLUSMAccountingSnapshotRef SRef)
+{
+    delete unwrap<usm_snapshot_t>(SRef);
+}
+
+size_t DPCTLUSMAccountingSnapshot_Size(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef)
+{
+    const auto snap = unwrap<usm_snapshot_t>(SRef);
+    return (snap) ? snap->size() : 0;
+}
+
+__dpctl_give DPCTLSyclDeviceRef DPCTLUSMAccountingSnapshot_GetDevice(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos)
+{
+    const auto entry = get_snapshot_entry(SRef, pos);
+    if (!entry) {
+        return nullptr;
+    }
+    try {
+        return wrap<device>(new device(entry->dev));
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+        return nullptr;
+    }
+}
+
+DPCTLSyclUSMType DPCTLUSMAccountingSnapshot_GetUSMType(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos)
+{
+    const auto entry = get_snapshot_entry(SRef, pos);
+    return (entry) ? entry->kind : DPCTL_USM_UNKNOWN;
+}
+
+__dpctl_give const char *DPCTLUSMAccountingSnapshot_GetCallSite(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos)
+{
+    const auto entry = get_snapshot_entry(SRef, pos);
+    if (!entry) {
+        return nullptr;
+    }
+    return dpctl::helper::cstring_from_string(entry->call_site);
+}
+
+size_t DPCTLUSMAccountingSnapshot_GetLiveBytes(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos)
+{
+    const auto entry = get_snapshot_entry(SRef, pos);
+    return (entry) ? entry->counters.live_bytes : 0;
+}
+
+size_t DPCTLUSMAccountingSnapshot_GetPeakBytes(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos)
+{
+    const auto entry = get_snapshot_entry(SRef, pos);
+    return (entry) ? entry->counters.peak_bytes : 0;
+}
+
+size_t DPCTLUSMAccountingSnapshot_GetLiveCount(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos)
+{
+    const auto entry = get_snapshot_entry(SRef, pos);
+    return (entry) ? entry->counters.live_count : 0;
+}
+
+size_t DPCTLUSMAccountingSnapshot_GetAllocCount(
+    __dpctl_keep const DPCTLUSMAccountingSnapshotRef SRef,
+    size_t pos)
+{
+    const auto entry = get_snapshot_entry(SRef, pos);
+    return (entry) ? entry->counters.alloc_count : 0;
+}
@@ -0,0 +1,228 @@
+//===------- test_event_timer.cpp - Test cases for event timer C API      ===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file has unit test cases for functions defined in
+/// dpctl_event_timer.h.
+///
+//===----------------------------------------------------------------------===//
+
+#include "dpctl_event_timer.h"
+#include "dpctl_sycl_device_interface.h"
+#include "dpctl_sycl_device_selector_interface.h"
+#include "dpctl_sycl_event_interface.h"
+#include "dpctl_sycl_queue_interface.h"
+#include "dpctl_sycl_usm_interface.h"
+#include "dpctl_utils.h"
+#include <future>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+namespace
+{
+constexpr size_t SIZE = 1024 * 1024;
+} // namespace
+
+struct TestDPCTLEventTimer : public ::testing::Test
+{
+    DPCTLSyclQueueRef QRef = nullptr;
+    DPCTLEventTimerRef TRef = nullptr;
+
+    TestDPCTLEventTimer()
+    {
+        auto DS = DPCTLDefaultSelector_Create();
+        auto DRef = DPCTLDevice_CreateFromSelector(DS);
+        if (DRef) {
+            QRef = DPCTLQueue_CreateForDevice(DRef, nullptr,
+                                              DPCTL_ENABLE_PROFILING);
+        }
+        DPCTLDevice_Delete(DRef);
+        DPCTLDeviceSelector_Delete(DS);
+        TRef = DPCTLEventTimer_Create();
+    }
+
+    void SetUp()
+    {
+        if (!QRef) {
+            GTEST_SKIP_("Default device is not available");
+        }
+        ASSERT_TRUE(TRef != nullptr);
+    }
+
+    ~TestDPCTLEventTimer()
+    {
+        DPCTLEventTimer_Delete(TRef);
+        DPCTLQueue_Delete(QRef);
+    }
+};
+
+TEST_F(TestDPCTLEventTimer, ChkNestedRegions)
+{
+    auto P = DPCTLmalloc_device(SIZE, QRef);
+    ASSERT_TRUE(P != nullptr);
+
+    constexpr size_t n_iters = 5;
+    for (size_t i = 0; i < n_iters; ++i) {
+        EXPECT_TRUE(DPCTLEventTimer_BeginRegion(TRef, "outer"));
+        auto E1 = DPCTLQueue_Memset(QRef, P, 0, SIZE);
+        EXPECT_TRUE(DPCTLEventTimer_BeginRegion(TRef, "inner"));
+        auto E2 = DPCTLQueue_Memset(QRef, P, 1, SIZE);
+        EXPECT_TRUE(DPCTLEventTimer_EndRegion(TRef));
+        EXPECT_TRUE(DPCTLEventTimer_EndRegion(TRef));
+        DPCTLEvent_Delete(E1);
+        DPCTLEvent_Delete(E2);
+    }
+    DPCTLEventTimer_Synchronize(TRef);
+
+    EXPECT_EQ(DPCTLEventTimer_GetNumRegions(TRef), 2);
+    // names are ordered lexicographically
+    const char *name = DPCTLEventTimer_GetRegionName(TRef, 0);
+    ASSERT_TRUE(name != nullptr);
+    EXPECT_EQ(std::string(name), "inner");
+    DPCTLCString_Delete(name);
+    EXPECT_TRUE(DPCTLEventTimer_GetRegionName(TRef, 2) == nullptr);
+
+    for (const char *region : {"inner", "outer"}) {
+        EXPECT_EQ(
+            DPCTLEventTimer_GetCount(TRef, region, DPCTL_EVENT_TIMER_HOST),
+            n_iters);
+        EXPECT_EQ(
+            DPCTLEventTimer_GetCount(TRef, region, DPCTL_EVENT_TIMER_DEVICE),
+            n_iters);
+        double min_dt = DPCTLEventTimer_GetQuantile(
+            TRef, region, DPCTL_EVENT_TIMER_DEVICE, 0.0);
+        double median_dt = DPCTLEventTimer_GetQuantile(
+            TRef, region, DPCTL_EVENT_TIMER_DEVICE, 0.5);
+        double max_dt = DPCTLEventTimer_GetQuantile(
+            TRef, region, DPCTL_EVENT_TIMER_DEVICE, 1.0);
+        EXPECT_TRUE(min_dt >= 0);
+        EXPECT_TRUE(min_dt <= median_dt);
+        EXPECT_TRUE(median_dt <= max_dt);
+        EXPECT_TRUE(
+            DPCTLEventTimer_GetMean(TRef, region, DPCTL_EVENT_TIMER_HOST) > 0);
+    }
+    // the outer region spans the commands of the inner region
+    EXPECT_TRUE(
+        DPCTLEventTimer_GetMean(TRef, "outer", DPCTL_EVENT_TIMER_DEVICE) >=
+        DPCTLEventTimer_GetMean(TRef, "inner", DPCTL_EVENT_TIMER_DEVICE));
+
+    DPCTLEventTimer_Reset(TRef);
+    EXPECT_EQ(DPCTLEventTimer_GetNumRegions(TRef), 0);
+    EXPECT_TRUE(DPCTLEventTimer_GetMean(TRef, "outer",
+                                        DPCTL_EVENT_TIMER_HOST) < 0);
+
+    DPCTLfree_with_queue(P, QRef);
+}
+
+TEST_F(TestDPCTLEventTimer, ChkRegionWithoutCommands)
+{
+    EXPECT_TRUE(DPCTLEventTimer_BeginRegion(TRef, "host_only"));
+    EXPECT_TRUE(DPCTLEventTimer_EndRegion(TRef));
+    DPCTLEventTimer_Synchronize(TRef);
+
+    EXPECT_EQ(
+        DPCTLEventTimer_GetCount(TRef, "host_only", DPCTL_EVENT_TIMER_HOST), 1);
+    EXPECT_EQ(
+        DPCTLEventTimer_GetCount(TRef, "host_only", DPCTL_EVENT_TIMER_DEVICE),
+        0);
+    EXPECT_EQ(DPCTLEventTimer_GetLastDuration(TRef, DPCTL_EVENT_TIMER_DEVICE),
+              0);
+    EXPECT_TRUE(DPCTLEventTimer_GetQuantile(TRef, "host_only",
+                                            DPCTL_EVENT_TIMER_HOST, 2.0) < 0);
+}
+
+TEST_F(TestDPCTLEventTimer, ChkMismatchedEnd)
+{
+    auto TRef2 = DPCTLEventTimer_Create();
+    ASSERT_TRUE(TRef2 != nullptr);
+    EXPECT_FALSE(DPCTLEventTimer_EndRegion(TRef));
+
+    EXPECT_TRUE(DPCTLEventTimer_BeginRegion(TRef, "region"));
+    EXPECT_FALSE(DPCTLEventTimer_EndRegion(TRef2));
+    EXPECT_TRUE(DPCTLEventTimer_EndRegion(TRef));
+
+    // open regions of a deleted timer are discarded
+    EXPECT_TRUE(DPCTLEventTimer_BeginRegion(TRef2, "region"));
+    DPCTLEventTimer_Delete(TRef2);
+    EXPECT_FALSE(DPCTLEventTimer_EndRegion(TRef));
+}
+
+TEST_F(TestDPCTLEventTimer, ChkManyEventsInRegion)
+{
+    auto P = DPCTLmalloc_device(SIZE, QRef);
+    ASSERT_TRUE(P != nullptr);
+
+    // more events than a region holds, completed ones are folded into its
+    // device span
+    constexpr size_t n_events = 3000;
+    EXPECT_TRUE(DPCTLEventTimer_BeginRegion(TRef, "long"));
+    for (size_t i = 0; i < n_events; ++i) {
+        auto E = DPCTLQueue_Memset(QRef, P, static_cast<int>(i % 7), 1024);
+        DPCTLEvent_Delete(E);
+    }
+    EXPECT_TRUE(DPCTLEventTimer_EndRegion(TRef));
+    DPCTLEventTimer_Synchronize(TRef);
+
+    EXPECT_EQ(DPCTLEventTimer_GetCount(TRef, "long", DPCTL_EVENT_TIMER_DEVICE),
+              1);
+    EXPECT_TRUE(
+        DPCTLEventTimer_GetLastDuration(TRef, DPCTL_EVENT_TIMER_DEVICE) > 0);
+
+    DPCTLfree_with_queue(P, QRef);
+}
+
+TEST_F(TestDPCTLEventTimer, ChkDeleteDiscardsRegionsOfAllThreads)
+{
+    auto TRef2 = DPCTLEventTimer_Create();
+    ASSERT_TRUE(TRef2 != nullptr);
+
+    std::promise<void> opened;
+    std::promise<void> deleted;
+    auto deleted_f = deleted.get_future();
+    bool end_after_delete = true;
+    std::thread worker([&]() {
+        EXPECT_TRUE(DPCTLEventTimer_BeginRegion(TRef2, "worker"));
+        opened.set_value();
+        deleted_f.wait();
+        // the region was discarded when the timer was deleted
+        end_after_delete = DPCTLEventTimer_EndRegion(TRef);
+    });
+    opened.get_future().wait();
+    DPCTLEventTimer_Delete(TRef2);
+    deleted.set_value();
+    worker.join();
+    EXPECT_FALSE(end_after_delete);
+}
+
+TEST(TestDPCTLEventTimerNullArgs, ChkNull)
+{
+    DPCTLEventTimerRef TRef = nullptr;
+    EXPECT_FALSE(DPCTLEventTimer_BeginRegion(TRef, "region"));
+    EXPECT_FALSE(DPCTLEventTimer_EndRegion(TRef));
+    EXPECT_NO_FATAL_FAILURE(DPCTLEventTimer_RecordEvent(nullptr));
+    EXPECT_NO_FATAL_FAILURE(DPCTLEventTimer_Synchronize(TRef));
+    EXPECT_NO_FATAL_FAILURE(DPCTLEventTimer_Reset(TRef));
+    EXPECT_EQ(DPCTLEventTimer_GetNumRegions(TRef), 0);
+    EXPECT_TRUE(DPCTLEventTimer_GetRegionName(TRef, 0) == nullptr);
+    EXPECT_EQ(DPCTLEventTimer_GetCount(TRef, "region", DPCTL_EVENT_TIMER_HOST),
+              0);
+    EXPECT_NO_FATAL_FAILURE(DPCTLEventTimer_Delete(TRef));
+}
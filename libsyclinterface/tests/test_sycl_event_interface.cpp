@@ -117,6 +117,30 @@ TEST_F(TestDPCTLSyclEventInterface, CheckCopy_Invalid)
     EXPECT_NO_FATAL_FAILURE(DPCTLEvent_Delete(E2));
 }
 
+TEST_F(TestDPCTLSyclEventInterface, CheckEvent_AreEq)
+{
+    DPCTLSyclEventRef Copied_ERef = nullptr;
+    DPCTLSyclEventRef Other_ERef = nullptr;
+    EXPECT_NO_FATAL_FAILURE(Copied_ERef = DPCTLEvent_Copy(ERef));
+    EXPECT_NO_FATAL_FAILURE(Other_ERef = DPCTLEvent_Create());
+    EXPECT_TRUE(DPCTLEvent_AreEq(ERef, Copied_ERef));
+    EXPECT_FALSE(DPCTLEvent_AreEq(ERef, Other_ERef));
+    EXPECT_TRUE(DPCTLEvent_Hash(ERef) == DPCTLEvent_Hash(Copied_ERef));
+    EXPECT_NO_FATAL_FAILURE(DPCTLEvent_Delete(Copied_ERef));
+    EXPECT_NO_FATAL_FAILURE(DPCTLEvent_Delete(Other_ERef));
+}
+
+TEST_F(TestDPCTLSyclEventInterface, CheckAreEq_Invalid)
+{
+    DPCTLSyclEventRef E = nullptr;
+    bool res = true;
+    size_t hash = 1;
+    EXPECT_NO_FATAL_FAILURE(res = DPCTLEvent_AreEq(ERef, E));
+    EXPECT_FALSE(res);
+    EXPECT_NO_FATAL_FAILURE(hash = DPCTLEvent_Hash(E));
+    EXPECT_TRUE(hash == 0);
+}
+
 TEST_F(TestDPCTLSyclEventInterface, CheckEvent_GetBackend)
 {
     DPCTLSyclBackendType BTy = DPCTLSyclBackendType::DPCTL_UNKNOWN_BACKEND;
@@ -0,0 +1,201 @@
+//===---- test_usm_accounting.cpp - Test cases for USM accounting C API   ===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file has unit test cases for functions defined in
+/// dpctl_usm_accounting.h.
+///
+//===----------------------------------------------------------------------===//
+
+#include "dpctl_sycl_device_interface.h"
+#include "dpctl_sycl_device_selector_interface.h"
+#include "dpctl_sycl_queue_interface.h"
+#include "dpctl_sycl_usm_interface.h"
+#include "dpctl_usm_accounting.h"
+#include "dpctl_utils.h"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace
+{
+constexpr size_t SIZE = 1024;
+
+struct site_stats
+{
+    bool found = false;
+    size_t live_bytes = 0;
+    size_t peak_bytes = 0;
+    size_t live_count = 0;
+    size_t alloc_count = 0;
+};
+
+site_stats get_site_stats(const std::string &site, DPCTLSyclUSMType kind)
+{
+    site_stats res;
+    auto SRef = DPCTLUSMAccounting_CreateSnapshot();
+    EXPECT_TRUE(SRef != nullptr);
+    size_t n = DPCTLUSMAccountingSnapshot_Size(SRef);
+    for (size_t i = 0; i < n; ++i) {
+        const char *cs = DPCTLUSMAccountingSnapshot_GetCallSite(SRef, i);
+        bool match = (site == cs) &&
+                     (DPCTLUSMAccountingSnapshot_GetUSMType(SRef, i) == kind);
+        DPCTLCString_Delete(cs);
+        if (match) {
+            res.found = true;
+            res.live_bytes = DPCTLUSMAccountingSnapshot_GetLiveBytes(SRef, i);
+            res.peak_bytes = DPCTLUSMAccountingSnapshot_GetPeakBytes(SRef, i);
+            res.live_count = DPCTLUSMAccountingSnapshot_GetLiveCount(SRef, i);
+            res.alloc_count =
+                DPCTLUSMAccountingSnapshot_GetAllocCount(SRef, i);
+            break;
+        }
+    }
+    DPCTLUSMAccountingSnapshot_Delete(SRef);
+    return res;
+}
+
+} // namespace
+
+struct TestDPCTLUSMAccounting : public ::testing::Test
+{
+    DPCTLSyclQueueRef QRef = nullptr;
+    bool was_enabled = false;
+
+    TestDPCTLUSMAccounting()
+    {
+        auto DS = DPCTLDefaultSelector_Create();
+        auto DRef = DPCTLDevice_CreateFromSelector(DS);
+        if (DRef) {
+            QRef = DPCTLQueue_CreateForDevice(DRef, nullptr, 0);
+        }
+        DPCTLDevice_Delete(DRef);
+        DPCTLDeviceSelector_Delete(DS);
+        was_enabled = DPCTLUSMAccounting_IsEnabled();
+        DPCTLUSMAccounting_SetEnabled(true);
+    }
+
+    void SetUp()
+    {
+        if (!QRef) {
+            GTEST_SKIP_("Default device is not available");
+        }
+    }
+
+    ~TestDPCTLUSMAccounting()
+    {
+        DPCTLUSMAccounting_SetEnabled(was_enabled);
+        DPCTLQueue_Delete(QRef);
+    }
+};
+
+TEST_F(TestDPCTLUSMAccounting, ChkLiveAndPeak)
+{
+    const std::string site = "ChkLiveAndPeak";
+    DPCTLUSMAccounting_ResetPeaks();
+
+    auto P1 = DPCTLmalloc_device(SIZE, QRef);
+    ASSERT_TRUE(P1 != nullptr);
+    DPCTLUSMAccounting_RecordAlloc(P1, SIZE, DPCTL_USM_DEVICE, QRef,
+                                   site.c_str());
+    auto P2 = DPCTLmalloc_device(2 * SIZE, QRef);
+    ASSERT_TRUE(P2 != nullptr);
+    DPCTLUSMAccounting_RecordAlloc(P2, 2 * SIZE, DPCTL_USM_DEVICE, QRef,
+                                   site.c_str());
+
+    auto st = get_site_stats(site, DPCTL_USM_DEVICE);
+    EXPECT_TRUE(st.found);
+    EXPECT_EQ(st.live_bytes, 3 * SIZE);
+    EXPECT_EQ(st.peak_bytes, 3 * SIZE);
+    EXPECT_EQ(st.live_count, 2);
+    EXPECT_EQ(st.alloc_count, 2);
+
+    DPCTLUSMAccounting_RecordFree(P2);
+    DPCTLfree_with_queue(P2, QRef);
+
+    st = get_site_stats(site, DPCTL_USM_DEVICE);
+    EXPECT_EQ(st.live_bytes, SIZE);
+    EXPECT_EQ(st.peak_bytes, 3 * SIZE);
+    EXPECT_EQ(st.live_count, 1);
+
+    DPCTLUSMAccounting_ResetPeaks();
+    st = get_site_stats(site, DPCTL_USM_DEVICE);
+    EXPECT_EQ(st.peak_bytes, SIZE);
+    EXPECT_EQ(st.alloc_count, 0);
+
+    DPCTLUSMAccounting_RecordFree(P1);
+    DPCTLfree_with_queue(P1, QRef);
+
+    st = get_site_stats(site, DPCTL_USM_DEVICE);
+    EXPECT_EQ(st.live_bytes, 0);
+    EXPECT_EQ(st.live_count, 0);
+
+    // entries without live allocations are discarded on reset
+    DPCTLUSMAccounting_ResetPeaks();
+    st = get_site_stats(site, DPCTL_USM_DEVICE);
+    EXPECT_FALSE(st.found);
+}
+
+TEST_F(TestDPCTLUSMAccounting, ChkDisabled)
+{
+    const std::string site = "ChkDisabled";
+    DPCTLUSMAccounting_SetEnabled(false);
+    EXPECT_FALSE(DPCTLUSMAccounting_IsEnabled());
+
+    auto P = DPCTLmalloc_shared(SIZE, QRef);
+    ASSERT_TRUE(P != nullptr);
+    DPCTLUSMAccounting_RecordAlloc(P, SIZE, DPCTL_USM_SHARED, QRef,
+                                   site.c_str());
+    auto st = get_site_stats(site, DPCTL_USM_SHARED);
+    EXPECT_FALSE(st.found);
+
+    EXPECT_NO_FATAL_FAILURE(DPCTLUSMAccounting_RecordFree(P));
+    DPCTLfree_with_queue(P, QRef);
+}
+
+TEST_F(TestDPCTLUSMAccounting, ChkReport)
+{
+    const std::string site = "ChkReport";
+    auto P = DPCTLmalloc_device(SIZE, QRef);
+    ASSERT_TRUE(P != nullptr);
+    DPCTLUSMAccounting_RecordAlloc(P, SIZE, DPCTL_USM_DEVICE, QRef,
+                                   site.c_str());
+
+    const char *report = DPCTLUSMAccounting_Report();
+    ASSERT_TRUE(report != nullptr);
+    std::string report_str(report);
+    DPCTLCString_Delete(report);
+    EXPECT_TRUE(report_str.find(site) != std::string::npos);
+    EXPECT_TRUE(report_str.find("[device]") != std::string::npos);
+
+    DPCTLUSMAccounting_RecordFree(P);
+    DPCTLfree_with_queue(P, QRef);
+}
+
+TEST(TestDPCTLUSMAccountingNullArgs, ChkNullSnapshot)
+{
+    DPCTLUSMAccountingSnapshotRef SRef = nullptr;
+    EXPECT_EQ(DPCTLUSMAccountingSnapshot_Size(SRef), 0);
+    EXPECT_TRUE(DPCTLUSMAccountingSnapshot_GetDevice(SRef, 0) == nullptr);
+    EXPECT_TRUE(DPCTLUSMAccountingSnapshot_GetCallSite(SRef, 0) == nullptr);
+    EXPECT_EQ(DPCTLUSMAccountingSnapshot_GetUSMType(SRef, 0),
+              DPCTL_USM_UNKNOWN);
+    EXPECT_NO_FATAL_FAILURE(DPCTLUSMAccountingSnapshot_Delete(SRef));
+    EXPECT_NO_FATAL_FAILURE(DPCTLUSMAccounting_RecordFree(nullptr));
+}
@@ -30,6 +30,7 @@ def run(
     use_glog=False,
     verbose=False,
     cmake_opts="",
+    target_cpu_aot=None,
 ):
     build_system = None
 
@@ -63,6 +64,12 @@ def run(
         cmake_args += [
             "-DCMAKE_VERBOSE_MAKEFILE:BOOL=ON",
         ]
+    if target_cpu_aot:
+        cmake_args += [
+            "-DDPCTL_TARGET_CPU_AOT:BOOL=ON",
+            "-DDPCTL_TARGET_CPU_AOT_ISA:STRING="
+            + target_cpu_aot.replace(",", ";"),
+        ]
     if cmake_opts:
         cmake_args += cmake_opts.split()
     subprocess.check_call(
@@ -124,6 +131,18 @@ if __name__ == "__main__":
         dest="verbose",
         action="store_true",
     )
+    driver.add_argument(
+        "--target-cpu-aot",
+        help="Also build variants of dpctl.tensor extensions with kernels "
+        "ahead-of-time compiled for x86_64 CPU devices, for each of given "
+        "comma-separated instruction sets among sse4.2, avx, avx2 and "
+        "avx512 (default: avx2). The variant for the widest instruction "
+        "set supported by the host CPU is used, if any",
+        dest="target_cpu_aot",
+        nargs="?",
+        const="avx2",
+        default=None,
+    )
     driver.add_argument(
         "--cmake-opts",
         help="Options to pass through to cmake",
@@ -175,6 +194,13 @@ if __name__ == "__main__":
                 opt_name = p.replace("_", "-")
                 raise RuntimeError(f"Option {opt_name} value {arg} must exist.")
 
+    if args.target_cpu_aot:
+        for isa in args.target_cpu_aot.split(","):
+            if isa not in ["sse4.2", "avx", "avx2", "avx512"]:
+                raise RuntimeError(
+                    f"Option target-cpu-aot has unrecognized value {isa}."
+                )
+
     run(
         use_oneapi=args.oneapi,
         build_type=args.debug,
@@ -186,4 +212,5 @@ if __name__ == "__main__":
         use_glog=args.glog,
         verbose=args.verbose,
         cmake_opts=args.cmake_opts,
+        target_cpu_aot=args.target_cpu_aot,
     )
@@ -0,0 +1,98 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compares results of two runs of libtensor micro-benchmarks.
+
+Both files are expected to be produced by `run_libtensor_benchmarks`
+target, i.e. with `--benchmark_out_format=json`. The script prints the
+relative change of attained bandwidth for every benchmark present in both
+runs and exits with non-zero status if any benchmark regressed by more
+than the given threshold.
+"""
+
+import json
+import sys
+
+
+def _load(path):
+    with open(path, "r") as fh:
+        data = json.load(fh)
+    res = dict()
+    for b in data.get("benchmarks", []):
+        if b.get("run_type", "iteration") != "iteration":
+            continue
+        if b.get("error_occurred", False):
+            continue
+        bw = b.get("bytes_per_second", None)
+        if bw is None:
+            continue
+        res[b["name"]] = bw
+    return res
+
+
+def compare(baseline_path, contender_path, threshold=0.1):
+    """Returns list of tuples (name, baseline GB/s, contender GB/s,
+    relative change, is_regression)"""
+    baseline = _load(baseline_path)
+    contender = _load(contender_path)
+    rows = []
+    for name in sorted(baseline):
+        if name not in contender:
+            continue
+        b_bw = baseline[name]
+        c_bw = contender[name]
+        rel = (c_bw - b_bw) / b_bw if b_bw > 0 else 0.0
+        rows.append((name, b_bw * 1e-9, c_bw * 1e-9, rel, rel < -threshold))
+    return rows
+
+
+def main():
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        description="Compare two runs of libtensor micro-benchmarks"
+    )
+    parser.add_argument("baseline", help="JSON file with baseline results")
+    parser.add_argument("contender", help="JSON file with new results")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.1,
+        help="Relative drop of bandwidth reported as regression",
+    )
+    args = parser.parse_args()
+
+    rows = compare(args.baseline, args.contender, threshold=args.threshold)
+    name_w = max([len("benchmark")] + [len(r[0]) for r in rows])
+    print(
+        f"{'benchmark':<{name_w}} {'base GB/s':>10} {'new GB/s':>10} "
+        f"{'change':>8}"
+    )
+    n_regressions = 0
+    for name, b_bw, c_bw, rel, is_regression in rows:
+        mark = " REGRESSION" if is_regression else ""
+        print(
+            f"{name:<{name_w}} {b_bw:>10.3f} {c_bw:>10.3f} "
+            f"{rel:>+8.1%}{mark}"
+        )
+        n_regressions += int(is_regression)
+    if n_regressions:
+        print(f"{n_regressions} benchmark(s) regressed", file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()